@@ -746,6 +746,7 @@ class timeseries(object):
     from_file = _swig_new_static_method(_cmf_core.timeseries_from_file)
     get_t = _swig_new_instance_method(_cmf_core.timeseries_get_t)
     get_i = _swig_new_instance_method(_cmf_core.timeseries_get_i)
+    next_jump = _swig_new_instance_method(_cmf_core.timeseries_next_jump)
     set_t = _swig_new_instance_method(_cmf_core.timeseries_set_t)
     set_i = _swig_new_instance_method(_cmf_core.timeseries_set_i)
     get_slice = _swig_new_instance_method(_cmf_core.timeseries_get_slice)
@@ -1533,6 +1534,7 @@ class flux_node(object):
     __call__ = _swig_new_instance_method(_cmf_core.flux_node___call__)
     conc = _swig_new_instance_method(_cmf_core.flux_node_conc)
     position = property(_cmf_core.flux_node_position_get, _cmf_core.flux_node_position_set, doc=r"""position : cmf::geometry::point""")
+    get_dpotential_dV = _swig_new_instance_method(_cmf_core.flux_node_get_dpotential_dV)
     is_empty = _swig_new_instance_method(_cmf_core.flux_node_is_empty)
 
     def __init__(self, *args, **kwargs):
@@ -3880,6 +3882,7 @@ class RetentionCurve(object):
     Wetness = _swig_new_instance_method(_cmf_core.RetentionCurve_Wetness)
     theta = _swig_new_instance_method(_cmf_core.RetentionCurve_theta)
     dPsiM_dW = _swig_new_instance_method(_cmf_core.RetentionCurve_dPsiM_dW)
+    dK_dW = _swig_new_instance_method(_cmf_core.RetentionCurve_dK_dW)
     Wetness_pF = _swig_new_instance_method(_cmf_core.RetentionCurve_Wetness_pF)
     MatricPotential = _swig_new_instance_method(_cmf_core.RetentionCurve_MatricPotential)
     copy = _swig_new_instance_method(_cmf_core.RetentionCurve_copy)
@@ -4140,6 +4143,7 @@ class SoilLayer(WaterStorage):
     get_soil = _swig_new_instance_method(_cmf_core.SoilLayer_get_soil)
     set_soil = _swig_new_instance_method(_cmf_core.SoilLayer_set_soil)
     get_K = _swig_new_instance_method(_cmf_core.SoilLayer_get_K)
+    get_dK_dV = _swig_new_instance_method(_cmf_core.SoilLayer_get_dK_dV)
     anisotropic_kf = property(_cmf_core.SoilLayer_anisotropic_kf_get, _cmf_core.SoilLayer_anisotropic_kf_set, doc=r"""anisotropic_kf : cmf::geometry::point""")
     get_capacity = _swig_new_instance_method(_cmf_core.SoilLayer_get_capacity)
     get_saturated_depth = _swig_new_instance_method(_cmf_core.SoilLayer_get_saturated_depth)
@@ -7540,6 +7544,70 @@ class project(StateVariableOwner):
 # Register project in _cmf_core:
 _cmf_core.project_swigregister(project)
 
+class solver_counters(object):
+    r"""Proxy of C++ cmf::math::solver_counters class."""
+
+    thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
+    __repr__ = _swig_repr
+    rhsevals = property(_cmf_core.solver_counters_rhsevals_get, _cmf_core.solver_counters_rhsevals_set, doc=r"""rhsevals : long long""")
+    jacevals = property(_cmf_core.solver_counters_jacevals_get, _cmf_core.solver_counters_jacevals_set, doc=r"""jacevals : long long""")
+    nonlinear_iterations = property(_cmf_core.solver_counters_nonlinear_iterations_get, _cmf_core.solver_counters_nonlinear_iterations_set, doc=r"""nonlinear_iterations : long long""")
+    linear_iterations = property(_cmf_core.solver_counters_linear_iterations_get, _cmf_core.solver_counters_linear_iterations_set, doc=r"""linear_iterations : long long""")
+    error_test_failures = property(_cmf_core.solver_counters_error_test_failures_get, _cmf_core.solver_counters_error_test_failures_set, doc=r"""error_test_failures : long long""")
+    convergence_failures = property(_cmf_core.solver_counters_convergence_failures_get, _cmf_core.solver_counters_convergence_failures_set, doc=r"""convergence_failures : long long""")
+    order = property(_cmf_core.solver_counters_order_get, _cmf_core.solver_counters_order_set, doc=r"""order : int""")
+
+    def __init__(self, *args, **kwargs):
+        r"""__init__(solver_counters self) -> solver_counters"""
+        _cmf_core.solver_counters_swiginit(self, _cmf_core.new_solver_counters(*args, **kwargs))
+    __swig_destroy__ = _cmf_core.delete_solver_counters
+
+# Register solver_counters in _cmf_core:
+_cmf_core.solver_counters_swigregister(solver_counters)
+
+class step_record(solver_counters):
+    r"""Proxy of C++ cmf::math::step_record class."""
+
+    thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
+    __repr__ = _swig_repr
+    t = property(_cmf_core.step_record_t_get, _cmf_core.step_record_t_set, doc=r"""t : cmf::math::Time""")
+    dt = property(_cmf_core.step_record_dt_get, _cmf_core.step_record_dt_set, doc=r"""dt : cmf::math::Time""")
+    wall_time = property(_cmf_core.step_record_wall_time_get, _cmf_core.step_record_wall_time_set, doc=r"""wall_time : double""")
+
+    def __init__(self, *args, **kwargs):
+        r"""__init__(step_record self) -> step_record"""
+        _cmf_core.step_record_swiginit(self, _cmf_core.new_step_record(*args, **kwargs))
+    __swig_destroy__ = _cmf_core.delete_step_record
+
+# Register step_record in _cmf_core:
+_cmf_core.step_record_swigregister(step_record)
+
+class SolverStatistics(object):
+    r"""Proxy of C++ cmf::math::SolverStatistics class."""
+
+    thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
+    __repr__ = _swig_repr
+    record = _swig_new_instance_method(_cmf_core.SolverStatistics_record)
+    size = _swig_new_instance_method(_cmf_core.SolverStatistics_size)
+    get_capacity = _swig_new_instance_method(_cmf_core.SolverStatistics_get_capacity)
+    get_record = _swig_new_instance_method(_cmf_core.SolverStatistics_get_record)
+    get_total = _swig_new_instance_method(_cmf_core.SolverStatistics_get_total)
+    get_steps = _swig_new_instance_method(_cmf_core.SolverStatistics_get_steps)
+    get_wall_time = _swig_new_instance_method(_cmf_core.SolverStatistics_get_wall_time)
+    get_time = _swig_new_instance_method(_cmf_core.SolverStatistics_get_time)
+    open_log = _swig_new_instance_method(_cmf_core.SolverStatistics_open_log)
+    close_log = _swig_new_instance_method(_cmf_core.SolverStatistics_close_log)
+    clear = _swig_new_instance_method(_cmf_core.SolverStatistics_clear)
+    to_string = _swig_new_instance_method(_cmf_core.SolverStatistics_to_string)
+
+    def __init__(self, *args, **kwargs):
+        r"""__init__(SolverStatistics self, size_t capacity=10000) -> SolverStatistics"""
+        _cmf_core.SolverStatistics_swiginit(self, _cmf_core.new_SolverStatistics(*args, **kwargs))
+    __swig_destroy__ = _cmf_core.delete_SolverStatistics
+
+# Register SolverStatistics in _cmf_core:
+_cmf_core.SolverStatistics_swigregister(SolverStatistics)
+
 class Integrator(object):
     r"""
 
@@ -7562,9 +7630,17 @@ class Integrator(object):
     get_dxdt = _swig_new_instance_method(_cmf_core.Integrator_get_dxdt)
     add_states = _swig_new_instance_method(_cmf_core.Integrator_add_states)
     add_single_state = _swig_new_instance_method(_cmf_core.Integrator_add_single_state)
+    reorder_states = _swig_new_instance_method(_cmf_core.Integrator_reorder_states)
+    get_bandwidth = _swig_new_instance_method(_cmf_core.Integrator_get_bandwidth)
     integratables = property(_cmf_core.Integrator_integratables_get, _cmf_core.Integrator_integratables_set, doc=r"""integratables : cmf::math::integratable_list""")
     reset_integratables = property(_cmf_core.Integrator_reset_integratables_get, _cmf_core.Integrator_reset_integratables_set, doc=r"""reset_integratables : bool""")
     use_OpenMP = property(_cmf_core.Integrator_use_OpenMP_get, _cmf_core.Integrator_use_OpenMP_set, doc=r"""use_OpenMP : bool""")
+    use_flux_graph = property(_cmf_core.Integrator_use_flux_graph_get, _cmf_core.Integrator_use_flux_graph_set, doc=r"""use_flux_graph : bool""")
+    use_contiguous_states = property(_cmf_core.Integrator_use_contiguous_states_get, _cmf_core.Integrator_use_contiguous_states_set, doc=r"""use_contiguous_states : bool""")
+    use_forcing_breakpoints = property(_cmf_core.Integrator_use_forcing_breakpoints_get, _cmf_core.Integrator_use_forcing_breakpoints_set, doc=r"""use_forcing_breakpoints : bool""")
+    get_next_breakpoint = _swig_new_instance_method(_cmf_core.Integrator_get_next_breakpoint)
+    statistics = property(_cmf_core.Integrator_statistics_get, _cmf_core.Integrator_statistics_set, doc=r"""statistics : std::shared_ptr< cmf::math::SolverStatistics >""")
+    get_counters = _swig_new_instance_method(_cmf_core.Integrator_get_counters)
     size = _swig_new_instance_method(_cmf_core.Integrator_size)
     get_state = _swig_new_instance_method(_cmf_core.Integrator_get_state)
     set_state = _swig_new_instance_method(_cmf_core.Integrator_set_state)
@@ -7577,6 +7653,8 @@ class Integrator(object):
     copy = _swig_new_instance_method(_cmf_core.Integrator_copy)
     integrate = _swig_new_instance_method(_cmf_core.Integrator_integrate)
     integrate_until = _swig_new_instance_method(_cmf_core.Integrator_integrate_until)
+    save_checkpoint = _swig_new_instance_method(_cmf_core.Integrator_save_checkpoint)
+    load_checkpoint = _swig_new_instance_method(_cmf_core.Integrator_load_checkpoint)
 
     def __repr__(self): 
         return self.to_string()
@@ -7694,6 +7772,7 @@ class BDF2(Integrator):
     __repr__ = _swig_repr
     get_error_position = _swig_new_instance_method(_cmf_core.BDF2_get_error_position)
     max_order = property(_cmf_core.BDF2_max_order_get, _cmf_core.BDF2_max_order_set, doc=r"""max_order : int""")
+    use_newton = property(_cmf_core.BDF2_use_newton_get, _cmf_core.BDF2_use_newton_set, doc=r"""use_newton : bool""")
 
     def __init__(self, *args):
         r"""
@@ -7785,6 +7864,7 @@ class ImplicitEuler(Integrator):
     thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
     __repr__ = _swig_repr
     dt_min = property(_cmf_core.ImplicitEuler_dt_min_get, _cmf_core.ImplicitEuler_dt_min_set, doc=r"""dt_min : cmf::math::Time""")
+    use_newton = property(_cmf_core.ImplicitEuler_use_newton_get, _cmf_core.ImplicitEuler_use_newton_set, doc=r"""use_newton : bool""")
 
     def __init__(self, *args):
         r"""
@@ -7850,6 +7930,7 @@ class CVodeIntegrator(Integrator):
     thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
     __repr__ = _swig_repr
     preconditioner = property(_cmf_core.CVodeIntegrator_preconditioner_get, _cmf_core.CVodeIntegrator_preconditioner_set, doc=r"""preconditioner : char""")
+    preconditioner_matrix = property(_cmf_core.CVodeIntegrator_preconditioner_matrix_get, _cmf_core.CVodeIntegrator_preconditioner_matrix_set, doc=r"""preconditioner_matrix : char""")
     MaxNonLinearIterations = property(_cmf_core.CVodeIntegrator_MaxNonLinearIterations_get, _cmf_core.CVodeIntegrator_MaxNonLinearIterations_set, doc=r"""MaxNonLinearIterations : int""")
     MaxConvergenceFailures = property(_cmf_core.CVodeIntegrator_MaxConvergenceFailures_get, _cmf_core.CVodeIntegrator_MaxConvergenceFailures_set, doc=r"""MaxConvergenceFailures : int""")
     MaxErrorTestFailures = property(_cmf_core.CVodeIntegrator_MaxErrorTestFailures_get, _cmf_core.CVodeIntegrator_MaxErrorTestFailures_set, doc=r"""MaxErrorTestFailures : int""")
@@ -7857,6 +7938,12 @@ class CVodeIntegrator(Integrator):
     LinearSolver = property(_cmf_core.CVodeIntegrator_LinearSolver_get, _cmf_core.CVodeIntegrator_LinearSolver_set, doc=r"""LinearSolver : int""")
     MaxOrder = property(_cmf_core.CVodeIntegrator_MaxOrder_get, _cmf_core.CVodeIntegrator_MaxOrder_set, doc=r"""MaxOrder : int""")
     max_step = property(_cmf_core.CVodeIntegrator_max_step_get, _cmf_core.CVodeIntegrator_max_step_set, doc=r"""max_step : cmf::math::Time""")
+    use_dense_output = property(_cmf_core.CVodeIntegrator_use_dense_output_get, _cmf_core.CVodeIntegrator_use_dense_output_set, doc=r"""use_dense_output : bool""")
+    profile_errors = property(_cmf_core.CVodeIntegrator_profile_errors_get, _cmf_core.CVodeIntegrator_profile_errors_set, doc=r"""profile_errors : bool""")
+    get_error_dominance = _swig_new_instance_method(_cmf_core.CVodeIntegrator_get_error_dominance)
+    get_error_share = _swig_new_instance_method(_cmf_core.CVodeIntegrator_get_error_share)
+    get_error_profile = _swig_new_instance_method(_cmf_core.CVodeIntegrator_get_error_profile)
+    clear_error_profile = _swig_new_instance_method(_cmf_core.CVodeIntegrator_clear_error_profile)
     get_order = _swig_new_instance_method(_cmf_core.CVodeIntegrator_get_order)
     initialize = _swig_new_instance_method(_cmf_core.CVodeIntegrator_initialize)
     release = _swig_new_instance_method(_cmf_core.CVodeIntegrator_release)
@@ -7895,11 +7982,17 @@ class MultiIntegrator(Integrator):
     thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
     __repr__ = _swig_repr
     copy = _swig_new_instance_method(_cmf_core.MultiIntegrator_copy)
+    set_rate = _swig_new_instance_method(_cmf_core.MultiIntegrator_set_rate)
+    get_rate = _swig_new_instance_method(_cmf_core.MultiIntegrator_get_rate)
+    get_coupling_count = _swig_new_instance_method(_cmf_core.MultiIntegrator_get_coupling_count)
     add_states_to_integrator = _swig_new_instance_method(_cmf_core.MultiIntegrator_add_states_to_integrator)
+    distribute_states = _swig_new_instance_method(_cmf_core.MultiIntegrator_distribute_states)
+    get_state_count = _swig_new_instance_method(_cmf_core.MultiIntegrator_get_state_count)
 
-    def __init__(self, *args, **kwargs):
+    def __init__(self, *args):
         r"""
         __init__(MultiIntegrator self, Integrator template_integrator, int count) -> MultiIntegrator
+        __init__(MultiIntegrator self, Integrator template_integrator, int count, StateVariableOwner states) -> MultiIntegrator
         MultiIntegrator(const cmf::math::Integrator &template_integrator, int
         count)
 
@@ -7912,7 +8005,7 @@ class MultiIntegrator(Integrator):
 
         count:  Number of integrators 
         """
-        _cmf_core.MultiIntegrator_swiginit(self, _cmf_core.new_MultiIntegrator(*args, **kwargs))
+        _cmf_core.MultiIntegrator_swiginit(self, _cmf_core.new_MultiIntegrator(*args))
     __swig_destroy__ = _cmf_core.delete_MultiIntegrator
 
 # Register MultiIntegrator in _cmf_core:
@@ -7965,6 +8058,142 @@ class SoluteWaterIntegrator(Integrator):
 # Register SoluteWaterIntegrator in _cmf_core:
 _cmf_core.SoluteWaterIntegrator_swigregister(SoluteWaterIntegrator)
 
+class SparseJacobian(object):
+    r"""Proxy of C++ cmf::math::SparseJacobian class."""
+
+    thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
+    __repr__ = _swig_repr
+    use_flux_derivatives = property(_cmf_core.SparseJacobian_use_flux_derivatives_get, _cmf_core.SparseJacobian_use_flux_derivatives_set, doc=r"""use_flux_derivatives : bool""")
+
+    def __init__(self, *args, **kwargs):
+        r"""__init__(SparseJacobian self, Integrator integ) -> SparseJacobian"""
+        _cmf_core.SparseJacobian_swiginit(self, _cmf_core.new_SparseJacobian(*args, **kwargs))
+    size = _swig_new_instance_method(_cmf_core.SparseJacobian_size)
+    nonzeros = _swig_new_instance_method(_cmf_core.SparseJacobian_nonzeros)
+    color_count = _swig_new_instance_method(_cmf_core.SparseJacobian_color_count)
+    derived_columns = _swig_new_instance_method(_cmf_core.SparseJacobian_derived_columns)
+    calculate = _swig_new_instance_method(_cmf_core.SparseJacobian_calculate)
+    get = _swig_new_instance_method(_cmf_core.SparseJacobian_get)
+    get_values = _swig_new_instance_method(_cmf_core.SparseJacobian_get_values)
+    get_columns = _swig_new_instance_method(_cmf_core.SparseJacobian_get_columns)
+    get_row_start = _swig_new_instance_method(_cmf_core.SparseJacobian_get_row_start)
+    __swig_destroy__ = _cmf_core.delete_SparseJacobian
+
+# Register SparseJacobian in _cmf_core:
+_cmf_core.SparseJacobian_swigregister(SparseJacobian)
+
+class SparseLU(object):
+    r"""Proxy of C++ cmf::math::SparseLU class."""
+
+    thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
+    __repr__ = _swig_repr
+
+    def __init__(self, *args, **kwargs):
+        r"""__init__(SparseLU self, cmf::math::num_array const & row_start, cmf::math::num_array const & columns) -> SparseLU"""
+        _cmf_core.SparseLU_swiginit(self, _cmf_core.new_SparseLU(*args, **kwargs))
+    size = _swig_new_instance_method(_cmf_core.SparseLU_size)
+    nonzeros = _swig_new_instance_method(_cmf_core.SparseLU_nonzeros)
+    factorize = _swig_new_instance_method(_cmf_core.SparseLU_factorize)
+    solve = _swig_new_instance_method(_cmf_core.SparseLU_solve)
+    __swig_destroy__ = _cmf_core.delete_SparseLU
+
+# Register SparseLU in _cmf_core:
+_cmf_core.SparseLU_swigregister(SparseLU)
+
+class IMEXIntegrator(Integrator):
+    r"""Proxy of C++ cmf::math::IMEXIntegrator class."""
+
+    thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
+    __repr__ = _swig_repr
+    dt_min = property(_cmf_core.IMEXIntegrator_dt_min_get, _cmf_core.IMEXIntegrator_dt_min_set, doc=r"""dt_min : cmf::math::Time""")
+    max_newton_iterations = property(_cmf_core.IMEXIntegrator_max_newton_iterations_get, _cmf_core.IMEXIntegrator_max_newton_iterations_set, doc=r"""max_newton_iterations : int""")
+    set_implicit = _swig_new_instance_method(_cmf_core.IMEXIntegrator_set_implicit)
+    is_implicit = _swig_new_instance_method(_cmf_core.IMEXIntegrator_is_implicit)
+    get_implicit_count = _swig_new_instance_method(_cmf_core.IMEXIntegrator_get_implicit_count)
+    set_implicit_by_type = _swig_new_instance_method(_cmf_core.IMEXIntegrator_set_implicit_by_type)
+    set_implicit_by_stiffness = _swig_new_instance_method(_cmf_core.IMEXIntegrator_set_implicit_by_stiffness)
+    get_rhsevals = _swig_new_instance_method(_cmf_core.IMEXIntegrator_get_rhsevals)
+
+    def __init__(self, *args):
+        r"""
+        __init__(IMEXIntegrator self, StateVariableOwner states, real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10)) -> IMEXIntegrator
+        __init__(IMEXIntegrator self, real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10)) -> IMEXIntegrator
+        __init__(IMEXIntegrator self, Integrator templ) -> IMEXIntegrator
+        """
+        _cmf_core.IMEXIntegrator_swiginit(self, _cmf_core.new_IMEXIntegrator(*args))
+    __swig_destroy__ = _cmf_core.delete_IMEXIntegrator
+
+# Register IMEXIntegrator in _cmf_core:
+_cmf_core.IMEXIntegrator_swigregister(IMEXIntegrator)
+
+class ROS2(Integrator):
+    r"""Proxy of C++ cmf::math::ROS2 class."""
+
+    thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
+    __repr__ = _swig_repr
+    dt_min = property(_cmf_core.ROS2_dt_min_get, _cmf_core.ROS2_dt_min_set, doc=r"""dt_min : cmf::math::Time""")
+    max_jacobian_age = property(_cmf_core.ROS2_max_jacobian_age_get, _cmf_core.ROS2_max_jacobian_age_set, doc=r"""max_jacobian_age : int""")
+    get_rhsevals = _swig_new_instance_method(_cmf_core.ROS2_get_rhsevals)
+    get_jacevals = _swig_new_instance_method(_cmf_core.ROS2_get_jacevals)
+
+    def __init__(self, *args):
+        r"""
+        __init__(ROS2 self, StateVariableOwner states, real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10)) -> ROS2
+        __init__(ROS2 self, real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10)) -> ROS2
+        __init__(ROS2 self, Integrator templ) -> ROS2
+        """
+        _cmf_core.ROS2_swiginit(self, _cmf_core.new_ROS2(*args))
+    __swig_destroy__ = _cmf_core.delete_ROS2
+
+# Register ROS2 in _cmf_core:
+_cmf_core.ROS2_swigregister(ROS2)
+
+class EnsembleIntegrator(Integrator):
+    r"""Proxy of C++ cmf::math::EnsembleIntegrator class."""
+
+    thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
+    __repr__ = _swig_repr
+    copy = _swig_new_instance_method(_cmf_core.EnsembleIntegrator_copy)
+    add_member = _swig_new_instance_method(_cmf_core.EnsembleIntegrator_add_member)
+    get_member_count = _swig_new_instance_method(_cmf_core.EnsembleIntegrator_get_member_count)
+    get_member_size = _swig_new_instance_method(_cmf_core.EnsembleIntegrator_get_member_size)
+    get_member = _swig_new_instance_method(_cmf_core.EnsembleIntegrator_get_member)
+    get_member_states = _swig_new_instance_method(_cmf_core.EnsembleIntegrator_get_member_states)
+
+    def __init__(self, *args, **kwargs):
+        r"""__init__(EnsembleIntegrator self, Integrator template_integrator) -> EnsembleIntegrator"""
+        _cmf_core.EnsembleIntegrator_swiginit(self, _cmf_core.new_EnsembleIntegrator(*args, **kwargs))
+    __swig_destroy__ = _cmf_core.delete_EnsembleIntegrator
+
+# Register EnsembleIntegrator in _cmf_core:
+_cmf_core.EnsembleIntegrator_swigregister(EnsembleIntegrator)
+
+class SteadyStateSolver(Integrator):
+    r"""Proxy of C++ cmf::math::SteadyStateSolver class."""
+
+    thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
+    __repr__ = _swig_repr
+    pseudo_dt = property(_cmf_core.SteadyStateSolver_pseudo_dt_get, _cmf_core.SteadyStateSolver_pseudo_dt_set, doc=r"""pseudo_dt : cmf::math::Time""")
+    period = property(_cmf_core.SteadyStateSolver_period_get, _cmf_core.SteadyStateSolver_period_set, doc=r"""period : cmf::math::Time""")
+    samples = property(_cmf_core.SteadyStateSolver_samples_get, _cmf_core.SteadyStateSolver_samples_set, doc=r"""samples : int""")
+    max_iterations = property(_cmf_core.SteadyStateSolver_max_iterations_get, _cmf_core.SteadyStateSolver_max_iterations_set, doc=r"""max_iterations : int""")
+    get_residual = _swig_new_instance_method(_cmf_core.SteadyStateSolver_get_residual)
+    get_rhsevals = _swig_new_instance_method(_cmf_core.SteadyStateSolver_get_rhsevals)
+    get_jacevals = _swig_new_instance_method(_cmf_core.SteadyStateSolver_get_jacevals)
+    solve = _swig_new_instance_method(_cmf_core.SteadyStateSolver_solve)
+
+    def __init__(self, *args):
+        r"""
+        __init__(SteadyStateSolver self, StateVariableOwner states, real epsilon=1e-6) -> SteadyStateSolver
+        __init__(SteadyStateSolver self, real epsilon=1e-6) -> SteadyStateSolver
+        __init__(SteadyStateSolver self, Integrator templ) -> SteadyStateSolver
+        """
+        _cmf_core.SteadyStateSolver_swiginit(self, _cmf_core.new_SteadyStateSolver(*args))
+    __swig_destroy__ = _cmf_core.delete_SteadyStateSolver
+
+# Register SteadyStateSolver in _cmf_core:
+_cmf_core.SteadyStateSolver_swigregister(SteadyStateSolver)
+
 
 ConstantFlux = TechnicalFlux
 ConstantStateFlux = statecontrol_connection
@@ -2685,194 +2685,204 @@ SWIGINTERN PyObject *SWIG_PyStaticMethod_New(PyObject *SWIGUNUSEDPARM(self), PyO
 #define SWIGTYPE_p_cmf__math__BDF2 swig_types[20]
 #define SWIGTYPE_p_cmf__math__CVodeIntegrator swig_types[21]
 #define SWIGTYPE_p_cmf__math__Date swig_types[22]
-#define SWIGTYPE_p_cmf__math__ExplicitEuler_fixed swig_types[23]
-#define SWIGTYPE_p_cmf__math__HeunIntegrator swig_types[24]
-#define SWIGTYPE_p_cmf__math__ImplicitEuler swig_types[25]
-#define SWIGTYPE_p_cmf__math__Integrator swig_types[26]
-#define SWIGTYPE_p_cmf__math__MultiIntegrator swig_types[27]
-#define SWIGTYPE_p_cmf__math__RKFIntegrator swig_types[28]
-#define SWIGTYPE_p_cmf__math__SoluteWaterIntegrator swig_types[29]
-#define SWIGTYPE_p_cmf__math__StateVariable swig_types[30]
-#define SWIGTYPE_p_cmf__math__StateVariableList swig_types[31]
-#define SWIGTYPE_p_cmf__math__StateVariableOwner swig_types[32]
-#define SWIGTYPE_p_cmf__math__Time swig_types[33]
-#define SWIGTYPE_p_cmf__math__cubicspline swig_types[34]
-#define SWIGTYPE_p_cmf__math__integratable swig_types[35]
-#define SWIGTYPE_p_cmf__math__integratable_list swig_types[36]
-#define SWIGTYPE_p_cmf__math__num_array swig_types[37]
-#define SWIGTYPE_p_cmf__math__timeseries swig_types[38]
-#define SWIGTYPE_p_cmf__project swig_types[39]
-#define SWIGTYPE_p_cmf__river__Channel swig_types[40]
-#define SWIGTYPE_p_cmf__river__CrossSectionReach swig_types[41]
-#define SWIGTYPE_p_cmf__river__IChannel swig_types[42]
-#define SWIGTYPE_p_cmf__river__IVolumeHeightFunction swig_types[43]
-#define SWIGTYPE_p_cmf__river__Manning swig_types[44]
-#define SWIGTYPE_p_cmf__river__Manning_Diffusive swig_types[45]
-#define SWIGTYPE_p_cmf__river__Manning_Kinematic swig_types[46]
-#define SWIGTYPE_p_cmf__river__MeanChannel swig_types[47]
-#define SWIGTYPE_p_cmf__river__OpenWaterStorage swig_types[48]
-#define SWIGTYPE_p_cmf__river__PipeReach swig_types[49]
-#define SWIGTYPE_p_cmf__river__Prism swig_types[50]
-#define SWIGTYPE_p_cmf__river__Reach swig_types[51]
-#define SWIGTYPE_p_cmf__river__ReachIterator swig_types[52]
-#define SWIGTYPE_p_cmf__river__RectangularReach swig_types[53]
-#define SWIGTYPE_p_cmf__river__SWATReachType swig_types[54]
-#define SWIGTYPE_p_cmf__river__TriangularReach swig_types[55]
-#define SWIGTYPE_p_cmf__river__volume_height_function swig_types[56]
-#define SWIGTYPE_p_cmf__upslope__BrooksCoreyRetentionCurve swig_types[57]
-#define SWIGTYPE_p_cmf__upslope__Cell swig_types[58]
-#define SWIGTYPE_p_cmf__upslope__CellConnector swig_types[59]
-#define SWIGTYPE_p_cmf__upslope__ET__CanopyStorageEvaporation swig_types[60]
-#define SWIGTYPE_p_cmf__upslope__ET__ContentStress swig_types[61]
-#define SWIGTYPE_p_cmf__upslope__ET__HargreaveET swig_types[62]
-#define SWIGTYPE_p_cmf__upslope__ET__OudinET swig_types[63]
-#define SWIGTYPE_p_cmf__upslope__ET__PenmanEvaporation swig_types[64]
-#define SWIGTYPE_p_cmf__upslope__ET__PenmanMonteithET swig_types[65]
-#define SWIGTYPE_p_cmf__upslope__ET__PriestleyTaylorET swig_types[66]
-#define SWIGTYPE_p_cmf__upslope__ET__RootUptakeStressFunction swig_types[67]
-#define SWIGTYPE_p_cmf__upslope__ET__SW_evap_from_canopy swig_types[68]
-#define SWIGTYPE_p_cmf__upslope__ET__SW_evap_from_layer swig_types[69]
-#define SWIGTYPE_p_cmf__upslope__ET__SW_evap_from_snow swig_types[70]
-#define SWIGTYPE_p_cmf__upslope__ET__SW_evap_from_surfacewater swig_types[71]
-#define SWIGTYPE_p_cmf__upslope__ET__SW_transpiration swig_types[72]
-#define SWIGTYPE_p_cmf__upslope__ET__ShuttleworthWallace swig_types[73]
-#define SWIGTYPE_p_cmf__upslope__ET__SuctionStress swig_types[74]
-#define SWIGTYPE_p_cmf__upslope__ET__TurcET swig_types[75]
-#define SWIGTYPE_p_cmf__upslope__ET__VolumeStress swig_types[76]
-#define SWIGTYPE_p_cmf__upslope__ET__constantETpot swig_types[77]
-#define SWIGTYPE_p_cmf__upslope__ET__stressedET swig_types[78]
-#define SWIGTYPE_p_cmf__upslope__ET__timeseriesETpot swig_types[79]
-#define SWIGTYPE_p_cmf__upslope__LinearRetention swig_types[80]
-#define SWIGTYPE_p_cmf__upslope__MacroPore swig_types[81]
-#define SWIGTYPE_p_cmf__upslope__RetentionCurve swig_types[82]
-#define SWIGTYPE_p_cmf__upslope__SoilLayer swig_types[83]
-#define SWIGTYPE_p_cmf__upslope__SurfaceWater swig_types[84]
-#define SWIGTYPE_p_cmf__upslope__Topology swig_types[85]
-#define SWIGTYPE_p_cmf__upslope__VanGenuchtenMualem swig_types[86]
-#define SWIGTYPE_p_cmf__upslope__aquifer swig_types[87]
-#define SWIGTYPE_p_cmf__upslope__aquifer_Darcy swig_types[88]
-#define SWIGTYPE_p_cmf__upslope__cell_vector swig_types[89]
-#define SWIGTYPE_p_cmf__upslope__connections__BaseMacroFlow swig_types[90]
-#define SWIGTYPE_p_cmf__upslope__connections__CanopyOverflow swig_types[91]
-#define SWIGTYPE_p_cmf__upslope__connections__Darcy swig_types[92]
-#define SWIGTYPE_p_cmf__upslope__connections__DarcyKinematic swig_types[93]
-#define SWIGTYPE_p_cmf__upslope__connections__DiffusiveMacroMicroExchange swig_types[94]
-#define SWIGTYPE_p_cmf__upslope__connections__DiffusiveSurfaceRunoff swig_types[95]
-#define SWIGTYPE_p_cmf__upslope__connections__EnergyBudgetSnowMelt swig_types[96]
-#define SWIGTYPE_p_cmf__upslope__connections__FreeDrainagePercolation swig_types[97]
-#define SWIGTYPE_p_cmf__upslope__connections__GradientMacroFlow swig_types[98]
-#define SWIGTYPE_p_cmf__upslope__connections__GradientMacroMicroExchange swig_types[99]
-#define SWIGTYPE_p_cmf__upslope__connections__GreenAmptInfiltration swig_types[100]
-#define SWIGTYPE_p_cmf__upslope__connections__JarvisMacroFlow swig_types[101]
-#define SWIGTYPE_p_cmf__upslope__connections__KinematicMacroFlow swig_types[102]
-#define SWIGTYPE_p_cmf__upslope__connections__KinematicSurfaceRunoff swig_types[103]
-#define SWIGTYPE_p_cmf__upslope__connections__LayerBypass swig_types[104]
-#define SWIGTYPE_p_cmf__upslope__connections__MACROlikeMacroMicroExchange swig_types[105]
-#define SWIGTYPE_p_cmf__upslope__connections__MatrixInfiltration swig_types[106]
-#define SWIGTYPE_p_cmf__upslope__connections__Rainfall swig_types[107]
-#define SWIGTYPE_p_cmf__upslope__connections__Richards swig_types[108]
-#define SWIGTYPE_p_cmf__upslope__connections__Richards_lateral swig_types[109]
-#define SWIGTYPE_p_cmf__upslope__connections__RutterInterception swig_types[110]
-#define SWIGTYPE_p_cmf__upslope__connections__SWATPercolation swig_types[111]
-#define SWIGTYPE_p_cmf__upslope__connections__SimplRichards swig_types[112]
-#define SWIGTYPE_p_cmf__upslope__connections__SimpleInfiltration swig_types[113]
-#define SWIGTYPE_p_cmf__upslope__connections__SimpleTindexSnowMelt swig_types[114]
-#define SWIGTYPE_p_cmf__upslope__connections__Snowfall swig_types[115]
-#define SWIGTYPE_p_cmf__upslope__connections__TOPModelFlow swig_types[116]
-#define SWIGTYPE_p_cmf__upslope__connections__TopographicGradientDarcy swig_types[117]
-#define SWIGTYPE_p_cmf__upslope__connections__lateral_sub_surface_flux swig_types[118]
-#define SWIGTYPE_p_cmf__upslope__layer_list swig_types[119]
-#define SWIGTYPE_p_cmf__upslope__neighbor_iterator swig_types[120]
-#define SWIGTYPE_p_cmf__upslope__subcatchment swig_types[121]
-#define SWIGTYPE_p_cmf__upslope__vegetation__Vegetation swig_types[122]
-#define SWIGTYPE_p_cmf__water__Adsorption swig_types[123]
-#define SWIGTYPE_p_cmf__water__ConstraintLinearStorageConnection swig_types[124]
-#define SWIGTYPE_p_cmf__water__DirichletBoundary swig_types[125]
-#define SWIGTYPE_p_cmf__water__ExponentialDeclineConnection swig_types[126]
-#define SWIGTYPE_p_cmf__water__FreundlichAdsorbtion swig_types[127]
-#define SWIGTYPE_p_cmf__water__LangmuirAdsorption swig_types[128]
-#define SWIGTYPE_p_cmf__water__LinearAdsorption swig_types[129]
-#define SWIGTYPE_p_cmf__water__LinearStorageConnection swig_types[130]
-#define SWIGTYPE_p_cmf__water__NeumannBoundary swig_types[131]
-#define SWIGTYPE_p_cmf__water__NeumannBoundary_list swig_types[132]
-#define SWIGTYPE_p_cmf__water__NeumannFlux swig_types[133]
-#define SWIGTYPE_p_cmf__water__NullAdsorption swig_types[134]
-#define SWIGTYPE_p_cmf__water__PowerLawConnection swig_types[135]
-#define SWIGTYPE_p_cmf__water__SoluteStorage swig_types[136]
-#define SWIGTYPE_p_cmf__water__SoluteTimeseries swig_types[137]
-#define SWIGTYPE_p_cmf__water__SystemBridge swig_types[138]
-#define SWIGTYPE_p_cmf__water__SystemBridgeConnection swig_types[139]
-#define SWIGTYPE_p_cmf__water__TechnicalFlux swig_types[140]
-#define SWIGTYPE_p_cmf__water__WaterStorage swig_types[141]
-#define SWIGTYPE_p_cmf__water__bidirectional_kinematic_exchange swig_types[142]
-#define SWIGTYPE_p_cmf__water__connection_list swig_types[143]
-#define SWIGTYPE_p_cmf__water__constraint_kinematic_wave swig_types[144]
-#define SWIGTYPE_p_cmf__water__external_control_connection swig_types[145]
-#define SWIGTYPE_p_cmf__water__flux_connection swig_types[146]
-#define SWIGTYPE_p_cmf__water__flux_integrator swig_types[147]
-#define SWIGTYPE_p_cmf__water__flux_node swig_types[148]
-#define SWIGTYPE_p_cmf__water__generic_gradient_connection swig_types[149]
-#define SWIGTYPE_p_cmf__water__kinematic_wave swig_types[150]
-#define SWIGTYPE_p_cmf__water__linear_scale swig_types[151]
-#define SWIGTYPE_p_cmf__water__node_list swig_types[152]
-#define SWIGTYPE_p_cmf__water__solute swig_types[153]
-#define SWIGTYPE_p_cmf__water__solute_vector swig_types[154]
-#define SWIGTYPE_p_cmf__water__statecontrol_connection swig_types[155]
-#define SWIGTYPE_p_cmf__water__waterbalance_connection swig_types[156]
-#define SWIGTYPE_p_cmf__water__waterbalance_integrator swig_types[157]
-#define SWIGTYPE_p_const_iterator swig_types[158]
-#define SWIGTYPE_p_difference_type swig_types[159]
-#define SWIGTYPE_p_double swig_types[160]
-#define SWIGTYPE_p_f_r_cmf__upslope__Cell_r_cmf__upslope__Cell_ptrdiff_t__void swig_types[161]
-#define SWIGTYPE_p_iterator swig_types[162]
-#define SWIGTYPE_p_p_PyObject swig_types[163]
-#define SWIGTYPE_p_ptr swig_types[164]
-#define SWIGTYPE_p_size_type swig_types[165]
-#define SWIGTYPE_p_std__allocatorT_double_t swig_types[166]
-#define SWIGTYPE_p_std__allocatorT_int_t swig_types[167]
-#define SWIGTYPE_p_std__allocatorT_size_t_t swig_types[168]
-#define SWIGTYPE_p_std__invalid_argument swig_types[169]
-#define SWIGTYPE_p_std__shared_ptrT_SoilLayer_t swig_types[170]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__ConstantRainSource_t swig_types[171]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__IDWRainfall_t swig_types[172]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__MeteoStation_t swig_types[173]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__RainSource_t swig_types[174]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__RainfallStationReference_t swig_types[175]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__RainfallStation_t swig_types[176]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__TimeseriesRainSource_t swig_types[177]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__aerodynamic_resistance_t swig_types[178]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__math__StateVariable_t swig_types[179]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__math__integratable_t swig_types[180]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__river__OpenWaterStorage_t swig_types[181]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__river__Reach_t swig_types[182]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__upslope__ET__ShuttleworthWallace_t swig_types[183]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__upslope__ET__aerodynamic_resistance_t swig_types[184]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__upslope__MacroPore_t swig_types[185]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__upslope__SoilLayer_t swig_types[186]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__upslope__SurfaceWater_t swig_types[187]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__upslope__aquifer_t swig_types[188]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__water__DirichletBoundary_t swig_types[189]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__water__NeumannBoundary_t swig_types[190]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__water__SoluteStorage_t swig_types[191]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__water__SystemBridge_t swig_types[192]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__water__WaterStorage_t swig_types[193]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__water__flux_connection_t swig_types[194]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__water__flux_integrator_t swig_types[195]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__water__flux_node_t swig_types[196]
-#define SWIGTYPE_p_std__shared_ptrT_cmf__water__waterbalance_integrator_t swig_types[197]
-#define SWIGTYPE_p_std__shared_ptrT_std__shared_ptrT_cmf__atmosphere__ConstantRainSource_t_t swig_types[198]
-#define SWIGTYPE_p_std__shared_ptrT_std__shared_ptrT_cmf__atmosphere__RainfallStationReference_t_t swig_types[199]
-#define SWIGTYPE_p_std__string swig_types[200]
-#define SWIGTYPE_p_std__vectorT_double_std__allocatorT_double_t_t swig_types[201]
-#define SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t swig_types[202]
-#define SWIGTYPE_p_std__vectorT_size_t_std__allocatorT_size_t_t_t swig_types[203]
-#define SWIGTYPE_p_std__vectorT_std__shared_ptrT_cmf__water__WaterStorage_t_std__allocatorT_std__shared_ptrT_cmf__water__WaterStorage_t_t_t swig_types[204]
-#define SWIGTYPE_p_std__vectorT_std__shared_ptrT_cmf__water__flux_connection_t_std__allocatorT_std__shared_ptrT_cmf__water__flux_connection_t_t_t__const_iterator swig_types[205]
-#define SWIGTYPE_p_std__vectorT_std__shared_ptrT_cmf__water__flux_connection_t_std__allocatorT_std__shared_ptrT_cmf__water__flux_connection_t_t_t__iterator swig_types[206]
-#define SWIGTYPE_p_swig__SwigPyIterator swig_types[207]
-#define SWIGTYPE_p_value_type swig_types[208]
-static swig_type_info *swig_types[210];
-static swig_module_info swig_module = {swig_types, 209, 0, 0, 0, 0};
+#define SWIGTYPE_p_cmf__math__EnsembleIntegrator swig_types[23]
+#define SWIGTYPE_p_cmf__math__ExplicitEuler_fixed swig_types[24]
+#define SWIGTYPE_p_cmf__math__HeunIntegrator swig_types[25]
+#define SWIGTYPE_p_cmf__math__IMEXIntegrator swig_types[26]
+#define SWIGTYPE_p_cmf__math__ImplicitEuler swig_types[27]
+#define SWIGTYPE_p_cmf__math__Integrator swig_types[28]
+#define SWIGTYPE_p_cmf__math__MultiIntegrator swig_types[29]
+#define SWIGTYPE_p_cmf__math__RKFIntegrator swig_types[30]
+#define SWIGTYPE_p_cmf__math__ROS2 swig_types[31]
+#define SWIGTYPE_p_cmf__math__SoluteWaterIntegrator swig_types[32]
+#define SWIGTYPE_p_cmf__math__SolverStatistics swig_types[33]
+#define SWIGTYPE_p_cmf__math__SparseJacobian swig_types[34]
+#define SWIGTYPE_p_cmf__math__SparseLU swig_types[35]
+#define SWIGTYPE_p_cmf__math__StateVariable swig_types[36]
+#define SWIGTYPE_p_cmf__math__StateVariableList swig_types[37]
+#define SWIGTYPE_p_cmf__math__StateVariableOwner swig_types[38]
+#define SWIGTYPE_p_cmf__math__SteadyStateSolver swig_types[39]
+#define SWIGTYPE_p_cmf__math__Time swig_types[40]
+#define SWIGTYPE_p_cmf__math__cubicspline swig_types[41]
+#define SWIGTYPE_p_cmf__math__integratable swig_types[42]
+#define SWIGTYPE_p_cmf__math__integratable_list swig_types[43]
+#define SWIGTYPE_p_cmf__math__num_array swig_types[44]
+#define SWIGTYPE_p_cmf__math__solver_counters swig_types[45]
+#define SWIGTYPE_p_cmf__math__step_record swig_types[46]
+#define SWIGTYPE_p_cmf__math__timeseries swig_types[47]
+#define SWIGTYPE_p_cmf__project swig_types[48]
+#define SWIGTYPE_p_cmf__river__Channel swig_types[49]
+#define SWIGTYPE_p_cmf__river__CrossSectionReach swig_types[50]
+#define SWIGTYPE_p_cmf__river__IChannel swig_types[51]
+#define SWIGTYPE_p_cmf__river__IVolumeHeightFunction swig_types[52]
+#define SWIGTYPE_p_cmf__river__Manning swig_types[53]
+#define SWIGTYPE_p_cmf__river__Manning_Diffusive swig_types[54]
+#define SWIGTYPE_p_cmf__river__Manning_Kinematic swig_types[55]
+#define SWIGTYPE_p_cmf__river__MeanChannel swig_types[56]
+#define SWIGTYPE_p_cmf__river__OpenWaterStorage swig_types[57]
+#define SWIGTYPE_p_cmf__river__PipeReach swig_types[58]
+#define SWIGTYPE_p_cmf__river__Prism swig_types[59]
+#define SWIGTYPE_p_cmf__river__Reach swig_types[60]
+#define SWIGTYPE_p_cmf__river__ReachIterator swig_types[61]
+#define SWIGTYPE_p_cmf__river__RectangularReach swig_types[62]
+#define SWIGTYPE_p_cmf__river__SWATReachType swig_types[63]
+#define SWIGTYPE_p_cmf__river__TriangularReach swig_types[64]
+#define SWIGTYPE_p_cmf__river__volume_height_function swig_types[65]
+#define SWIGTYPE_p_cmf__upslope__BrooksCoreyRetentionCurve swig_types[66]
+#define SWIGTYPE_p_cmf__upslope__Cell swig_types[67]
+#define SWIGTYPE_p_cmf__upslope__CellConnector swig_types[68]
+#define SWIGTYPE_p_cmf__upslope__ET__CanopyStorageEvaporation swig_types[69]
+#define SWIGTYPE_p_cmf__upslope__ET__ContentStress swig_types[70]
+#define SWIGTYPE_p_cmf__upslope__ET__HargreaveET swig_types[71]
+#define SWIGTYPE_p_cmf__upslope__ET__OudinET swig_types[72]
+#define SWIGTYPE_p_cmf__upslope__ET__PenmanEvaporation swig_types[73]
+#define SWIGTYPE_p_cmf__upslope__ET__PenmanMonteithET swig_types[74]
+#define SWIGTYPE_p_cmf__upslope__ET__PriestleyTaylorET swig_types[75]
+#define SWIGTYPE_p_cmf__upslope__ET__RootUptakeStressFunction swig_types[76]
+#define SWIGTYPE_p_cmf__upslope__ET__SW_evap_from_canopy swig_types[77]
+#define SWIGTYPE_p_cmf__upslope__ET__SW_evap_from_layer swig_types[78]
+#define SWIGTYPE_p_cmf__upslope__ET__SW_evap_from_snow swig_types[79]
+#define SWIGTYPE_p_cmf__upslope__ET__SW_evap_from_surfacewater swig_types[80]
+#define SWIGTYPE_p_cmf__upslope__ET__SW_transpiration swig_types[81]
+#define SWIGTYPE_p_cmf__upslope__ET__ShuttleworthWallace swig_types[82]
+#define SWIGTYPE_p_cmf__upslope__ET__SuctionStress swig_types[83]
+#define SWIGTYPE_p_cmf__upslope__ET__TurcET swig_types[84]
+#define SWIGTYPE_p_cmf__upslope__ET__VolumeStress swig_types[85]
+#define SWIGTYPE_p_cmf__upslope__ET__constantETpot swig_types[86]
+#define SWIGTYPE_p_cmf__upslope__ET__stressedET swig_types[87]
+#define SWIGTYPE_p_cmf__upslope__ET__timeseriesETpot swig_types[88]
+#define SWIGTYPE_p_cmf__upslope__LinearRetention swig_types[89]
+#define SWIGTYPE_p_cmf__upslope__MacroPore swig_types[90]
+#define SWIGTYPE_p_cmf__upslope__RetentionCurve swig_types[91]
+#define SWIGTYPE_p_cmf__upslope__SoilLayer swig_types[92]
+#define SWIGTYPE_p_cmf__upslope__SurfaceWater swig_types[93]
+#define SWIGTYPE_p_cmf__upslope__Topology swig_types[94]
+#define SWIGTYPE_p_cmf__upslope__VanGenuchtenMualem swig_types[95]
+#define SWIGTYPE_p_cmf__upslope__aquifer swig_types[96]
+#define SWIGTYPE_p_cmf__upslope__aquifer_Darcy swig_types[97]
+#define SWIGTYPE_p_cmf__upslope__cell_vector swig_types[98]
+#define SWIGTYPE_p_cmf__upslope__connections__BaseMacroFlow swig_types[99]
+#define SWIGTYPE_p_cmf__upslope__connections__CanopyOverflow swig_types[100]
+#define SWIGTYPE_p_cmf__upslope__connections__Darcy swig_types[101]
+#define SWIGTYPE_p_cmf__upslope__connections__DarcyKinematic swig_types[102]
+#define SWIGTYPE_p_cmf__upslope__connections__DiffusiveMacroMicroExchange swig_types[103]
+#define SWIGTYPE_p_cmf__upslope__connections__DiffusiveSurfaceRunoff swig_types[104]
+#define SWIGTYPE_p_cmf__upslope__connections__EnergyBudgetSnowMelt swig_types[105]
+#define SWIGTYPE_p_cmf__upslope__connections__FreeDrainagePercolation swig_types[106]
+#define SWIGTYPE_p_cmf__upslope__connections__GradientMacroFlow swig_types[107]
+#define SWIGTYPE_p_cmf__upslope__connections__GradientMacroMicroExchange swig_types[108]
+#define SWIGTYPE_p_cmf__upslope__connections__GreenAmptInfiltration swig_types[109]
+#define SWIGTYPE_p_cmf__upslope__connections__JarvisMacroFlow swig_types[110]
+#define SWIGTYPE_p_cmf__upslope__connections__KinematicMacroFlow swig_types[111]
+#define SWIGTYPE_p_cmf__upslope__connections__KinematicSurfaceRunoff swig_types[112]
+#define SWIGTYPE_p_cmf__upslope__connections__LayerBypass swig_types[113]
+#define SWIGTYPE_p_cmf__upslope__connections__MACROlikeMacroMicroExchange swig_types[114]
+#define SWIGTYPE_p_cmf__upslope__connections__MatrixInfiltration swig_types[115]
+#define SWIGTYPE_p_cmf__upslope__connections__Rainfall swig_types[116]
+#define SWIGTYPE_p_cmf__upslope__connections__Richards swig_types[117]
+#define SWIGTYPE_p_cmf__upslope__connections__Richards_lateral swig_types[118]
+#define SWIGTYPE_p_cmf__upslope__connections__RutterInterception swig_types[119]
+#define SWIGTYPE_p_cmf__upslope__connections__SWATPercolation swig_types[120]
+#define SWIGTYPE_p_cmf__upslope__connections__SimplRichards swig_types[121]
+#define SWIGTYPE_p_cmf__upslope__connections__SimpleInfiltration swig_types[122]
+#define SWIGTYPE_p_cmf__upslope__connections__SimpleTindexSnowMelt swig_types[123]
+#define SWIGTYPE_p_cmf__upslope__connections__Snowfall swig_types[124]
+#define SWIGTYPE_p_cmf__upslope__connections__TOPModelFlow swig_types[125]
+#define SWIGTYPE_p_cmf__upslope__connections__TopographicGradientDarcy swig_types[126]
+#define SWIGTYPE_p_cmf__upslope__connections__lateral_sub_surface_flux swig_types[127]
+#define SWIGTYPE_p_cmf__upslope__layer_list swig_types[128]
+#define SWIGTYPE_p_cmf__upslope__neighbor_iterator swig_types[129]
+#define SWIGTYPE_p_cmf__upslope__subcatchment swig_types[130]
+#define SWIGTYPE_p_cmf__upslope__vegetation__Vegetation swig_types[131]
+#define SWIGTYPE_p_cmf__water__Adsorption swig_types[132]
+#define SWIGTYPE_p_cmf__water__ConstraintLinearStorageConnection swig_types[133]
+#define SWIGTYPE_p_cmf__water__DirichletBoundary swig_types[134]
+#define SWIGTYPE_p_cmf__water__ExponentialDeclineConnection swig_types[135]
+#define SWIGTYPE_p_cmf__water__FreundlichAdsorbtion swig_types[136]
+#define SWIGTYPE_p_cmf__water__LangmuirAdsorption swig_types[137]
+#define SWIGTYPE_p_cmf__water__LinearAdsorption swig_types[138]
+#define SWIGTYPE_p_cmf__water__LinearStorageConnection swig_types[139]
+#define SWIGTYPE_p_cmf__water__NeumannBoundary swig_types[140]
+#define SWIGTYPE_p_cmf__water__NeumannBoundary_list swig_types[141]
+#define SWIGTYPE_p_cmf__water__NeumannFlux swig_types[142]
+#define SWIGTYPE_p_cmf__water__NullAdsorption swig_types[143]
+#define SWIGTYPE_p_cmf__water__PowerLawConnection swig_types[144]
+#define SWIGTYPE_p_cmf__water__SoluteStorage swig_types[145]
+#define SWIGTYPE_p_cmf__water__SoluteTimeseries swig_types[146]
+#define SWIGTYPE_p_cmf__water__SystemBridge swig_types[147]
+#define SWIGTYPE_p_cmf__water__SystemBridgeConnection swig_types[148]
+#define SWIGTYPE_p_cmf__water__TechnicalFlux swig_types[149]
+#define SWIGTYPE_p_cmf__water__WaterStorage swig_types[150]
+#define SWIGTYPE_p_cmf__water__bidirectional_kinematic_exchange swig_types[151]
+#define SWIGTYPE_p_cmf__water__connection_list swig_types[152]
+#define SWIGTYPE_p_cmf__water__constraint_kinematic_wave swig_types[153]
+#define SWIGTYPE_p_cmf__water__external_control_connection swig_types[154]
+#define SWIGTYPE_p_cmf__water__flux_connection swig_types[155]
+#define SWIGTYPE_p_cmf__water__flux_integrator swig_types[156]
+#define SWIGTYPE_p_cmf__water__flux_node swig_types[157]
+#define SWIGTYPE_p_cmf__water__generic_gradient_connection swig_types[158]
+#define SWIGTYPE_p_cmf__water__kinematic_wave swig_types[159]
+#define SWIGTYPE_p_cmf__water__linear_scale swig_types[160]
+#define SWIGTYPE_p_cmf__water__node_list swig_types[161]
+#define SWIGTYPE_p_cmf__water__solute swig_types[162]
+#define SWIGTYPE_p_cmf__water__solute_vector swig_types[163]
+#define SWIGTYPE_p_cmf__water__statecontrol_connection swig_types[164]
+#define SWIGTYPE_p_cmf__water__waterbalance_connection swig_types[165]
+#define SWIGTYPE_p_cmf__water__waterbalance_integrator swig_types[166]
+#define SWIGTYPE_p_const_iterator swig_types[167]
+#define SWIGTYPE_p_difference_type swig_types[168]
+#define SWIGTYPE_p_double swig_types[169]
+#define SWIGTYPE_p_f_r_cmf__upslope__Cell_r_cmf__upslope__Cell_ptrdiff_t__void swig_types[170]
+#define SWIGTYPE_p_iterator swig_types[171]
+#define SWIGTYPE_p_p_PyObject swig_types[172]
+#define SWIGTYPE_p_ptr swig_types[173]
+#define SWIGTYPE_p_size_type swig_types[174]
+#define SWIGTYPE_p_std__allocatorT_double_t swig_types[175]
+#define SWIGTYPE_p_std__allocatorT_int_t swig_types[176]
+#define SWIGTYPE_p_std__allocatorT_size_t_t swig_types[177]
+#define SWIGTYPE_p_std__invalid_argument swig_types[178]
+#define SWIGTYPE_p_std__shared_ptrT_SoilLayer_t swig_types[179]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__ConstantRainSource_t swig_types[180]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__IDWRainfall_t swig_types[181]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__MeteoStation_t swig_types[182]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__RainSource_t swig_types[183]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__RainfallStationReference_t swig_types[184]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__RainfallStation_t swig_types[185]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__TimeseriesRainSource_t swig_types[186]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__atmosphere__aerodynamic_resistance_t swig_types[187]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t swig_types[188]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__math__StateVariable_t swig_types[189]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__math__integratable_t swig_types[190]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__river__OpenWaterStorage_t swig_types[191]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__river__Reach_t swig_types[192]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__upslope__ET__ShuttleworthWallace_t swig_types[193]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__upslope__ET__aerodynamic_resistance_t swig_types[194]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__upslope__MacroPore_t swig_types[195]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__upslope__SoilLayer_t swig_types[196]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__upslope__SurfaceWater_t swig_types[197]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__upslope__aquifer_t swig_types[198]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__water__DirichletBoundary_t swig_types[199]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__water__NeumannBoundary_t swig_types[200]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__water__SoluteStorage_t swig_types[201]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__water__SystemBridge_t swig_types[202]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__water__WaterStorage_t swig_types[203]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__water__flux_connection_t swig_types[204]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__water__flux_integrator_t swig_types[205]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__water__flux_node_t swig_types[206]
+#define SWIGTYPE_p_std__shared_ptrT_cmf__water__waterbalance_integrator_t swig_types[207]
+#define SWIGTYPE_p_std__shared_ptrT_std__shared_ptrT_cmf__atmosphere__ConstantRainSource_t_t swig_types[208]
+#define SWIGTYPE_p_std__shared_ptrT_std__shared_ptrT_cmf__atmosphere__RainfallStationReference_t_t swig_types[209]
+#define SWIGTYPE_p_std__string swig_types[210]
+#define SWIGTYPE_p_std__vectorT_double_std__allocatorT_double_t_t swig_types[211]
+#define SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t swig_types[212]
+#define SWIGTYPE_p_std__vectorT_size_t_std__allocatorT_size_t_t_t swig_types[213]
+#define SWIGTYPE_p_std__vectorT_std__shared_ptrT_cmf__water__WaterStorage_t_std__allocatorT_std__shared_ptrT_cmf__water__WaterStorage_t_t_t swig_types[214]
+#define SWIGTYPE_p_std__vectorT_std__shared_ptrT_cmf__water__flux_connection_t_std__allocatorT_std__shared_ptrT_cmf__water__flux_connection_t_t_t__const_iterator swig_types[215]
+#define SWIGTYPE_p_std__vectorT_std__shared_ptrT_cmf__water__flux_connection_t_std__allocatorT_std__shared_ptrT_cmf__water__flux_connection_t_t_t__iterator swig_types[216]
+#define SWIGTYPE_p_swig__SwigPyIterator swig_types[217]
+#define SWIGTYPE_p_value_type swig_types[218]
+static swig_type_info *swig_types[220];
+static swig_module_info swig_module = {swig_types, 219, 0, 0, 0, 0};
 #define SWIG_TypeQuery(name) SWIG_TypeQueryModule(&swig_module, &swig_module, name)
 #define SWIG_MangledTypeQuery(name) SWIG_MangledTypeQueryModule(&swig_module, &swig_module, name)
 
@@ -5973,6 +5983,7 @@ SWIGINTERN cmf::upslope::SoilLayer::ptr cmf_upslope_layer_list___get(cmf::upslop
   
 
 #include "math/statevariable.h"
+#include "math/integrators/solver_statistics.h"
 #include "math/integrators/integrator.h"
 #include "math/integrators/bdf2.h"
 #include "math/integrators/explicit_euler.h"
@@ -5981,6 +5992,12 @@ SWIGINTERN cmf::upslope::SoilLayer::ptr cmf_upslope_layer_list___get(cmf::upslop
 #include "math/integrators/cvodeintegrator.h"
 #include "math/integrators/multiintegrator.h"
 #include "math/integrators/WaterSoluteIntegrator.h"
+#include "math/integrators/sparse_jacobian.h"
+#include "math/integrators/sparse_lu.h"
+#include "math/integrators/imexintegrator.h"
+#include "math/integrators/ros2.h"
+#include "math/integrators/ensembleintegrator.h"
+#include "math/integrators/steady_state.h"
 
 
 #define cmf_math_CVode_order_get(self_) self_->get_order()
@@ -21610,6 +21627,48 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_timeseries_next_jump(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::timeseries *arg1 = (cmf::math::timeseries *) 0 ;
+  cmf::math::Time arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"t",  NULL 
+  };
+  cmf::math::Time result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:timeseries_next_jump", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__timeseries, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "timeseries_next_jump" "', argument " "1"" of type '" "cmf::math::timeseries const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::timeseries * >(argp1);
+  {
+    arg2 = convert_datetime_to_cmftime(obj1);
+    if (arg2 == cmf::math::never)  {
+      SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+    }
+  }
+  {
+    try {
+      result = ((cmf::math::timeseries const *)arg1)->next_jump(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj((new cmf::math::Time(static_cast< const cmf::math::Time& >(result))), SWIGTYPE_p_cmf__math__Time, SWIG_POINTER_OWN |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_timeseries_set_t(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   cmf::math::timeseries *arg1 = (cmf::math::timeseries *) 0 ;
@@ -30347,6 +30406,50 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_flux_node_get_dpotential_dV(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::water::flux_node *arg1 = (cmf::water::flux_node *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::shared_ptr< cmf::water::flux_node const > tempshared1 ;
+  std::shared_ptr< cmf::water::flux_node const > *smartarg1 = 0 ;
+  PyObject *swig_obj[1] ;
+  real result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  {
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(swig_obj[0], &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__water__flux_node_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "flux_node_get_dpotential_dV" "', argument " "1"" of type '" "cmf::water::flux_node const *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr< const cmf::water::flux_node > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr< const cmf::water::flux_node > * >(argp1);
+      arg1 = const_cast< cmf::water::flux_node * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr< const cmf::water::flux_node > * >(argp1);
+      arg1 = const_cast< cmf::water::flux_node * >((smartarg1 ? smartarg1->get() : 0));
+    }
+  }
+  {
+    try {
+      result = (real)((cmf::water::flux_node const *)arg1)->get_dpotential_dV();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_flux_node_is_empty(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   cmf::water::flux_node *arg1 = (cmf::water::flux_node *) 0 ;
@@ -56676,6 +56779,183 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_RetentionCurve_dK_dW__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::upslope::RetentionCurve *arg1 = (cmf::upslope::RetentionCurve *) 0 ;
+  real arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  real result;
+  
+  if ((nobjs < 2) || (nobjs > 2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__upslope__RetentionCurve, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RetentionCurve_dK_dW" "', argument " "1"" of type '" "cmf::upslope::RetentionCurve const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::upslope::RetentionCurve * >(argp1);
+  ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "RetentionCurve_dK_dW" "', argument " "2"" of type '" "real""'");
+  } 
+  arg2 = static_cast< real >(val2);
+  {
+    try {
+      result = (real)((cmf::upslope::RetentionCurve const *)arg1)->dK_dW(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_RetentionCurve_dK_dW__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::upslope::RetentionCurve *arg1 = (cmf::upslope::RetentionCurve *) 0 ;
+  cmf::math::num_array *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  cmf::math::num_array result;
+  
+  if ((nobjs < 2) || (nobjs > 2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__upslope__RetentionCurve, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "RetentionCurve_dK_dW" "', argument " "1"" of type '" "cmf::upslope::RetentionCurve const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::upslope::RetentionCurve * >(argp1);
+  {
+    // Convert a array_wrapper from numpy array
+    double * data=0;
+    ptrdiff_t size = from_npy_array(swig_obj[1],&data); 
+    if (!data) {
+      SWIG_exception_fail(SWIG_TypeError,"Input data is not 'array-like' (in the sense of numpy arrays)");
+      return NULL;
+    }
+    arg2 = new cmf::math::num_array(size,data);
+  }
+  {
+    try {
+      result = ((cmf::upslope::RetentionCurve const *)arg1)->dK_dW((cmf::math::num_array const &)*arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  {
+    resultobj = as_npy_array(result);
+  }
+  {
+    delete arg2;
+  }
+  return resultobj;
+fail:
+  {
+    delete arg2;
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_RetentionCurve_dK_dW(PyObject *self, PyObject *args) {
+  Py_ssize_t argc;
+  PyObject *argv[3] = {
+    0
+  };
+  
+  if (!(argc = SWIG_Python_UnpackTuple(args, "RetentionCurve_dK_dW", 0, 2, argv))) SWIG_fail;
+  --argc;
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (argc == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__upslope__RetentionCurve, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          _v = test_npy_array(argv[1]);
+        }
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (argc == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__upslope__RetentionCurve, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_double(argv[1], NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      return _wrap_RetentionCurve_dK_dW__SWIG_1(self, argc, argv);
+    case 2:
+      return _wrap_RetentionCurve_dK_dW__SWIG_0(self, argc, argv);
+    }
+  }
+  
+fail:
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'RetentionCurve_dK_dW'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    cmf::upslope::RetentionCurve::dK_dW(real) const\n"
+    "    cmf::upslope::RetentionCurve::dK_dW(cmf::math::num_array const &) const\n");
+  return 0;
+}
+
+
 SWIGINTERN PyObject *_wrap_RetentionCurve_Wetness_pF__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
   PyObject *resultobj = 0;
   cmf::upslope::RetentionCurve *arg1 = (cmf::upslope::RetentionCurve *) 0 ;
@@ -59342,6 +59622,74 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_SoilLayer_get_dK_dV(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::upslope::SoilLayer *arg1 = (cmf::upslope::SoilLayer *) 0 ;
+  cmf::geometry::point arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::shared_ptr< cmf::upslope::SoilLayer const > tempshared1 ;
+  std::shared_ptr< cmf::upslope::SoilLayer const > *smartarg1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"direction",  NULL 
+  };
+  real result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:SoilLayer_get_dK_dV", kwnames, &obj0, &obj1)) SWIG_fail;
+  {
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(obj0, &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__upslope__SoilLayer_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SoilLayer_get_dK_dV" "', argument " "1"" of type '" "cmf::upslope::SoilLayer const *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr< const cmf::upslope::SoilLayer > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr< const cmf::upslope::SoilLayer > * >(argp1);
+      arg1 = const_cast< cmf::upslope::SoilLayer * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr< const cmf::upslope::SoilLayer > * >(argp1);
+      arg1 = const_cast< cmf::upslope::SoilLayer * >((smartarg1 ? smartarg1->get() : 0));
+    }
+  }
+  {
+    if (check_xy(obj1)) {
+      std::string res = convert_xyz_to_point(obj1,arg2);
+      if (res.size()) {
+        SWIG_exception_fail(SWIG_ValueError,res.c_str());
+        return NULL;
+      }
+    } 
+    else if (PySequence_Check(obj1)) {
+      std::string res = convert_seq_to_point(obj1,arg2);
+      if (res.size()) {
+        SWIG_exception_fail(SWIG_ValueError, res.c_str());
+      }
+    } else {
+      std::string res="<";
+      res+=pyrepr(obj1);
+      res+="> has to be a cmf.point, a sequence, or any object with x and y (optional z) attributes";
+      SWIG_exception_fail(SWIG_ValueError,res.c_str());
+    }
+  }
+  {
+    try {
+      result = (real)((cmf::upslope::SoilLayer const *)arg1)->get_dK_dV(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_SoilLayer_anisotropic_kf_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   cmf::upslope::SoilLayer *arg1 = (cmf::upslope::SoilLayer *) 0 ;
@@ -81888,194 +82236,80 @@ SWIGINTERN PyObject *project_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *
   return SWIG_Python_InitShadowInstance(args);
 }
 
-SWIGINTERN PyObject *_wrap_Integrator___getitem__(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_solver_counters_rhsevals_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
-  int arg2 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
+  long long arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  char * kwnames[] = {
-    (char *)"self",  (char *)"position",  NULL 
-  };
-  cmf::math::StateVariable::ptr result;
+  PyObject *swig_obj[2] ;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator___getitem__", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_Python_UnpackTuple(args, "solver_counters_rhsevals_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator___getitem__" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_rhsevals_set" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  ecode2 = SWIG_AsVal_long_SS_long(swig_obj[1], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Integrator___getitem__" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "solver_counters_rhsevals_set" "', argument " "2"" of type '" "long long""'");
   } 
-  arg2 = static_cast< int >(val2);
-  {
-    try {
-      result = (arg1)->operator [](arg2);
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
-  }
-  {
-    if (!(result)) resultobj = SWIG_NewPointerObj(0,SWIGTYPE_p_std__shared_ptrT_cmf__math__StateVariable_t, SWIG_POINTER_OWN);
-    int dcast = 0;
-    /*@SWIG:C:\Apps\swigwin-4.0.0\Lib\typemaps\swigmacros.swg,193,%formacro@*//*@SWIG:C:\Apps\swigwin-4.0.0\Lib\typemaps\swigmacros.swg,185,%_formacro_1@*//*@SWIG:cmf\cmf_core_src\cmf_swiglib.i,74,%_node_down_cast@*/
-    if (dcast==0 && result) /*check for cmf::water::WaterStorage*/  {
-      std::shared_ptr<cmf::water::WaterStorage> output = std::dynamic_pointer_cast<cmf::water::WaterStorage>(result);
-      if (output) /*flux_node is cmf::water::WaterStorage */ {
-        dcast=1; 
-        resultobj = SWIG_NewPointerObj(new std::shared_ptr<cmf::water::WaterStorage>(output),SWIGTYPE_p_std__shared_ptrT_cmf__water__WaterStorage_t, SWIG_POINTER_OWN); 
-      }
-    }
-    /*@SWIG@*/
-    
-    /*@SWIG:C:\Apps\swigwin-4.0.0\Lib\typemaps\swigmacros.swg,185,%_formacro_1@*//*@SWIG:cmf\cmf_core_src\cmf_swiglib.i,74,%_node_down_cast@*/
-    if (dcast==0 && result) /*check for cmf::water::SoluteStorage*/  {
-      std::shared_ptr<cmf::water::SoluteStorage> output = std::dynamic_pointer_cast<cmf::water::SoluteStorage>(result);
-      if (output) /*flux_node is cmf::water::SoluteStorage */ {
-        dcast=1; 
-        resultobj = SWIG_NewPointerObj(new std::shared_ptr<cmf::water::SoluteStorage>(output),SWIGTYPE_p_std__shared_ptrT_cmf__water__SoluteStorage_t, SWIG_POINTER_OWN); 
-      }
-    }
-    /*@SWIG@*/
-    
-    
-    
-    /*@SWIG@*/
-    
-    /*@SWIG@*//*@SWIG@*/
-    if (!dcast) resultobj = SWIG_NewPointerObj(new std::shared_ptr<cmf::math::StateVariable>(result),
-      SWIGTYPE_p_std__shared_ptrT_cmf__math__StateVariable_t, SWIG_POINTER_OWN)
-    ;
-  }
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_Integrator_get_dxdt(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
-  PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
-  cmf::math::Time arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  char * kwnames[] = {
-    (char *)"self",  (char *)"time",  NULL 
-  };
-  cmf::math::num_array result;
-  
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator_get_dxdt", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_dxdt" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  {
-    arg2 = convert_datetime_to_cmftime(obj1);
-    if (arg2 == cmf::math::never)  {
-      SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
-    }
-  }
-  {
-    try {
-      result = ((cmf::math::Integrator const *)arg1)->get_dxdt(arg2);
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
-  }
-  {
-    resultobj = as_npy_array(result);
-  }
+  arg2 = static_cast< long long >(val2);
+  if (arg1) (arg1)->rhsevals = arg2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_get_states__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_solver_counters_rhsevals_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  cmf::math::num_array result;
+  PyObject *swig_obj[1] ;
+  long long result;
   
-  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_states" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  {
-    try {
-      result = ((cmf::math::Integrator const *)arg1)->get_states();
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
-  }
-  {
-    resultobj = as_npy_array(result);
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_rhsevals_get" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  result = (long long) ((arg1)->rhsevals);
+  resultobj = SWIG_From_long_SS_long(static_cast< long long >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_add_states(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_solver_counters_jacevals_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
-  cmf::math::StateVariableOwner *arg2 = 0 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
+  long long arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  char * kwnames[] = {
-    (char *)"self",  (char *)"stateOwner",  NULL 
-  };
+  long long val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator_add_states", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_Python_UnpackTuple(args, "solver_counters_jacevals_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_add_states" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Integrator_add_states" "', argument " "2"" of type '" "cmf::math::StateVariableOwner &""'"); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Integrator_add_states" "', argument " "2"" of type '" "cmf::math::StateVariableOwner &""'"); 
-  }
-  arg2 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp2);
-  {
-    try {
-      (arg1)->add_states(*arg2);
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_jacevals_set" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  ecode2 = SWIG_AsVal_long_SS_long(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "solver_counters_jacevals_set" "', argument " "2"" of type '" "long long""'");
+  } 
+  arg2 = static_cast< long long >(val2);
+  if (arg1) (arg1)->jacevals = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -82083,74 +82317,51 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_add_single_state(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_solver_counters_jacevals_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
-  cmf::math::StateVariable::ptr arg2 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 ;
-  int res2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  char * kwnames[] = {
-    (char *)"self",  (char *)"state",  NULL 
-  };
+  PyObject *swig_obj[1] ;
+  long long result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator_add_single_state", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_add_single_state" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  {
-    int newmem = 0;
-    res2 = SWIG_ConvertPtrAndOwn(obj1, &argp2, SWIGTYPE_p_std__shared_ptrT_cmf__math__StateVariable_t,  0 , &newmem);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Integrator_add_single_state" "', argument " "2"" of type '" "cmf::math::StateVariable::ptr""'");
-    }
-    if (argp2) arg2 = *(reinterpret_cast< cmf::math::StateVariable::ptr * >(argp2));
-    if (newmem & SWIG_CAST_NEW_MEMORY) delete reinterpret_cast< cmf::math::StateVariable::ptr * >(argp2);
-  }
-  {
-    try {
-      (arg1)->add_single_state(arg2);
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_jacevals_get" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
-  resultobj = SWIG_Py_Void();
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  result = (long long) ((arg1)->jacevals);
+  resultobj = SWIG_From_long_SS_long(static_cast< long long >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_integratables_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_solver_counters_nonlinear_iterations_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
-  cmf::math::integratable_list *arg2 = (cmf::math::integratable_list *) 0 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
+  long long arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  long long val2 ;
+  int ecode2 = 0 ;
   PyObject *swig_obj[2] ;
   
-  if (!SWIG_Python_UnpackTuple(args, "Integrator_integratables_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_Python_UnpackTuple(args, "solver_counters_nonlinear_iterations_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_integratables_set" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_nonlinear_iterations_set" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2,SWIGTYPE_p_cmf__math__integratable_list, 0 |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Integrator_integratables_set" "', argument " "2"" of type '" "cmf::math::integratable_list *""'"); 
-  }
-  arg2 = reinterpret_cast< cmf::math::integratable_list * >(argp2);
-  if (arg1) (arg1)->integratables = *arg2;
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  ecode2 = SWIG_AsVal_long_SS_long(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "solver_counters_nonlinear_iterations_set" "', argument " "2"" of type '" "long long""'");
+  } 
+  arg2 = static_cast< long long >(val2);
+  if (arg1) (arg1)->nonlinear_iterations = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -82158,51 +82369,51 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_integratables_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_solver_counters_nonlinear_iterations_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  cmf::math::integratable_list *result = 0 ;
+  long long result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_integratables_get" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_nonlinear_iterations_get" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  result = (cmf::math::integratable_list *)& ((arg1)->integratables);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__integratable_list, 0 |  0 );
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  result = (long long) ((arg1)->nonlinear_iterations);
+  resultobj = SWIG_From_long_SS_long(static_cast< long long >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_reset_integratables_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_solver_counters_linear_iterations_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
-  bool arg2 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
+  long long arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   PyObject *swig_obj[2] ;
   
-  if (!SWIG_Python_UnpackTuple(args, "Integrator_reset_integratables_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_Python_UnpackTuple(args, "solver_counters_linear_iterations_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_reset_integratables_set" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_linear_iterations_set" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  ecode2 = SWIG_AsVal_bool(swig_obj[1], &val2);
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  ecode2 = SWIG_AsVal_long_SS_long(swig_obj[1], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Integrator_reset_integratables_set" "', argument " "2"" of type '" "bool""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "solver_counters_linear_iterations_set" "', argument " "2"" of type '" "long long""'");
   } 
-  arg2 = static_cast< bool >(val2);
-  if (arg1) (arg1)->reset_integratables = arg2;
+  arg2 = static_cast< long long >(val2);
+  if (arg1) (arg1)->linear_iterations = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -82210,51 +82421,51 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_reset_integratables_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_solver_counters_linear_iterations_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  bool result;
+  long long result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_reset_integratables_get" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_linear_iterations_get" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  result = (bool) ((arg1)->reset_integratables);
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  result = (long long) ((arg1)->linear_iterations);
+  resultobj = SWIG_From_long_SS_long(static_cast< long long >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_use_OpenMP_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_solver_counters_error_test_failures_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
-  bool arg2 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
+  long long arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   PyObject *swig_obj[2] ;
   
-  if (!SWIG_Python_UnpackTuple(args, "Integrator_use_OpenMP_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_Python_UnpackTuple(args, "solver_counters_error_test_failures_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_use_OpenMP_set" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_error_test_failures_set" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  ecode2 = SWIG_AsVal_bool(swig_obj[1], &val2);
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  ecode2 = SWIG_AsVal_long_SS_long(swig_obj[1], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Integrator_use_OpenMP_set" "', argument " "2"" of type '" "bool""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "solver_counters_error_test_failures_set" "', argument " "2"" of type '" "long long""'");
   } 
-  arg2 = static_cast< bool >(val2);
-  if (arg1) (arg1)->use_OpenMP = arg2;
+  arg2 = static_cast< long long >(val2);
+  if (arg1) (arg1)->error_test_failures = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -82262,148 +82473,103 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_use_OpenMP_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_solver_counters_error_test_failures_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  bool result;
+  long long result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_use_OpenMP_get" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_error_test_failures_get" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  result = (bool) ((arg1)->use_OpenMP);
-  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  result = (long long) ((arg1)->error_test_failures);
+  resultobj = SWIG_From_long_SS_long(static_cast< long long >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_size(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_solver_counters_convergence_failures_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
+  long long arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  size_t result;
+  long long val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_Python_UnpackTuple(args, "solver_counters_convergence_failures_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_size" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  {
-    try {
-      result = ((cmf::math::Integrator const *)arg1)->size();
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_convergence_failures_set" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
-  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  ecode2 = SWIG_AsVal_long_SS_long(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "solver_counters_convergence_failures_set" "', argument " "2"" of type '" "long long""'");
+  } 
+  arg2 = static_cast< long long >(val2);
+  if (arg1) (arg1)->convergence_failures = arg2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_get_state(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_solver_counters_convergence_failures_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
-  ptrdiff_t arg2 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  ptrdiff_t val2 ;
-  int ecode2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  char * kwnames[] = {
-    (char *)"self",  (char *)"position",  NULL 
-  };
-  real result;
+  PyObject *swig_obj[1] ;
+  long long result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator_get_state", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_state" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  ecode2 = SWIG_AsVal_ptrdiff_t(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Integrator_get_state" "', argument " "2"" of type '" "ptrdiff_t""'");
-  } 
-  arg2 = static_cast< ptrdiff_t >(val2);
-  {
-    try {
-      result = (real)((cmf::math::Integrator const *)arg1)->get_state(arg2);
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_convergence_failures_get" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  result = (long long) ((arg1)->convergence_failures);
+  resultobj = SWIG_From_long_SS_long(static_cast< long long >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_set_state(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_solver_counters_order_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
-  ptrdiff_t arg2 ;
-  real arg3 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  ptrdiff_t val2 ;
+  int val2 ;
   int ecode2 = 0 ;
-  double val3 ;
-  int ecode3 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  char * kwnames[] = {
-    (char *)"self",  (char *)"position",  (char *)"newState",  NULL 
-  };
+  PyObject *swig_obj[2] ;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:Integrator_set_state", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_Python_UnpackTuple(args, "solver_counters_order_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_set_state" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_order_set" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  ecode2 = SWIG_AsVal_ptrdiff_t(obj1, &val2);
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Integrator_set_state" "', argument " "2"" of type '" "ptrdiff_t""'");
-  } 
-  arg2 = static_cast< ptrdiff_t >(val2);
-  ecode3 = SWIG_AsVal_double(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Integrator_set_state" "', argument " "3"" of type '" "real""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "solver_counters_order_set" "', argument " "2"" of type '" "int""'");
   } 
-  arg3 = static_cast< real >(val3);
-  {
-    try {
-      (arg1)->set_state(arg2,arg3);
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
-  }
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->order = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -82411,121 +82577,65 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_get_states__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_solver_counters_order_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  cmf::math::StateVariableList result;
+  PyObject *swig_obj[1] ;
+  int result;
   
-  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_states" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  {
-    try {
-      result = (arg1)->get_states();
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "solver_counters_order_get" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
-  resultobj = SWIG_NewPointerObj((new cmf::math::StateVariableList(static_cast< const cmf::math::StateVariableList& >(result))), SWIGTYPE_p_cmf__math__StateVariableList, SWIG_POINTER_OWN |  0 );
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
+  result = (int) ((arg1)->order);
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_get_states(PyObject *self, PyObject *args) {
-  Py_ssize_t argc;
-  PyObject *argv[2] = {
-    0
-  };
+SWIGINTERN PyObject *_wrap_new_solver_counters(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::solver_counters *result = 0 ;
   
-  if (!(argc = SWIG_Python_UnpackTuple(args, "Integrator_get_states", 0, 1, argv))) SWIG_fail;
-  --argc;
+  if (!SWIG_Python_UnpackTuple(args, "new_solver_counters", 0, 0, 0)) SWIG_fail;
   {
-    unsigned long _index = 0;
-    SWIG_TypeRank _rank = 0; 
-    if (argc == 1) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      SWIG_TypeRank _pi = 1;
-      int _v = 0;
-      {
-        void *vptr = 0;
-        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__Integrator, 0);
-        _v = SWIG_CheckState(res);
-      }
-      if (!_v) goto check_1;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
-      if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 1;
-        if (_rank == _rankm) goto dispatch;
-      }
-    }
-  check_1:
-    
-    if (argc == 1) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      SWIG_TypeRank _pi = 1;
-      int _v = 0;
-      {
-        void *vptr = 0;
-        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__Integrator, 0);
-        _v = SWIG_CheckState(res);
-      }
-      if (!_v) goto check_2;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
-      if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 2;
-        if (_rank == _rankm) goto dispatch;
-      }
+    try {
+      result = (cmf::math::solver_counters *)new cmf::math::solver_counters();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
     }
-  check_2:
     
-  dispatch:
-    switch(_index) {
-    case 1:
-      return _wrap_Integrator_get_states__SWIG_1(self, argc, argv);
-    case 2:
-      return _wrap_Integrator_get_states__SWIG_0(self, argc, argv);
-    }
   }
-  
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__solver_counters, SWIG_POINTER_NEW |  0 );
+  return resultobj;
 fail:
-  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'Integrator_get_states'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    cmf::math::Integrator::get_states() const\n"
-    "    cmf::math::Integrator::get_states()\n");
-  return 0;
+  return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_Integrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_solver_counters(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::solver_counters *arg1 = (cmf::math::solver_counters *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_DISOWN |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__solver_counters, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_Integrator" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_solver_counters" "', argument " "1"" of type '" "cmf::math::solver_counters *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::solver_counters * >(argp1);
   {
     try {
       delete arg1;
@@ -82543,72 +82653,91 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_get_t(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *solver_counters_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__solver_counters, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *solver_counters_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_step_record_t_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::step_record *arg1 = (cmf::math::step_record *) 0 ;
+  cmf::math::Time *arg2 = (cmf::math::Time *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  cmf::math::Time result;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject *swig_obj[2] ;
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_Python_UnpackTuple(args, "step_record_t_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__step_record, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_t" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "step_record_t_set" "', argument " "1"" of type '" "cmf::math::step_record *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  {
-    try {
-      result = ((cmf::math::Integrator const *)arg1)->get_t();
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
+  arg1 = reinterpret_cast< cmf::math::step_record * >(argp1);
+  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2,SWIGTYPE_p_cmf__math__Time, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "step_record_t_set" "', argument " "2"" of type '" "cmf::math::Time *""'"); 
   }
-  resultobj = SWIG_NewPointerObj((new cmf::math::Time(static_cast< const cmf::math::Time& >(result))), SWIGTYPE_p_cmf__math__Time, SWIG_POINTER_OWN |  0 );
+  arg2 = reinterpret_cast< cmf::math::Time * >(argp2);
+  if (arg1) (arg1)->t = *arg2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_set_t(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_step_record_t_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
-  cmf::math::Time arg2 ;
+  cmf::math::step_record *arg1 = (cmf::math::step_record *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  char * kwnames[] = {
-    (char *)"self",  (char *)"val",  NULL 
-  };
+  PyObject *swig_obj[1] ;
+  cmf::math::Time *result = 0 ;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator_set_t", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__step_record, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_set_t" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "step_record_t_get" "', argument " "1"" of type '" "cmf::math::step_record *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  {
-    arg2 = convert_datetime_to_cmftime(obj1);
-    if (arg2 == cmf::math::never)  {
-      SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
-    }
+  arg1 = reinterpret_cast< cmf::math::step_record * >(argp1);
+  result = (cmf::math::Time *)& ((arg1)->t);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__Time, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_step_record_dt_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::step_record *arg1 = (cmf::math::step_record *) 0 ;
+  cmf::math::Time *arg2 = (cmf::math::Time *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "step_record_dt_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__step_record, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "step_record_dt_set" "', argument " "1"" of type '" "cmf::math::step_record *""'"); 
   }
-  {
-    try {
-      (arg1)->set_t(arg2);
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
+  arg1 = reinterpret_cast< cmf::math::step_record * >(argp1);
+  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2,SWIGTYPE_p_cmf__math__Time, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "step_record_dt_set" "', argument " "2"" of type '" "cmf::math::Time *""'"); 
   }
+  arg2 = reinterpret_cast< cmf::math::Time * >(argp2);
+  if (arg1) (arg1)->dt = *arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -82616,55 +82745,89 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_get_dt(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_step_record_dt_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::step_record *arg1 = (cmf::math::step_record *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  cmf::math::Time result;
+  cmf::math::Time *result = 0 ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__step_record, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_dt" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "step_record_dt_get" "', argument " "1"" of type '" "cmf::math::step_record *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  {
-    try {
-      result = ((cmf::math::Integrator const *)arg1)->get_dt();
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
+  arg1 = reinterpret_cast< cmf::math::step_record * >(argp1);
+  result = (cmf::math::Time *)& ((arg1)->dt);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__Time, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_step_record_wall_time_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::step_record *arg1 = (cmf::math::step_record *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "step_record_wall_time_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__step_record, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "step_record_wall_time_set" "', argument " "1"" of type '" "cmf::math::step_record *""'"); 
   }
-  resultobj = SWIG_NewPointerObj((new cmf::math::Time(static_cast< const cmf::math::Time& >(result))), SWIGTYPE_p_cmf__math__Time, SWIG_POINTER_OWN |  0 );
+  arg1 = reinterpret_cast< cmf::math::step_record * >(argp1);
+  ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "step_record_wall_time_set" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  if (arg1) (arg1)->wall_time = arg2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_reset(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_step_record_wall_time_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::step_record *arg1 = (cmf::math::step_record *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
+  double result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__step_record, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_reset" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "step_record_wall_time_get" "', argument " "1"" of type '" "cmf::math::step_record *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::step_record * >(argp1);
+  result = (double) ((arg1)->wall_time);
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_step_record(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::step_record *result = 0 ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "new_step_record", 0, 0, 0)) SWIG_fail;
   {
     try {
-      (arg1)->reset();
+      result = (cmf::math::step_record *)new cmf::math::step_record();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -82672,31 +82835,30 @@ SWIGINTERN PyObject *_wrap_Integrator_reset(PyObject *SWIGUNUSEDPARM(self), PyOb
     }
     
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__step_record, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_copy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_step_record(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::step_record *arg1 = (cmf::math::step_record *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  cmf::math::Integrator *result = 0 ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__step_record, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_copy" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_step_record" "', argument " "1"" of type '" "cmf::math::step_record *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::step_record * >(argp1);
   {
     try {
-      result = (cmf::math::Integrator *)((cmf::math::Integrator const *)arg1)->copy();
+      delete arg1;
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -82704,34 +82866,68 @@ SWIGINTERN PyObject *_wrap_Integrator_copy(PyObject *SWIGUNUSEDPARM(self), PyObj
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_integrate(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *step_record_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__step_record, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *step_record_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_SolverStatistics_record(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::SolverStatistics *arg1 = (cmf::math::SolverStatistics *) 0 ;
   cmf::math::Time arg2 ;
   cmf::math::Time arg3 ;
+  double arg4 ;
+  cmf::math::solver_counters *arg5 = 0 ;
+  cmf::math::solver_counters *arg6 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  std::shared_ptr< cmf::math::SolverStatistics > tempshared1 ;
+  std::shared_ptr< cmf::math::SolverStatistics > *smartarg1 = 0 ;
+  double val4 ;
+  int ecode4 = 0 ;
+  void *argp5 = 0 ;
+  int res5 = 0 ;
+  void *argp6 = 0 ;
+  int res6 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
   char * kwnames[] = {
-    (char *)"self",  (char *)"t_max",  (char *)"dt",  NULL 
+    (char *)"self",  (char *)"t",  (char *)"dt",  (char *)"wall_time",  (char *)"before",  (char *)"after",  NULL 
   };
-  int result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:Integrator_integrate", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_integrate" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOOO:SolverStatistics_record", kwnames, &obj0, &obj1, &obj2, &obj3, &obj4, &obj5)) SWIG_fail;
+  {
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(obj0, &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SolverStatistics_record" "', argument " "1"" of type '" "cmf::math::SolverStatistics *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >((smartarg1 ? smartarg1->get() : 0));
+    }
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
   {
     arg2 = convert_datetime_to_cmftime(obj1);
     if (arg2 == cmf::math::never)  {
@@ -82744,9 +82940,30 @@ SWIGINTERN PyObject *_wrap_Integrator_integrate(PyObject *SWIGUNUSEDPARM(self),
       SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
     }
   }
+  ecode4 = SWIG_AsVal_double(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "SolverStatistics_record" "', argument " "4"" of type '" "double""'");
+  } 
+  arg4 = static_cast< double >(val4);
+  res5 = SWIG_ConvertPtr(obj4, &argp5, SWIGTYPE_p_cmf__math__solver_counters,  0  | 0);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "SolverStatistics_record" "', argument " "5"" of type '" "cmf::math::solver_counters const &""'"); 
+  }
+  if (!argp5) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SolverStatistics_record" "', argument " "5"" of type '" "cmf::math::solver_counters const &""'"); 
+  }
+  arg5 = reinterpret_cast< cmf::math::solver_counters * >(argp5);
+  res6 = SWIG_ConvertPtr(obj5, &argp6, SWIGTYPE_p_cmf__math__solver_counters,  0  | 0);
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), "in method '" "SolverStatistics_record" "', argument " "6"" of type '" "cmf::math::solver_counters const &""'"); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SolverStatistics_record" "', argument " "6"" of type '" "cmf::math::solver_counters const &""'"); 
+  }
+  arg6 = reinterpret_cast< cmf::math::solver_counters * >(argp6);
   {
     try {
-      result = (int)(arg1)->integrate(arg2,arg3);
+      (arg1)->record(arg2,arg3,arg4,(cmf::math::solver_counters const &)*arg5,(cmf::math::solver_counters const &)*arg6);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -82754,61 +82971,43 @@ SWIGINTERN PyObject *_wrap_Integrator_integrate(PyObject *SWIGUNUSEDPARM(self),
     }
     
   }
-  resultobj = SWIG_From_int(static_cast< int >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator_integrate_until(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_SolverStatistics_size(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
-  cmf::math::Time arg2 ;
-  cmf::math::Time arg3 = (cmf::math::Time) cmf::math::Time() ;
-  bool arg4 = (bool) false ;
+  cmf::math::SolverStatistics *arg1 = (cmf::math::SolverStatistics *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool val4 ;
-  int ecode4 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  PyObject * obj3 = 0 ;
-  char * kwnames[] = {
-    (char *)"self",  (char *)"t_max",  (char *)"dt",  (char *)"reset",  NULL 
-  };
+  std::shared_ptr< cmf::math::SolverStatistics const > tempshared1 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > *smartarg1 = 0 ;
+  PyObject *swig_obj[1] ;
+  size_t result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|OO:Integrator_integrate_until", kwnames, &obj0, &obj1, &obj2, &obj3)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_integrate_until" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
   {
-    arg2 = convert_datetime_to_cmftime(obj1);
-    if (arg2 == cmf::math::never)  {
-      SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(swig_obj[0], &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SolverStatistics_size" "', argument " "1"" of type '" "cmf::math::SolverStatistics const *""'");
     }
-  }
-  if (obj2) {
-    {
-      arg3 = convert_datetime_to_cmftime(obj2);
-      if (arg3 == cmf::math::never)  {
-        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
-      }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >((smartarg1 ? smartarg1->get() : 0));
     }
   }
-  if (obj3) {
-    ecode4 = SWIG_AsVal_bool(obj3, &val4);
-    if (!SWIG_IsOK(ecode4)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "Integrator_integrate_until" "', argument " "4"" of type '" "bool""'");
-    } 
-    arg4 = static_cast< bool >(val4);
-  }
   {
     try {
-      (arg1)->integrate_until(arg2,arg3,arg4);
+      result = ((cmf::math::SolverStatistics const *)arg1)->size();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -82816,31 +83015,43 @@ SWIGINTERN PyObject *_wrap_Integrator_integrate_until(PyObject *SWIGUNUSEDPARM(s
     }
     
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Integrator___len__(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SolverStatistics_get_capacity(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::SolverStatistics *arg1 = (cmf::math::SolverStatistics *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > tempshared1 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > *smartarg1 = 0 ;
   PyObject *swig_obj[1] ;
   size_t result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator___len__" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  {
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(swig_obj[0], &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SolverStatistics_get_capacity" "', argument " "1"" of type '" "cmf::math::SolverStatistics const *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >((smartarg1 ? smartarg1->get() : 0));
+    }
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
   {
     try {
-      result = cmf_math_Integrator___len__(arg1);
+      result = ((cmf::math::SolverStatistics const *)arg1)->get_capacity();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -82855,31 +83066,91 @@ fail:
 }
 
 
-SWIGINTERN PyObject *Integrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__Integrator, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
+SWIGINTERN PyObject *_wrap_SolverStatistics_get_record(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::SolverStatistics *arg1 = (cmf::math::SolverStatistics *) 0 ;
+  ptrdiff_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > tempshared1 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > *smartarg1 = 0 ;
+  ptrdiff_t val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"index",  NULL 
+  };
+  cmf::math::step_record result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:SolverStatistics_get_record", kwnames, &obj0, &obj1)) SWIG_fail;
+  {
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(obj0, &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SolverStatistics_get_record" "', argument " "1"" of type '" "cmf::math::SolverStatistics const *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >((smartarg1 ? smartarg1->get() : 0));
+    }
+  }
+  ecode2 = SWIG_AsVal_ptrdiff_t(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SolverStatistics_get_record" "', argument " "2"" of type '" "ptrdiff_t""'");
+  } 
+  arg2 = static_cast< ptrdiff_t >(val2);
+  {
+    try {
+      result = ((cmf::math::SolverStatistics const *)arg1)->get_record(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj((new cmf::math::step_record(static_cast< const cmf::math::step_record& >(result))), SWIGTYPE_p_cmf__math__step_record, SWIG_POINTER_OWN |  0 );
+  return resultobj;
+fail:
+  return NULL;
 }
 
-SWIGINTERN PyObject *_wrap_BDF2_get_error_position(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+
+SWIGINTERN PyObject *_wrap_SolverStatistics_get_total(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::BDF2 *arg1 = (cmf::math::BDF2 *) 0 ;
+  cmf::math::SolverStatistics *arg1 = (cmf::math::SolverStatistics *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > tempshared1 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > *smartarg1 = 0 ;
   PyObject *swig_obj[1] ;
-  int result;
+  cmf::math::solver_counters result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__BDF2, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BDF2_get_error_position" "', argument " "1"" of type '" "cmf::math::BDF2 const *""'"); 
+  {
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(swig_obj[0], &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SolverStatistics_get_total" "', argument " "1"" of type '" "cmf::math::SolverStatistics const *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >((smartarg1 ? smartarg1->get() : 0));
+    }
   }
-  arg1 = reinterpret_cast< cmf::math::BDF2 * >(argp1);
   {
     try {
-      result = (int)((cmf::math::BDF2 const *)arg1)->get_error_position();
+      result = ((cmf::math::SolverStatistics const *)arg1)->get_total();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -82887,92 +83158,131 @@ SWIGINTERN PyObject *_wrap_BDF2_get_error_position(PyObject *SWIGUNUSEDPARM(self
     }
     
   }
-  resultobj = SWIG_From_int(static_cast< int >(result));
+  resultobj = SWIG_NewPointerObj((new cmf::math::solver_counters(static_cast< const cmf::math::solver_counters& >(result))), SWIGTYPE_p_cmf__math__solver_counters, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_BDF2_max_order_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SolverStatistics_get_steps(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::BDF2 *arg1 = (cmf::math::BDF2 *) 0 ;
-  int arg2 ;
+  cmf::math::SolverStatistics *arg1 = (cmf::math::SolverStatistics *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  PyObject *swig_obj[2] ;
+  std::shared_ptr< cmf::math::SolverStatistics const > tempshared1 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > *smartarg1 = 0 ;
+  PyObject *swig_obj[1] ;
+  long long result;
   
-  if (!SWIG_Python_UnpackTuple(args, "BDF2_max_order_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__BDF2, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BDF2_max_order_set" "', argument " "1"" of type '" "cmf::math::BDF2 *""'"); 
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  {
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(swig_obj[0], &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SolverStatistics_get_steps" "', argument " "1"" of type '" "cmf::math::SolverStatistics const *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >((smartarg1 ? smartarg1->get() : 0));
+    }
   }
-  arg1 = reinterpret_cast< cmf::math::BDF2 * >(argp1);
-  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "BDF2_max_order_set" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->max_order = arg2;
-  resultobj = SWIG_Py_Void();
+  {
+    try {
+      result = (long long)((cmf::math::SolverStatistics const *)arg1)->get_steps();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_long_SS_long(static_cast< long long >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_BDF2_max_order_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SolverStatistics_get_wall_time(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::BDF2 *arg1 = (cmf::math::BDF2 *) 0 ;
+  cmf::math::SolverStatistics *arg1 = (cmf::math::SolverStatistics *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > tempshared1 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > *smartarg1 = 0 ;
   PyObject *swig_obj[1] ;
-  int result;
+  double result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__BDF2, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BDF2_max_order_get" "', argument " "1"" of type '" "cmf::math::BDF2 *""'"); 
+  {
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(swig_obj[0], &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SolverStatistics_get_wall_time" "', argument " "1"" of type '" "cmf::math::SolverStatistics const *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >((smartarg1 ? smartarg1->get() : 0));
+    }
   }
-  arg1 = reinterpret_cast< cmf::math::BDF2 * >(argp1);
-  result = (int) ((arg1)->max_order);
-  resultobj = SWIG_From_int(static_cast< int >(result));
+  {
+    try {
+      result = (double)((cmf::math::SolverStatistics const *)arg1)->get_wall_time();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_BDF2__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_SolverStatistics_get_time(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  real arg1 = (real) 1e-9 ;
-  cmf::math::Time arg2 = (cmf::math::Time) cmf::math::timespan(10) ;
-  double val1 ;
-  int ecode1 = 0 ;
-  cmf::math::BDF2 *result = 0 ;
+  cmf::math::SolverStatistics *arg1 = (cmf::math::SolverStatistics *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > tempshared1 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > *smartarg1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::Time result;
   
-  if ((nobjs < 0) || (nobjs > 2)) SWIG_fail;
-  if (swig_obj[0]) {
-    ecode1 = SWIG_AsVal_double(swig_obj[0], &val1);
-    if (!SWIG_IsOK(ecode1)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_BDF2" "', argument " "1"" of type '" "real""'");
-    } 
-    arg1 = static_cast< real >(val1);
-  }
-  if (swig_obj[1]) {
-    {
-      arg2 = convert_datetime_to_cmftime(swig_obj[1]);
-      if (arg2 == cmf::math::never)  {
-        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
-      }
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  {
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(swig_obj[0], &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SolverStatistics_get_time" "', argument " "1"" of type '" "cmf::math::SolverStatistics const *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >((smartarg1 ? smartarg1->get() : 0));
     }
   }
   {
     try {
-      result = (cmf::math::BDF2 *)new cmf::math::BDF2(arg1,arg2);
+      result = ((cmf::math::SolverStatistics const *)arg1)->get_time();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -82980,51 +83290,55 @@ SWIGINTERN PyObject *_wrap_new_BDF2__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_s
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__BDF2, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_NewPointerObj((new cmf::math::Time(static_cast< const cmf::math::Time& >(result))), SWIGTYPE_p_cmf__math__Time, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_BDF2__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_SolverStatistics_open_log(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  cmf::math::StateVariableOwner *arg1 = 0 ;
-  real arg2 = (real) 1e-9 ;
-  cmf::math::Time arg3 = (cmf::math::Time) cmf::math::timespan(10) ;
+  cmf::math::SolverStatistics *arg1 = (cmf::math::SolverStatistics *) 0 ;
+  std::string arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double val2 ;
-  int ecode2 = 0 ;
-  cmf::math::BDF2 *result = 0 ;
+  std::shared_ptr< cmf::math::SolverStatistics > tempshared1 ;
+  std::shared_ptr< cmf::math::SolverStatistics > *smartarg1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"filename",  NULL 
+  };
   
-  if ((nobjs < 1) || (nobjs > 3)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_BDF2" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
-  }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_BDF2" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
-  if (swig_obj[1]) {
-    ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_BDF2" "', argument " "2"" of type '" "real""'");
-    } 
-    arg2 = static_cast< real >(val2);
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:SolverStatistics_open_log", kwnames, &obj0, &obj1)) SWIG_fail;
+  {
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(obj0, &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SolverStatistics_open_log" "', argument " "1"" of type '" "cmf::math::SolverStatistics *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >((smartarg1 ? smartarg1->get() : 0));
+    }
   }
-  if (swig_obj[2]) {
-    {
-      arg3 = convert_datetime_to_cmftime(swig_obj[2]);
-      if (arg3 == cmf::math::never)  {
-        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
-      }
+  {
+    std::string *ptr = (std::string *)0;
+    int res = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res) || !ptr) {
+      SWIG_exception_fail(SWIG_ArgError((ptr ? res : SWIG_TypeError)), "in method '" "SolverStatistics_open_log" "', argument " "2"" of type '" "std::string""'"); 
     }
+    arg2 = *ptr;
+    if (SWIG_IsNewObj(res)) delete ptr;
   }
   {
     try {
-      result = (cmf::math::BDF2 *)new cmf::math::BDF2(*arg1,arg2,arg3);
+      (arg1)->open_log(arg2);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -83032,32 +83346,42 @@ SWIGINTERN PyObject *_wrap_new_BDF2__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_s
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__BDF2, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_BDF2__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_SolverStatistics_close_log(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = 0 ;
+  cmf::math::SolverStatistics *arg1 = (cmf::math::SolverStatistics *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  cmf::math::BDF2 *result = 0 ;
+  std::shared_ptr< cmf::math::SolverStatistics > tempshared1 ;
+  std::shared_ptr< cmf::math::SolverStatistics > *smartarg1 = 0 ;
+  PyObject *swig_obj[1] ;
   
-  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_BDF2" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
-  }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_BDF2" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  {
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(swig_obj[0], &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SolverStatistics_close_log" "', argument " "1"" of type '" "cmf::math::SolverStatistics *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >((smartarg1 ? smartarg1->get() : 0));
+    }
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
   {
     try {
-      result = (cmf::math::BDF2 *)new cmf::math::BDF2((cmf::math::Integrator const &)*arg1);
+      (arg1)->close_log();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -83065,45 +83389,4187 @@ SWIGINTERN PyObject *_wrap_new_BDF2__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_s
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__BDF2, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_BDF2(PyObject *self, PyObject *args) {
-  Py_ssize_t argc;
-  PyObject *argv[4] = {
-    0
-  };
+SWIGINTERN PyObject *_wrap_SolverStatistics_clear(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SolverStatistics *arg1 = (cmf::math::SolverStatistics *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::shared_ptr< cmf::math::SolverStatistics > tempshared1 ;
+  std::shared_ptr< cmf::math::SolverStatistics > *smartarg1 = 0 ;
+  PyObject *swig_obj[1] ;
   
-  if (!(argc = SWIG_Python_UnpackTuple(args, "new_BDF2", 0, 3, argv))) SWIG_fail;
-  --argc;
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
   {
-    unsigned long _index = 0;
-    SWIG_TypeRank _rank = 0; 
-    if ((argc >= 0) && (argc <= 2)) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      SWIG_TypeRank _pi = 1;
-      int _v = 0;
-      if (argc > 0) {
-        {
-          {
-            int res = SWIG_AsVal_double(argv[0], NULL);
-            _v = SWIG_CheckState(res);
-          }
-        }
-        if (!_v) goto check_1;
-        _ranki += _v*_pi;
-        _rankm += _pi;
-        _pi *= SWIG_MAXCASTRANK;
-        if (argc > 1) {
-          {
-            {
-              _v = check_time(argv[1]);
-            }
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(swig_obj[0], &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SolverStatistics_clear" "', argument " "1"" of type '" "cmf::math::SolverStatistics *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >((smartarg1 ? smartarg1->get() : 0));
+    }
+  }
+  {
+    try {
+      (arg1)->clear();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SolverStatistics_to_string(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SolverStatistics *arg1 = (cmf::math::SolverStatistics *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > tempshared1 ;
+  std::shared_ptr< cmf::math::SolverStatistics const > *smartarg1 = 0 ;
+  PyObject *swig_obj[1] ;
+  std::string result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  {
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(swig_obj[0], &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SolverStatistics_to_string" "', argument " "1"" of type '" "cmf::math::SolverStatistics const *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr< const cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >((smartarg1 ? smartarg1->get() : 0));
+    }
+  }
+  {
+    try {
+      result = ((cmf::math::SolverStatistics const *)arg1)->to_string();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_SolverStatistics(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  size_t arg1 = (size_t) 10000 ;
+  size_t val1 ;
+  int ecode1 = 0 ;
+  PyObject * obj0 = 0 ;
+  char * kwnames[] = {
+    (char *)"capacity",  NULL 
+  };
+  cmf::math::SolverStatistics *result = 0 ;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O:new_SolverStatistics", kwnames, &obj0)) SWIG_fail;
+  if (obj0) {
+    ecode1 = SWIG_AsVal_size_t(obj0, &val1);
+    if (!SWIG_IsOK(ecode1)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_SolverStatistics" "', argument " "1"" of type '" "size_t""'");
+    } 
+    arg1 = static_cast< size_t >(val1);
+  }
+  {
+    try {
+      result = (cmf::math::SolverStatistics *)new cmf::math::SolverStatistics(arg1);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  {
+    std::shared_ptr<  cmf::math::SolverStatistics > *smartresult = result ? new std::shared_ptr<  cmf::math::SolverStatistics >(result SWIG_NO_NULL_DELETER_SWIG_POINTER_NEW) : 0;
+    resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(smartresult), SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, SWIG_POINTER_NEW | SWIG_POINTER_OWN);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_SolverStatistics(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SolverStatistics *arg1 = (cmf::math::SolverStatistics *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::shared_ptr< cmf::math::SolverStatistics > tempshared1 ;
+  std::shared_ptr< cmf::math::SolverStatistics > *smartarg1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  {
+    int newmem = 0;
+    res1 = SWIG_ConvertPtrAndOwn(swig_obj[0], &argp1, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0 |  0 , &newmem);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_SolverStatistics" "', argument " "1"" of type '" "cmf::math::SolverStatistics *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      tempshared1 = *reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      delete reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >(tempshared1.get());
+    } else {
+      smartarg1 = reinterpret_cast< std::shared_ptr<  cmf::math::SolverStatistics > * >(argp1);
+      arg1 = const_cast< cmf::math::SolverStatistics * >((smartarg1 ? smartarg1->get() : 0));
+    }
+  }
+  {
+    try {
+      (void)arg1; delete smartarg1;
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *SolverStatistics_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *SolverStatistics_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_Integrator___getitem__(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"position",  NULL 
+  };
+  cmf::math::StateVariable::ptr result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator___getitem__", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator___getitem__" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Integrator___getitem__" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try {
+      result = (arg1)->operator [](arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  {
+    if (!(result)) resultobj = SWIG_NewPointerObj(0,SWIGTYPE_p_std__shared_ptrT_cmf__math__StateVariable_t, SWIG_POINTER_OWN);
+    int dcast = 0;
+    /*@SWIG:C:\Apps\swigwin-4.0.0\Lib\typemaps\swigmacros.swg,193,%formacro@*//*@SWIG:C:\Apps\swigwin-4.0.0\Lib\typemaps\swigmacros.swg,185,%_formacro_1@*//*@SWIG:cmf\cmf_core_src\cmf_swiglib.i,74,%_node_down_cast@*/
+    if (dcast==0 && result) /*check for cmf::water::WaterStorage*/  {
+      std::shared_ptr<cmf::water::WaterStorage> output = std::dynamic_pointer_cast<cmf::water::WaterStorage>(result);
+      if (output) /*flux_node is cmf::water::WaterStorage */ {
+        dcast=1; 
+        resultobj = SWIG_NewPointerObj(new std::shared_ptr<cmf::water::WaterStorage>(output),SWIGTYPE_p_std__shared_ptrT_cmf__water__WaterStorage_t, SWIG_POINTER_OWN); 
+      }
+    }
+    /*@SWIG@*/
+    
+    /*@SWIG:C:\Apps\swigwin-4.0.0\Lib\typemaps\swigmacros.swg,185,%_formacro_1@*//*@SWIG:cmf\cmf_core_src\cmf_swiglib.i,74,%_node_down_cast@*/
+    if (dcast==0 && result) /*check for cmf::water::SoluteStorage*/  {
+      std::shared_ptr<cmf::water::SoluteStorage> output = std::dynamic_pointer_cast<cmf::water::SoluteStorage>(result);
+      if (output) /*flux_node is cmf::water::SoluteStorage */ {
+        dcast=1; 
+        resultobj = SWIG_NewPointerObj(new std::shared_ptr<cmf::water::SoluteStorage>(output),SWIGTYPE_p_std__shared_ptrT_cmf__water__SoluteStorage_t, SWIG_POINTER_OWN); 
+      }
+    }
+    /*@SWIG@*/
+    
+    
+    
+    /*@SWIG@*/
+    
+    /*@SWIG@*//*@SWIG@*/
+    if (!dcast) resultobj = SWIG_NewPointerObj(new std::shared_ptr<cmf::math::StateVariable>(result),
+      SWIGTYPE_p_std__shared_ptrT_cmf__math__StateVariable_t, SWIG_POINTER_OWN)
+    ;
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_get_dxdt(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::Time arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"time",  NULL 
+  };
+  cmf::math::num_array result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator_get_dxdt", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_dxdt" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    arg2 = convert_datetime_to_cmftime(obj1);
+    if (arg2 == cmf::math::never)  {
+      SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+    }
+  }
+  {
+    try {
+      result = ((cmf::math::Integrator const *)arg1)->get_dxdt(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  {
+    resultobj = as_npy_array(result);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_get_states__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  cmf::math::num_array result;
+  
+  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_states" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::Integrator const *)arg1)->get_states();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  {
+    resultobj = as_npy_array(result);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_add_states(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::StateVariableOwner *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"stateOwner",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator_add_states", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_add_states" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Integrator_add_states" "', argument " "2"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Integrator_add_states" "', argument " "2"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg2 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp2);
+  {
+    try {
+      (arg1)->add_states(*arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_add_single_state(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::StateVariable::ptr arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"state",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator_add_single_state", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_add_single_state" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    int newmem = 0;
+    res2 = SWIG_ConvertPtrAndOwn(obj1, &argp2, SWIGTYPE_p_std__shared_ptrT_cmf__math__StateVariable_t,  0 , &newmem);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Integrator_add_single_state" "', argument " "2"" of type '" "cmf::math::StateVariable::ptr""'");
+    }
+    if (argp2) arg2 = *(reinterpret_cast< cmf::math::StateVariable::ptr * >(argp2));
+    if (newmem & SWIG_CAST_NEW_MEMORY) delete reinterpret_cast< cmf::math::StateVariable::ptr * >(argp2);
+  }
+  {
+    try {
+      (arg1)->add_single_state(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_reorder_states(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_reorder_states" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      (arg1)->reorder_states();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_get_bandwidth(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  size_t result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_bandwidth" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::Integrator const *)arg1)->get_bandwidth();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_integratables_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::integratable_list *arg2 = (cmf::math::integratable_list *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "Integrator_integratables_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_integratables_set" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2,SWIGTYPE_p_cmf__math__integratable_list, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Integrator_integratables_set" "', argument " "2"" of type '" "cmf::math::integratable_list *""'"); 
+  }
+  arg2 = reinterpret_cast< cmf::math::integratable_list * >(argp2);
+  if (arg1) (arg1)->integratables = *arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_integratables_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::integratable_list *result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_integratables_get" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  result = (cmf::math::integratable_list *)& ((arg1)->integratables);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__integratable_list, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_reset_integratables_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "Integrator_reset_integratables_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_reset_integratables_set" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  ecode2 = SWIG_AsVal_bool(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Integrator_reset_integratables_set" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->reset_integratables = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_reset_integratables_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_reset_integratables_get" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  result = (bool) ((arg1)->reset_integratables);
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_use_OpenMP_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "Integrator_use_OpenMP_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_use_OpenMP_set" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  ecode2 = SWIG_AsVal_bool(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Integrator_use_OpenMP_set" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->use_OpenMP = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_use_OpenMP_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_use_OpenMP_get" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  result = (bool) ((arg1)->use_OpenMP);
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_use_flux_graph_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "Integrator_use_flux_graph_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_use_flux_graph_set" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  ecode2 = SWIG_AsVal_bool(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Integrator_use_flux_graph_set" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->use_flux_graph = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_use_flux_graph_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_use_flux_graph_get" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  result = (bool) ((arg1)->use_flux_graph);
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_use_contiguous_states_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "Integrator_use_contiguous_states_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_use_contiguous_states_set" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  ecode2 = SWIG_AsVal_bool(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Integrator_use_contiguous_states_set" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->use_contiguous_states = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_use_contiguous_states_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_use_contiguous_states_get" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  result = (bool) ((arg1)->use_contiguous_states);
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_use_forcing_breakpoints_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "Integrator_use_forcing_breakpoints_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_use_forcing_breakpoints_set" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  ecode2 = SWIG_AsVal_bool(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Integrator_use_forcing_breakpoints_set" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->use_forcing_breakpoints = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_use_forcing_breakpoints_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_use_forcing_breakpoints_get" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  result = (bool) ((arg1)->use_forcing_breakpoints);
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_get_next_breakpoint(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::Time arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"t",  NULL 
+  };
+  cmf::math::Time result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator_get_next_breakpoint", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_next_breakpoint" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    arg2 = convert_datetime_to_cmftime(obj1);
+    if (arg2 == cmf::math::never)  {
+      SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+    }
+  }
+  {
+    try {
+      result = ((cmf::math::Integrator const *)arg1)->get_next_breakpoint(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj((new cmf::math::Time(static_cast< const cmf::math::Time& >(result))), SWIGTYPE_p_cmf__math__Time, SWIG_POINTER_OWN |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_statistics_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  std::shared_ptr< cmf::math::SolverStatistics > *arg2 = (std::shared_ptr< cmf::math::SolverStatistics > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 ;
+  int res2 = 0 ;
+  std::shared_ptr< cmf::math::SolverStatistics > tempshared2 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "Integrator_statistics_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_statistics_set" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    int newmem = 0;
+    res2 = SWIG_ConvertPtrAndOwn(swig_obj[1], &argp2, SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t,  0 , &newmem);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Integrator_statistics_set" "', argument " "2"" of type '" "std::shared_ptr< cmf::math::SolverStatistics > *""'");
+    }
+    if (newmem & SWIG_CAST_NEW_MEMORY) {
+      if (argp2) tempshared2 = *reinterpret_cast< std::shared_ptr< cmf::math::SolverStatistics > * >(argp2);
+      delete reinterpret_cast< std::shared_ptr< cmf::math::SolverStatistics > * >(argp2);
+      arg2 = &tempshared2;
+    } else {
+      arg2 = (argp2) ? reinterpret_cast< std::shared_ptr< cmf::math::SolverStatistics > * >(argp2) : &tempshared2;
+    }
+  }
+  if (arg1) (arg1)->statistics = *arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_statistics_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  std::shared_ptr< cmf::math::SolverStatistics > *result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_statistics_get" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  result = (std::shared_ptr< cmf::math::SolverStatistics > *)& ((arg1)->statistics);
+  {
+    std::shared_ptr<  cmf::math::SolverStatistics > *smartresult = *result ? new std::shared_ptr<  cmf::math::SolverStatistics >(*result) : 0;
+    resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(smartresult), SWIGTYPE_p_std__shared_ptrT_cmf__math__SolverStatistics_t, SWIG_POINTER_OWN);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_get_counters(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::solver_counters result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_counters" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::Integrator const *)arg1)->get_counters();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj((new cmf::math::solver_counters(static_cast< const cmf::math::solver_counters& >(result))), SWIGTYPE_p_cmf__math__solver_counters, SWIG_POINTER_OWN |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_size(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  size_t result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_size" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::Integrator const *)arg1)->size();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_get_state(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  ptrdiff_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  ptrdiff_t val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"position",  NULL 
+  };
+  real result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator_get_state", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_state" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  ecode2 = SWIG_AsVal_ptrdiff_t(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Integrator_get_state" "', argument " "2"" of type '" "ptrdiff_t""'");
+  } 
+  arg2 = static_cast< ptrdiff_t >(val2);
+  {
+    try {
+      result = (real)((cmf::math::Integrator const *)arg1)->get_state(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_set_state(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  ptrdiff_t arg2 ;
+  real arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  ptrdiff_t val2 ;
+  int ecode2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"position",  (char *)"newState",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:Integrator_set_state", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_set_state" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  ecode2 = SWIG_AsVal_ptrdiff_t(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Integrator_set_state" "', argument " "2"" of type '" "ptrdiff_t""'");
+  } 
+  arg2 = static_cast< ptrdiff_t >(val2);
+  ecode3 = SWIG_AsVal_double(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Integrator_set_state" "', argument " "3"" of type '" "real""'");
+  } 
+  arg3 = static_cast< real >(val3);
+  {
+    try {
+      (arg1)->set_state(arg2,arg3);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_get_states__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  cmf::math::StateVariableList result;
+  
+  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_states" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = (arg1)->get_states();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj((new cmf::math::StateVariableList(static_cast< const cmf::math::StateVariableList& >(result))), SWIGTYPE_p_cmf__math__StateVariableList, SWIG_POINTER_OWN |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_get_states(PyObject *self, PyObject *args) {
+  Py_ssize_t argc;
+  PyObject *argv[2] = {
+    0
+  };
+  
+  if (!(argc = SWIG_Python_UnpackTuple(args, "Integrator_get_states", 0, 1, argv))) SWIG_fail;
+  --argc;
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (argc == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__Integrator, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (argc == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__Integrator, 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      return _wrap_Integrator_get_states__SWIG_1(self, argc, argv);
+    case 2:
+      return _wrap_Integrator_get_states__SWIG_0(self, argc, argv);
+    }
+  }
+  
+fail:
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'Integrator_get_states'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    cmf::math::Integrator::get_states() const\n"
+    "    cmf::math::Integrator::get_states()\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_Integrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_Integrator" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_get_t(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::Time result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_t" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::Integrator const *)arg1)->get_t();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj((new cmf::math::Time(static_cast< const cmf::math::Time& >(result))), SWIGTYPE_p_cmf__math__Time, SWIG_POINTER_OWN |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_set_t(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::Time arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"val",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator_set_t", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_set_t" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    arg2 = convert_datetime_to_cmftime(obj1);
+    if (arg2 == cmf::math::never)  {
+      SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+    }
+  }
+  {
+    try {
+      (arg1)->set_t(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_get_dt(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::Time result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_get_dt" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::Integrator const *)arg1)->get_dt();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj((new cmf::math::Time(static_cast< const cmf::math::Time& >(result))), SWIGTYPE_p_cmf__math__Time, SWIG_POINTER_OWN |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_reset(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_reset" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      (arg1)->reset();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_copy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::Integrator *result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_copy" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = (cmf::math::Integrator *)((cmf::math::Integrator const *)arg1)->copy();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_integrate(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::Time arg2 ;
+  cmf::math::Time arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"t_max",  (char *)"dt",  NULL 
+  };
+  int result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:Integrator_integrate", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_integrate" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    arg2 = convert_datetime_to_cmftime(obj1);
+    if (arg2 == cmf::math::never)  {
+      SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+    }
+  }
+  {
+    arg3 = convert_datetime_to_cmftime(obj2);
+    if (arg3 == cmf::math::never)  {
+      SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+    }
+  }
+  {
+    try {
+      result = (int)(arg1)->integrate(arg2,arg3);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_integrate_until(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  cmf::math::Time arg2 ;
+  cmf::math::Time arg3 = (cmf::math::Time) cmf::math::Time() ;
+  bool arg4 = (bool) false ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"t_max",  (char *)"dt",  (char *)"reset",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|OO:Integrator_integrate_until", kwnames, &obj0, &obj1, &obj2, &obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_integrate_until" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    arg2 = convert_datetime_to_cmftime(obj1);
+    if (arg2 == cmf::math::never)  {
+      SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+    }
+  }
+  if (obj2) {
+    {
+      arg3 = convert_datetime_to_cmftime(obj2);
+      if (arg3 == cmf::math::never)  {
+        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+      }
+    }
+  }
+  if (obj3) {
+    ecode4 = SWIG_AsVal_bool(obj3, &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "Integrator_integrate_until" "', argument " "4"" of type '" "bool""'");
+    } 
+    arg4 = static_cast< bool >(val4);
+  }
+  {
+    try {
+      (arg1)->integrate_until(arg2,arg3,arg4);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_save_checkpoint(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  std::string arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"filename",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator_save_checkpoint", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_save_checkpoint" "', argument " "1"" of type '" "cmf::math::Integrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    int res = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res) || !ptr) {
+      SWIG_exception_fail(SWIG_ArgError((ptr ? res : SWIG_TypeError)), "in method '" "Integrator_save_checkpoint" "', argument " "2"" of type '" "std::string""'"); 
+    }
+    arg2 = *ptr;
+    if (SWIG_IsNewObj(res)) delete ptr;
+  }
+  {
+    try {
+      ((cmf::math::Integrator const *)arg1)->save_checkpoint(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator_load_checkpoint(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  std::string arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"filename",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:Integrator_load_checkpoint", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator_load_checkpoint" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    int res = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res) || !ptr) {
+      SWIG_exception_fail(SWIG_ArgError((ptr ? res : SWIG_TypeError)), "in method '" "Integrator_load_checkpoint" "', argument " "2"" of type '" "std::string""'"); 
+    }
+    arg2 = *ptr;
+    if (SWIG_IsNewObj(res)) delete ptr;
+  }
+  {
+    try {
+      (arg1)->load_checkpoint(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Integrator___len__(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = (cmf::math::Integrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  size_t result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__Integrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Integrator___len__" "', argument " "1"" of type '" "cmf::math::Integrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = cmf_math_Integrator___len__(arg1);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *Integrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__Integrator, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_BDF2_get_error_position(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::BDF2 *arg1 = (cmf::math::BDF2 *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__BDF2, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BDF2_get_error_position" "', argument " "1"" of type '" "cmf::math::BDF2 const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::BDF2 * >(argp1);
+  {
+    try {
+      result = (int)((cmf::math::BDF2 const *)arg1)->get_error_position();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_BDF2_max_order_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::BDF2 *arg1 = (cmf::math::BDF2 *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "BDF2_max_order_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__BDF2, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BDF2_max_order_set" "', argument " "1"" of type '" "cmf::math::BDF2 *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::BDF2 * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "BDF2_max_order_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->max_order = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_BDF2_max_order_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::BDF2 *arg1 = (cmf::math::BDF2 *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__BDF2, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BDF2_max_order_get" "', argument " "1"" of type '" "cmf::math::BDF2 *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::BDF2 * >(argp1);
+  result = (int) ((arg1)->max_order);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_BDF2_use_newton_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::BDF2 *arg1 = (cmf::math::BDF2 *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "BDF2_use_newton_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__BDF2, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BDF2_use_newton_set" "', argument " "1"" of type '" "cmf::math::BDF2 *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::BDF2 * >(argp1);
+  ecode2 = SWIG_AsVal_bool(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "BDF2_use_newton_set" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->use_newton = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_BDF2_use_newton_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::BDF2 *arg1 = (cmf::math::BDF2 *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__BDF2, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "BDF2_use_newton_get" "', argument " "1"" of type '" "cmf::math::BDF2 *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::BDF2 * >(argp1);
+  result = (bool) ((arg1)->use_newton);
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_BDF2__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  real arg1 = (real) 1e-9 ;
+  cmf::math::Time arg2 = (cmf::math::Time) cmf::math::timespan(10) ;
+  double val1 ;
+  int ecode1 = 0 ;
+  cmf::math::BDF2 *result = 0 ;
+  
+  if ((nobjs < 0) || (nobjs > 2)) SWIG_fail;
+  if (swig_obj[0]) {
+    ecode1 = SWIG_AsVal_double(swig_obj[0], &val1);
+    if (!SWIG_IsOK(ecode1)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_BDF2" "', argument " "1"" of type '" "real""'");
+    } 
+    arg1 = static_cast< real >(val1);
+  }
+  if (swig_obj[1]) {
+    {
+      arg2 = convert_datetime_to_cmftime(swig_obj[1]);
+      if (arg2 == cmf::math::never)  {
+        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+      }
+    }
+  }
+  {
+    try {
+      result = (cmf::math::BDF2 *)new cmf::math::BDF2(arg1,arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__BDF2, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_BDF2__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::StateVariableOwner *arg1 = 0 ;
+  real arg2 = (real) 1e-9 ;
+  cmf::math::Time arg3 = (cmf::math::Time) cmf::math::timespan(10) ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  cmf::math::BDF2 *result = 0 ;
+  
+  if ((nobjs < 1) || (nobjs > 3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_BDF2" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_BDF2" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
+  if (swig_obj[1]) {
+    ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_BDF2" "', argument " "2"" of type '" "real""'");
+    } 
+    arg2 = static_cast< real >(val2);
+  }
+  if (swig_obj[2]) {
+    {
+      arg3 = convert_datetime_to_cmftime(swig_obj[2]);
+      if (arg3 == cmf::math::never)  {
+        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+      }
+    }
+  }
+  {
+    try {
+      result = (cmf::math::BDF2 *)new cmf::math::BDF2(*arg1,arg2,arg3);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__BDF2, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_BDF2__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  cmf::math::BDF2 *result = 0 ;
+  
+  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_BDF2" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_BDF2" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = (cmf::math::BDF2 *)new cmf::math::BDF2((cmf::math::Integrator const &)*arg1);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__BDF2, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_BDF2(PyObject *self, PyObject *args) {
+  Py_ssize_t argc;
+  PyObject *argv[4] = {
+    0
+  };
+  
+  if (!(argc = SWIG_Python_UnpackTuple(args, "new_BDF2", 0, 3, argv))) SWIG_fail;
+  --argc;
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if ((argc >= 0) && (argc <= 2)) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      if (argc > 0) {
+        {
+          {
+            int res = SWIG_AsVal_double(argv[0], NULL);
+            _v = SWIG_CheckState(res);
+          }
+        }
+        if (!_v) goto check_1;
+        _ranki += _v*_pi;
+        _rankm += _pi;
+        _pi *= SWIG_MAXCASTRANK;
+        if (argc > 1) {
+          {
+            {
+              _v = check_time(argv[1]);
+            }
+          }
+          if (!_v) goto check_1;
+          _ranki += _v*_pi;
+          _rankm += _pi;
+          _pi *= SWIG_MAXCASTRANK;
+        }
+      }
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if ((argc >= 1) && (argc <= 3)) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (argc > 1) {
+        {
+          {
+            int res = SWIG_AsVal_double(argv[1], NULL);
+            _v = SWIG_CheckState(res);
+          }
+        }
+        if (!_v) goto check_2;
+        _ranki += _v*_pi;
+        _rankm += _pi;
+        _pi *= SWIG_MAXCASTRANK;
+        if (argc > 2) {
+          {
+            {
+              _v = check_time(argv[2]);
+            }
+          }
+          if (!_v) goto check_2;
+          _ranki += _v*_pi;
+          _rankm += _pi;
+          _pi *= SWIG_MAXCASTRANK;
+        }
+      }
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+    if (argc == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 3;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_3:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      return _wrap_new_BDF2__SWIG_0(self, argc, argv);
+    case 2:
+      return _wrap_new_BDF2__SWIG_1(self, argc, argv);
+    case 3:
+      return _wrap_new_BDF2__SWIG_2(self, argc, argv);
+    }
+  }
+  
+fail:
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_BDF2'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    cmf::math::BDF2::BDF2(real,cmf::math::Time)\n"
+    "    cmf::math::BDF2::BDF2(cmf::math::StateVariableOwner &,real,cmf::math::Time)\n"
+    "    cmf::math::BDF2::BDF2(cmf::math::Integrator const &)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_BDF2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::BDF2 *arg1 = (cmf::math::BDF2 *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__BDF2, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_BDF2" "', argument " "1"" of type '" "cmf::math::BDF2 *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::BDF2 * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *BDF2_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__BDF2, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *BDF2_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_new_ExplicitEuler_fixed__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::StateVariableOwner *arg1 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  cmf::math::ExplicitEuler_fixed *result = 0 ;
+  
+  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_ExplicitEuler_fixed" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_ExplicitEuler_fixed" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
+  {
+    try {
+      result = (cmf::math::ExplicitEuler_fixed *)new cmf::math::ExplicitEuler_fixed(*arg1);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ExplicitEuler_fixed, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_ExplicitEuler_fixed__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **SWIGUNUSEDPARM(swig_obj)) {
+  PyObject *resultobj = 0;
+  cmf::math::ExplicitEuler_fixed *result = 0 ;
+  
+  if ((nobjs < 0) || (nobjs > 0)) SWIG_fail;
+  {
+    try {
+      result = (cmf::math::ExplicitEuler_fixed *)new cmf::math::ExplicitEuler_fixed();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ExplicitEuler_fixed, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_ExplicitEuler_fixed__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  cmf::math::ExplicitEuler_fixed *result = 0 ;
+  
+  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_ExplicitEuler_fixed" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_ExplicitEuler_fixed" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = (cmf::math::ExplicitEuler_fixed *)new cmf::math::ExplicitEuler_fixed((cmf::math::Integrator const &)*arg1);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ExplicitEuler_fixed, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_ExplicitEuler_fixed(PyObject *self, PyObject *args) {
+  Py_ssize_t argc;
+  PyObject *argv[2] = {
+    0
+  };
+  
+  if (!(argc = SWIG_Python_UnpackTuple(args, "new_ExplicitEuler_fixed", 0, 1, argv))) SWIG_fail;
+  --argc;
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (argc == 0) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+    if (argc == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+    if (argc == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 3;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_3:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      return _wrap_new_ExplicitEuler_fixed__SWIG_1(self, argc, argv);
+    case 2:
+      return _wrap_new_ExplicitEuler_fixed__SWIG_0(self, argc, argv);
+    case 3:
+      return _wrap_new_ExplicitEuler_fixed__SWIG_2(self, argc, argv);
+    }
+  }
+  
+fail:
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_ExplicitEuler_fixed'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    cmf::math::ExplicitEuler_fixed::ExplicitEuler_fixed(cmf::math::StateVariableOwner &)\n"
+    "    cmf::math::ExplicitEuler_fixed::ExplicitEuler_fixed()\n"
+    "    cmf::math::ExplicitEuler_fixed::ExplicitEuler_fixed(cmf::math::Integrator const &)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_ExplicitEuler_fixed(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::ExplicitEuler_fixed *arg1 = (cmf::math::ExplicitEuler_fixed *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ExplicitEuler_fixed, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_ExplicitEuler_fixed" "', argument " "1"" of type '" "cmf::math::ExplicitEuler_fixed *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::ExplicitEuler_fixed * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *ExplicitEuler_fixed_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__ExplicitEuler_fixed, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *ExplicitEuler_fixed_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_HeunIntegrator_alpha_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::HeunIntegrator *arg1 = (cmf::math::HeunIntegrator *) 0 ;
+  real arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "HeunIntegrator_alpha_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__HeunIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "HeunIntegrator_alpha_set" "', argument " "1"" of type '" "cmf::math::HeunIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::HeunIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "HeunIntegrator_alpha_set" "', argument " "2"" of type '" "real""'");
+  } 
+  arg2 = static_cast< real >(val2);
+  if (arg1) (arg1)->alpha = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_HeunIntegrator_alpha_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::HeunIntegrator *arg1 = (cmf::math::HeunIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  real result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__HeunIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "HeunIntegrator_alpha_get" "', argument " "1"" of type '" "cmf::math::HeunIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::HeunIntegrator * >(argp1);
+  result = (real) ((arg1)->alpha);
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_HeunIntegrator__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::StateVariableOwner *arg1 = 0 ;
+  real arg2 = (real) 0.5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  cmf::math::HeunIntegrator *result = 0 ;
+  
+  if ((nobjs < 1) || (nobjs > 2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_HeunIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_HeunIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
+  if (swig_obj[1]) {
+    ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_HeunIntegrator" "', argument " "2"" of type '" "real""'");
+    } 
+    arg2 = static_cast< real >(val2);
+  }
+  {
+    try {
+      result = (cmf::math::HeunIntegrator *)new cmf::math::HeunIntegrator(*arg1,arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__HeunIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_HeunIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  real arg1 = (real) 0.5 ;
+  double val1 ;
+  int ecode1 = 0 ;
+  cmf::math::HeunIntegrator *result = 0 ;
+  
+  if ((nobjs < 0) || (nobjs > 1)) SWIG_fail;
+  if (swig_obj[0]) {
+    ecode1 = SWIG_AsVal_double(swig_obj[0], &val1);
+    if (!SWIG_IsOK(ecode1)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_HeunIntegrator" "', argument " "1"" of type '" "real""'");
+    } 
+    arg1 = static_cast< real >(val1);
+  }
+  {
+    try {
+      result = (cmf::math::HeunIntegrator *)new cmf::math::HeunIntegrator(arg1);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__HeunIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_HeunIntegrator__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  cmf::math::HeunIntegrator *result = 0 ;
+  
+  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_HeunIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_HeunIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = (cmf::math::HeunIntegrator *)new cmf::math::HeunIntegrator((cmf::math::Integrator const &)*arg1);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__HeunIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_HeunIntegrator(PyObject *self, PyObject *args) {
+  Py_ssize_t argc;
+  PyObject *argv[3] = {
+    0
+  };
+  
+  if (!(argc = SWIG_Python_UnpackTuple(args, "new_HeunIntegrator", 0, 2, argv))) SWIG_fail;
+  --argc;
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if ((argc >= 0) && (argc <= 1)) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      if (argc > 0) {
+        {
+          {
+            int res = SWIG_AsVal_double(argv[0], NULL);
+            _v = SWIG_CheckState(res);
+          }
+        }
+        if (!_v) goto check_1;
+        _ranki += _v*_pi;
+        _rankm += _pi;
+        _pi *= SWIG_MAXCASTRANK;
+      }
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if ((argc >= 1) && (argc <= 2)) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (argc > 1) {
+        {
+          {
+            int res = SWIG_AsVal_double(argv[1], NULL);
+            _v = SWIG_CheckState(res);
+          }
+        }
+        if (!_v) goto check_2;
+        _ranki += _v*_pi;
+        _rankm += _pi;
+        _pi *= SWIG_MAXCASTRANK;
+      }
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+    if (argc == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 3;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_3:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      return _wrap_new_HeunIntegrator__SWIG_1(self, argc, argv);
+    case 2:
+      return _wrap_new_HeunIntegrator__SWIG_0(self, argc, argv);
+    case 3:
+      return _wrap_new_HeunIntegrator__SWIG_2(self, argc, argv);
+    }
+  }
+  
+fail:
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_HeunIntegrator'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    cmf::math::HeunIntegrator::HeunIntegrator(cmf::math::StateVariableOwner &,real)\n"
+    "    cmf::math::HeunIntegrator::HeunIntegrator(real)\n"
+    "    cmf::math::HeunIntegrator::HeunIntegrator(cmf::math::Integrator const &)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_HeunIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::HeunIntegrator *arg1 = (cmf::math::HeunIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__HeunIntegrator, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_HeunIntegrator" "', argument " "1"" of type '" "cmf::math::HeunIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::HeunIntegrator * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *HeunIntegrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__HeunIntegrator, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *HeunIntegrator_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_ImplicitEuler_dt_min_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::ImplicitEuler *arg1 = (cmf::math::ImplicitEuler *) 0 ;
+  cmf::math::Time *arg2 = (cmf::math::Time *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "ImplicitEuler_dt_min_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ImplicitEuler, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "ImplicitEuler_dt_min_set" "', argument " "1"" of type '" "cmf::math::ImplicitEuler *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::ImplicitEuler * >(argp1);
+  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2,SWIGTYPE_p_cmf__math__Time, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "ImplicitEuler_dt_min_set" "', argument " "2"" of type '" "cmf::math::Time *""'"); 
+  }
+  arg2 = reinterpret_cast< cmf::math::Time * >(argp2);
+  if (arg1) (arg1)->dt_min = *arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_ImplicitEuler_dt_min_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::ImplicitEuler *arg1 = (cmf::math::ImplicitEuler *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::Time *result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ImplicitEuler, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "ImplicitEuler_dt_min_get" "', argument " "1"" of type '" "cmf::math::ImplicitEuler *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::ImplicitEuler * >(argp1);
+  result = (cmf::math::Time *)& ((arg1)->dt_min);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__Time, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_ImplicitEuler_use_newton_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::ImplicitEuler *arg1 = (cmf::math::ImplicitEuler *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "ImplicitEuler_use_newton_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ImplicitEuler, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "ImplicitEuler_use_newton_set" "', argument " "1"" of type '" "cmf::math::ImplicitEuler *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::ImplicitEuler * >(argp1);
+  ecode2 = SWIG_AsVal_bool(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "ImplicitEuler_use_newton_set" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->use_newton = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_ImplicitEuler_use_newton_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::ImplicitEuler *arg1 = (cmf::math::ImplicitEuler *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ImplicitEuler, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "ImplicitEuler_use_newton_get" "', argument " "1"" of type '" "cmf::math::ImplicitEuler *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::ImplicitEuler * >(argp1);
+  result = (bool) ((arg1)->use_newton);
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_ImplicitEuler__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::StateVariableOwner *arg1 = 0 ;
+  real arg2 = (real) 1e-9 ;
+  cmf::math::Time arg3 = (cmf::math::Time) cmf::math::timespan(10) ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  cmf::math::ImplicitEuler *result = 0 ;
+  
+  if ((nobjs < 1) || (nobjs > 3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_ImplicitEuler" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_ImplicitEuler" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
+  if (swig_obj[1]) {
+    ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_ImplicitEuler" "', argument " "2"" of type '" "real""'");
+    } 
+    arg2 = static_cast< real >(val2);
+  }
+  if (swig_obj[2]) {
+    {
+      arg3 = convert_datetime_to_cmftime(swig_obj[2]);
+      if (arg3 == cmf::math::never)  {
+        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+      }
+    }
+  }
+  {
+    try {
+      result = (cmf::math::ImplicitEuler *)new cmf::math::ImplicitEuler(*arg1,arg2,arg3);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ImplicitEuler, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_ImplicitEuler__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  real arg1 = (real) 1e-9 ;
+  cmf::math::Time arg2 = (cmf::math::Time) cmf::math::timespan(10) ;
+  double val1 ;
+  int ecode1 = 0 ;
+  cmf::math::ImplicitEuler *result = 0 ;
+  
+  if ((nobjs < 0) || (nobjs > 2)) SWIG_fail;
+  if (swig_obj[0]) {
+    ecode1 = SWIG_AsVal_double(swig_obj[0], &val1);
+    if (!SWIG_IsOK(ecode1)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_ImplicitEuler" "', argument " "1"" of type '" "real""'");
+    } 
+    arg1 = static_cast< real >(val1);
+  }
+  if (swig_obj[1]) {
+    {
+      arg2 = convert_datetime_to_cmftime(swig_obj[1]);
+      if (arg2 == cmf::math::never)  {
+        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+      }
+    }
+  }
+  {
+    try {
+      result = (cmf::math::ImplicitEuler *)new cmf::math::ImplicitEuler(arg1,arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ImplicitEuler, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_ImplicitEuler__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  cmf::math::ImplicitEuler *result = 0 ;
+  
+  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_ImplicitEuler" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_ImplicitEuler" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = (cmf::math::ImplicitEuler *)new cmf::math::ImplicitEuler((cmf::math::Integrator const &)*arg1);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ImplicitEuler, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_ImplicitEuler(PyObject *self, PyObject *args) {
+  Py_ssize_t argc;
+  PyObject *argv[4] = {
+    0
+  };
+  
+  if (!(argc = SWIG_Python_UnpackTuple(args, "new_ImplicitEuler", 0, 3, argv))) SWIG_fail;
+  --argc;
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if ((argc >= 0) && (argc <= 2)) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      if (argc > 0) {
+        {
+          {
+            int res = SWIG_AsVal_double(argv[0], NULL);
+            _v = SWIG_CheckState(res);
+          }
+        }
+        if (!_v) goto check_1;
+        _ranki += _v*_pi;
+        _rankm += _pi;
+        _pi *= SWIG_MAXCASTRANK;
+        if (argc > 1) {
+          {
+            {
+              _v = check_time(argv[1]);
+            }
+          }
+          if (!_v) goto check_1;
+          _ranki += _v*_pi;
+          _rankm += _pi;
+          _pi *= SWIG_MAXCASTRANK;
+        }
+      }
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if ((argc >= 1) && (argc <= 3)) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (argc > 1) {
+        {
+          {
+            int res = SWIG_AsVal_double(argv[1], NULL);
+            _v = SWIG_CheckState(res);
+          }
+        }
+        if (!_v) goto check_2;
+        _ranki += _v*_pi;
+        _rankm += _pi;
+        _pi *= SWIG_MAXCASTRANK;
+        if (argc > 2) {
+          {
+            {
+              _v = check_time(argv[2]);
+            }
+          }
+          if (!_v) goto check_2;
+          _ranki += _v*_pi;
+          _rankm += _pi;
+          _pi *= SWIG_MAXCASTRANK;
+        }
+      }
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+    if (argc == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 3;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_3:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      return _wrap_new_ImplicitEuler__SWIG_1(self, argc, argv);
+    case 2:
+      return _wrap_new_ImplicitEuler__SWIG_0(self, argc, argv);
+    case 3:
+      return _wrap_new_ImplicitEuler__SWIG_2(self, argc, argv);
+    }
+  }
+  
+fail:
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_ImplicitEuler'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    cmf::math::ImplicitEuler::ImplicitEuler(cmf::math::StateVariableOwner &,real,cmf::math::Time)\n"
+    "    cmf::math::ImplicitEuler::ImplicitEuler(real,cmf::math::Time)\n"
+    "    cmf::math::ImplicitEuler::ImplicitEuler(cmf::math::Integrator const &)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_ImplicitEuler(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::ImplicitEuler *arg1 = (cmf::math::ImplicitEuler *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ImplicitEuler, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_ImplicitEuler" "', argument " "1"" of type '" "cmf::math::ImplicitEuler *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::ImplicitEuler * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *ImplicitEuler_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__ImplicitEuler, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *ImplicitEuler_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_new_RKFIntegrator__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::StateVariableOwner *arg1 = 0 ;
+  real arg2 = (real) 1e-9 ;
+  cmf::math::Time arg3 = (cmf::math::Time) cmf::math::timespan(1000) ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  cmf::math::RKFIntegrator *result = 0 ;
+  
+  if ((nobjs < 1) || (nobjs > 3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_RKFIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_RKFIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
+  if (swig_obj[1]) {
+    ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_RKFIntegrator" "', argument " "2"" of type '" "real""'");
+    } 
+    arg2 = static_cast< real >(val2);
+  }
+  if (swig_obj[2]) {
+    {
+      arg3 = convert_datetime_to_cmftime(swig_obj[2]);
+      if (arg3 == cmf::math::never)  {
+        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+      }
+    }
+  }
+  {
+    try {
+      result = (cmf::math::RKFIntegrator *)new cmf::math::RKFIntegrator(*arg1,arg2,arg3);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__RKFIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_RKFIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  real arg1 = (real) 1e-9 ;
+  cmf::math::Time arg2 = (cmf::math::Time) cmf::math::timespan(1000) ;
+  double val1 ;
+  int ecode1 = 0 ;
+  cmf::math::RKFIntegrator *result = 0 ;
+  
+  if ((nobjs < 0) || (nobjs > 2)) SWIG_fail;
+  if (swig_obj[0]) {
+    ecode1 = SWIG_AsVal_double(swig_obj[0], &val1);
+    if (!SWIG_IsOK(ecode1)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_RKFIntegrator" "', argument " "1"" of type '" "real""'");
+    } 
+    arg1 = static_cast< real >(val1);
+  }
+  if (swig_obj[1]) {
+    {
+      arg2 = convert_datetime_to_cmftime(swig_obj[1]);
+      if (arg2 == cmf::math::never)  {
+        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+      }
+    }
+  }
+  {
+    try {
+      result = (cmf::math::RKFIntegrator *)new cmf::math::RKFIntegrator(arg1,arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__RKFIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_RKFIntegrator(PyObject *self, PyObject *args) {
+  Py_ssize_t argc;
+  PyObject *argv[4] = {
+    0
+  };
+  
+  if (!(argc = SWIG_Python_UnpackTuple(args, "new_RKFIntegrator", 0, 3, argv))) SWIG_fail;
+  --argc;
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if ((argc >= 0) && (argc <= 2)) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      if (argc > 0) {
+        {
+          {
+            int res = SWIG_AsVal_double(argv[0], NULL);
+            _v = SWIG_CheckState(res);
+          }
+        }
+        if (!_v) goto check_1;
+        _ranki += _v*_pi;
+        _rankm += _pi;
+        _pi *= SWIG_MAXCASTRANK;
+        if (argc > 1) {
+          {
+            {
+              _v = check_time(argv[1]);
+            }
+          }
+          if (!_v) goto check_1;
+          _ranki += _v*_pi;
+          _rankm += _pi;
+          _pi *= SWIG_MAXCASTRANK;
+        }
+      }
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if ((argc >= 1) && (argc <= 3)) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (argc > 1) {
+        {
+          {
+            int res = SWIG_AsVal_double(argv[1], NULL);
+            _v = SWIG_CheckState(res);
+          }
+        }
+        if (!_v) goto check_2;
+        _ranki += _v*_pi;
+        _rankm += _pi;
+        _pi *= SWIG_MAXCASTRANK;
+        if (argc > 2) {
+          {
+            {
+              _v = check_time(argv[2]);
+            }
+          }
+          if (!_v) goto check_2;
+          _ranki += _v*_pi;
+          _rankm += _pi;
+          _pi *= SWIG_MAXCASTRANK;
+        }
+      }
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      return _wrap_new_RKFIntegrator__SWIG_1(self, argc, argv);
+    case 2:
+      return _wrap_new_RKFIntegrator__SWIG_0(self, argc, argv);
+    }
+  }
+  
+fail:
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_RKFIntegrator'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    cmf::math::RKFIntegrator::RKFIntegrator(cmf::math::StateVariableOwner &,real,cmf::math::Time)\n"
+    "    cmf::math::RKFIntegrator::RKFIntegrator(real,cmf::math::Time)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_RKFIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::RKFIntegrator *arg1 = (cmf::math::RKFIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__RKFIntegrator, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_RKFIntegrator" "', argument " "1"" of type '" "cmf::math::RKFIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::RKFIntegrator * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *RKFIntegrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__RKFIntegrator, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *RKFIntegrator_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_preconditioner_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  char arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  char val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_preconditioner_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_preconditioner_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_char(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_preconditioner_set" "', argument " "2"" of type '" "char""'");
+  } 
+  arg2 = static_cast< char >(val2);
+  if (arg1) (arg1)->preconditioner = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_preconditioner_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  char result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_preconditioner_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  result = (char) ((arg1)->preconditioner);
+  resultobj = SWIG_From_char(static_cast< char >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_preconditioner_matrix_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  char arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  char val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_preconditioner_matrix_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_preconditioner_matrix_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_char(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_preconditioner_matrix_set" "', argument " "2"" of type '" "char""'");
+  } 
+  arg2 = static_cast< char >(val2);
+  if (arg1) (arg1)->preconditioner_matrix = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_preconditioner_matrix_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  char result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_preconditioner_matrix_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  result = (char) ((arg1)->preconditioner_matrix);
+  resultobj = SWIG_From_char(static_cast< char >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxNonLinearIterations_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_MaxNonLinearIterations_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxNonLinearIterations_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_MaxNonLinearIterations_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->MaxNonLinearIterations = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxNonLinearIterations_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxNonLinearIterations_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  result = (int) ((arg1)->MaxNonLinearIterations);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxConvergenceFailures_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_MaxConvergenceFailures_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxConvergenceFailures_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_MaxConvergenceFailures_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->MaxConvergenceFailures = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxConvergenceFailures_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxConvergenceFailures_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  result = (int) ((arg1)->MaxConvergenceFailures);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxErrorTestFailures_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_MaxErrorTestFailures_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxErrorTestFailures_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_MaxErrorTestFailures_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->MaxErrorTestFailures = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxErrorTestFailures_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxErrorTestFailures_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  result = (int) ((arg1)->MaxErrorTestFailures);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_maxl_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_maxl_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_maxl_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_maxl_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->maxl = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_maxl_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_maxl_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  result = (int) ((arg1)->maxl);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_LinearSolver_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_LinearSolver_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_LinearSolver_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_LinearSolver_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->LinearSolver = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_LinearSolver_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_LinearSolver_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  result = (int) ((arg1)->LinearSolver);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxOrder_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_MaxOrder_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxOrder_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_MaxOrder_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->MaxOrder = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxOrder_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxOrder_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  result = (int) ((arg1)->MaxOrder);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_max_step_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  cmf::math::Time *arg2 = (cmf::math::Time *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_max_step_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_max_step_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2,SWIGTYPE_p_cmf__math__Time, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CVodeIntegrator_max_step_set" "', argument " "2"" of type '" "cmf::math::Time *""'"); 
+  }
+  arg2 = reinterpret_cast< cmf::math::Time * >(argp2);
+  if (arg1) (arg1)->max_step = *arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_max_step_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::Time *result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_max_step_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  result = (cmf::math::Time *)& ((arg1)->max_step);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__Time, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_use_dense_output_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_use_dense_output_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_use_dense_output_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_bool(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_use_dense_output_set" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->use_dense_output = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_use_dense_output_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_use_dense_output_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  result = (bool) ((arg1)->use_dense_output);
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_profile_errors_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_profile_errors_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_profile_errors_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_bool(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_profile_errors_set" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->profile_errors = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_profile_errors_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_profile_errors_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  result = (bool) ((arg1)->profile_errors);
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_get_error_dominance(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::num_array result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_get_error_dominance" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::CVodeIntegrator const *)arg1)->get_error_dominance();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  {
+    resultobj = as_npy_array(result);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_get_error_share(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::num_array result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_get_error_share" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::CVodeIntegrator const *)arg1)->get_error_share();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  {
+    resultobj = as_npy_array(result);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_get_error_profile(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  size_t arg2 = (size_t) 10 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"count",  NULL 
+  };
+  std::string result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:CVodeIntegrator_get_error_profile", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_get_error_profile" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  if (obj1) {
+    ecode2 = SWIG_AsVal_size_t(obj1, &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_get_error_profile" "', argument " "2"" of type '" "size_t""'");
+    } 
+    arg2 = static_cast< size_t >(val2);
+  }
+  {
+    try {
+      result = ((cmf::math::CVodeIntegrator const *)arg1)->get_error_profile(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_clear_error_profile(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_clear_error_profile" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  {
+    try {
+      (arg1)->clear_error_profile();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_get_order(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_get_order" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  {
+    try {
+      result = (int)((cmf::math::CVodeIntegrator const *)arg1)->get_order();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_initialize(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_initialize" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  {
+    try {
+      (arg1)->initialize();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_release(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_release" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  {
+    try {
+      (arg1)->release();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_CVodeIntegrator__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  real arg1 = (real) 1e-9 ;
+  char arg2 = (char) 'R' ;
+  double val1 ;
+  int ecode1 = 0 ;
+  char val2 ;
+  int ecode2 = 0 ;
+  cmf::math::CVodeIntegrator *result = 0 ;
+  
+  if ((nobjs < 0) || (nobjs > 2)) SWIG_fail;
+  if (swig_obj[0]) {
+    ecode1 = SWIG_AsVal_double(swig_obj[0], &val1);
+    if (!SWIG_IsOK(ecode1)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_CVodeIntegrator" "', argument " "1"" of type '" "real""'");
+    } 
+    arg1 = static_cast< real >(val1);
+  }
+  if (swig_obj[1]) {
+    ecode2 = SWIG_AsVal_char(swig_obj[1], &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_CVodeIntegrator" "', argument " "2"" of type '" "char""'");
+    } 
+    arg2 = static_cast< char >(val2);
+  }
+  {
+    try {
+      result = (cmf::math::CVodeIntegrator *)new cmf::math::CVodeIntegrator(arg1,arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__CVodeIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_CVodeIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::StateVariableOwner *arg1 = 0 ;
+  real arg2 = (real) 1e-9 ;
+  char arg3 = (char) 'R' ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  char val3 ;
+  int ecode3 = 0 ;
+  cmf::math::CVodeIntegrator *result = 0 ;
+  
+  if ((nobjs < 1) || (nobjs > 3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_CVodeIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_CVodeIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
+  if (swig_obj[1]) {
+    ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_CVodeIntegrator" "', argument " "2"" of type '" "real""'");
+    } 
+    arg2 = static_cast< real >(val2);
+  }
+  if (swig_obj[2]) {
+    ecode3 = SWIG_AsVal_char(swig_obj[2], &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_CVodeIntegrator" "', argument " "3"" of type '" "char""'");
+    } 
+    arg3 = static_cast< char >(val3);
+  }
+  {
+    try {
+      result = (cmf::math::CVodeIntegrator *)new cmf::math::CVodeIntegrator(*arg1,arg2,arg3);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__CVodeIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_CVodeIntegrator__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  cmf::math::CVodeIntegrator *result = 0 ;
+  
+  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__CVodeIntegrator,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_CVodeIntegrator" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_CVodeIntegrator" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  {
+    try {
+      result = (cmf::math::CVodeIntegrator *)new cmf::math::CVodeIntegrator((cmf::math::CVodeIntegrator const &)*arg1);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__CVodeIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_CVodeIntegrator(PyObject *self, PyObject *args) {
+  Py_ssize_t argc;
+  PyObject *argv[4] = {
+    0
+  };
+  
+  if (!(argc = SWIG_Python_UnpackTuple(args, "new_CVodeIntegrator", 0, 3, argv))) SWIG_fail;
+  --argc;
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if ((argc >= 0) && (argc <= 2)) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      if (argc > 0) {
+        {
+          {
+            int res = SWIG_AsVal_double(argv[0], NULL);
+            _v = SWIG_CheckState(res);
+          }
+        }
+        if (!_v) goto check_1;
+        _ranki += _v*_pi;
+        _rankm += _pi;
+        _pi *= SWIG_MAXCASTRANK;
+        if (argc > 1) {
+          {
+            {
+              int res = SWIG_AsVal_char(argv[1], NULL);
+              _v = SWIG_CheckState(res);
+            }
           }
           if (!_v) goto check_1;
           _ranki += _v*_pi;
@@ -83118,105 +87584,1080 @@ SWIGINTERN PyObject *_wrap_new_BDF2(PyObject *self, PyObject *args) {
     }
   check_1:
     
-    if ((argc >= 1) && (argc <= 3)) {
+    if ((argc >= 1) && (argc <= 3)) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (argc > 1) {
+        {
+          {
+            int res = SWIG_AsVal_double(argv[1], NULL);
+            _v = SWIG_CheckState(res);
+          }
+        }
+        if (!_v) goto check_2;
+        _ranki += _v*_pi;
+        _rankm += _pi;
+        _pi *= SWIG_MAXCASTRANK;
+        if (argc > 2) {
+          {
+            {
+              int res = SWIG_AsVal_char(argv[2], NULL);
+              _v = SWIG_CheckState(res);
+            }
+          }
+          if (!_v) goto check_2;
+          _ranki += _v*_pi;
+          _rankm += _pi;
+          _pi *= SWIG_MAXCASTRANK;
+        }
+      }
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_2:
+    
+    if (argc == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__CVodeIntegrator, SWIG_POINTER_NO_NULL | 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 3;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_3:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      return _wrap_new_CVodeIntegrator__SWIG_0(self, argc, argv);
+    case 2:
+      return _wrap_new_CVodeIntegrator__SWIG_1(self, argc, argv);
+    case 3:
+      return _wrap_new_CVodeIntegrator__SWIG_2(self, argc, argv);
+    }
+  }
+  
+fail:
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_CVodeIntegrator'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    cmf::math::CVodeIntegrator::CVodeIntegrator(real,char)\n"
+    "    cmf::math::CVodeIntegrator::CVodeIntegrator(cmf::math::StateVariableOwner &,real,char)\n"
+    "    cmf::math::CVodeIntegrator::CVodeIntegrator(cmf::math::CVodeIntegrator const &)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_get_error(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::num_array result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_get_error" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::CVodeIntegrator const *)arg1)->get_error();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  {
+    resultobj = as_npy_array(result);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_get_nonlinear_iterations(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_get_nonlinear_iterations" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  {
+    try {
+      result = (int)((cmf::math::CVodeIntegrator const *)arg1)->get_nonlinear_iterations();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_get_rhsevals(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_get_rhsevals" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  {
+    try {
+      result = (int)((cmf::math::CVodeIntegrator const *)arg1)->get_rhsevals();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_CVodeIntegrator_copy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::CVodeIntegrator *result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_copy" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  {
+    try {
+      result = (cmf::math::CVodeIntegrator *)((cmf::math::CVodeIntegrator const *)arg1)->copy();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_CVodeIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_CVodeIntegrator" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *CVodeIntegrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__CVodeIntegrator, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *CVodeIntegrator_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_MultiIntegrator_copy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::MultiIntegrator *arg1 = (cmf::math::MultiIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::MultiIntegrator *result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__MultiIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "MultiIntegrator_copy" "', argument " "1"" of type '" "cmf::math::MultiIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::MultiIntegrator * >(argp1);
+  {
+    try {
+      result = (cmf::math::MultiIntegrator *)((cmf::math::MultiIntegrator const *)arg1)->copy();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__MultiIntegrator, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_MultiIntegrator_set_rate(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::MultiIntegrator *arg1 = (cmf::math::MultiIntegrator *) 0 ;
+  int arg2 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"integrator_position",  (char *)"rate",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:MultiIntegrator_set_rate", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__MultiIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "MultiIntegrator_set_rate" "', argument " "1"" of type '" "cmf::math::MultiIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::MultiIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "MultiIntegrator_set_rate" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "MultiIntegrator_set_rate" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
+  {
+    try {
+      (arg1)->set_rate(arg2,arg3);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_MultiIntegrator_get_rate(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::MultiIntegrator *arg1 = (cmf::math::MultiIntegrator *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"integrator_position",  NULL 
+  };
+  int result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:MultiIntegrator_get_rate", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__MultiIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "MultiIntegrator_get_rate" "', argument " "1"" of type '" "cmf::math::MultiIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::MultiIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "MultiIntegrator_get_rate" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try {
+      result = (int)((cmf::math::MultiIntegrator const *)arg1)->get_rate(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_MultiIntegrator_get_coupling_count(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::MultiIntegrator *arg1 = (cmf::math::MultiIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  size_t result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__MultiIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "MultiIntegrator_get_coupling_count" "', argument " "1"" of type '" "cmf::math::MultiIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::MultiIntegrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::MultiIntegrator const *)arg1)->get_coupling_count();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_MultiIntegrator_add_states_to_integrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::MultiIntegrator *arg1 = (cmf::math::MultiIntegrator *) 0 ;
+  cmf::math::StateVariableOwner *arg2 = 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"stateOwner",  (char *)"integrator_position",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:MultiIntegrator_add_states_to_integrator", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__MultiIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "MultiIntegrator_add_states_to_integrator" "', argument " "1"" of type '" "cmf::math::MultiIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::MultiIntegrator * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "MultiIntegrator_add_states_to_integrator" "', argument " "2"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "MultiIntegrator_add_states_to_integrator" "', argument " "2"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg2 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "MultiIntegrator_add_states_to_integrator" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
+  {
+    try {
+      (arg1)->add_states_to_integrator(*arg2,arg3);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_MultiIntegrator_distribute_states(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::MultiIntegrator *arg1 = (cmf::math::MultiIntegrator *) 0 ;
+  cmf::math::StateVariableOwner *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"stateOwner",  NULL 
+  };
+  size_t result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:MultiIntegrator_distribute_states", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__MultiIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "MultiIntegrator_distribute_states" "', argument " "1"" of type '" "cmf::math::MultiIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::MultiIntegrator * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "MultiIntegrator_distribute_states" "', argument " "2"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "MultiIntegrator_distribute_states" "', argument " "2"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg2 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp2);
+  {
+    try {
+      result = (arg1)->distribute_states(*arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_MultiIntegrator_get_state_count(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::MultiIntegrator *arg1 = (cmf::math::MultiIntegrator *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"integrator_position",  NULL 
+  };
+  size_t result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:MultiIntegrator_get_state_count", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__MultiIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "MultiIntegrator_get_state_count" "', argument " "1"" of type '" "cmf::math::MultiIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::MultiIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "MultiIntegrator_get_state_count" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try {
+      result = ((cmf::math::MultiIntegrator const *)arg1)->get_state_count(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_MultiIntegrator__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  cmf::math::MultiIntegrator *result = 0 ;
+  
+  if ((nobjs < 2) || (nobjs > 2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_MultiIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_MultiIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_MultiIntegrator" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try {
+      result = (cmf::math::MultiIntegrator *)new cmf::math::MultiIntegrator((cmf::math::Integrator const &)*arg1,arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__MultiIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_MultiIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = 0 ;
+  int arg2 ;
+  cmf::math::StateVariableOwner *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  cmf::math::MultiIntegrator *result = 0 ;
+  
+  if ((nobjs < 3) || (nobjs > 3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_MultiIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_MultiIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_MultiIntegrator" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  res3 = SWIG_ConvertPtr(swig_obj[2], &argp3, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_MultiIntegrator" "', argument " "3"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_MultiIntegrator" "', argument " "3"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg3 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp3);
+  {
+    try {
+      result = (cmf::math::MultiIntegrator *)new cmf::math::MultiIntegrator((cmf::math::Integrator const &)*arg1,arg2,*arg3);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__MultiIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_MultiIntegrator(PyObject *self, PyObject *args) {
+  Py_ssize_t argc;
+  PyObject *argv[4] = {
+    0
+  };
+  
+  if (!(argc = SWIG_Python_UnpackTuple(args, "new_MultiIntegrator", 0, 3, argv))) SWIG_fail;
+  --argc;
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (argc == 2) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        {
+          int res = SWIG_AsVal_int(argv[1], NULL);
+          _v = SWIG_CheckState(res);
+        }
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (argc == 3) {
       SWIG_TypeRank _ranki = 0;
       SWIG_TypeRank _rankm = 0;
       SWIG_TypeRank _pi = 1;
       int _v = 0;
       {
-        void *vptr = 0;
-        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
+        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
         _v = SWIG_CheckState(res);
       }
       if (!_v) goto check_2;
       _ranki += _v*_pi;
       _rankm += _pi;
       _pi *= SWIG_MAXCASTRANK;
-      if (argc > 1) {
+      {
         {
-          {
-            int res = SWIG_AsVal_double(argv[1], NULL);
-            _v = SWIG_CheckState(res);
-          }
-        }
-        if (!_v) goto check_2;
-        _ranki += _v*_pi;
-        _rankm += _pi;
-        _pi *= SWIG_MAXCASTRANK;
-        if (argc > 2) {
-          {
-            {
-              _v = check_time(argv[2]);
-            }
-          }
-          if (!_v) goto check_2;
-          _ranki += _v*_pi;
-          _rankm += _pi;
-          _pi *= SWIG_MAXCASTRANK;
+          int res = SWIG_AsVal_int(argv[1], NULL);
+          _v = SWIG_CheckState(res);
         }
       }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
       if (!_index || (_ranki < _rank)) {
         _rank = _ranki; _index = 2;
         if (_rank == _rankm) goto dispatch;
       }
-    }
-  check_2:
-    
-    if (argc == 1) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      SWIG_TypeRank _pi = 1;
-      int _v = 0;
+    }
+  check_2:
+    
+  dispatch:
+    switch(_index) {
+    case 1:
+      return _wrap_new_MultiIntegrator__SWIG_0(self, argc, argv);
+    case 2:
+      return _wrap_new_MultiIntegrator__SWIG_1(self, argc, argv);
+    }
+  }
+  
+fail:
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_MultiIntegrator'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    cmf::math::MultiIntegrator::MultiIntegrator(cmf::math::Integrator const &,int)\n"
+    "    cmf::math::MultiIntegrator::MultiIntegrator(cmf::math::Integrator const &,int,cmf::math::StateVariableOwner &)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_MultiIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::MultiIntegrator *arg1 = (cmf::math::MultiIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__MultiIntegrator, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_MultiIntegrator" "', argument " "1"" of type '" "cmf::math::MultiIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::MultiIntegrator * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *MultiIntegrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__MultiIntegrator, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *MultiIntegrator_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_SoluteWaterIntegrator_copy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SoluteWaterIntegrator *arg1 = (cmf::math::SoluteWaterIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::SoluteWaterIntegrator *result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SoluteWaterIntegrator_copy" "', argument " "1"" of type '" "cmf::math::SoluteWaterIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SoluteWaterIntegrator * >(argp1);
+  {
+    try {
+      result = (cmf::math::SoluteWaterIntegrator *)((cmf::math::SoluteWaterIntegrator const *)arg1)->copy();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_SoluteWaterIntegrator__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::water::solute_vector *arg1 = 0 ;
+  cmf::math::Integrator *arg2 = 0 ;
+  cmf::math::Integrator *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  cmf::math::SoluteWaterIntegrator *result = 0 ;
+  
+  if ((nobjs < 3) || (nobjs > 3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__water__solute_vector,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_SoluteWaterIntegrator" "', argument " "1"" of type '" "cmf::water::solute_vector const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "1"" of type '" "cmf::water::solute_vector const &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::water::solute_vector * >(argp1);
+  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_SoluteWaterIntegrator" "', argument " "2"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "2"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  arg2 = reinterpret_cast< cmf::math::Integrator * >(argp2);
+  res3 = SWIG_ConvertPtr(swig_obj[2], &argp3, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_SoluteWaterIntegrator" "', argument " "3"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "3"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  arg3 = reinterpret_cast< cmf::math::Integrator * >(argp3);
+  {
+    try {
+      result = (cmf::math::SoluteWaterIntegrator *)new cmf::math::SoluteWaterIntegrator((cmf::water::solute_vector const &)*arg1,(cmf::math::Integrator const &)*arg2,(cmf::math::Integrator const &)*arg3);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_SoluteWaterIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  SwigValueWrapper< cmf::water::solute_vector > arg1 ;
+  cmf::math::Integrator *arg2 = 0 ;
+  cmf::math::Integrator *arg3 = 0 ;
+  cmf::math::StateVariableOwner *arg4 = 0 ;
+  void *argp1 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  void *argp4 = 0 ;
+  int res4 = 0 ;
+  cmf::math::SoluteWaterIntegrator *result = 0 ;
+  
+  if ((nobjs < 4) || (nobjs > 4)) SWIG_fail;
+  {
+    res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__water__solute_vector,  0  | 0);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_SoluteWaterIntegrator" "', argument " "1"" of type '" "cmf::water::solute_vector""'"); 
+    }  
+    if (!argp1) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "1"" of type '" "cmf::water::solute_vector""'");
+    } else {
+      cmf::water::solute_vector * temp = reinterpret_cast< cmf::water::solute_vector * >(argp1);
+      arg1 = *temp;
+      if (SWIG_IsNewObj(res1)) delete temp;
+    }
+  }
+  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_SoluteWaterIntegrator" "', argument " "2"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "2"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  arg2 = reinterpret_cast< cmf::math::Integrator * >(argp2);
+  res3 = SWIG_ConvertPtr(swig_obj[2], &argp3, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_SoluteWaterIntegrator" "', argument " "3"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "3"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  arg3 = reinterpret_cast< cmf::math::Integrator * >(argp3);
+  res4 = SWIG_ConvertPtr(swig_obj[3], &argp4, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "new_SoluteWaterIntegrator" "', argument " "4"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp4) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "4"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg4 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp4);
+  {
+    try {
+      result = (cmf::math::SoluteWaterIntegrator *)new cmf::math::SoluteWaterIntegrator(arg1,(cmf::math::Integrator const &)*arg2,(cmf::math::Integrator const &)*arg3,*arg4);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_SoluteWaterIntegrator(PyObject *self, PyObject *args) {
+  Py_ssize_t argc;
+  PyObject *argv[5] = {
+    0
+  };
+  
+  if (!(argc = SWIG_Python_UnpackTuple(args, "new_SoluteWaterIntegrator", 0, 4, argv))) SWIG_fail;
+  --argc;
+  {
+    unsigned long _index = 0;
+    SWIG_TypeRank _rank = 0; 
+    if (argc == 3) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__water__solute_vector, SWIG_POINTER_NO_NULL | 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_ConvertPtr(argv[2], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_1;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 1;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_1:
+    
+    if (argc == 4) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__water__solute_vector, SWIG_POINTER_NO_NULL | 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      {
+        int res = SWIG_ConvertPtr(argv[2], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_2;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
       {
-        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[3], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
         _v = SWIG_CheckState(res);
       }
-      if (!_v) goto check_3;
+      if (!_v) goto check_2;
       _ranki += _v*_pi;
       _rankm += _pi;
       _pi *= SWIG_MAXCASTRANK;
       if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 3;
+        _rank = _ranki; _index = 2;
         if (_rank == _rankm) goto dispatch;
       }
     }
-  check_3:
+  check_2:
     
   dispatch:
     switch(_index) {
     case 1:
-      return _wrap_new_BDF2__SWIG_0(self, argc, argv);
+      return _wrap_new_SoluteWaterIntegrator__SWIG_0(self, argc, argv);
     case 2:
-      return _wrap_new_BDF2__SWIG_1(self, argc, argv);
-    case 3:
-      return _wrap_new_BDF2__SWIG_2(self, argc, argv);
+      return _wrap_new_SoluteWaterIntegrator__SWIG_1(self, argc, argv);
     }
   }
   
 fail:
-  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_BDF2'.\n"
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_SoluteWaterIntegrator'.\n"
     "  Possible C/C++ prototypes are:\n"
-    "    cmf::math::BDF2::BDF2(real,cmf::math::Time)\n"
-    "    cmf::math::BDF2::BDF2(cmf::math::StateVariableOwner &,real,cmf::math::Time)\n"
-    "    cmf::math::BDF2::BDF2(cmf::math::Integrator const &)\n");
+    "    cmf::math::SoluteWaterIntegrator::SoluteWaterIntegrator(cmf::water::solute_vector const &,cmf::math::Integrator const &,cmf::math::Integrator const &)\n"
+    "    cmf::math::SoluteWaterIntegrator::SoluteWaterIntegrator(cmf::water::solute_vector,cmf::math::Integrator const &,cmf::math::Integrator const &,cmf::math::StateVariableOwner &)\n");
   return 0;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_BDF2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_SoluteWaterIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::BDF2 *arg1 = (cmf::math::BDF2 *) 0 ;
+  cmf::math::SoluteWaterIntegrator *arg1 = (cmf::math::SoluteWaterIntegrator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__BDF2, SWIG_POINTER_DISOWN |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_BDF2" "', argument " "1"" of type '" "cmf::math::BDF2 *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_SoluteWaterIntegrator" "', argument " "1"" of type '" "cmf::math::SoluteWaterIntegrator *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::BDF2 * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::SoluteWaterIntegrator * >(argp1);
   {
     try {
       delete arg1;
@@ -83234,36 +88675,124 @@ fail:
 }
 
 
-SWIGINTERN PyObject *BDF2_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SoluteWaterIntegrator_to_string(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SoluteWaterIntegrator *arg1 = (cmf::math::SoluteWaterIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  std::string result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SoluteWaterIntegrator_to_string" "', argument " "1"" of type '" "cmf::math::SoluteWaterIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SoluteWaterIntegrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::SoluteWaterIntegrator const *)arg1)->to_string();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *SoluteWaterIntegrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *obj;
   if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__BDF2, SWIG_NewClientData(obj));
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, SWIG_NewClientData(obj));
   return SWIG_Py_Void();
 }
 
-SWIGINTERN PyObject *BDF2_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *SoluteWaterIntegrator_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   return SWIG_Python_InitShadowInstance(args);
 }
 
-SWIGINTERN PyObject *_wrap_new_ExplicitEuler_fixed__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_SparseJacobian_use_flux_derivatives_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::StateVariableOwner *arg1 = 0 ;
+  cmf::math::SparseJacobian *arg1 = (cmf::math::SparseJacobian *) 0 ;
+  bool arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  cmf::math::ExplicitEuler_fixed *result = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
   
-  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_Python_UnpackTuple(args, "SparseJacobian_use_flux_derivatives_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SparseJacobian, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_ExplicitEuler_fixed" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseJacobian_use_flux_derivatives_set" "', argument " "1"" of type '" "cmf::math::SparseJacobian *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SparseJacobian * >(argp1);
+  ecode2 = SWIG_AsVal_bool(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SparseJacobian_use_flux_derivatives_set" "', argument " "2"" of type '" "bool""'");
+  } 
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->use_flux_derivatives = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SparseJacobian_use_flux_derivatives_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SparseJacobian *arg1 = (cmf::math::SparseJacobian *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  bool result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SparseJacobian, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseJacobian_use_flux_derivatives_get" "', argument " "1"" of type '" "cmf::math::SparseJacobian *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SparseJacobian * >(argp1);
+  result = (bool) ((arg1)->use_flux_derivatives);
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_SparseJacobian(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  char * kwnames[] = {
+    (char *)"integ",  NULL 
+  };
+  cmf::math::SparseJacobian *result = 0 ;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:new_SparseJacobian", kwnames, &obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_SparseJacobian" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
   }
   if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_ExplicitEuler_fixed" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SparseJacobian" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
   {
     try {
-      result = (cmf::math::ExplicitEuler_fixed *)new cmf::math::ExplicitEuler_fixed(*arg1);
+      result = (cmf::math::SparseJacobian *)new cmf::math::SparseJacobian((cmf::math::Integrator const &)*arg1);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -83271,21 +88800,31 @@ SWIGINTERN PyObject *_wrap_new_ExplicitEuler_fixed__SWIG_0(PyObject *SWIGUNUSEDP
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ExplicitEuler_fixed, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__SparseJacobian, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_ExplicitEuler_fixed__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **SWIGUNUSEDPARM(swig_obj)) {
+SWIGINTERN PyObject *_wrap_SparseJacobian_size(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::ExplicitEuler_fixed *result = 0 ;
+  cmf::math::SparseJacobian *arg1 = (cmf::math::SparseJacobian *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  size_t result;
   
-  if ((nobjs < 0) || (nobjs > 0)) SWIG_fail;
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SparseJacobian, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseJacobian_size" "', argument " "1"" of type '" "cmf::math::SparseJacobian const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SparseJacobian * >(argp1);
   {
     try {
-      result = (cmf::math::ExplicitEuler_fixed *)new cmf::math::ExplicitEuler_fixed();
+      result = ((cmf::math::SparseJacobian const *)arg1)->size();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -83293,32 +88832,63 @@ SWIGINTERN PyObject *_wrap_new_ExplicitEuler_fixed__SWIG_1(PyObject *SWIGUNUSEDP
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ExplicitEuler_fixed, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_ExplicitEuler_fixed__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_SparseJacobian_nonzeros(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = 0 ;
+  cmf::math::SparseJacobian *arg1 = (cmf::math::SparseJacobian *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  cmf::math::ExplicitEuler_fixed *result = 0 ;
+  PyObject *swig_obj[1] ;
+  size_t result;
   
-  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SparseJacobian, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_ExplicitEuler_fixed" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseJacobian_nonzeros" "', argument " "1"" of type '" "cmf::math::SparseJacobian const *""'"); 
   }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_ExplicitEuler_fixed" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  arg1 = reinterpret_cast< cmf::math::SparseJacobian * >(argp1);
+  {
+    try {
+      result = ((cmf::math::SparseJacobian const *)arg1)->nonzeros();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SparseJacobian_color_count(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SparseJacobian *arg1 = (cmf::math::SparseJacobian *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  size_t result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SparseJacobian, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseJacobian_color_count" "', argument " "1"" of type '" "cmf::math::SparseJacobian const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SparseJacobian * >(argp1);
   {
     try {
-      result = (cmf::math::ExplicitEuler_fixed *)new cmf::math::ExplicitEuler_fixed((cmf::math::Integrator const &)*arg1);
+      result = ((cmf::math::SparseJacobian const *)arg1)->color_count();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -83326,108 +88896,277 @@ SWIGINTERN PyObject *_wrap_new_ExplicitEuler_fixed__SWIG_2(PyObject *SWIGUNUSEDP
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ExplicitEuler_fixed, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_ExplicitEuler_fixed(PyObject *self, PyObject *args) {
-  Py_ssize_t argc;
-  PyObject *argv[2] = {
-    0
+SWIGINTERN PyObject *_wrap_SparseJacobian_derived_columns(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SparseJacobian *arg1 = (cmf::math::SparseJacobian *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  size_t result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SparseJacobian, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseJacobian_derived_columns" "', argument " "1"" of type '" "cmf::math::SparseJacobian const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SparseJacobian * >(argp1);
+  {
+    try {
+      result = ((cmf::math::SparseJacobian const *)arg1)->derived_columns();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SparseJacobian_calculate(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::SparseJacobian *arg1 = (cmf::math::SparseJacobian *) 0 ;
+  cmf::math::Integrator *arg2 = 0 ;
+  cmf::math::Time arg3 ;
+  real arg4 = (real) 1e-6 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  double val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"integ",  (char *)"t",  (char *)"delta",  NULL 
   };
   
-  if (!(argc = SWIG_Python_UnpackTuple(args, "new_ExplicitEuler_fixed", 0, 1, argv))) SWIG_fail;
-  --argc;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO|O:SparseJacobian_calculate", kwnames, &obj0, &obj1, &obj2, &obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__SparseJacobian, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseJacobian_calculate" "', argument " "1"" of type '" "cmf::math::SparseJacobian *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SparseJacobian * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_cmf__math__Integrator,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SparseJacobian_calculate" "', argument " "2"" of type '" "cmf::math::Integrator &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "SparseJacobian_calculate" "', argument " "2"" of type '" "cmf::math::Integrator &""'"); 
+  }
+  arg2 = reinterpret_cast< cmf::math::Integrator * >(argp2);
   {
-    unsigned long _index = 0;
-    SWIG_TypeRank _rank = 0; 
-    if (argc == 0) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 1;
-        if (_rank == _rankm) goto dispatch;
-      }
+    arg3 = convert_datetime_to_cmftime(obj2);
+    if (arg3 == cmf::math::never)  {
+      SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
     }
-    if (argc == 1) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      SWIG_TypeRank _pi = 1;
-      int _v = 0;
-      {
-        void *vptr = 0;
-        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (!_v) goto check_2;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
-      if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 2;
-        if (_rank == _rankm) goto dispatch;
-      }
+  }
+  if (obj3) {
+    ecode4 = SWIG_AsVal_double(obj3, &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "SparseJacobian_calculate" "', argument " "4"" of type '" "real""'");
+    } 
+    arg4 = static_cast< real >(val4);
+  }
+  {
+    try {
+      (arg1)->calculate(*arg2,arg3,arg4);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
     }
-  check_2:
     
-    if (argc == 1) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      SWIG_TypeRank _pi = 1;
-      int _v = 0;
-      {
-        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
-        _v = SWIG_CheckState(res);
-      }
-      if (!_v) goto check_3;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
-      if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 3;
-        if (_rank == _rankm) goto dispatch;
-      }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SparseJacobian_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::SparseJacobian *arg1 = (cmf::math::SparseJacobian *) 0 ;
+  size_t arg2 ;
+  size_t arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  size_t val2 ;
+  int ecode2 = 0 ;
+  size_t val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"i",  (char *)"j",  NULL 
+  };
+  real result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:SparseJacobian_get", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__SparseJacobian, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseJacobian_get" "', argument " "1"" of type '" "cmf::math::SparseJacobian const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SparseJacobian * >(argp1);
+  ecode2 = SWIG_AsVal_size_t(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SparseJacobian_get" "', argument " "2"" of type '" "size_t""'");
+  } 
+  arg2 = static_cast< size_t >(val2);
+  ecode3 = SWIG_AsVal_size_t(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "SparseJacobian_get" "', argument " "3"" of type '" "size_t""'");
+  } 
+  arg3 = static_cast< size_t >(val3);
+  {
+    try {
+      result = (real)((cmf::math::SparseJacobian const *)arg1)->get(arg2,arg3);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
     }
-  check_3:
     
-  dispatch:
-    switch(_index) {
-    case 1:
-      return _wrap_new_ExplicitEuler_fixed__SWIG_1(self, argc, argv);
-    case 2:
-      return _wrap_new_ExplicitEuler_fixed__SWIG_0(self, argc, argv);
-    case 3:
-      return _wrap_new_ExplicitEuler_fixed__SWIG_2(self, argc, argv);
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SparseJacobian_get_values(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SparseJacobian *arg1 = (cmf::math::SparseJacobian *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::num_array result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SparseJacobian, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseJacobian_get_values" "', argument " "1"" of type '" "cmf::math::SparseJacobian const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SparseJacobian * >(argp1);
+  {
+    try {
+      result = ((cmf::math::SparseJacobian const *)arg1)->get_values();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  {
+    resultobj = as_npy_array(result);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SparseJacobian_get_columns(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SparseJacobian *arg1 = (cmf::math::SparseJacobian *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::num_array result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SparseJacobian, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseJacobian_get_columns" "', argument " "1"" of type '" "cmf::math::SparseJacobian const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SparseJacobian * >(argp1);
+  {
+    try {
+      result = ((cmf::math::SparseJacobian const *)arg1)->get_columns();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
     }
+    
   }
+  {
+    resultobj = as_npy_array(result);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SparseJacobian_get_row_start(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SparseJacobian *arg1 = (cmf::math::SparseJacobian *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::num_array result;
   
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SparseJacobian, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseJacobian_get_row_start" "', argument " "1"" of type '" "cmf::math::SparseJacobian const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SparseJacobian * >(argp1);
+  {
+    try {
+      result = ((cmf::math::SparseJacobian const *)arg1)->get_row_start();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  {
+    resultobj = as_npy_array(result);
+  }
+  return resultobj;
 fail:
-  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_ExplicitEuler_fixed'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    cmf::math::ExplicitEuler_fixed::ExplicitEuler_fixed(cmf::math::StateVariableOwner &)\n"
-    "    cmf::math::ExplicitEuler_fixed::ExplicitEuler_fixed()\n"
-    "    cmf::math::ExplicitEuler_fixed::ExplicitEuler_fixed(cmf::math::Integrator const &)\n");
-  return 0;
+  return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_ExplicitEuler_fixed(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_SparseJacobian(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::ExplicitEuler_fixed *arg1 = (cmf::math::ExplicitEuler_fixed *) 0 ;
+  cmf::math::SparseJacobian *arg1 = (cmf::math::SparseJacobian *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ExplicitEuler_fixed, SWIG_POINTER_DISOWN |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SparseJacobian, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_ExplicitEuler_fixed" "', argument " "1"" of type '" "cmf::math::ExplicitEuler_fixed *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_SparseJacobian" "', argument " "1"" of type '" "cmf::math::SparseJacobian *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::ExplicitEuler_fixed * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::SparseJacobian * >(argp1);
   {
     try {
       delete arg1;
@@ -83445,98 +89184,128 @@ fail:
 }
 
 
-SWIGINTERN PyObject *ExplicitEuler_fixed_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *SparseJacobian_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *obj;
   if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__ExplicitEuler_fixed, SWIG_NewClientData(obj));
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__SparseJacobian, SWIG_NewClientData(obj));
   return SWIG_Py_Void();
 }
 
-SWIGINTERN PyObject *ExplicitEuler_fixed_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *SparseJacobian_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   return SWIG_Python_InitShadowInstance(args);
 }
 
-SWIGINTERN PyObject *_wrap_HeunIntegrator_alpha_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_SparseLU(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  cmf::math::HeunIntegrator *arg1 = (cmf::math::HeunIntegrator *) 0 ;
-  real arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  double val2 ;
-  int ecode2 = 0 ;
-  PyObject *swig_obj[2] ;
+  cmf::math::num_array *arg1 = 0 ;
+  cmf::math::num_array *arg2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"row_start",  (char *)"columns",  NULL 
+  };
+  cmf::math::SparseLU *result = 0 ;
   
-  if (!SWIG_Python_UnpackTuple(args, "HeunIntegrator_alpha_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__HeunIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "HeunIntegrator_alpha_set" "', argument " "1"" of type '" "cmf::math::HeunIntegrator *""'"); 
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:new_SparseLU", kwnames, &obj0, &obj1)) SWIG_fail;
+  {
+    // Convert a array_wrapper from numpy array
+    double * data=0;
+    ptrdiff_t size = from_npy_array(obj0,&data); 
+    if (!data) {
+      SWIG_exception_fail(SWIG_TypeError,"Input data is not 'array-like' (in the sense of numpy arrays)");
+      return NULL;
+    }
+    arg1 = new cmf::math::num_array(size,data);
+  }
+  {
+    // Convert a array_wrapper from numpy array
+    double * data=0;
+    ptrdiff_t size = from_npy_array(obj1,&data); 
+    if (!data) {
+      SWIG_exception_fail(SWIG_TypeError,"Input data is not 'array-like' (in the sense of numpy arrays)");
+      return NULL;
+    }
+    arg2 = new cmf::math::num_array(size,data);
+  }
+  {
+    try {
+      result = (cmf::math::SparseLU *)new cmf::math::SparseLU((cmf::math::num_array const &)*arg1,(cmf::math::num_array const &)*arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__SparseLU, SWIG_POINTER_NEW |  0 );
+  {
+    delete arg1;
+  }
+  {
+    delete arg2;
   }
-  arg1 = reinterpret_cast< cmf::math::HeunIntegrator * >(argp1);
-  ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "HeunIntegrator_alpha_set" "', argument " "2"" of type '" "real""'");
-  } 
-  arg2 = static_cast< real >(val2);
-  if (arg1) (arg1)->alpha = arg2;
-  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
+  {
+    delete arg1;
+  }
+  {
+    delete arg2;
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_HeunIntegrator_alpha_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SparseLU_size(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::HeunIntegrator *arg1 = (cmf::math::HeunIntegrator *) 0 ;
+  cmf::math::SparseLU *arg1 = (cmf::math::SparseLU *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  real result;
+  size_t result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__HeunIntegrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SparseLU, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "HeunIntegrator_alpha_get" "', argument " "1"" of type '" "cmf::math::HeunIntegrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseLU_size" "', argument " "1"" of type '" "cmf::math::SparseLU const *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::HeunIntegrator * >(argp1);
-  result = (real) ((arg1)->alpha);
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  arg1 = reinterpret_cast< cmf::math::SparseLU * >(argp1);
+  {
+    try {
+      result = ((cmf::math::SparseLU const *)arg1)->size();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_HeunIntegrator__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_SparseLU_nonzeros(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::StateVariableOwner *arg1 = 0 ;
-  real arg2 = (real) 0.5 ;
+  cmf::math::SparseLU *arg1 = (cmf::math::SparseLU *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double val2 ;
-  int ecode2 = 0 ;
-  cmf::math::HeunIntegrator *result = 0 ;
+  PyObject *swig_obj[1] ;
+  size_t result;
   
-  if ((nobjs < 1) || (nobjs > 2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SparseLU, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_HeunIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
-  }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_HeunIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
-  if (swig_obj[1]) {
-    ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_HeunIntegrator" "', argument " "2"" of type '" "real""'");
-    } 
-    arg2 = static_cast< real >(val2);
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseLU_nonzeros" "', argument " "1"" of type '" "cmf::math::SparseLU const *""'"); 
   }
+  arg1 = reinterpret_cast< cmf::math::SparseLU * >(argp1);
   {
     try {
-      result = (cmf::math::HeunIntegrator *)new cmf::math::HeunIntegrator(*arg1,arg2);
+      result = ((cmf::math::SparseLU const *)arg1)->nonzeros();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -83544,31 +89313,45 @@ SWIGINTERN PyObject *_wrap_new_HeunIntegrator__SWIG_0(PyObject *SWIGUNUSEDPARM(s
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__HeunIntegrator, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_HeunIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_SparseLU_factorize(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  real arg1 = (real) 0.5 ;
-  double val1 ;
-  int ecode1 = 0 ;
-  cmf::math::HeunIntegrator *result = 0 ;
+  cmf::math::SparseLU *arg1 = (cmf::math::SparseLU *) 0 ;
+  cmf::math::num_array *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"values",  NULL 
+  };
+  bool result;
   
-  if ((nobjs < 0) || (nobjs > 1)) SWIG_fail;
-  if (swig_obj[0]) {
-    ecode1 = SWIG_AsVal_double(swig_obj[0], &val1);
-    if (!SWIG_IsOK(ecode1)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_HeunIntegrator" "', argument " "1"" of type '" "real""'");
-    } 
-    arg1 = static_cast< real >(val1);
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:SparseLU_factorize", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__SparseLU, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseLU_factorize" "', argument " "1"" of type '" "cmf::math::SparseLU *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SparseLU * >(argp1);
+  {
+    // Convert a array_wrapper from numpy array
+    double * data=0;
+    ptrdiff_t size = from_npy_array(obj1,&data); 
+    if (!data) {
+      SWIG_exception_fail(SWIG_TypeError,"Input data is not 'array-like' (in the sense of numpy arrays)");
+      return NULL;
+    }
+    arg2 = new cmf::math::num_array(size,data);
   }
   {
     try {
-      result = (cmf::math::HeunIntegrator *)new cmf::math::HeunIntegrator(arg1);
+      result = (bool)(arg1)->factorize((cmf::math::num_array const &)*arg2);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -83576,32 +89359,51 @@ SWIGINTERN PyObject *_wrap_new_HeunIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(s
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__HeunIntegrator, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  {
+    delete arg2;
+  }
   return resultobj;
 fail:
+  {
+    delete arg2;
+  }
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_HeunIntegrator__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_SparseLU_solve(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = 0 ;
+  cmf::math::SparseLU *arg1 = (cmf::math::SparseLU *) 0 ;
+  cmf::math::num_array *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  cmf::math::HeunIntegrator *result = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"b",  NULL 
+  };
+  cmf::math::num_array result;
   
-  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:SparseLU_solve", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__SparseLU, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_HeunIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SparseLU_solve" "', argument " "1"" of type '" "cmf::math::SparseLU const *""'"); 
   }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_HeunIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  arg1 = reinterpret_cast< cmf::math::SparseLU * >(argp1);
+  {
+    // Convert a array_wrapper from numpy array
+    double * data=0;
+    ptrdiff_t size = from_npy_array(obj1,&data); 
+    if (!data) {
+      SWIG_exception_fail(SWIG_TypeError,"Input data is not 'array-like' (in the sense of numpy arrays)");
+      return NULL;
+    }
+    arg2 = new cmf::math::num_array(size,data);
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
   {
     try {
-      result = (cmf::math::HeunIntegrator *)new cmf::math::HeunIntegrator((cmf::math::Integrator const &)*arg1);
+      result = ((cmf::math::SparseLU const *)arg1)->solve((cmf::math::num_array const &)*arg2);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -83609,136 +89411,35 @@ SWIGINTERN PyObject *_wrap_new_HeunIntegrator__SWIG_2(PyObject *SWIGUNUSEDPARM(s
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__HeunIntegrator, SWIG_POINTER_NEW |  0 );
+  {
+    resultobj = as_npy_array(result);
+  }
+  {
+    delete arg2;
+  }
   return resultobj;
 fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_new_HeunIntegrator(PyObject *self, PyObject *args) {
-  Py_ssize_t argc;
-  PyObject *argv[3] = {
-    0
-  };
-  
-  if (!(argc = SWIG_Python_UnpackTuple(args, "new_HeunIntegrator", 0, 2, argv))) SWIG_fail;
-  --argc;
   {
-    unsigned long _index = 0;
-    SWIG_TypeRank _rank = 0; 
-    if ((argc >= 0) && (argc <= 1)) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      SWIG_TypeRank _pi = 1;
-      int _v = 0;
-      if (argc > 0) {
-        {
-          {
-            int res = SWIG_AsVal_double(argv[0], NULL);
-            _v = SWIG_CheckState(res);
-          }
-        }
-        if (!_v) goto check_1;
-        _ranki += _v*_pi;
-        _rankm += _pi;
-        _pi *= SWIG_MAXCASTRANK;
-      }
-      if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 1;
-        if (_rank == _rankm) goto dispatch;
-      }
-    }
-  check_1:
-    
-    if ((argc >= 1) && (argc <= 2)) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      SWIG_TypeRank _pi = 1;
-      int _v = 0;
-      {
-        void *vptr = 0;
-        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (!_v) goto check_2;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
-      if (argc > 1) {
-        {
-          {
-            int res = SWIG_AsVal_double(argv[1], NULL);
-            _v = SWIG_CheckState(res);
-          }
-        }
-        if (!_v) goto check_2;
-        _ranki += _v*_pi;
-        _rankm += _pi;
-        _pi *= SWIG_MAXCASTRANK;
-      }
-      if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 2;
-        if (_rank == _rankm) goto dispatch;
-      }
-    }
-  check_2:
-    
-    if (argc == 1) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      SWIG_TypeRank _pi = 1;
-      int _v = 0;
-      {
-        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
-        _v = SWIG_CheckState(res);
-      }
-      if (!_v) goto check_3;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
-      if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 3;
-        if (_rank == _rankm) goto dispatch;
-      }
-    }
-  check_3:
-    
-  dispatch:
-    switch(_index) {
-    case 1:
-      return _wrap_new_HeunIntegrator__SWIG_1(self, argc, argv);
-    case 2:
-      return _wrap_new_HeunIntegrator__SWIG_0(self, argc, argv);
-    case 3:
-      return _wrap_new_HeunIntegrator__SWIG_2(self, argc, argv);
-    }
+    delete arg2;
   }
-  
-fail:
-  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_HeunIntegrator'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    cmf::math::HeunIntegrator::HeunIntegrator(cmf::math::StateVariableOwner &,real)\n"
-    "    cmf::math::HeunIntegrator::HeunIntegrator(real)\n"
-    "    cmf::math::HeunIntegrator::HeunIntegrator(cmf::math::Integrator const &)\n");
-  return 0;
+  return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_HeunIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_SparseLU(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::HeunIntegrator *arg1 = (cmf::math::HeunIntegrator *) 0 ;
+  cmf::math::SparseLU *arg1 = (cmf::math::SparseLU *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__HeunIntegrator, SWIG_POINTER_DISOWN |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SparseLU, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_HeunIntegrator" "', argument " "1"" of type '" "cmf::math::HeunIntegrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_SparseLU" "', argument " "1"" of type '" "cmf::math::SparseLU *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::HeunIntegrator * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::SparseLU * >(argp1);
   {
     try {
       delete arg1;
@@ -83756,20 +89457,20 @@ fail:
 }
 
 
-SWIGINTERN PyObject *HeunIntegrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *SparseLU_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *obj;
   if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__HeunIntegrator, SWIG_NewClientData(obj));
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__SparseLU, SWIG_NewClientData(obj));
   return SWIG_Py_Void();
 }
 
-SWIGINTERN PyObject *HeunIntegrator_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *SparseLU_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   return SWIG_Python_InitShadowInstance(args);
 }
 
-SWIGINTERN PyObject *_wrap_ImplicitEuler_dt_min_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IMEXIntegrator_dt_min_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::ImplicitEuler *arg1 = (cmf::math::ImplicitEuler *) 0 ;
+  cmf::math::IMEXIntegrator *arg1 = (cmf::math::IMEXIntegrator *) 0 ;
   cmf::math::Time *arg2 = (cmf::math::Time *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
@@ -83777,15 +89478,15 @@ SWIGINTERN PyObject *_wrap_ImplicitEuler_dt_min_set(PyObject *SWIGUNUSEDPARM(sel
   int res2 = 0 ;
   PyObject *swig_obj[2] ;
   
-  if (!SWIG_Python_UnpackTuple(args, "ImplicitEuler_dt_min_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ImplicitEuler, 0 |  0 );
+  if (!SWIG_Python_UnpackTuple(args, "IMEXIntegrator_dt_min_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__IMEXIntegrator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "ImplicitEuler_dt_min_set" "', argument " "1"" of type '" "cmf::math::ImplicitEuler *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IMEXIntegrator_dt_min_set" "', argument " "1"" of type '" "cmf::math::IMEXIntegrator *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::ImplicitEuler * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::IMEXIntegrator * >(argp1);
   res2 = SWIG_ConvertPtr(swig_obj[1], &argp2,SWIGTYPE_p_cmf__math__Time, 0 |  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "ImplicitEuler_dt_min_set" "', argument " "2"" of type '" "cmf::math::Time *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "IMEXIntegrator_dt_min_set" "', argument " "2"" of type '" "cmf::math::Time *""'"); 
   }
   arg2 = reinterpret_cast< cmf::math::Time * >(argp2);
   if (arg1) (arg1)->dt_min = *arg2;
@@ -83796,9 +89497,9 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_ImplicitEuler_dt_min_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IMEXIntegrator_dt_min_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::ImplicitEuler *arg1 = (cmf::math::ImplicitEuler *) 0 ;
+  cmf::math::IMEXIntegrator *arg1 = (cmf::math::IMEXIntegrator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
@@ -83806,11 +89507,11 @@ SWIGINTERN PyObject *_wrap_ImplicitEuler_dt_min_get(PyObject *SWIGUNUSEDPARM(sel
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ImplicitEuler, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__IMEXIntegrator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "ImplicitEuler_dt_min_get" "', argument " "1"" of type '" "cmf::math::ImplicitEuler *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IMEXIntegrator_dt_min_get" "', argument " "1"" of type '" "cmf::math::IMEXIntegrator *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::ImplicitEuler * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::IMEXIntegrator * >(argp1);
   result = (cmf::math::Time *)& ((arg1)->dt_min);
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__Time, 0 |  0 );
   return resultobj;
@@ -83819,85 +89520,95 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_new_ImplicitEuler__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_IMEXIntegrator_max_newton_iterations_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::StateVariableOwner *arg1 = 0 ;
-  real arg2 = (real) 1e-9 ;
-  cmf::math::Time arg3 = (cmf::math::Time) cmf::math::timespan(10) ;
+  cmf::math::IMEXIntegrator *arg1 = (cmf::math::IMEXIntegrator *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double val2 ;
+  int val2 ;
   int ecode2 = 0 ;
-  cmf::math::ImplicitEuler *result = 0 ;
+  PyObject *swig_obj[2] ;
   
-  if ((nobjs < 1) || (nobjs > 3)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_Python_UnpackTuple(args, "IMEXIntegrator_max_newton_iterations_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__IMEXIntegrator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_ImplicitEuler" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
-  }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_ImplicitEuler" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
-  if (swig_obj[1]) {
-    ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_ImplicitEuler" "', argument " "2"" of type '" "real""'");
-    } 
-    arg2 = static_cast< real >(val2);
-  }
-  if (swig_obj[2]) {
-    {
-      arg3 = convert_datetime_to_cmftime(swig_obj[2]);
-      if (arg3 == cmf::math::never)  {
-        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
-      }
-    }
-  }
-  {
-    try {
-      result = (cmf::math::ImplicitEuler *)new cmf::math::ImplicitEuler(*arg1,arg2,arg3);
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IMEXIntegrator_max_newton_iterations_set" "', argument " "1"" of type '" "cmf::math::IMEXIntegrator *""'"); 
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ImplicitEuler, SWIG_POINTER_NEW |  0 );
+  arg1 = reinterpret_cast< cmf::math::IMEXIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "IMEXIntegrator_max_newton_iterations_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->max_newton_iterations = arg2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_ImplicitEuler__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_IMEXIntegrator_max_newton_iterations_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  real arg1 = (real) 1e-9 ;
-  cmf::math::Time arg2 = (cmf::math::Time) cmf::math::timespan(10) ;
-  double val1 ;
-  int ecode1 = 0 ;
-  cmf::math::ImplicitEuler *result = 0 ;
+  cmf::math::IMEXIntegrator *arg1 = (cmf::math::IMEXIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
   
-  if ((nobjs < 0) || (nobjs > 2)) SWIG_fail;
-  if (swig_obj[0]) {
-    ecode1 = SWIG_AsVal_double(swig_obj[0], &val1);
-    if (!SWIG_IsOK(ecode1)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_ImplicitEuler" "', argument " "1"" of type '" "real""'");
-    } 
-    arg1 = static_cast< real >(val1);
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__IMEXIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IMEXIntegrator_max_newton_iterations_get" "', argument " "1"" of type '" "cmf::math::IMEXIntegrator *""'"); 
   }
-  if (swig_obj[1]) {
-    {
-      arg2 = convert_datetime_to_cmftime(swig_obj[1]);
-      if (arg2 == cmf::math::never)  {
-        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
-      }
-    }
+  arg1 = reinterpret_cast< cmf::math::IMEXIntegrator * >(argp1);
+  result = (int) ((arg1)->max_newton_iterations);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_IMEXIntegrator_set_implicit(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::IMEXIntegrator *arg1 = (cmf::math::IMEXIntegrator *) 0 ;
+  int arg2 ;
+  bool arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  bool val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"position",  (char *)"implicit",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:IMEXIntegrator_set_implicit", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__IMEXIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IMEXIntegrator_set_implicit" "', argument " "1"" of type '" "cmf::math::IMEXIntegrator *""'"); 
   }
+  arg1 = reinterpret_cast< cmf::math::IMEXIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "IMEXIntegrator_set_implicit" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_bool(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "IMEXIntegrator_set_implicit" "', argument " "3"" of type '" "bool""'");
+  } 
+  arg3 = static_cast< bool >(val3);
   {
     try {
-      result = (cmf::math::ImplicitEuler *)new cmf::math::ImplicitEuler(arg1,arg2);
+      (arg1)->set_implicit(arg2,arg3);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -83905,32 +89616,42 @@ SWIGINTERN PyObject *_wrap_new_ImplicitEuler__SWIG_1(PyObject *SWIGUNUSEDPARM(se
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ImplicitEuler, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_ImplicitEuler__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_IMEXIntegrator_is_implicit(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = 0 ;
+  cmf::math::IMEXIntegrator *arg1 = (cmf::math::IMEXIntegrator *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  cmf::math::ImplicitEuler *result = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"position",  NULL 
+  };
+  bool result;
   
-  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:IMEXIntegrator_is_implicit", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__IMEXIntegrator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_ImplicitEuler" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IMEXIntegrator_is_implicit" "', argument " "1"" of type '" "cmf::math::IMEXIntegrator const *""'"); 
   }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_ImplicitEuler" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::IMEXIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "IMEXIntegrator_is_implicit" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
   {
     try {
-      result = (cmf::math::ImplicitEuler *)new cmf::math::ImplicitEuler((cmf::math::Integrator const &)*arg1);
+      result = (bool)((cmf::math::IMEXIntegrator const *)arg1)->is_implicit(arg2);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -83938,161 +89659,62 @@ SWIGINTERN PyObject *_wrap_new_ImplicitEuler__SWIG_2(PyObject *SWIGUNUSEDPARM(se
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ImplicitEuler, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_ImplicitEuler(PyObject *self, PyObject *args) {
-  Py_ssize_t argc;
-  PyObject *argv[4] = {
-    0
-  };
+SWIGINTERN PyObject *_wrap_IMEXIntegrator_get_implicit_count(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::IMEXIntegrator *arg1 = (cmf::math::IMEXIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  size_t result;
   
-  if (!(argc = SWIG_Python_UnpackTuple(args, "new_ImplicitEuler", 0, 3, argv))) SWIG_fail;
-  --argc;
-  {
-    unsigned long _index = 0;
-    SWIG_TypeRank _rank = 0; 
-    if ((argc >= 0) && (argc <= 2)) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      SWIG_TypeRank _pi = 1;
-      int _v = 0;
-      if (argc > 0) {
-        {
-          {
-            int res = SWIG_AsVal_double(argv[0], NULL);
-            _v = SWIG_CheckState(res);
-          }
-        }
-        if (!_v) goto check_1;
-        _ranki += _v*_pi;
-        _rankm += _pi;
-        _pi *= SWIG_MAXCASTRANK;
-        if (argc > 1) {
-          {
-            {
-              _v = check_time(argv[1]);
-            }
-          }
-          if (!_v) goto check_1;
-          _ranki += _v*_pi;
-          _rankm += _pi;
-          _pi *= SWIG_MAXCASTRANK;
-        }
-      }
-      if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 1;
-        if (_rank == _rankm) goto dispatch;
-      }
-    }
-  check_1:
-    
-    if ((argc >= 1) && (argc <= 3)) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      SWIG_TypeRank _pi = 1;
-      int _v = 0;
-      {
-        void *vptr = 0;
-        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (!_v) goto check_2;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
-      if (argc > 1) {
-        {
-          {
-            int res = SWIG_AsVal_double(argv[1], NULL);
-            _v = SWIG_CheckState(res);
-          }
-        }
-        if (!_v) goto check_2;
-        _ranki += _v*_pi;
-        _rankm += _pi;
-        _pi *= SWIG_MAXCASTRANK;
-        if (argc > 2) {
-          {
-            {
-              _v = check_time(argv[2]);
-            }
-          }
-          if (!_v) goto check_2;
-          _ranki += _v*_pi;
-          _rankm += _pi;
-          _pi *= SWIG_MAXCASTRANK;
-        }
-      }
-      if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 2;
-        if (_rank == _rankm) goto dispatch;
-      }
-    }
-  check_2:
-    
-    if (argc == 1) {
-      SWIG_TypeRank _ranki = 0;
-      SWIG_TypeRank _rankm = 0;
-      SWIG_TypeRank _pi = 1;
-      int _v = 0;
-      {
-        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
-        _v = SWIG_CheckState(res);
-      }
-      if (!_v) goto check_3;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
-      if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 3;
-        if (_rank == _rankm) goto dispatch;
-      }
-    }
-  check_3:
-    
-  dispatch:
-    switch(_index) {
-    case 1:
-      return _wrap_new_ImplicitEuler__SWIG_1(self, argc, argv);
-    case 2:
-      return _wrap_new_ImplicitEuler__SWIG_0(self, argc, argv);
-    case 3:
-      return _wrap_new_ImplicitEuler__SWIG_2(self, argc, argv);
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__IMEXIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IMEXIntegrator_get_implicit_count" "', argument " "1"" of type '" "cmf::math::IMEXIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::IMEXIntegrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::IMEXIntegrator const *)arg1)->get_implicit_count();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
     }
+    
   }
-  
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
+  return resultobj;
 fail:
-  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_ImplicitEuler'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    cmf::math::ImplicitEuler::ImplicitEuler(cmf::math::StateVariableOwner &,real,cmf::math::Time)\n"
-    "    cmf::math::ImplicitEuler::ImplicitEuler(real,cmf::math::Time)\n"
-    "    cmf::math::ImplicitEuler::ImplicitEuler(cmf::math::Integrator const &)\n");
-  return 0;
+  return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_ImplicitEuler(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_IMEXIntegrator_set_implicit_by_type(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::ImplicitEuler *arg1 = (cmf::math::ImplicitEuler *) 0 ;
+  cmf::math::IMEXIntegrator *arg1 = (cmf::math::IMEXIntegrator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ImplicitEuler, SWIG_POINTER_DISOWN |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__IMEXIntegrator, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_ImplicitEuler" "', argument " "1"" of type '" "cmf::math::ImplicitEuler *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IMEXIntegrator_set_implicit_by_type" "', argument " "1"" of type '" "cmf::math::IMEXIntegrator *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::ImplicitEuler * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::IMEXIntegrator * >(argp1);
   {
     try {
-      delete arg1;
+      (arg1)->set_implicit_by_type();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -84107,41 +89729,103 @@ fail:
 }
 
 
-SWIGINTERN PyObject *ImplicitEuler_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__ImplicitEuler, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
+SWIGINTERN PyObject *_wrap_IMEXIntegrator_set_implicit_by_stiffness(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::IMEXIntegrator *arg1 = (cmf::math::IMEXIntegrator *) 0 ;
+  cmf::math::Time arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"dt",  NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:IMEXIntegrator_set_implicit_by_stiffness", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__IMEXIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IMEXIntegrator_set_implicit_by_stiffness" "', argument " "1"" of type '" "cmf::math::IMEXIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::IMEXIntegrator * >(argp1);
+  {
+    arg2 = convert_datetime_to_cmftime(obj1);
+    if (arg2 == cmf::math::never)  {
+      SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+    }
+  }
+  {
+    try {
+      (arg1)->set_implicit_by_stiffness(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
 }
 
-SWIGINTERN PyObject *ImplicitEuler_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  return SWIG_Python_InitShadowInstance(args);
+
+SWIGINTERN PyObject *_wrap_IMEXIntegrator_get_rhsevals(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::IMEXIntegrator *arg1 = (cmf::math::IMEXIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__IMEXIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "IMEXIntegrator_get_rhsevals" "', argument " "1"" of type '" "cmf::math::IMEXIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::IMEXIntegrator * >(argp1);
+  {
+    try {
+      result = (int)((cmf::math::IMEXIntegrator const *)arg1)->get_rhsevals();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
 }
 
-SWIGINTERN PyObject *_wrap_new_RKFIntegrator__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+
+SWIGINTERN PyObject *_wrap_new_IMEXIntegrator__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
   PyObject *resultobj = 0;
   cmf::math::StateVariableOwner *arg1 = 0 ;
   real arg2 = (real) 1e-9 ;
-  cmf::math::Time arg3 = (cmf::math::Time) cmf::math::timespan(1000) ;
+  cmf::math::Time arg3 = (cmf::math::Time) cmf::math::timespan(10) ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   double val2 ;
   int ecode2 = 0 ;
-  cmf::math::RKFIntegrator *result = 0 ;
+  cmf::math::IMEXIntegrator *result = 0 ;
   
   if ((nobjs < 1) || (nobjs > 3)) SWIG_fail;
   res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_RKFIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_IMEXIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
   }
   if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_RKFIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_IMEXIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
   }
   arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
   if (swig_obj[1]) {
     ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
     if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_RKFIntegrator" "', argument " "2"" of type '" "real""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_IMEXIntegrator" "', argument " "2"" of type '" "real""'");
     } 
     arg2 = static_cast< real >(val2);
   }
@@ -84155,7 +89839,7 @@ SWIGINTERN PyObject *_wrap_new_RKFIntegrator__SWIG_0(PyObject *SWIGUNUSEDPARM(se
   }
   {
     try {
-      result = (cmf::math::RKFIntegrator *)new cmf::math::RKFIntegrator(*arg1,arg2,arg3);
+      result = (cmf::math::IMEXIntegrator *)new cmf::math::IMEXIntegrator(*arg1,arg2,arg3);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -84163,26 +89847,26 @@ SWIGINTERN PyObject *_wrap_new_RKFIntegrator__SWIG_0(PyObject *SWIGUNUSEDPARM(se
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__RKFIntegrator, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__IMEXIntegrator, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_RKFIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_new_IMEXIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
   PyObject *resultobj = 0;
   real arg1 = (real) 1e-9 ;
-  cmf::math::Time arg2 = (cmf::math::Time) cmf::math::timespan(1000) ;
+  cmf::math::Time arg2 = (cmf::math::Time) cmf::math::timespan(10) ;
   double val1 ;
   int ecode1 = 0 ;
-  cmf::math::RKFIntegrator *result = 0 ;
+  cmf::math::IMEXIntegrator *result = 0 ;
   
   if ((nobjs < 0) || (nobjs > 2)) SWIG_fail;
   if (swig_obj[0]) {
     ecode1 = SWIG_AsVal_double(swig_obj[0], &val1);
     if (!SWIG_IsOK(ecode1)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_RKFIntegrator" "', argument " "1"" of type '" "real""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_IMEXIntegrator" "', argument " "1"" of type '" "real""'");
     } 
     arg1 = static_cast< real >(val1);
   }
@@ -84196,7 +89880,7 @@ SWIGINTERN PyObject *_wrap_new_RKFIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(se
   }
   {
     try {
-      result = (cmf::math::RKFIntegrator *)new cmf::math::RKFIntegrator(arg1,arg2);
+      result = (cmf::math::IMEXIntegrator *)new cmf::math::IMEXIntegrator(arg1,arg2);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -84204,20 +89888,53 @@ SWIGINTERN PyObject *_wrap_new_RKFIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(se
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__RKFIntegrator, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__IMEXIntegrator, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_RKFIntegrator(PyObject *self, PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_IMEXIntegrator__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  cmf::math::IMEXIntegrator *result = 0 ;
+  
+  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_IMEXIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_IMEXIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = (cmf::math::IMEXIntegrator *)new cmf::math::IMEXIntegrator((cmf::math::Integrator const &)*arg1);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__IMEXIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_IMEXIntegrator(PyObject *self, PyObject *args) {
   Py_ssize_t argc;
   PyObject *argv[4] = {
     0
   };
   
-  if (!(argc = SWIG_Python_UnpackTuple(args, "new_RKFIntegrator", 0, 3, argv))) SWIG_fail;
+  if (!(argc = SWIG_Python_UnpackTuple(args, "new_IMEXIntegrator", 0, 3, argv))) SWIG_fail;
   --argc;
   {
     unsigned long _index = 0;
@@ -84301,38 +90018,61 @@ SWIGINTERN PyObject *_wrap_new_RKFIntegrator(PyObject *self, PyObject *args) {
     }
   check_2:
     
+    if (argc == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
+      {
+        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
+        _v = SWIG_CheckState(res);
+      }
+      if (!_v) goto check_3;
+      _ranki += _v*_pi;
+      _rankm += _pi;
+      _pi *= SWIG_MAXCASTRANK;
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 3;
+        if (_rank == _rankm) goto dispatch;
+      }
+    }
+  check_3:
+    
   dispatch:
     switch(_index) {
     case 1:
-      return _wrap_new_RKFIntegrator__SWIG_1(self, argc, argv);
+      return _wrap_new_IMEXIntegrator__SWIG_1(self, argc, argv);
     case 2:
-      return _wrap_new_RKFIntegrator__SWIG_0(self, argc, argv);
+      return _wrap_new_IMEXIntegrator__SWIG_0(self, argc, argv);
+    case 3:
+      return _wrap_new_IMEXIntegrator__SWIG_2(self, argc, argv);
     }
   }
   
 fail:
-  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_RKFIntegrator'.\n"
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_IMEXIntegrator'.\n"
     "  Possible C/C++ prototypes are:\n"
-    "    cmf::math::RKFIntegrator::RKFIntegrator(cmf::math::StateVariableOwner &,real,cmf::math::Time)\n"
-    "    cmf::math::RKFIntegrator::RKFIntegrator(real,cmf::math::Time)\n");
+    "    cmf::math::IMEXIntegrator::IMEXIntegrator(cmf::math::StateVariableOwner &,real,cmf::math::Time)\n"
+    "    cmf::math::IMEXIntegrator::IMEXIntegrator(real,cmf::math::Time)\n"
+    "    cmf::math::IMEXIntegrator::IMEXIntegrator(cmf::math::Integrator const &)\n");
   return 0;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_RKFIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_IMEXIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::RKFIntegrator *arg1 = (cmf::math::RKFIntegrator *) 0 ;
+  cmf::math::IMEXIntegrator *arg1 = (cmf::math::IMEXIntegrator *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__RKFIntegrator, SWIG_POINTER_DISOWN |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__IMEXIntegrator, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_RKFIntegrator" "', argument " "1"" of type '" "cmf::math::RKFIntegrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_IMEXIntegrator" "', argument " "1"" of type '" "cmf::math::IMEXIntegrator *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::RKFIntegrator * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::IMEXIntegrator * >(argp1);
   {
     try {
       delete arg1;
@@ -84350,351 +90090,39 @@ fail:
 }
 
 
-SWIGINTERN PyObject *RKFIntegrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *IMEXIntegrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *obj;
   if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__RKFIntegrator, SWIG_NewClientData(obj));
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__IMEXIntegrator, SWIG_NewClientData(obj));
   return SWIG_Py_Void();
 }
 
-SWIGINTERN PyObject *RKFIntegrator_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *IMEXIntegrator_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   return SWIG_Python_InitShadowInstance(args);
 }
 
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_preconditioner_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  char arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  char val2 ;
-  int ecode2 = 0 ;
-  PyObject *swig_obj[2] ;
-  
-  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_preconditioner_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_preconditioner_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  ecode2 = SWIG_AsVal_char(swig_obj[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_preconditioner_set" "', argument " "2"" of type '" "char""'");
-  } 
-  arg2 = static_cast< char >(val2);
-  if (arg1) (arg1)->preconditioner = arg2;
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_preconditioner_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  char result;
-  
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_preconditioner_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  result = (char) ((arg1)->preconditioner);
-  resultobj = SWIG_From_char(static_cast< char >(result));
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxNonLinearIterations_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  int arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  PyObject *swig_obj[2] ;
-  
-  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_MaxNonLinearIterations_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxNonLinearIterations_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_MaxNonLinearIterations_set" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->MaxNonLinearIterations = arg2;
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxNonLinearIterations_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  int result;
-  
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxNonLinearIterations_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  result = (int) ((arg1)->MaxNonLinearIterations);
-  resultobj = SWIG_From_int(static_cast< int >(result));
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxConvergenceFailures_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  int arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  PyObject *swig_obj[2] ;
-  
-  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_MaxConvergenceFailures_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxConvergenceFailures_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_MaxConvergenceFailures_set" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->MaxConvergenceFailures = arg2;
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxConvergenceFailures_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  int result;
-  
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxConvergenceFailures_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  result = (int) ((arg1)->MaxConvergenceFailures);
-  resultobj = SWIG_From_int(static_cast< int >(result));
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxErrorTestFailures_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  int arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  PyObject *swig_obj[2] ;
-  
-  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_MaxErrorTestFailures_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxErrorTestFailures_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_MaxErrorTestFailures_set" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->MaxErrorTestFailures = arg2;
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxErrorTestFailures_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  int result;
-  
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxErrorTestFailures_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  result = (int) ((arg1)->MaxErrorTestFailures);
-  resultobj = SWIG_From_int(static_cast< int >(result));
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_maxl_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  int arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  PyObject *swig_obj[2] ;
-  
-  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_maxl_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_maxl_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_maxl_set" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->maxl = arg2;
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_maxl_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  int result;
-  
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_maxl_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  result = (int) ((arg1)->maxl);
-  resultobj = SWIG_From_int(static_cast< int >(result));
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_LinearSolver_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_ROS2_dt_min_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  int arg2 ;
+  cmf::math::ROS2 *arg1 = (cmf::math::ROS2 *) 0 ;
+  cmf::math::Time *arg2 = (cmf::math::Time *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
   PyObject *swig_obj[2] ;
   
-  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_LinearSolver_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_LinearSolver_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_LinearSolver_set" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->LinearSolver = arg2;
-  resultobj = SWIG_Py_Void();
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_LinearSolver_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  int result;
-  
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_Python_UnpackTuple(args, "ROS2_dt_min_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ROS2, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_LinearSolver_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "ROS2_dt_min_set" "', argument " "1"" of type '" "cmf::math::ROS2 *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  result = (int) ((arg1)->LinearSolver);
-  resultobj = SWIG_From_int(static_cast< int >(result));
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxOrder_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  int arg2 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  PyObject *swig_obj[2] ;
-  
-  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_MaxOrder_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxOrder_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+  arg1 = reinterpret_cast< cmf::math::ROS2 * >(argp1);
+  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2,SWIGTYPE_p_cmf__math__Time, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "ROS2_dt_min_set" "', argument " "2"" of type '" "cmf::math::Time *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "CVodeIntegrator_MaxOrder_set" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->MaxOrder = arg2;
+  arg2 = reinterpret_cast< cmf::math::Time * >(argp2);
+  if (arg1) (arg1)->dt_min = *arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -84702,51 +90130,51 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_MaxOrder_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_ROS2_dt_min_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  cmf::math::ROS2 *arg1 = (cmf::math::ROS2 *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  int result;
+  cmf::math::Time *result = 0 ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ROS2, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_MaxOrder_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "ROS2_dt_min_get" "', argument " "1"" of type '" "cmf::math::ROS2 *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  result = (int) ((arg1)->MaxOrder);
-  resultobj = SWIG_From_int(static_cast< int >(result));
+  arg1 = reinterpret_cast< cmf::math::ROS2 * >(argp1);
+  result = (cmf::math::Time *)& ((arg1)->dt_min);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__Time, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_max_step_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_ROS2_max_jacobian_age_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
-  cmf::math::Time *arg2 = (cmf::math::Time *) 0 ;
+  cmf::math::ROS2 *arg1 = (cmf::math::ROS2 *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
   PyObject *swig_obj[2] ;
   
-  if (!SWIG_Python_UnpackTuple(args, "CVodeIntegrator_max_step_set", 2, 2, swig_obj)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_Python_UnpackTuple(args, "ROS2_max_jacobian_age_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ROS2, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_max_step_set" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "ROS2_max_jacobian_age_set" "', argument " "1"" of type '" "cmf::math::ROS2 *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2,SWIGTYPE_p_cmf__math__Time, 0 |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "CVodeIntegrator_max_step_set" "', argument " "2"" of type '" "cmf::math::Time *""'"); 
-  }
-  arg2 = reinterpret_cast< cmf::math::Time * >(argp2);
-  if (arg1) (arg1)->max_step = *arg2;
+  arg1 = reinterpret_cast< cmf::math::ROS2 * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "ROS2_max_jacobian_age_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->max_jacobian_age = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -84754,32 +90182,32 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_max_step_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_ROS2_max_jacobian_age_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  cmf::math::ROS2 *arg1 = (cmf::math::ROS2 *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  cmf::math::Time *result = 0 ;
+  int result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ROS2, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_max_step_get" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "ROS2_max_jacobian_age_get" "', argument " "1"" of type '" "cmf::math::ROS2 *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  result = (cmf::math::Time *)& ((arg1)->max_step);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__Time, 0 |  0 );
+  arg1 = reinterpret_cast< cmf::math::ROS2 * >(argp1);
+  result = (int) ((arg1)->max_jacobian_age);
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_get_order(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_ROS2_get_rhsevals(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  cmf::math::ROS2 *arg1 = (cmf::math::ROS2 *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
@@ -84787,14 +90215,14 @@ SWIGINTERN PyObject *_wrap_CVodeIntegrator_get_order(PyObject *SWIGUNUSEDPARM(se
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ROS2, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_get_order" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "ROS2_get_rhsevals" "', argument " "1"" of type '" "cmf::math::ROS2 const *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::ROS2 * >(argp1);
   {
     try {
-      result = (int)((cmf::math::CVodeIntegrator const *)arg1)->get_order();
+      result = (int)((cmf::math::ROS2 const *)arg1)->get_rhsevals();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -84809,23 +90237,24 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_initialize(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_ROS2_get_jacevals(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  cmf::math::ROS2 *arg1 = (cmf::math::ROS2 *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
+  int result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ROS2, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_initialize" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "ROS2_get_jacevals" "', argument " "1"" of type '" "cmf::math::ROS2 const *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::ROS2 * >(argp1);
   {
     try {
-      (arg1)->initialize();
+      result = (int)((cmf::math::ROS2 const *)arg1)->get_jacevals();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -84833,30 +90262,51 @@ SWIGINTERN PyObject *_wrap_CVodeIntegrator_initialize(PyObject *SWIGUNUSEDPARM(s
     }
     
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_release(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_ROS2__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
   PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  cmf::math::StateVariableOwner *arg1 = 0 ;
+  real arg2 = (real) 1e-9 ;
+  cmf::math::Time arg3 = (cmf::math::Time) cmf::math::timespan(10) ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
+  double val2 ;
+  int ecode2 = 0 ;
+  cmf::math::ROS2 *result = 0 ;
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if ((nobjs < 1) || (nobjs > 3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_release" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_ROS2" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_ROS2" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
+  if (swig_obj[1]) {
+    ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_ROS2" "', argument " "2"" of type '" "real""'");
+    } 
+    arg2 = static_cast< real >(val2);
+  }
+  if (swig_obj[2]) {
+    {
+      arg3 = convert_datetime_to_cmftime(swig_obj[2]);
+      if (arg3 == cmf::math::never)  {
+        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+      }
+    }
   }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
   {
     try {
-      (arg1)->release();
+      result = (cmf::math::ROS2 *)new cmf::math::ROS2(*arg1,arg2,arg3);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -84864,94 +90314,40 @@ SWIGINTERN PyObject *_wrap_CVodeIntegrator_release(PyObject *SWIGUNUSEDPARM(self
     }
     
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ROS2, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_CVodeIntegrator__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_new_ROS2__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
   PyObject *resultobj = 0;
   real arg1 = (real) 1e-9 ;
-  char arg2 = (char) 'R' ;
+  cmf::math::Time arg2 = (cmf::math::Time) cmf::math::timespan(10) ;
   double val1 ;
   int ecode1 = 0 ;
-  char val2 ;
-  int ecode2 = 0 ;
-  cmf::math::CVodeIntegrator *result = 0 ;
+  cmf::math::ROS2 *result = 0 ;
   
   if ((nobjs < 0) || (nobjs > 2)) SWIG_fail;
   if (swig_obj[0]) {
     ecode1 = SWIG_AsVal_double(swig_obj[0], &val1);
     if (!SWIG_IsOK(ecode1)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_CVodeIntegrator" "', argument " "1"" of type '" "real""'");
+      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_ROS2" "', argument " "1"" of type '" "real""'");
     } 
     arg1 = static_cast< real >(val1);
   }
   if (swig_obj[1]) {
-    ecode2 = SWIG_AsVal_char(swig_obj[1], &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_CVodeIntegrator" "', argument " "2"" of type '" "char""'");
-    } 
-    arg2 = static_cast< char >(val2);
-  }
-  {
-    try {
-      result = (cmf::math::CVodeIntegrator *)new cmf::math::CVodeIntegrator(arg1,arg2);
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
+    {
+      arg2 = convert_datetime_to_cmftime(swig_obj[1]);
+      if (arg2 == cmf::math::never)  {
+        SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+      }
     }
-    
-  }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__CVodeIntegrator, SWIG_POINTER_NEW |  0 );
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_new_CVodeIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
-  PyObject *resultobj = 0;
-  cmf::math::StateVariableOwner *arg1 = 0 ;
-  real arg2 = (real) 1e-9 ;
-  char arg3 = (char) 'R' ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  double val2 ;
-  int ecode2 = 0 ;
-  char val3 ;
-  int ecode3 = 0 ;
-  cmf::math::CVodeIntegrator *result = 0 ;
-  
-  if ((nobjs < 1) || (nobjs > 3)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_CVodeIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
-  }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_CVodeIntegrator" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
-  if (swig_obj[1]) {
-    ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
-    if (!SWIG_IsOK(ecode2)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_CVodeIntegrator" "', argument " "2"" of type '" "real""'");
-    } 
-    arg2 = static_cast< real >(val2);
-  }
-  if (swig_obj[2]) {
-    ecode3 = SWIG_AsVal_char(swig_obj[2], &val3);
-    if (!SWIG_IsOK(ecode3)) {
-      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_CVodeIntegrator" "', argument " "3"" of type '" "char""'");
-    } 
-    arg3 = static_cast< char >(val3);
   }
   {
     try {
-      result = (cmf::math::CVodeIntegrator *)new cmf::math::CVodeIntegrator(*arg1,arg2,arg3);
+      result = (cmf::math::ROS2 *)new cmf::math::ROS2(arg1,arg2);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -84959,32 +90355,32 @@ SWIGINTERN PyObject *_wrap_new_CVodeIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__CVodeIntegrator, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ROS2, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_CVodeIntegrator__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_new_ROS2__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
   PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = 0 ;
+  cmf::math::Integrator *arg1 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  cmf::math::CVodeIntegrator *result = 0 ;
+  cmf::math::ROS2 *result = 0 ;
   
   if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__CVodeIntegrator,  0  | 0);
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_CVodeIntegrator" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_ROS2" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
   }
   if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_CVodeIntegrator" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const &""'"); 
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_ROS2" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
   {
     try {
-      result = (cmf::math::CVodeIntegrator *)new cmf::math::CVodeIntegrator((cmf::math::CVodeIntegrator const &)*arg1);
+      result = (cmf::math::ROS2 *)new cmf::math::ROS2((cmf::math::Integrator const &)*arg1);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -84992,20 +90388,20 @@ SWIGINTERN PyObject *_wrap_new_CVodeIntegrator__SWIG_2(PyObject *SWIGUNUSEDPARM(
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__CVodeIntegrator, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__ROS2, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_CVodeIntegrator(PyObject *self, PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_ROS2(PyObject *self, PyObject *args) {
   Py_ssize_t argc;
   PyObject *argv[4] = {
     0
   };
   
-  if (!(argc = SWIG_Python_UnpackTuple(args, "new_CVodeIntegrator", 0, 3, argv))) SWIG_fail;
+  if (!(argc = SWIG_Python_UnpackTuple(args, "new_ROS2", 0, 3, argv))) SWIG_fail;
   --argc;
   {
     unsigned long _index = 0;
@@ -85029,8 +90425,7 @@ SWIGINTERN PyObject *_wrap_new_CVodeIntegrator(PyObject *self, PyObject *args) {
         if (argc > 1) {
           {
             {
-              int res = SWIG_AsVal_char(argv[1], NULL);
-              _v = SWIG_CheckState(res);
+              _v = check_time(argv[1]);
             }
           }
           if (!_v) goto check_1;
@@ -85074,8 +90469,7 @@ SWIGINTERN PyObject *_wrap_new_CVodeIntegrator(PyObject *self, PyObject *args) {
         if (argc > 2) {
           {
             {
-              int res = SWIG_AsVal_char(argv[2], NULL);
-              _v = SWIG_CheckState(res);
+              _v = check_time(argv[2]);
             }
           }
           if (!_v) goto check_2;
@@ -85097,7 +90491,7 @@ SWIGINTERN PyObject *_wrap_new_CVodeIntegrator(PyObject *self, PyObject *args) {
       SWIG_TypeRank _pi = 1;
       int _v = 0;
       {
-        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__CVodeIntegrator, SWIG_POINTER_NO_NULL | 0);
+        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
         _v = SWIG_CheckState(res);
       }
       if (!_v) goto check_3;
@@ -85114,93 +90508,511 @@ SWIGINTERN PyObject *_wrap_new_CVodeIntegrator(PyObject *self, PyObject *args) {
   dispatch:
     switch(_index) {
     case 1:
-      return _wrap_new_CVodeIntegrator__SWIG_0(self, argc, argv);
+      return _wrap_new_ROS2__SWIG_1(self, argc, argv);
     case 2:
-      return _wrap_new_CVodeIntegrator__SWIG_1(self, argc, argv);
+      return _wrap_new_ROS2__SWIG_0(self, argc, argv);
     case 3:
-      return _wrap_new_CVodeIntegrator__SWIG_2(self, argc, argv);
+      return _wrap_new_ROS2__SWIG_2(self, argc, argv);
+    }
+  }
+  
+fail:
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_ROS2'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    cmf::math::ROS2::ROS2(cmf::math::StateVariableOwner &,real,cmf::math::Time)\n"
+    "    cmf::math::ROS2::ROS2(real,cmf::math::Time)\n"
+    "    cmf::math::ROS2::ROS2(cmf::math::Integrator const &)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_ROS2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::ROS2 *arg1 = (cmf::math::ROS2 *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__ROS2, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_ROS2" "', argument " "1"" of type '" "cmf::math::ROS2 *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::ROS2 * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *ROS2_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__ROS2, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *ROS2_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_EnsembleIntegrator_copy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::EnsembleIntegrator *arg1 = (cmf::math::EnsembleIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::EnsembleIntegrator * result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__EnsembleIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EnsembleIntegrator_copy" "', argument " "1"" of type '" "cmf::math::EnsembleIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::EnsembleIntegrator * >(argp1);
+  {
+    try {
+      result = (cmf::math::EnsembleIntegrator *)((cmf::math::EnsembleIntegrator const *)arg1)->copy();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__EnsembleIntegrator, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EnsembleIntegrator_add_member(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::EnsembleIntegrator *arg1 = (cmf::math::EnsembleIntegrator *) 0 ;
+  cmf::math::StateVariableOwner *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"member",  NULL 
+  };
+  size_t result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EnsembleIntegrator_add_member", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__EnsembleIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EnsembleIntegrator_add_member" "', argument " "1"" of type '" "cmf::math::EnsembleIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::EnsembleIntegrator * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "EnsembleIntegrator_add_member" "', argument " "2"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "EnsembleIntegrator_add_member" "', argument " "2"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg2 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp2);
+  {
+    try {
+      result = (arg1)->add_member(*arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EnsembleIntegrator_get_member_count(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::EnsembleIntegrator *arg1 = (cmf::math::EnsembleIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  size_t result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__EnsembleIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EnsembleIntegrator_get_member_count" "', argument " "1"" of type '" "cmf::math::EnsembleIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::EnsembleIntegrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::EnsembleIntegrator const *)arg1)->get_member_count();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EnsembleIntegrator_get_member_size(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::EnsembleIntegrator *arg1 = (cmf::math::EnsembleIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  size_t result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__EnsembleIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EnsembleIntegrator_get_member_size" "', argument " "1"" of type '" "cmf::math::EnsembleIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::EnsembleIntegrator * >(argp1);
+  {
+    try {
+      result = ((cmf::math::EnsembleIntegrator const *)arg1)->get_member_size();
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_From_size_t(static_cast< size_t >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EnsembleIntegrator_get_member(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::EnsembleIntegrator *arg1 = (cmf::math::EnsembleIntegrator *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"member",  NULL 
+  };
+  cmf::math::StateVariableList result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EnsembleIntegrator_get_member", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__EnsembleIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EnsembleIntegrator_get_member" "', argument " "1"" of type '" "cmf::math::EnsembleIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::EnsembleIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EnsembleIntegrator_get_member" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try {
+      result = ((cmf::math::EnsembleIntegrator const *)arg1)->get_member(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj((new cmf::math::StateVariableList(static_cast< const cmf::math::StateVariableList& >(result))), SWIGTYPE_p_cmf__math__StateVariableList, SWIG_POINTER_OWN |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_EnsembleIntegrator_get_member_states(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::EnsembleIntegrator *arg1 = (cmf::math::EnsembleIntegrator *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"member",  NULL 
+  };
+  cmf::math::num_array result;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EnsembleIntegrator_get_member_states", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__EnsembleIntegrator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "EnsembleIntegrator_get_member_states" "', argument " "1"" of type '" "cmf::math::EnsembleIntegrator const *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::EnsembleIntegrator * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "EnsembleIntegrator_get_member_states" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try {
+      result = ((cmf::math::EnsembleIntegrator const *)arg1)->get_member_states(arg2);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  {
+    resultobj = as_npy_array(result);
+  }
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_EnsembleIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  cmf::math::Integrator *arg1 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  char * kwnames[] = {
+    (char *)"template_integrator",  NULL 
+  };
+  cmf::math::EnsembleIntegrator *result = 0 ;
+  
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:new_EnsembleIntegrator", kwnames, &obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_EnsembleIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_EnsembleIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
+  {
+    try {
+      result = (cmf::math::EnsembleIntegrator *)new cmf::math::EnsembleIntegrator((cmf::math::Integrator const &)*arg1);
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+    
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__EnsembleIntegrator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_EnsembleIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::EnsembleIntegrator *arg1 = (cmf::math::EnsembleIntegrator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__EnsembleIntegrator, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_EnsembleIntegrator" "', argument " "1"" of type '" "cmf::math::EnsembleIntegrator *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::EnsembleIntegrator * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (const std::out_of_range& e) {
+      SWIG_exception(SWIG_IndexError, e.what());    
+    } catch (const std::exception& e) {
+      SWIG_exception(SWIG_RuntimeError, e.what());
     }
+    
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *EnsembleIntegrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__EnsembleIntegrator, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *EnsembleIntegrator_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
+SWIGINTERN PyObject *_wrap_SteadyStateSolver_pseudo_dt_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SteadyStateSolver *arg1 = (cmf::math::SteadyStateSolver *) 0 ;
+  cmf::math::Time *arg2 = (cmf::math::Time *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject *swig_obj[2] ;
+  
+  if (!SWIG_Python_UnpackTuple(args, "SteadyStateSolver_pseudo_dt_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SteadyStateSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SteadyStateSolver_pseudo_dt_set" "', argument " "1"" of type '" "cmf::math::SteadyStateSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SteadyStateSolver * >(argp1);
+  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2,SWIGTYPE_p_cmf__math__Time, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SteadyStateSolver_pseudo_dt_set" "', argument " "2"" of type '" "cmf::math::Time *""'"); 
+  }
+  arg2 = reinterpret_cast< cmf::math::Time * >(argp2);
+  if (arg1) (arg1)->pseudo_dt = *arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SteadyStateSolver_pseudo_dt_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SteadyStateSolver *arg1 = (cmf::math::SteadyStateSolver *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  cmf::math::Time *result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SteadyStateSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SteadyStateSolver_pseudo_dt_get" "', argument " "1"" of type '" "cmf::math::SteadyStateSolver *""'"); 
   }
+  arg1 = reinterpret_cast< cmf::math::SteadyStateSolver * >(argp1);
+  result = (cmf::math::Time *)& ((arg1)->pseudo_dt);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__Time, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_SteadyStateSolver_period_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  cmf::math::SteadyStateSolver *arg1 = (cmf::math::SteadyStateSolver *) 0 ;
+  cmf::math::Time *arg2 = (cmf::math::Time *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject *swig_obj[2] ;
   
+  if (!SWIG_Python_UnpackTuple(args, "SteadyStateSolver_period_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SteadyStateSolver, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SteadyStateSolver_period_set" "', argument " "1"" of type '" "cmf::math::SteadyStateSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SteadyStateSolver * >(argp1);
+  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2,SWIGTYPE_p_cmf__math__Time, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "SteadyStateSolver_period_set" "', argument " "2"" of type '" "cmf::math::Time *""'"); 
+  }
+  arg2 = reinterpret_cast< cmf::math::Time * >(argp2);
+  if (arg1) (arg1)->period = *arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
 fail:
-  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_CVodeIntegrator'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    cmf::math::CVodeIntegrator::CVodeIntegrator(real,char)\n"
-    "    cmf::math::CVodeIntegrator::CVodeIntegrator(cmf::math::StateVariableOwner &,real,char)\n"
-    "    cmf::math::CVodeIntegrator::CVodeIntegrator(cmf::math::CVodeIntegrator const &)\n");
-  return 0;
+  return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_get_error(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SteadyStateSolver_period_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  cmf::math::SteadyStateSolver *arg1 = (cmf::math::SteadyStateSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  cmf::math::num_array result;
+  cmf::math::Time *result = 0 ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SteadyStateSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_get_error" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  {
-    try {
-      result = ((cmf::math::CVodeIntegrator const *)arg1)->get_error();
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
-  }
-  {
-    resultobj = as_npy_array(result);
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SteadyStateSolver_period_get" "', argument " "1"" of type '" "cmf::math::SteadyStateSolver *""'"); 
   }
+  arg1 = reinterpret_cast< cmf::math::SteadyStateSolver * >(argp1);
+  result = (cmf::math::Time *)& ((arg1)->period);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__Time, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_get_nonlinear_iterations(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SteadyStateSolver_samples_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  cmf::math::SteadyStateSolver *arg1 = (cmf::math::SteadyStateSolver *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  int result;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_Python_UnpackTuple(args, "SteadyStateSolver_samples_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SteadyStateSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_get_nonlinear_iterations" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  {
-    try {
-      result = (int)((cmf::math::CVodeIntegrator const *)arg1)->get_nonlinear_iterations();
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SteadyStateSolver_samples_set" "', argument " "1"" of type '" "cmf::math::SteadyStateSolver *""'"); 
   }
-  resultobj = SWIG_From_int(static_cast< int >(result));
+  arg1 = reinterpret_cast< cmf::math::SteadyStateSolver * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SteadyStateSolver_samples_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->samples = arg2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_get_rhsevals(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SteadyStateSolver_samples_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  cmf::math::SteadyStateSolver *arg1 = (cmf::math::SteadyStateSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
@@ -85208,21 +91020,12 @@ SWIGINTERN PyObject *_wrap_CVodeIntegrator_get_rhsevals(PyObject *SWIGUNUSEDPARM
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SteadyStateSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_get_rhsevals" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  {
-    try {
-      result = (int)((cmf::math::CVodeIntegrator const *)arg1)->get_rhsevals();
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SteadyStateSolver_samples_get" "', argument " "1"" of type '" "cmf::math::SteadyStateSolver *""'"); 
   }
+  arg1 = reinterpret_cast< cmf::math::SteadyStateSolver * >(argp1);
+  result = (int) ((arg1)->samples);
   resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
@@ -85230,98 +91033,76 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_CVodeIntegrator_copy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SteadyStateSolver_max_iterations_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  cmf::math::SteadyStateSolver *arg1 = (cmf::math::SteadyStateSolver *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  cmf::math::CVodeIntegrator *result = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject *swig_obj[2] ;
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  if (!SWIG_Python_UnpackTuple(args, "SteadyStateSolver_max_iterations_set", 2, 2, swig_obj)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SteadyStateSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CVodeIntegrator_copy" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator const *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  {
-    try {
-      result = (cmf::math::CVodeIntegrator *)((cmf::math::CVodeIntegrator const *)arg1)->copy();
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SteadyStateSolver_max_iterations_set" "', argument " "1"" of type '" "cmf::math::SteadyStateSolver *""'"); 
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__CVodeIntegrator, 0 |  0 );
+  arg1 = reinterpret_cast< cmf::math::SteadyStateSolver * >(argp1);
+  ecode2 = SWIG_AsVal_int(swig_obj[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "SteadyStateSolver_max_iterations_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->max_iterations = arg2;
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_CVodeIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SteadyStateSolver_max_iterations_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::CVodeIntegrator *arg1 = (cmf::math::CVodeIntegrator *) 0 ;
+  cmf::math::SteadyStateSolver *arg1 = (cmf::math::SteadyStateSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
+  int result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__CVodeIntegrator, SWIG_POINTER_DISOWN |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SteadyStateSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_CVodeIntegrator" "', argument " "1"" of type '" "cmf::math::CVodeIntegrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::CVodeIntegrator * >(argp1);
-  {
-    try {
-      delete arg1;
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SteadyStateSolver_max_iterations_get" "', argument " "1"" of type '" "cmf::math::SteadyStateSolver *""'"); 
   }
-  resultobj = SWIG_Py_Void();
+  arg1 = reinterpret_cast< cmf::math::SteadyStateSolver * >(argp1);
+  result = (int) ((arg1)->max_iterations);
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *CVodeIntegrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__CVodeIntegrator, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *CVodeIntegrator_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  return SWIG_Python_InitShadowInstance(args);
-}
-
-SWIGINTERN PyObject *_wrap_MultiIntegrator_copy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SteadyStateSolver_get_residual(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::MultiIntegrator *arg1 = (cmf::math::MultiIntegrator *) 0 ;
+  cmf::math::SteadyStateSolver *arg1 = (cmf::math::SteadyStateSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  cmf::math::MultiIntegrator *result = 0 ;
+  real result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__MultiIntegrator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SteadyStateSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "MultiIntegrator_copy" "', argument " "1"" of type '" "cmf::math::MultiIntegrator const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SteadyStateSolver_get_residual" "', argument " "1"" of type '" "cmf::math::SteadyStateSolver const *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::MultiIntegrator * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::SteadyStateSolver * >(argp1);
   {
     try {
-      result = (cmf::math::MultiIntegrator *)((cmf::math::MultiIntegrator const *)arg1)->copy();
+      result = (real)((cmf::math::SteadyStateSolver const *)arg1)->get_residual();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -85329,53 +91110,31 @@ SWIGINTERN PyObject *_wrap_MultiIntegrator_copy(PyObject *SWIGUNUSEDPARM(self),
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__MultiIntegrator, 0 |  0 );
+  resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_MultiIntegrator_add_states_to_integrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_SteadyStateSolver_get_rhsevals(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::MultiIntegrator *arg1 = (cmf::math::MultiIntegrator *) 0 ;
-  cmf::math::StateVariableOwner *arg2 = 0 ;
-  int arg3 ;
+  cmf::math::SteadyStateSolver *arg1 = (cmf::math::SteadyStateSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  char * kwnames[] = {
-    (char *)"self",  (char *)"stateOwner",  (char *)"integrator_position",  NULL 
-  };
+  PyObject *swig_obj[1] ;
+  int result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:MultiIntegrator_add_states_to_integrator", kwnames, &obj0, &obj1, &obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__MultiIntegrator, 0 |  0 );
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SteadyStateSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "MultiIntegrator_add_states_to_integrator" "', argument " "1"" of type '" "cmf::math::MultiIntegrator *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::MultiIntegrator * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "MultiIntegrator_add_states_to_integrator" "', argument " "2"" of type '" "cmf::math::StateVariableOwner &""'"); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "MultiIntegrator_add_states_to_integrator" "', argument " "2"" of type '" "cmf::math::StateVariableOwner &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SteadyStateSolver_get_rhsevals" "', argument " "1"" of type '" "cmf::math::SteadyStateSolver const *""'"); 
   }
-  arg2 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp2);
-  ecode3 = SWIG_AsVal_int(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "MultiIntegrator_add_states_to_integrator" "', argument " "3"" of type '" "int""'");
-  } 
-  arg3 = static_cast< int >(val3);
+  arg1 = reinterpret_cast< cmf::math::SteadyStateSolver * >(argp1);
   {
     try {
-      (arg1)->add_states_to_integrator(*arg2,arg3);
+      result = (int)((cmf::math::SteadyStateSolver const *)arg1)->get_rhsevals();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -85383,45 +91142,31 @@ SWIGINTERN PyObject *_wrap_MultiIntegrator_add_states_to_integrator(PyObject *SW
     }
     
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_MultiIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_SteadyStateSolver_get_jacevals(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::Integrator *arg1 = 0 ;
-  int arg2 ;
+  cmf::math::SteadyStateSolver *arg1 = (cmf::math::SteadyStateSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
-  int ecode2 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  char * kwnames[] = {
-    (char *)"template_integrator",  (char *)"count",  NULL 
-  };
-  cmf::math::MultiIntegrator *result = 0 ;
+  PyObject *swig_obj[1] ;
+  int result;
   
-  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:new_MultiIntegrator", kwnames, &obj0, &obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SteadyStateSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_MultiIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
-  }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_MultiIntegrator" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SteadyStateSolver_get_jacevals" "', argument " "1"" of type '" "cmf::math::SteadyStateSolver const *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_MultiIntegrator" "', argument " "2"" of type '" "int""'");
-  } 
-  arg2 = static_cast< int >(val2);
+  arg1 = reinterpret_cast< cmf::math::SteadyStateSolver * >(argp1);
   {
     try {
-      result = (cmf::math::MultiIntegrator *)new cmf::math::MultiIntegrator((cmf::math::Integrator const &)*arg1,arg2);
+      result = (int)((cmf::math::SteadyStateSolver const *)arg1)->get_jacevals();
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -85429,30 +91174,41 @@ SWIGINTERN PyObject *_wrap_new_MultiIntegrator(PyObject *SWIGUNUSEDPARM(self), P
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__MultiIntegrator, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_MultiIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_SteadyStateSolver_solve(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  cmf::math::MultiIntegrator *arg1 = (cmf::math::MultiIntegrator *) 0 ;
+  cmf::math::SteadyStateSolver *arg1 = (cmf::math::SteadyStateSolver *) 0 ;
+  cmf::math::Time arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char * kwnames[] = {
+    (char *)"self",  (char *)"t",  NULL 
+  };
+  int result;
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__MultiIntegrator, SWIG_POINTER_DISOWN |  0 );
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:SteadyStateSolver_solve", kwnames, &obj0, &obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_cmf__math__SteadyStateSolver, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_MultiIntegrator" "', argument " "1"" of type '" "cmf::math::MultiIntegrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SteadyStateSolver_solve" "', argument " "1"" of type '" "cmf::math::SteadyStateSolver *""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::SteadyStateSolver * >(argp1);
+  {
+    arg2 = convert_datetime_to_cmftime(obj1);
+    if (arg2 == cmf::math::never)  {
+      SWIG_exception_fail(SWIG_TypeError,"Can't convert input value to cmf.Time object");
+    }
   }
-  arg1 = reinterpret_cast< cmf::math::MultiIntegrator * >(argp1);
   {
     try {
-      delete arg1;
+      result = (int)(arg1)->solve(arg2);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -85460,42 +91216,42 @@ SWIGINTERN PyObject *_wrap_delete_MultiIntegrator(PyObject *SWIGUNUSEDPARM(self)
     }
     
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *MultiIntegrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__MultiIntegrator, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *MultiIntegrator_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  return SWIG_Python_InitShadowInstance(args);
-}
-
-SWIGINTERN PyObject *_wrap_SoluteWaterIntegrator_copy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_SteadyStateSolver__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
   PyObject *resultobj = 0;
-  cmf::math::SoluteWaterIntegrator *arg1 = (cmf::math::SoluteWaterIntegrator *) 0 ;
+  cmf::math::StateVariableOwner *arg1 = 0 ;
+  real arg2 = (real) 1e-6 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  cmf::math::SoluteWaterIntegrator *result = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  cmf::math::SteadyStateSolver *result = 0 ;
   
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, 0 |  0 );
+  if ((nobjs < 1) || (nobjs > 2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SoluteWaterIntegrator_copy" "', argument " "1"" of type '" "cmf::math::SoluteWaterIntegrator const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_SteadyStateSolver" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SteadyStateSolver" "', argument " "1"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  }
+  arg1 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp1);
+  if (swig_obj[1]) {
+    ecode2 = SWIG_AsVal_double(swig_obj[1], &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "new_SteadyStateSolver" "', argument " "2"" of type '" "real""'");
+    } 
+    arg2 = static_cast< real >(val2);
   }
-  arg1 = reinterpret_cast< cmf::math::SoluteWaterIntegrator * >(argp1);
   {
     try {
-      result = (cmf::math::SoluteWaterIntegrator *)((cmf::math::SoluteWaterIntegrator const *)arg1)->copy();
+      result = (cmf::math::SteadyStateSolver *)new cmf::math::SteadyStateSolver(*arg1,arg2);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -85503,54 +91259,31 @@ SWIGINTERN PyObject *_wrap_SoluteWaterIntegrator_copy(PyObject *SWIGUNUSEDPARM(s
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, 0 |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__SteadyStateSolver, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_SoluteWaterIntegrator__SWIG_0(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_new_SteadyStateSolver__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
   PyObject *resultobj = 0;
-  cmf::water::solute_vector *arg1 = 0 ;
-  cmf::math::Integrator *arg2 = 0 ;
-  cmf::math::Integrator *arg3 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  void *argp3 = 0 ;
-  int res3 = 0 ;
-  cmf::math::SoluteWaterIntegrator *result = 0 ;
+  real arg1 = (real) 1e-6 ;
+  double val1 ;
+  int ecode1 = 0 ;
+  cmf::math::SteadyStateSolver *result = 0 ;
   
-  if ((nobjs < 3) || (nobjs > 3)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__water__solute_vector,  0  | 0);
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_SoluteWaterIntegrator" "', argument " "1"" of type '" "cmf::water::solute_vector const &""'"); 
-  }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "1"" of type '" "cmf::water::solute_vector const &""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::water::solute_vector * >(argp1);
-  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_SoluteWaterIntegrator" "', argument " "2"" of type '" "cmf::math::Integrator const &""'"); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "2"" of type '" "cmf::math::Integrator const &""'"); 
-  }
-  arg2 = reinterpret_cast< cmf::math::Integrator * >(argp2);
-  res3 = SWIG_ConvertPtr(swig_obj[2], &argp3, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_SoluteWaterIntegrator" "', argument " "3"" of type '" "cmf::math::Integrator const &""'"); 
-  }
-  if (!argp3) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "3"" of type '" "cmf::math::Integrator const &""'"); 
+  if ((nobjs < 0) || (nobjs > 1)) SWIG_fail;
+  if (swig_obj[0]) {
+    ecode1 = SWIG_AsVal_double(swig_obj[0], &val1);
+    if (!SWIG_IsOK(ecode1)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "new_SteadyStateSolver" "', argument " "1"" of type '" "real""'");
+    } 
+    arg1 = static_cast< real >(val1);
   }
-  arg3 = reinterpret_cast< cmf::math::Integrator * >(argp3);
   {
     try {
-      result = (cmf::math::SoluteWaterIntegrator *)new cmf::math::SoluteWaterIntegrator((cmf::water::solute_vector const &)*arg1,(cmf::math::Integrator const &)*arg2,(cmf::math::Integrator const &)*arg3);
+      result = (cmf::math::SteadyStateSolver *)new cmf::math::SteadyStateSolver(arg1);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -85558,70 +91291,32 @@ SWIGINTERN PyObject *_wrap_new_SoluteWaterIntegrator__SWIG_0(PyObject *SWIGUNUSE
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__SteadyStateSolver, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_SoluteWaterIntegrator__SWIG_1(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
+SWIGINTERN PyObject *_wrap_new_SteadyStateSolver__SWIG_2(PyObject *SWIGUNUSEDPARM(self), Py_ssize_t nobjs, PyObject **swig_obj) {
   PyObject *resultobj = 0;
-  SwigValueWrapper< cmf::water::solute_vector > arg1 ;
-  cmf::math::Integrator *arg2 = 0 ;
-  cmf::math::Integrator *arg3 = 0 ;
-  cmf::math::StateVariableOwner *arg4 = 0 ;
-  void *argp1 ;
+  cmf::math::Integrator *arg1 = 0 ;
+  void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  void *argp3 = 0 ;
-  int res3 = 0 ;
-  void *argp4 = 0 ;
-  int res4 = 0 ;
-  cmf::math::SoluteWaterIntegrator *result = 0 ;
+  cmf::math::SteadyStateSolver *result = 0 ;
   
-  if ((nobjs < 4) || (nobjs > 4)) SWIG_fail;
-  {
-    res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__water__solute_vector,  0  | 0);
-    if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_SoluteWaterIntegrator" "', argument " "1"" of type '" "cmf::water::solute_vector""'"); 
-    }  
-    if (!argp1) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "1"" of type '" "cmf::water::solute_vector""'");
-    } else {
-      cmf::water::solute_vector * temp = reinterpret_cast< cmf::water::solute_vector * >(argp1);
-      arg1 = *temp;
-      if (SWIG_IsNewObj(res1)) delete temp;
-    }
-  }
-  res2 = SWIG_ConvertPtr(swig_obj[1], &argp2, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_SoluteWaterIntegrator" "', argument " "2"" of type '" "cmf::math::Integrator const &""'"); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "2"" of type '" "cmf::math::Integrator const &""'"); 
-  }
-  arg2 = reinterpret_cast< cmf::math::Integrator * >(argp2);
-  res3 = SWIG_ConvertPtr(swig_obj[2], &argp3, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_SoluteWaterIntegrator" "', argument " "3"" of type '" "cmf::math::Integrator const &""'"); 
-  }
-  if (!argp3) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "3"" of type '" "cmf::math::Integrator const &""'"); 
-  }
-  arg3 = reinterpret_cast< cmf::math::Integrator * >(argp3);
-  res4 = SWIG_ConvertPtr(swig_obj[3], &argp4, SWIGTYPE_p_cmf__math__StateVariableOwner,  0 );
-  if (!SWIG_IsOK(res4)) {
-    SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "new_SoluteWaterIntegrator" "', argument " "4"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  if ((nobjs < 1) || (nobjs > 1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1, SWIGTYPE_p_cmf__math__Integrator,  0  | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_SteadyStateSolver" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
   }
-  if (!argp4) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SoluteWaterIntegrator" "', argument " "4"" of type '" "cmf::math::StateVariableOwner &""'"); 
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_SteadyStateSolver" "', argument " "1"" of type '" "cmf::math::Integrator const &""'"); 
   }
-  arg4 = reinterpret_cast< cmf::math::StateVariableOwner * >(argp4);
+  arg1 = reinterpret_cast< cmf::math::Integrator * >(argp1);
   {
     try {
-      result = (cmf::math::SoluteWaterIntegrator *)new cmf::math::SoluteWaterIntegrator(arg1,(cmf::math::Integrator const &)*arg2,(cmf::math::Integrator const &)*arg3,*arg4);
+      result = (cmf::math::SteadyStateSolver *)new cmf::math::SteadyStateSolver((cmf::math::Integrator const &)*arg1);
     } catch (const std::out_of_range& e) {
       SWIG_exception(SWIG_IndexError, e.what());    
     } catch (const std::exception& e) {
@@ -85629,53 +91324,41 @@ SWIGINTERN PyObject *_wrap_new_SoluteWaterIntegrator__SWIG_1(PyObject *SWIGUNUSE
     }
     
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_cmf__math__SteadyStateSolver, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_new_SoluteWaterIntegrator(PyObject *self, PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_SteadyStateSolver(PyObject *self, PyObject *args) {
   Py_ssize_t argc;
-  PyObject *argv[5] = {
+  PyObject *argv[3] = {
     0
   };
   
-  if (!(argc = SWIG_Python_UnpackTuple(args, "new_SoluteWaterIntegrator", 0, 4, argv))) SWIG_fail;
+  if (!(argc = SWIG_Python_UnpackTuple(args, "new_SteadyStateSolver", 0, 2, argv))) SWIG_fail;
   --argc;
   {
     unsigned long _index = 0;
     SWIG_TypeRank _rank = 0; 
-    if (argc == 3) {
+    if ((argc >= 0) && (argc <= 1)) {
       SWIG_TypeRank _ranki = 0;
       SWIG_TypeRank _rankm = 0;
       SWIG_TypeRank _pi = 1;
       int _v = 0;
-      {
-        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__water__solute_vector, SWIG_POINTER_NO_NULL | 0);
-        _v = SWIG_CheckState(res);
-      }
-      if (!_v) goto check_1;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
-      {
-        int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
-        _v = SWIG_CheckState(res);
-      }
-      if (!_v) goto check_1;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
-      {
-        int res = SWIG_ConvertPtr(argv[2], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
-        _v = SWIG_CheckState(res);
+      if (argc > 0) {
+        {
+          {
+            int res = SWIG_AsVal_double(argv[0], NULL);
+            _v = SWIG_CheckState(res);
+          }
+        }
+        if (!_v) goto check_1;
+        _ranki += _v*_pi;
+        _rankm += _pi;
+        _pi *= SWIG_MAXCASTRANK;
       }
-      if (!_v) goto check_1;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
       if (!_index || (_ranki < _rank)) {
         _rank = _ranki; _index = 1;
         if (_rank == _rankm) goto dispatch;
@@ -85683,83 +91366,94 @@ SWIGINTERN PyObject *_wrap_new_SoluteWaterIntegrator(PyObject *self, PyObject *a
     }
   check_1:
     
-    if (argc == 4) {
+    if ((argc >= 1) && (argc <= 2)) {
       SWIG_TypeRank _ranki = 0;
       SWIG_TypeRank _rankm = 0;
       SWIG_TypeRank _pi = 1;
       int _v = 0;
       {
-        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__water__solute_vector, SWIG_POINTER_NO_NULL | 0);
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
         _v = SWIG_CheckState(res);
       }
       if (!_v) goto check_2;
       _ranki += _v*_pi;
       _rankm += _pi;
       _pi *= SWIG_MAXCASTRANK;
-      {
-        int res = SWIG_ConvertPtr(argv[1], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
-        _v = SWIG_CheckState(res);
+      if (argc > 1) {
+        {
+          {
+            int res = SWIG_AsVal_double(argv[1], NULL);
+            _v = SWIG_CheckState(res);
+          }
+        }
+        if (!_v) goto check_2;
+        _ranki += _v*_pi;
+        _rankm += _pi;
+        _pi *= SWIG_MAXCASTRANK;
       }
-      if (!_v) goto check_2;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
-      {
-        int res = SWIG_ConvertPtr(argv[2], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
-        _v = SWIG_CheckState(res);
+      if (!_index || (_ranki < _rank)) {
+        _rank = _ranki; _index = 2;
+        if (_rank == _rankm) goto dispatch;
       }
-      if (!_v) goto check_2;
-      _ranki += _v*_pi;
-      _rankm += _pi;
-      _pi *= SWIG_MAXCASTRANK;
+    }
+  check_2:
+    
+    if (argc == 1) {
+      SWIG_TypeRank _ranki = 0;
+      SWIG_TypeRank _rankm = 0;
+      SWIG_TypeRank _pi = 1;
+      int _v = 0;
       {
-        void *vptr = 0;
-        int res = SWIG_ConvertPtr(argv[3], &vptr, SWIGTYPE_p_cmf__math__StateVariableOwner, SWIG_POINTER_NO_NULL);
+        int res = SWIG_ConvertPtr(argv[0], 0, SWIGTYPE_p_cmf__math__Integrator, SWIG_POINTER_NO_NULL | 0);
         _v = SWIG_CheckState(res);
       }
-      if (!_v) goto check_2;
+      if (!_v) goto check_3;
       _ranki += _v*_pi;
       _rankm += _pi;
       _pi *= SWIG_MAXCASTRANK;
       if (!_index || (_ranki < _rank)) {
-        _rank = _ranki; _index = 2;
+        _rank = _ranki; _index = 3;
         if (_rank == _rankm) goto dispatch;
       }
     }
-  check_2:
+  check_3:
     
   dispatch:
     switch(_index) {
     case 1:
-      return _wrap_new_SoluteWaterIntegrator__SWIG_0(self, argc, argv);
+      return _wrap_new_SteadyStateSolver__SWIG_1(self, argc, argv);
     case 2:
-      return _wrap_new_SoluteWaterIntegrator__SWIG_1(self, argc, argv);
+      return _wrap_new_SteadyStateSolver__SWIG_0(self, argc, argv);
+    case 3:
+      return _wrap_new_SteadyStateSolver__SWIG_2(self, argc, argv);
     }
   }
   
 fail:
-  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_SoluteWaterIntegrator'.\n"
+  SWIG_Python_RaiseOrModifyTypeError("Wrong number or type of arguments for overloaded function 'new_SteadyStateSolver'.\n"
     "  Possible C/C++ prototypes are:\n"
-    "    cmf::math::SoluteWaterIntegrator::SoluteWaterIntegrator(cmf::water::solute_vector const &,cmf::math::Integrator const &,cmf::math::Integrator const &)\n"
-    "    cmf::math::SoluteWaterIntegrator::SoluteWaterIntegrator(cmf::water::solute_vector,cmf::math::Integrator const &,cmf::math::Integrator const &,cmf::math::StateVariableOwner &)\n");
+    "    cmf::math::SteadyStateSolver::SteadyStateSolver(cmf::math::StateVariableOwner &,real)\n"
+    "    cmf::math::SteadyStateSolver::SteadyStateSolver(real)\n"
+    "    cmf::math::SteadyStateSolver::SteadyStateSolver(cmf::math::Integrator const &)\n");
   return 0;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_SoluteWaterIntegrator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_SteadyStateSolver(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  cmf::math::SoluteWaterIntegrator *arg1 = (cmf::math::SoluteWaterIntegrator *) 0 ;
+  cmf::math::SteadyStateSolver *arg1 = (cmf::math::SteadyStateSolver *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, SWIG_POINTER_DISOWN |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SteadyStateSolver, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_SoluteWaterIntegrator" "', argument " "1"" of type '" "cmf::math::SoluteWaterIntegrator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_SteadyStateSolver" "', argument " "1"" of type '" "cmf::math::SteadyStateSolver *""'"); 
   }
-  arg1 = reinterpret_cast< cmf::math::SoluteWaterIntegrator * >(argp1);
+  arg1 = reinterpret_cast< cmf::math::SteadyStateSolver * >(argp1);
   {
     try {
       delete arg1;
@@ -85777,46 +91471,14 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_SoluteWaterIntegrator_to_string(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  cmf::math::SoluteWaterIntegrator *arg1 = (cmf::math::SoluteWaterIntegrator *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  std::string result;
-  
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "SoluteWaterIntegrator_to_string" "', argument " "1"" of type '" "cmf::math::SoluteWaterIntegrator const *""'"); 
-  }
-  arg1 = reinterpret_cast< cmf::math::SoluteWaterIntegrator * >(argp1);
-  {
-    try {
-      result = ((cmf::math::SoluteWaterIntegrator const *)arg1)->to_string();
-    } catch (const std::out_of_range& e) {
-      SWIG_exception(SWIG_IndexError, e.what());    
-    } catch (const std::exception& e) {
-      SWIG_exception(SWIG_RuntimeError, e.what());
-    }
-    
-  }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *SoluteWaterIntegrator_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *SteadyStateSolver_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *obj;
   if (!SWIG_Python_UnpackTuple(args, "swigregister", 1, 1, &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__SoluteWaterIntegrator, SWIG_NewClientData(obj));
+  SWIG_TypeNewClientData(SWIGTYPE_p_cmf__math__SteadyStateSolver, SWIG_NewClientData(obj));
   return SWIG_Py_Void();
 }
 
-SWIGINTERN PyObject *SoluteWaterIntegrator_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *SteadyStateSolver_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   return SWIG_Python_InitShadowInstance(args);
 }
 
@@ -86437,6 +92099,7 @@ static PyMethodDef SwigMethods[] = {
 		"double\n"
 		"get_i(ptrdiff_t i) const \n"
 		""},
+	 { "timeseries_next_jump", (PyCFunction)(void(*)(void))_wrap_timeseries_next_jump, METH_VARARGS|METH_KEYWORDS, "timeseries_next_jump(timeseries self, Time t) -> Time"},
 	 { "timeseries_set_t", (PyCFunction)(void(*)(void))_wrap_timeseries_set_t, METH_VARARGS|METH_KEYWORDS, "\n"
 		"timeseries_set_t(timeseries self, Time t, double value)\n"
 		"void\n"
@@ -87081,6 +92744,7 @@ static PyMethodDef SwigMethods[] = {
 		""},
 	 { "flux_node_position_set", _wrap_flux_node_position_set, METH_VARARGS, "flux_node_position_set(flux_node self, point position)"},
 	 { "flux_node_position_get", _wrap_flux_node_position_get, METH_O, "flux_node_position_get(flux_node self) -> point"},
+	 { "flux_node_get_dpotential_dV", _wrap_flux_node_get_dpotential_dV, METH_O, "flux_node_get_dpotential_dV(flux_node self) -> real"},
 	 { "flux_node_is_empty", _wrap_flux_node_is_empty, METH_O, "\n"
 		"flux_node_is_empty(flux_node self) -> double\n"
 		"virtual\n"
@@ -89401,6 +95065,10 @@ static PyMethodDef SwigMethods[] = {
 		"cmf::math::num_array dPsiM_dW(const cmf::math::num_array &wetness)\n"
 		"const \n"
 		""},
+	 { "RetentionCurve_dK_dW", _wrap_RetentionCurve_dK_dW, METH_VARARGS, "\n"
+		"RetentionCurve_dK_dW(RetentionCurve self, real wetness) -> real\n"
+		"RetentionCurve_dK_dW(RetentionCurve self, cmf::math::num_array const & wetness) -> cmf::math::num_array\n"
+		""},
 	 { "RetentionCurve_Wetness_pF", _wrap_RetentionCurve_Wetness_pF, METH_VARARGS, "\n"
 		"RetentionCurve_Wetness_pF(RetentionCurve self, real pF) -> real\n"
 		"RetentionCurve_Wetness_pF(RetentionCurve self, cmf::math::num_array const & pF) -> cmf::math::num_array\n"
@@ -89622,6 +95290,7 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"Returns the actual anisotropic conductivity along a direction :math:`K = (k_f \\\\cdot d) K`. \n"
 		""},
+	 { "SoilLayer_get_dK_dV", (PyCFunction)(void(*)(void))_wrap_SoilLayer_get_dK_dV, METH_VARARGS|METH_KEYWORDS, "SoilLayer_get_dK_dV(SoilLayer self, point direction) -> real"},
 	 { "SoilLayer_anisotropic_kf_set", _wrap_SoilLayer_anisotropic_kf_set, METH_VARARGS, "SoilLayer_anisotropic_kf_set(SoilLayer self, point anisotropic_kf)"},
 	 { "SoilLayer_anisotropic_kf_get", _wrap_SoilLayer_anisotropic_kf_get, METH_O, "SoilLayer_anisotropic_kf_get(SoilLayer self) -> point"},
 	 { "SoilLayer_get_capacity", _wrap_SoilLayer_get_capacity, METH_O, "\n"
@@ -91758,6 +97427,50 @@ static PyMethodDef SwigMethods[] = {
 	 { "project_cells_get", _wrap_project_cells_get, METH_O, "project_cells_get(project self) -> cell_vector"},
 	 { "project_swigregister", project_swigregister, METH_O, NULL},
 	 { "project_swiginit", project_swiginit, METH_VARARGS, NULL},
+	 { "solver_counters_rhsevals_set", _wrap_solver_counters_rhsevals_set, METH_VARARGS, "solver_counters_rhsevals_set(solver_counters self, long long rhsevals)"},
+	 { "solver_counters_rhsevals_get", _wrap_solver_counters_rhsevals_get, METH_O, "solver_counters_rhsevals_get(solver_counters self) -> long long"},
+	 { "solver_counters_jacevals_set", _wrap_solver_counters_jacevals_set, METH_VARARGS, "solver_counters_jacevals_set(solver_counters self, long long jacevals)"},
+	 { "solver_counters_jacevals_get", _wrap_solver_counters_jacevals_get, METH_O, "solver_counters_jacevals_get(solver_counters self) -> long long"},
+	 { "solver_counters_nonlinear_iterations_set", _wrap_solver_counters_nonlinear_iterations_set, METH_VARARGS, "solver_counters_nonlinear_iterations_set(solver_counters self, long long nonlinear_iterations)"},
+	 { "solver_counters_nonlinear_iterations_get", _wrap_solver_counters_nonlinear_iterations_get, METH_O, "solver_counters_nonlinear_iterations_get(solver_counters self) -> long long"},
+	 { "solver_counters_linear_iterations_set", _wrap_solver_counters_linear_iterations_set, METH_VARARGS, "solver_counters_linear_iterations_set(solver_counters self, long long linear_iterations)"},
+	 { "solver_counters_linear_iterations_get", _wrap_solver_counters_linear_iterations_get, METH_O, "solver_counters_linear_iterations_get(solver_counters self) -> long long"},
+	 { "solver_counters_error_test_failures_set", _wrap_solver_counters_error_test_failures_set, METH_VARARGS, "solver_counters_error_test_failures_set(solver_counters self, long long error_test_failures)"},
+	 { "solver_counters_error_test_failures_get", _wrap_solver_counters_error_test_failures_get, METH_O, "solver_counters_error_test_failures_get(solver_counters self) -> long long"},
+	 { "solver_counters_convergence_failures_set", _wrap_solver_counters_convergence_failures_set, METH_VARARGS, "solver_counters_convergence_failures_set(solver_counters self, long long convergence_failures)"},
+	 { "solver_counters_convergence_failures_get", _wrap_solver_counters_convergence_failures_get, METH_O, "solver_counters_convergence_failures_get(solver_counters self) -> long long"},
+	 { "solver_counters_order_set", _wrap_solver_counters_order_set, METH_VARARGS, "solver_counters_order_set(solver_counters self, int order)"},
+	 { "solver_counters_order_get", _wrap_solver_counters_order_get, METH_O, "solver_counters_order_get(solver_counters self) -> int"},
+	 { "new_solver_counters", _wrap_new_solver_counters, METH_NOARGS, "new_solver_counters() -> solver_counters"},
+	 { "delete_solver_counters", _wrap_delete_solver_counters, METH_O, "delete_solver_counters(solver_counters self)"},
+	 { "solver_counters_swigregister", solver_counters_swigregister, METH_O, NULL},
+	 { "solver_counters_swiginit", solver_counters_swiginit, METH_VARARGS, NULL},
+	 { "step_record_t_set", _wrap_step_record_t_set, METH_VARARGS, "step_record_t_set(step_record self, Time t)"},
+	 { "step_record_t_get", _wrap_step_record_t_get, METH_O, "step_record_t_get(step_record self) -> Time"},
+	 { "step_record_dt_set", _wrap_step_record_dt_set, METH_VARARGS, "step_record_dt_set(step_record self, Time dt)"},
+	 { "step_record_dt_get", _wrap_step_record_dt_get, METH_O, "step_record_dt_get(step_record self) -> Time"},
+	 { "step_record_wall_time_set", _wrap_step_record_wall_time_set, METH_VARARGS, "step_record_wall_time_set(step_record self, double wall_time)"},
+	 { "step_record_wall_time_get", _wrap_step_record_wall_time_get, METH_O, "step_record_wall_time_get(step_record self) -> double"},
+	 { "new_step_record", _wrap_new_step_record, METH_NOARGS, "new_step_record() -> step_record"},
+	 { "delete_step_record", _wrap_delete_step_record, METH_O, "delete_step_record(step_record self)"},
+	 { "step_record_swigregister", step_record_swigregister, METH_O, NULL},
+	 { "step_record_swiginit", step_record_swiginit, METH_VARARGS, NULL},
+	 { "SolverStatistics_record", (PyCFunction)(void(*)(void))_wrap_SolverStatistics_record, METH_VARARGS|METH_KEYWORDS, "SolverStatistics_record(SolverStatistics self, Time t, Time dt, double wall_time, solver_counters before, solver_counters after)"},
+	 { "SolverStatistics_size", _wrap_SolverStatistics_size, METH_O, "SolverStatistics_size(SolverStatistics self) -> size_t"},
+	 { "SolverStatistics_get_capacity", _wrap_SolverStatistics_get_capacity, METH_O, "SolverStatistics_get_capacity(SolverStatistics self) -> size_t"},
+	 { "SolverStatistics_get_record", (PyCFunction)(void(*)(void))_wrap_SolverStatistics_get_record, METH_VARARGS|METH_KEYWORDS, "SolverStatistics_get_record(SolverStatistics self, ptrdiff_t index) -> step_record"},
+	 { "SolverStatistics_get_total", _wrap_SolverStatistics_get_total, METH_O, "SolverStatistics_get_total(SolverStatistics self) -> solver_counters"},
+	 { "SolverStatistics_get_steps", _wrap_SolverStatistics_get_steps, METH_O, "SolverStatistics_get_steps(SolverStatistics self) -> long long"},
+	 { "SolverStatistics_get_wall_time", _wrap_SolverStatistics_get_wall_time, METH_O, "SolverStatistics_get_wall_time(SolverStatistics self) -> double"},
+	 { "SolverStatistics_get_time", _wrap_SolverStatistics_get_time, METH_O, "SolverStatistics_get_time(SolverStatistics self) -> Time"},
+	 { "SolverStatistics_open_log", (PyCFunction)(void(*)(void))_wrap_SolverStatistics_open_log, METH_VARARGS|METH_KEYWORDS, "SolverStatistics_open_log(SolverStatistics self, std::string filename)"},
+	 { "SolverStatistics_close_log", _wrap_SolverStatistics_close_log, METH_O, "SolverStatistics_close_log(SolverStatistics self)"},
+	 { "SolverStatistics_clear", _wrap_SolverStatistics_clear, METH_O, "SolverStatistics_clear(SolverStatistics self)"},
+	 { "SolverStatistics_to_string", _wrap_SolverStatistics_to_string, METH_O, "SolverStatistics_to_string(SolverStatistics self) -> std::string"},
+	 { "new_SolverStatistics", (PyCFunction)(void(*)(void))_wrap_new_SolverStatistics, METH_VARARGS|METH_KEYWORDS, "new_SolverStatistics(size_t capacity=10000) -> SolverStatistics"},
+	 { "delete_SolverStatistics", _wrap_delete_SolverStatistics, METH_O, "delete_SolverStatistics(SolverStatistics self)"},
+	 { "SolverStatistics_swigregister", SolverStatistics_swigregister, METH_O, NULL},
+	 { "SolverStatistics_swiginit", SolverStatistics_swiginit, METH_VARARGS, NULL},
 	 { "Integrator___getitem__", (PyCFunction)(void(*)(void))_wrap_Integrator___getitem__, METH_VARARGS|METH_KEYWORDS, "Integrator___getitem__(Integrator self, int position) -> cmf::math::StateVariable::ptr"},
 	 { "Integrator_get_dxdt", (PyCFunction)(void(*)(void))_wrap_Integrator_get_dxdt, METH_VARARGS|METH_KEYWORDS, "\n"
 		"Integrator_get_dxdt(Integrator self, Time time) -> cmf::math::num_array\n"
@@ -91776,12 +97489,24 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"Adds a single state variable to the integrator. \n"
 		""},
+	 { "Integrator_reorder_states", _wrap_Integrator_reorder_states, METH_O, "Integrator_reorder_states(Integrator self)"},
+	 { "Integrator_get_bandwidth", _wrap_Integrator_get_bandwidth, METH_O, "Integrator_get_bandwidth(Integrator self) -> size_t"},
 	 { "Integrator_integratables_set", _wrap_Integrator_integratables_set, METH_VARARGS, "Integrator_integratables_set(Integrator self, integratable_list integratables)"},
 	 { "Integrator_integratables_get", _wrap_Integrator_integratables_get, METH_O, "Integrator_integratables_get(Integrator self) -> integratable_list"},
 	 { "Integrator_reset_integratables_set", _wrap_Integrator_reset_integratables_set, METH_VARARGS, "Integrator_reset_integratables_set(Integrator self, bool reset_integratables)"},
 	 { "Integrator_reset_integratables_get", _wrap_Integrator_reset_integratables_get, METH_O, "Integrator_reset_integratables_get(Integrator self) -> bool"},
 	 { "Integrator_use_OpenMP_set", _wrap_Integrator_use_OpenMP_set, METH_VARARGS, "Integrator_use_OpenMP_set(Integrator self, bool use_OpenMP)"},
 	 { "Integrator_use_OpenMP_get", _wrap_Integrator_use_OpenMP_get, METH_O, "Integrator_use_OpenMP_get(Integrator self) -> bool"},
+	 { "Integrator_use_flux_graph_set", _wrap_Integrator_use_flux_graph_set, METH_VARARGS, "Integrator_use_flux_graph_set(Integrator self, bool use_flux_graph)"},
+	 { "Integrator_use_flux_graph_get", _wrap_Integrator_use_flux_graph_get, METH_O, "Integrator_use_flux_graph_get(Integrator self) -> bool"},
+	 { "Integrator_use_contiguous_states_set", _wrap_Integrator_use_contiguous_states_set, METH_VARARGS, "Integrator_use_contiguous_states_set(Integrator self, bool use_contiguous_states)"},
+	 { "Integrator_use_contiguous_states_get", _wrap_Integrator_use_contiguous_states_get, METH_O, "Integrator_use_contiguous_states_get(Integrator self) -> bool"},
+	 { "Integrator_use_forcing_breakpoints_set", _wrap_Integrator_use_forcing_breakpoints_set, METH_VARARGS, "Integrator_use_forcing_breakpoints_set(Integrator self, bool use_forcing_breakpoints)"},
+	 { "Integrator_use_forcing_breakpoints_get", _wrap_Integrator_use_forcing_breakpoints_get, METH_O, "Integrator_use_forcing_breakpoints_get(Integrator self) -> bool"},
+	 { "Integrator_get_next_breakpoint", (PyCFunction)(void(*)(void))_wrap_Integrator_get_next_breakpoint, METH_VARARGS|METH_KEYWORDS, "Integrator_get_next_breakpoint(Integrator self, Time t) -> Time"},
+	 { "Integrator_statistics_set", _wrap_Integrator_statistics_set, METH_VARARGS, "Integrator_statistics_set(Integrator self, std::shared_ptr< cmf::math::SolverStatistics > statistics)"},
+	 { "Integrator_statistics_get", _wrap_Integrator_statistics_get, METH_O, "Integrator_statistics_get(Integrator self) -> std::shared_ptr< cmf::math::SolverStatistics >"},
+	 { "Integrator_get_counters", _wrap_Integrator_get_counters, METH_O, "Integrator_get_counters(Integrator self) -> solver_counters"},
 	 { "Integrator_size", _wrap_Integrator_size, METH_O, "\n"
 		"Integrator_size(Integrator self) -> size_t\n"
 		"size_t size()\n"
@@ -91886,6 +97611,8 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"reset:  If true, solver is reseted before integration starts \n"
 		""},
+	 { "Integrator_save_checkpoint", (PyCFunction)(void(*)(void))_wrap_Integrator_save_checkpoint, METH_VARARGS|METH_KEYWORDS, "Integrator_save_checkpoint(Integrator self, std::string filename)"},
+	 { "Integrator_load_checkpoint", (PyCFunction)(void(*)(void))_wrap_Integrator_load_checkpoint, METH_VARARGS|METH_KEYWORDS, "Integrator_load_checkpoint(Integrator self, std::string filename)"},
 	 { "Integrator___len__", _wrap_Integrator___len__, METH_O, "Integrator___len__(Integrator self) -> size_t"},
 	 { "Integrator_swigregister", Integrator_swigregister, METH_O, NULL},
 	 { "BDF2_get_error_position", _wrap_BDF2_get_error_position, METH_O, "\n"
@@ -91897,6 +97624,8 @@ static PyMethodDef SwigMethods[] = {
 		""},
 	 { "BDF2_max_order_set", _wrap_BDF2_max_order_set, METH_VARARGS, "BDF2_max_order_set(BDF2 self, int max_order)"},
 	 { "BDF2_max_order_get", _wrap_BDF2_max_order_get, METH_O, "BDF2_max_order_get(BDF2 self) -> int"},
+	 { "BDF2_use_newton_set", _wrap_BDF2_use_newton_set, METH_VARARGS, "BDF2_use_newton_set(BDF2 self, bool use_newton)"},
+	 { "BDF2_use_newton_get", _wrap_BDF2_use_newton_get, METH_O, "BDF2_use_newton_get(BDF2 self) -> bool"},
 	 { "new_BDF2", _wrap_new_BDF2, METH_VARARGS, "\n"
 		"BDF2(real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
 		"BDF2(StateVariableOwner states, real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
@@ -91947,6 +97676,8 @@ static PyMethodDef SwigMethods[] = {
 	 { "HeunIntegrator_swiginit", HeunIntegrator_swiginit, METH_VARARGS, NULL},
 	 { "ImplicitEuler_dt_min_set", _wrap_ImplicitEuler_dt_min_set, METH_VARARGS, "ImplicitEuler_dt_min_set(ImplicitEuler self, Time dt_min)"},
 	 { "ImplicitEuler_dt_min_get", _wrap_ImplicitEuler_dt_min_get, METH_O, "ImplicitEuler_dt_min_get(ImplicitEuler self) -> Time"},
+	 { "ImplicitEuler_use_newton_set", _wrap_ImplicitEuler_use_newton_set, METH_VARARGS, "ImplicitEuler_use_newton_set(ImplicitEuler self, bool use_newton)"},
+	 { "ImplicitEuler_use_newton_get", _wrap_ImplicitEuler_use_newton_get, METH_O, "ImplicitEuler_use_newton_get(ImplicitEuler self) -> bool"},
 	 { "new_ImplicitEuler", _wrap_new_ImplicitEuler, METH_VARARGS, "\n"
 		"ImplicitEuler(StateVariableOwner states, real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
 		"ImplicitEuler(real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
@@ -91978,6 +97709,8 @@ static PyMethodDef SwigMethods[] = {
 	 { "RKFIntegrator_swiginit", RKFIntegrator_swiginit, METH_VARARGS, NULL},
 	 { "CVodeIntegrator_preconditioner_set", _wrap_CVodeIntegrator_preconditioner_set, METH_VARARGS, "CVodeIntegrator_preconditioner_set(CVodeIntegrator self, char preconditioner)"},
 	 { "CVodeIntegrator_preconditioner_get", _wrap_CVodeIntegrator_preconditioner_get, METH_O, "CVodeIntegrator_preconditioner_get(CVodeIntegrator self) -> char"},
+	 { "CVodeIntegrator_preconditioner_matrix_set", _wrap_CVodeIntegrator_preconditioner_matrix_set, METH_VARARGS, "CVodeIntegrator_preconditioner_matrix_set(CVodeIntegrator self, char preconditioner_matrix)"},
+	 { "CVodeIntegrator_preconditioner_matrix_get", _wrap_CVodeIntegrator_preconditioner_matrix_get, METH_O, "CVodeIntegrator_preconditioner_matrix_get(CVodeIntegrator self) -> char"},
 	 { "CVodeIntegrator_MaxNonLinearIterations_set", _wrap_CVodeIntegrator_MaxNonLinearIterations_set, METH_VARARGS, "CVodeIntegrator_MaxNonLinearIterations_set(CVodeIntegrator self, int MaxNonLinearIterations)"},
 	 { "CVodeIntegrator_MaxNonLinearIterations_get", _wrap_CVodeIntegrator_MaxNonLinearIterations_get, METH_O, "CVodeIntegrator_MaxNonLinearIterations_get(CVodeIntegrator self) -> int"},
 	 { "CVodeIntegrator_MaxConvergenceFailures_set", _wrap_CVodeIntegrator_MaxConvergenceFailures_set, METH_VARARGS, "CVodeIntegrator_MaxConvergenceFailures_set(CVodeIntegrator self, int MaxConvergenceFailures)"},
@@ -91992,6 +97725,14 @@ static PyMethodDef SwigMethods[] = {
 	 { "CVodeIntegrator_MaxOrder_get", _wrap_CVodeIntegrator_MaxOrder_get, METH_O, "CVodeIntegrator_MaxOrder_get(CVodeIntegrator self) -> int"},
 	 { "CVodeIntegrator_max_step_set", _wrap_CVodeIntegrator_max_step_set, METH_VARARGS, "CVodeIntegrator_max_step_set(CVodeIntegrator self, Time max_step)"},
 	 { "CVodeIntegrator_max_step_get", _wrap_CVodeIntegrator_max_step_get, METH_O, "CVodeIntegrator_max_step_get(CVodeIntegrator self) -> Time"},
+	 { "CVodeIntegrator_use_dense_output_set", _wrap_CVodeIntegrator_use_dense_output_set, METH_VARARGS, "CVodeIntegrator_use_dense_output_set(CVodeIntegrator self, bool use_dense_output)"},
+	 { "CVodeIntegrator_use_dense_output_get", _wrap_CVodeIntegrator_use_dense_output_get, METH_O, "CVodeIntegrator_use_dense_output_get(CVodeIntegrator self) -> bool"},
+	 { "CVodeIntegrator_profile_errors_set", _wrap_CVodeIntegrator_profile_errors_set, METH_VARARGS, "CVodeIntegrator_profile_errors_set(CVodeIntegrator self, bool profile_errors)"},
+	 { "CVodeIntegrator_profile_errors_get", _wrap_CVodeIntegrator_profile_errors_get, METH_O, "CVodeIntegrator_profile_errors_get(CVodeIntegrator self) -> bool"},
+	 { "CVodeIntegrator_get_error_dominance", _wrap_CVodeIntegrator_get_error_dominance, METH_O, "CVodeIntegrator_get_error_dominance(CVodeIntegrator self) -> cmf::math::num_array"},
+	 { "CVodeIntegrator_get_error_share", _wrap_CVodeIntegrator_get_error_share, METH_O, "CVodeIntegrator_get_error_share(CVodeIntegrator self) -> cmf::math::num_array"},
+	 { "CVodeIntegrator_get_error_profile", (PyCFunction)(void(*)(void))_wrap_CVodeIntegrator_get_error_profile, METH_VARARGS|METH_KEYWORDS, "CVodeIntegrator_get_error_profile(CVodeIntegrator self, size_t count=10) -> std::string"},
+	 { "CVodeIntegrator_clear_error_profile", _wrap_CVodeIntegrator_clear_error_profile, METH_O, "CVodeIntegrator_clear_error_profile(CVodeIntegrator self)"},
 	 { "CVodeIntegrator_get_order", _wrap_CVodeIntegrator_get_order, METH_O, "\n"
 		"CVodeIntegrator_get_order(CVodeIntegrator self) -> int\n"
 		"int\n"
@@ -92068,6 +97809,9 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"Polymorphic copy constructor. \n"
 		""},
+	 { "MultiIntegrator_set_rate", (PyCFunction)(void(*)(void))_wrap_MultiIntegrator_set_rate, METH_VARARGS|METH_KEYWORDS, "MultiIntegrator_set_rate(MultiIntegrator self, int integrator_position, int rate)"},
+	 { "MultiIntegrator_get_rate", (PyCFunction)(void(*)(void))_wrap_MultiIntegrator_get_rate, METH_VARARGS|METH_KEYWORDS, "MultiIntegrator_get_rate(MultiIntegrator self, int integrator_position) -> int"},
+	 { "MultiIntegrator_get_coupling_count", _wrap_MultiIntegrator_get_coupling_count, METH_O, "MultiIntegrator_get_coupling_count(MultiIntegrator self) -> size_t"},
 	 { "MultiIntegrator_add_states_to_integrator", (PyCFunction)(void(*)(void))_wrap_MultiIntegrator_add_states_to_integrator, METH_VARARGS|METH_KEYWORDS, "\n"
 		"MultiIntegrator_add_states_to_integrator(MultiIntegrator self, StateVariableOwner stateOwner, int integrator_position)\n"
 		"void\n"
@@ -92076,8 +97820,11 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"Add state variables from a StateVariableOwner. \n"
 		""},
-	 { "new_MultiIntegrator", (PyCFunction)(void(*)(void))_wrap_new_MultiIntegrator, METH_VARARGS|METH_KEYWORDS, "\n"
-		"new_MultiIntegrator(Integrator template_integrator, int count) -> MultiIntegrator\n"
+	 { "MultiIntegrator_distribute_states", (PyCFunction)(void(*)(void))_wrap_MultiIntegrator_distribute_states, METH_VARARGS|METH_KEYWORDS, "MultiIntegrator_distribute_states(MultiIntegrator self, StateVariableOwner stateOwner) -> size_t"},
+	 { "MultiIntegrator_get_state_count", (PyCFunction)(void(*)(void))_wrap_MultiIntegrator_get_state_count, METH_VARARGS|METH_KEYWORDS, "MultiIntegrator_get_state_count(MultiIntegrator self, int integrator_position) -> size_t"},
+	 { "new_MultiIntegrator", _wrap_new_MultiIntegrator, METH_VARARGS, "\n"
+		"MultiIntegrator(Integrator template_integrator, int count)\n"
+		"new_MultiIntegrator(Integrator template_integrator, int count, StateVariableOwner states) -> MultiIntegrator\n"
 		"MultiIntegrator(const cmf::math::Integrator &template_integrator, int\n"
 		"count)\n"
 		"\n"
@@ -92131,6 +97878,91 @@ static PyMethodDef SwigMethods[] = {
 		""},
 	 { "SoluteWaterIntegrator_swigregister", SoluteWaterIntegrator_swigregister, METH_O, NULL},
 	 { "SoluteWaterIntegrator_swiginit", SoluteWaterIntegrator_swiginit, METH_VARARGS, NULL},
+	 { "SparseJacobian_use_flux_derivatives_set", _wrap_SparseJacobian_use_flux_derivatives_set, METH_VARARGS, "SparseJacobian_use_flux_derivatives_set(SparseJacobian self, bool use_flux_derivatives)"},
+	 { "SparseJacobian_use_flux_derivatives_get", _wrap_SparseJacobian_use_flux_derivatives_get, METH_O, "SparseJacobian_use_flux_derivatives_get(SparseJacobian self) -> bool"},
+	 { "new_SparseJacobian", (PyCFunction)(void(*)(void))_wrap_new_SparseJacobian, METH_VARARGS|METH_KEYWORDS, "new_SparseJacobian(Integrator integ) -> SparseJacobian"},
+	 { "SparseJacobian_size", _wrap_SparseJacobian_size, METH_O, "SparseJacobian_size(SparseJacobian self) -> size_t"},
+	 { "SparseJacobian_nonzeros", _wrap_SparseJacobian_nonzeros, METH_O, "SparseJacobian_nonzeros(SparseJacobian self) -> size_t"},
+	 { "SparseJacobian_color_count", _wrap_SparseJacobian_color_count, METH_O, "SparseJacobian_color_count(SparseJacobian self) -> size_t"},
+	 { "SparseJacobian_derived_columns", _wrap_SparseJacobian_derived_columns, METH_O, "SparseJacobian_derived_columns(SparseJacobian self) -> size_t"},
+	 { "SparseJacobian_calculate", (PyCFunction)(void(*)(void))_wrap_SparseJacobian_calculate, METH_VARARGS|METH_KEYWORDS, "SparseJacobian_calculate(SparseJacobian self, Integrator integ, Time t, real delta=1e-6)"},
+	 { "SparseJacobian_get", (PyCFunction)(void(*)(void))_wrap_SparseJacobian_get, METH_VARARGS|METH_KEYWORDS, "SparseJacobian_get(SparseJacobian self, size_t i, size_t j) -> real"},
+	 { "SparseJacobian_get_values", _wrap_SparseJacobian_get_values, METH_O, "SparseJacobian_get_values(SparseJacobian self) -> cmf::math::num_array"},
+	 { "SparseJacobian_get_columns", _wrap_SparseJacobian_get_columns, METH_O, "SparseJacobian_get_columns(SparseJacobian self) -> cmf::math::num_array"},
+	 { "SparseJacobian_get_row_start", _wrap_SparseJacobian_get_row_start, METH_O, "SparseJacobian_get_row_start(SparseJacobian self) -> cmf::math::num_array"},
+	 { "delete_SparseJacobian", _wrap_delete_SparseJacobian, METH_O, "delete_SparseJacobian(SparseJacobian self)"},
+	 { "SparseJacobian_swigregister", SparseJacobian_swigregister, METH_O, NULL},
+	 { "SparseJacobian_swiginit", SparseJacobian_swiginit, METH_VARARGS, NULL},
+	 { "new_SparseLU", (PyCFunction)(void(*)(void))_wrap_new_SparseLU, METH_VARARGS|METH_KEYWORDS, "new_SparseLU(cmf::math::num_array const & row_start, cmf::math::num_array const & columns) -> SparseLU"},
+	 { "SparseLU_size", _wrap_SparseLU_size, METH_O, "SparseLU_size(SparseLU self) -> size_t"},
+	 { "SparseLU_nonzeros", _wrap_SparseLU_nonzeros, METH_O, "SparseLU_nonzeros(SparseLU self) -> size_t"},
+	 { "SparseLU_factorize", (PyCFunction)(void(*)(void))_wrap_SparseLU_factorize, METH_VARARGS|METH_KEYWORDS, "SparseLU_factorize(SparseLU self, cmf::math::num_array const & values) -> bool"},
+	 { "SparseLU_solve", (PyCFunction)(void(*)(void))_wrap_SparseLU_solve, METH_VARARGS|METH_KEYWORDS, "SparseLU_solve(SparseLU self, cmf::math::num_array const & b) -> cmf::math::num_array"},
+	 { "delete_SparseLU", _wrap_delete_SparseLU, METH_O, "delete_SparseLU(SparseLU self)"},
+	 { "SparseLU_swigregister", SparseLU_swigregister, METH_O, NULL},
+	 { "SparseLU_swiginit", SparseLU_swiginit, METH_VARARGS, NULL},
+	 { "IMEXIntegrator_dt_min_set", _wrap_IMEXIntegrator_dt_min_set, METH_VARARGS, "IMEXIntegrator_dt_min_set(IMEXIntegrator self, Time dt_min)"},
+	 { "IMEXIntegrator_dt_min_get", _wrap_IMEXIntegrator_dt_min_get, METH_O, "IMEXIntegrator_dt_min_get(IMEXIntegrator self) -> Time"},
+	 { "IMEXIntegrator_max_newton_iterations_set", _wrap_IMEXIntegrator_max_newton_iterations_set, METH_VARARGS, "IMEXIntegrator_max_newton_iterations_set(IMEXIntegrator self, int max_newton_iterations)"},
+	 { "IMEXIntegrator_max_newton_iterations_get", _wrap_IMEXIntegrator_max_newton_iterations_get, METH_O, "IMEXIntegrator_max_newton_iterations_get(IMEXIntegrator self) -> int"},
+	 { "IMEXIntegrator_set_implicit", (PyCFunction)(void(*)(void))_wrap_IMEXIntegrator_set_implicit, METH_VARARGS|METH_KEYWORDS, "IMEXIntegrator_set_implicit(IMEXIntegrator self, int position, bool implicit)"},
+	 { "IMEXIntegrator_is_implicit", (PyCFunction)(void(*)(void))_wrap_IMEXIntegrator_is_implicit, METH_VARARGS|METH_KEYWORDS, "IMEXIntegrator_is_implicit(IMEXIntegrator self, int position) -> bool"},
+	 { "IMEXIntegrator_get_implicit_count", _wrap_IMEXIntegrator_get_implicit_count, METH_O, "IMEXIntegrator_get_implicit_count(IMEXIntegrator self) -> size_t"},
+	 { "IMEXIntegrator_set_implicit_by_type", _wrap_IMEXIntegrator_set_implicit_by_type, METH_O, "IMEXIntegrator_set_implicit_by_type(IMEXIntegrator self)"},
+	 { "IMEXIntegrator_set_implicit_by_stiffness", (PyCFunction)(void(*)(void))_wrap_IMEXIntegrator_set_implicit_by_stiffness, METH_VARARGS|METH_KEYWORDS, "IMEXIntegrator_set_implicit_by_stiffness(IMEXIntegrator self, Time dt)"},
+	 { "IMEXIntegrator_get_rhsevals", _wrap_IMEXIntegrator_get_rhsevals, METH_O, "IMEXIntegrator_get_rhsevals(IMEXIntegrator self) -> int"},
+	 { "new_IMEXIntegrator", _wrap_new_IMEXIntegrator, METH_VARARGS, "\n"
+		"IMEXIntegrator(StateVariableOwner states, real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
+		"IMEXIntegrator(real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
+		"new_IMEXIntegrator(Integrator templ) -> IMEXIntegrator\n"
+		""},
+	 { "delete_IMEXIntegrator", _wrap_delete_IMEXIntegrator, METH_O, "delete_IMEXIntegrator(IMEXIntegrator self)"},
+	 { "IMEXIntegrator_swigregister", IMEXIntegrator_swigregister, METH_O, NULL},
+	 { "IMEXIntegrator_swiginit", IMEXIntegrator_swiginit, METH_VARARGS, NULL},
+	 { "ROS2_dt_min_set", _wrap_ROS2_dt_min_set, METH_VARARGS, "ROS2_dt_min_set(ROS2 self, Time dt_min)"},
+	 { "ROS2_dt_min_get", _wrap_ROS2_dt_min_get, METH_O, "ROS2_dt_min_get(ROS2 self) -> Time"},
+	 { "ROS2_max_jacobian_age_set", _wrap_ROS2_max_jacobian_age_set, METH_VARARGS, "ROS2_max_jacobian_age_set(ROS2 self, int max_jacobian_age)"},
+	 { "ROS2_max_jacobian_age_get", _wrap_ROS2_max_jacobian_age_get, METH_O, "ROS2_max_jacobian_age_get(ROS2 self) -> int"},
+	 { "ROS2_get_rhsevals", _wrap_ROS2_get_rhsevals, METH_O, "ROS2_get_rhsevals(ROS2 self) -> int"},
+	 { "ROS2_get_jacevals", _wrap_ROS2_get_jacevals, METH_O, "ROS2_get_jacevals(ROS2 self) -> int"},
+	 { "new_ROS2", _wrap_new_ROS2, METH_VARARGS, "\n"
+		"ROS2(StateVariableOwner states, real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
+		"ROS2(real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
+		"new_ROS2(Integrator templ) -> ROS2\n"
+		""},
+	 { "delete_ROS2", _wrap_delete_ROS2, METH_O, "delete_ROS2(ROS2 self)"},
+	 { "ROS2_swigregister", ROS2_swigregister, METH_O, NULL},
+	 { "ROS2_swiginit", ROS2_swiginit, METH_VARARGS, NULL},
+	 { "EnsembleIntegrator_copy", _wrap_EnsembleIntegrator_copy, METH_O, "EnsembleIntegrator_copy(EnsembleIntegrator self) -> EnsembleIntegrator"},
+	 { "EnsembleIntegrator_add_member", (PyCFunction)(void(*)(void))_wrap_EnsembleIntegrator_add_member, METH_VARARGS|METH_KEYWORDS, "EnsembleIntegrator_add_member(EnsembleIntegrator self, StateVariableOwner member) -> size_t"},
+	 { "EnsembleIntegrator_get_member_count", _wrap_EnsembleIntegrator_get_member_count, METH_O, "EnsembleIntegrator_get_member_count(EnsembleIntegrator self) -> size_t"},
+	 { "EnsembleIntegrator_get_member_size", _wrap_EnsembleIntegrator_get_member_size, METH_O, "EnsembleIntegrator_get_member_size(EnsembleIntegrator self) -> size_t"},
+	 { "EnsembleIntegrator_get_member", (PyCFunction)(void(*)(void))_wrap_EnsembleIntegrator_get_member, METH_VARARGS|METH_KEYWORDS, "EnsembleIntegrator_get_member(EnsembleIntegrator self, int member) -> StateVariableList"},
+	 { "EnsembleIntegrator_get_member_states", (PyCFunction)(void(*)(void))_wrap_EnsembleIntegrator_get_member_states, METH_VARARGS|METH_KEYWORDS, "EnsembleIntegrator_get_member_states(EnsembleIntegrator self, int member) -> cmf::math::num_array"},
+	 { "new_EnsembleIntegrator", (PyCFunction)(void(*)(void))_wrap_new_EnsembleIntegrator, METH_VARARGS|METH_KEYWORDS, "new_EnsembleIntegrator(Integrator template_integrator) -> EnsembleIntegrator"},
+	 { "delete_EnsembleIntegrator", _wrap_delete_EnsembleIntegrator, METH_O, "delete_EnsembleIntegrator(EnsembleIntegrator self)"},
+	 { "EnsembleIntegrator_swigregister", EnsembleIntegrator_swigregister, METH_O, NULL},
+	 { "EnsembleIntegrator_swiginit", EnsembleIntegrator_swiginit, METH_VARARGS, NULL},
+	 { "SteadyStateSolver_pseudo_dt_set", _wrap_SteadyStateSolver_pseudo_dt_set, METH_VARARGS, "SteadyStateSolver_pseudo_dt_set(SteadyStateSolver self, Time pseudo_dt)"},
+	 { "SteadyStateSolver_pseudo_dt_get", _wrap_SteadyStateSolver_pseudo_dt_get, METH_O, "SteadyStateSolver_pseudo_dt_get(SteadyStateSolver self) -> Time"},
+	 { "SteadyStateSolver_period_set", _wrap_SteadyStateSolver_period_set, METH_VARARGS, "SteadyStateSolver_period_set(SteadyStateSolver self, Time period)"},
+	 { "SteadyStateSolver_period_get", _wrap_SteadyStateSolver_period_get, METH_O, "SteadyStateSolver_period_get(SteadyStateSolver self) -> Time"},
+	 { "SteadyStateSolver_samples_set", _wrap_SteadyStateSolver_samples_set, METH_VARARGS, "SteadyStateSolver_samples_set(SteadyStateSolver self, int samples)"},
+	 { "SteadyStateSolver_samples_get", _wrap_SteadyStateSolver_samples_get, METH_O, "SteadyStateSolver_samples_get(SteadyStateSolver self) -> int"},
+	 { "SteadyStateSolver_max_iterations_set", _wrap_SteadyStateSolver_max_iterations_set, METH_VARARGS, "SteadyStateSolver_max_iterations_set(SteadyStateSolver self, int max_iterations)"},
+	 { "SteadyStateSolver_max_iterations_get", _wrap_SteadyStateSolver_max_iterations_get, METH_O, "SteadyStateSolver_max_iterations_get(SteadyStateSolver self) -> int"},
+	 { "SteadyStateSolver_get_residual", _wrap_SteadyStateSolver_get_residual, METH_O, "SteadyStateSolver_get_residual(SteadyStateSolver self) -> real"},
+	 { "SteadyStateSolver_get_rhsevals", _wrap_SteadyStateSolver_get_rhsevals, METH_O, "SteadyStateSolver_get_rhsevals(SteadyStateSolver self) -> int"},
+	 { "SteadyStateSolver_get_jacevals", _wrap_SteadyStateSolver_get_jacevals, METH_O, "SteadyStateSolver_get_jacevals(SteadyStateSolver self) -> int"},
+	 { "SteadyStateSolver_solve", (PyCFunction)(void(*)(void))_wrap_SteadyStateSolver_solve, METH_VARARGS|METH_KEYWORDS, "SteadyStateSolver_solve(SteadyStateSolver self, Time t) -> int"},
+	 { "new_SteadyStateSolver", _wrap_new_SteadyStateSolver, METH_VARARGS, "\n"
+		"SteadyStateSolver(StateVariableOwner states, real epsilon=1e-6)\n"
+		"SteadyStateSolver(real epsilon=1e-6)\n"
+		"new_SteadyStateSolver(Integrator templ) -> SteadyStateSolver\n"
+		""},
+	 { "delete_SteadyStateSolver", _wrap_delete_SteadyStateSolver, METH_O, "delete_SteadyStateSolver(SteadyStateSolver self)"},
+	 { "SteadyStateSolver_swigregister", SteadyStateSolver_swigregister, METH_O, NULL},
+	 { "SteadyStateSolver_swiginit", SteadyStateSolver_swiginit, METH_VARARGS, NULL},
 	 { NULL, NULL, 0, NULL }
 };
 
@@ -92751,6 +98583,7 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 		"double\n"
 		"get_i(ptrdiff_t i) const \n"
 		""},
+	 { "timeseries_next_jump", (PyCFunction)(void(*)(void))_wrap_timeseries_next_jump, METH_VARARGS|METH_KEYWORDS, "next_jump(timeseries self, Time t) -> Time"},
 	 { "timeseries_set_t", (PyCFunction)(void(*)(void))_wrap_timeseries_set_t, METH_VARARGS|METH_KEYWORDS, "\n"
 		"set_t(timeseries self, Time t, double value)\n"
 		"void\n"
@@ -93395,6 +99228,7 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 		""},
 	 { "flux_node_position_set", _wrap_flux_node_position_set, METH_VARARGS, "flux_node_position_set(flux_node self, point position)"},
 	 { "flux_node_position_get", _wrap_flux_node_position_get, METH_O, "flux_node_position_get(flux_node self) -> point"},
+	 { "flux_node_get_dpotential_dV", _wrap_flux_node_get_dpotential_dV, METH_O, "get_dpotential_dV(flux_node self) -> real"},
 	 { "flux_node_is_empty", _wrap_flux_node_is_empty, METH_O, "\n"
 		"is_empty(flux_node self) -> double\n"
 		"virtual\n"
@@ -95715,6 +101549,10 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 		"cmf::math::num_array dPsiM_dW(const cmf::math::num_array &wetness)\n"
 		"const \n"
 		""},
+	 { "RetentionCurve_dK_dW", _wrap_RetentionCurve_dK_dW, METH_VARARGS, "\n"
+		"dK_dW(RetentionCurve self, real wetness) -> real\n"
+		"dK_dW(RetentionCurve self, cmf::math::num_array const & wetness) -> cmf::math::num_array\n"
+		""},
 	 { "RetentionCurve_Wetness_pF", _wrap_RetentionCurve_Wetness_pF, METH_VARARGS, "\n"
 		"Wetness_pF(RetentionCurve self, real pF) -> real\n"
 		"Wetness_pF(RetentionCurve self, cmf::math::num_array const & pF) -> cmf::math::num_array\n"
@@ -95936,6 +101774,7 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 		"\n"
 		"Returns the actual anisotropic conductivity along a direction :math:`K = (k_f \\\\cdot d) K`. \n"
 		""},
+	 { "SoilLayer_get_dK_dV", (PyCFunction)(void(*)(void))_wrap_SoilLayer_get_dK_dV, METH_VARARGS|METH_KEYWORDS, "get_dK_dV(SoilLayer self, point direction) -> real"},
 	 { "SoilLayer_anisotropic_kf_set", _wrap_SoilLayer_anisotropic_kf_set, METH_VARARGS, "SoilLayer_anisotropic_kf_set(SoilLayer self, point anisotropic_kf)"},
 	 { "SoilLayer_anisotropic_kf_get", _wrap_SoilLayer_anisotropic_kf_get, METH_O, "SoilLayer_anisotropic_kf_get(SoilLayer self) -> point"},
 	 { "SoilLayer_get_capacity", _wrap_SoilLayer_get_capacity, METH_O, "\n"
@@ -98072,6 +103911,50 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "project_cells_get", _wrap_project_cells_get, METH_O, "project_cells_get(project self) -> cell_vector"},
 	 { "project_swigregister", project_swigregister, METH_O, NULL},
 	 { "project_swiginit", project_swiginit, METH_VARARGS, NULL},
+	 { "solver_counters_rhsevals_set", _wrap_solver_counters_rhsevals_set, METH_VARARGS, "solver_counters_rhsevals_set(solver_counters self, long long rhsevals)"},
+	 { "solver_counters_rhsevals_get", _wrap_solver_counters_rhsevals_get, METH_O, "solver_counters_rhsevals_get(solver_counters self) -> long long"},
+	 { "solver_counters_jacevals_set", _wrap_solver_counters_jacevals_set, METH_VARARGS, "solver_counters_jacevals_set(solver_counters self, long long jacevals)"},
+	 { "solver_counters_jacevals_get", _wrap_solver_counters_jacevals_get, METH_O, "solver_counters_jacevals_get(solver_counters self) -> long long"},
+	 { "solver_counters_nonlinear_iterations_set", _wrap_solver_counters_nonlinear_iterations_set, METH_VARARGS, "solver_counters_nonlinear_iterations_set(solver_counters self, long long nonlinear_iterations)"},
+	 { "solver_counters_nonlinear_iterations_get", _wrap_solver_counters_nonlinear_iterations_get, METH_O, "solver_counters_nonlinear_iterations_get(solver_counters self) -> long long"},
+	 { "solver_counters_linear_iterations_set", _wrap_solver_counters_linear_iterations_set, METH_VARARGS, "solver_counters_linear_iterations_set(solver_counters self, long long linear_iterations)"},
+	 { "solver_counters_linear_iterations_get", _wrap_solver_counters_linear_iterations_get, METH_O, "solver_counters_linear_iterations_get(solver_counters self) -> long long"},
+	 { "solver_counters_error_test_failures_set", _wrap_solver_counters_error_test_failures_set, METH_VARARGS, "solver_counters_error_test_failures_set(solver_counters self, long long error_test_failures)"},
+	 { "solver_counters_error_test_failures_get", _wrap_solver_counters_error_test_failures_get, METH_O, "solver_counters_error_test_failures_get(solver_counters self) -> long long"},
+	 { "solver_counters_convergence_failures_set", _wrap_solver_counters_convergence_failures_set, METH_VARARGS, "solver_counters_convergence_failures_set(solver_counters self, long long convergence_failures)"},
+	 { "solver_counters_convergence_failures_get", _wrap_solver_counters_convergence_failures_get, METH_O, "solver_counters_convergence_failures_get(solver_counters self) -> long long"},
+	 { "solver_counters_order_set", _wrap_solver_counters_order_set, METH_VARARGS, "solver_counters_order_set(solver_counters self, int order)"},
+	 { "solver_counters_order_get", _wrap_solver_counters_order_get, METH_O, "solver_counters_order_get(solver_counters self) -> int"},
+	 { "new_solver_counters", _wrap_new_solver_counters, METH_NOARGS, "new_solver_counters() -> solver_counters"},
+	 { "delete_solver_counters", _wrap_delete_solver_counters, METH_O, "delete_solver_counters(solver_counters self)"},
+	 { "solver_counters_swigregister", solver_counters_swigregister, METH_O, NULL},
+	 { "solver_counters_swiginit", solver_counters_swiginit, METH_VARARGS, NULL},
+	 { "step_record_t_set", _wrap_step_record_t_set, METH_VARARGS, "step_record_t_set(step_record self, Time t)"},
+	 { "step_record_t_get", _wrap_step_record_t_get, METH_O, "step_record_t_get(step_record self) -> Time"},
+	 { "step_record_dt_set", _wrap_step_record_dt_set, METH_VARARGS, "step_record_dt_set(step_record self, Time dt)"},
+	 { "step_record_dt_get", _wrap_step_record_dt_get, METH_O, "step_record_dt_get(step_record self) -> Time"},
+	 { "step_record_wall_time_set", _wrap_step_record_wall_time_set, METH_VARARGS, "step_record_wall_time_set(step_record self, double wall_time)"},
+	 { "step_record_wall_time_get", _wrap_step_record_wall_time_get, METH_O, "step_record_wall_time_get(step_record self) -> double"},
+	 { "new_step_record", _wrap_new_step_record, METH_NOARGS, "new_step_record() -> step_record"},
+	 { "delete_step_record", _wrap_delete_step_record, METH_O, "delete_step_record(step_record self)"},
+	 { "step_record_swigregister", step_record_swigregister, METH_O, NULL},
+	 { "step_record_swiginit", step_record_swiginit, METH_VARARGS, NULL},
+	 { "SolverStatistics_record", (PyCFunction)(void(*)(void))_wrap_SolverStatistics_record, METH_VARARGS|METH_KEYWORDS, "record(SolverStatistics self, Time t, Time dt, double wall_time, solver_counters before, solver_counters after)"},
+	 { "SolverStatistics_size", _wrap_SolverStatistics_size, METH_O, "size(SolverStatistics self) -> size_t"},
+	 { "SolverStatistics_get_capacity", _wrap_SolverStatistics_get_capacity, METH_O, "get_capacity(SolverStatistics self) -> size_t"},
+	 { "SolverStatistics_get_record", (PyCFunction)(void(*)(void))_wrap_SolverStatistics_get_record, METH_VARARGS|METH_KEYWORDS, "get_record(SolverStatistics self, ptrdiff_t index) -> step_record"},
+	 { "SolverStatistics_get_total", _wrap_SolverStatistics_get_total, METH_O, "get_total(SolverStatistics self) -> solver_counters"},
+	 { "SolverStatistics_get_steps", _wrap_SolverStatistics_get_steps, METH_O, "get_steps(SolverStatistics self) -> long long"},
+	 { "SolverStatistics_get_wall_time", _wrap_SolverStatistics_get_wall_time, METH_O, "get_wall_time(SolverStatistics self) -> double"},
+	 { "SolverStatistics_get_time", _wrap_SolverStatistics_get_time, METH_O, "get_time(SolverStatistics self) -> Time"},
+	 { "SolverStatistics_open_log", (PyCFunction)(void(*)(void))_wrap_SolverStatistics_open_log, METH_VARARGS|METH_KEYWORDS, "open_log(SolverStatistics self, std::string filename)"},
+	 { "SolverStatistics_close_log", _wrap_SolverStatistics_close_log, METH_O, "close_log(SolverStatistics self)"},
+	 { "SolverStatistics_clear", _wrap_SolverStatistics_clear, METH_O, "clear(SolverStatistics self)"},
+	 { "SolverStatistics_to_string", _wrap_SolverStatistics_to_string, METH_O, "to_string(SolverStatistics self) -> std::string"},
+	 { "new_SolverStatistics", (PyCFunction)(void(*)(void))_wrap_new_SolverStatistics, METH_VARARGS|METH_KEYWORDS, "new_SolverStatistics(size_t capacity=10000) -> SolverStatistics"},
+	 { "delete_SolverStatistics", _wrap_delete_SolverStatistics, METH_O, "delete_SolverStatistics(SolverStatistics self)"},
+	 { "SolverStatistics_swigregister", SolverStatistics_swigregister, METH_O, NULL},
+	 { "SolverStatistics_swiginit", SolverStatistics_swiginit, METH_VARARGS, NULL},
 	 { "Integrator___getitem__", (PyCFunction)(void(*)(void))_wrap_Integrator___getitem__, METH_VARARGS|METH_KEYWORDS, "__getitem__(Integrator self, int position) -> cmf::math::StateVariable::ptr"},
 	 { "Integrator_get_dxdt", (PyCFunction)(void(*)(void))_wrap_Integrator_get_dxdt, METH_VARARGS|METH_KEYWORDS, "\n"
 		"get_dxdt(Integrator self, Time time) -> cmf::math::num_array\n"
@@ -98090,12 +103973,24 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 		"\n"
 		"Adds a single state variable to the integrator. \n"
 		""},
+	 { "Integrator_reorder_states", _wrap_Integrator_reorder_states, METH_O, "reorder_states(Integrator self)"},
+	 { "Integrator_get_bandwidth", _wrap_Integrator_get_bandwidth, METH_O, "get_bandwidth(Integrator self) -> size_t"},
 	 { "Integrator_integratables_set", _wrap_Integrator_integratables_set, METH_VARARGS, "Integrator_integratables_set(Integrator self, integratable_list integratables)"},
 	 { "Integrator_integratables_get", _wrap_Integrator_integratables_get, METH_O, "Integrator_integratables_get(Integrator self) -> integratable_list"},
 	 { "Integrator_reset_integratables_set", _wrap_Integrator_reset_integratables_set, METH_VARARGS, "Integrator_reset_integratables_set(Integrator self, bool reset_integratables)"},
 	 { "Integrator_reset_integratables_get", _wrap_Integrator_reset_integratables_get, METH_O, "Integrator_reset_integratables_get(Integrator self) -> bool"},
 	 { "Integrator_use_OpenMP_set", _wrap_Integrator_use_OpenMP_set, METH_VARARGS, "Integrator_use_OpenMP_set(Integrator self, bool use_OpenMP)"},
 	 { "Integrator_use_OpenMP_get", _wrap_Integrator_use_OpenMP_get, METH_O, "Integrator_use_OpenMP_get(Integrator self) -> bool"},
+	 { "Integrator_use_flux_graph_set", _wrap_Integrator_use_flux_graph_set, METH_VARARGS, "Integrator_use_flux_graph_set(Integrator self, bool use_flux_graph)"},
+	 { "Integrator_use_flux_graph_get", _wrap_Integrator_use_flux_graph_get, METH_O, "Integrator_use_flux_graph_get(Integrator self) -> bool"},
+	 { "Integrator_use_contiguous_states_set", _wrap_Integrator_use_contiguous_states_set, METH_VARARGS, "Integrator_use_contiguous_states_set(Integrator self, bool use_contiguous_states)"},
+	 { "Integrator_use_contiguous_states_get", _wrap_Integrator_use_contiguous_states_get, METH_O, "Integrator_use_contiguous_states_get(Integrator self) -> bool"},
+	 { "Integrator_use_forcing_breakpoints_set", _wrap_Integrator_use_forcing_breakpoints_set, METH_VARARGS, "Integrator_use_forcing_breakpoints_set(Integrator self, bool use_forcing_breakpoints)"},
+	 { "Integrator_use_forcing_breakpoints_get", _wrap_Integrator_use_forcing_breakpoints_get, METH_O, "Integrator_use_forcing_breakpoints_get(Integrator self) -> bool"},
+	 { "Integrator_get_next_breakpoint", (PyCFunction)(void(*)(void))_wrap_Integrator_get_next_breakpoint, METH_VARARGS|METH_KEYWORDS, "get_next_breakpoint(Integrator self, Time t) -> Time"},
+	 { "Integrator_statistics_set", _wrap_Integrator_statistics_set, METH_VARARGS, "Integrator_statistics_set(Integrator self, std::shared_ptr< cmf::math::SolverStatistics > statistics)"},
+	 { "Integrator_statistics_get", _wrap_Integrator_statistics_get, METH_O, "Integrator_statistics_get(Integrator self) -> std::shared_ptr< cmf::math::SolverStatistics >"},
+	 { "Integrator_get_counters", _wrap_Integrator_get_counters, METH_O, "get_counters(Integrator self) -> solver_counters"},
 	 { "Integrator_size", _wrap_Integrator_size, METH_O, "\n"
 		"size(Integrator self) -> size_t\n"
 		"size_t size()\n"
@@ -98200,6 +104095,8 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 		"\n"
 		"reset:  If true, solver is reseted before integration starts \n"
 		""},
+	 { "Integrator_save_checkpoint", (PyCFunction)(void(*)(void))_wrap_Integrator_save_checkpoint, METH_VARARGS|METH_KEYWORDS, "save_checkpoint(Integrator self, std::string filename)"},
+	 { "Integrator_load_checkpoint", (PyCFunction)(void(*)(void))_wrap_Integrator_load_checkpoint, METH_VARARGS|METH_KEYWORDS, "load_checkpoint(Integrator self, std::string filename)"},
 	 { "Integrator___len__", _wrap_Integrator___len__, METH_O, "__len__(Integrator self) -> size_t"},
 	 { "Integrator_swigregister", Integrator_swigregister, METH_O, NULL},
 	 { "BDF2_get_error_position", _wrap_BDF2_get_error_position, METH_O, "\n"
@@ -98211,6 +104108,8 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 		""},
 	 { "BDF2_max_order_set", _wrap_BDF2_max_order_set, METH_VARARGS, "BDF2_max_order_set(BDF2 self, int max_order)"},
 	 { "BDF2_max_order_get", _wrap_BDF2_max_order_get, METH_O, "BDF2_max_order_get(BDF2 self) -> int"},
+	 { "BDF2_use_newton_set", _wrap_BDF2_use_newton_set, METH_VARARGS, "BDF2_use_newton_set(BDF2 self, bool use_newton)"},
+	 { "BDF2_use_newton_get", _wrap_BDF2_use_newton_get, METH_O, "BDF2_use_newton_get(BDF2 self) -> bool"},
 	 { "new_BDF2", _wrap_new_BDF2, METH_VARARGS, "\n"
 		"BDF2(real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
 		"BDF2(StateVariableOwner states, real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
@@ -98261,6 +104160,8 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "HeunIntegrator_swiginit", HeunIntegrator_swiginit, METH_VARARGS, NULL},
 	 { "ImplicitEuler_dt_min_set", _wrap_ImplicitEuler_dt_min_set, METH_VARARGS, "ImplicitEuler_dt_min_set(ImplicitEuler self, Time dt_min)"},
 	 { "ImplicitEuler_dt_min_get", _wrap_ImplicitEuler_dt_min_get, METH_O, "ImplicitEuler_dt_min_get(ImplicitEuler self) -> Time"},
+	 { "ImplicitEuler_use_newton_set", _wrap_ImplicitEuler_use_newton_set, METH_VARARGS, "ImplicitEuler_use_newton_set(ImplicitEuler self, bool use_newton)"},
+	 { "ImplicitEuler_use_newton_get", _wrap_ImplicitEuler_use_newton_get, METH_O, "ImplicitEuler_use_newton_get(ImplicitEuler self) -> bool"},
 	 { "new_ImplicitEuler", _wrap_new_ImplicitEuler, METH_VARARGS, "\n"
 		"ImplicitEuler(StateVariableOwner states, real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
 		"ImplicitEuler(real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
@@ -98292,6 +104193,8 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "RKFIntegrator_swiginit", RKFIntegrator_swiginit, METH_VARARGS, NULL},
 	 { "CVodeIntegrator_preconditioner_set", _wrap_CVodeIntegrator_preconditioner_set, METH_VARARGS, "CVodeIntegrator_preconditioner_set(CVodeIntegrator self, char preconditioner)"},
 	 { "CVodeIntegrator_preconditioner_get", _wrap_CVodeIntegrator_preconditioner_get, METH_O, "CVodeIntegrator_preconditioner_get(CVodeIntegrator self) -> char"},
+	 { "CVodeIntegrator_preconditioner_matrix_set", _wrap_CVodeIntegrator_preconditioner_matrix_set, METH_VARARGS, "CVodeIntegrator_preconditioner_matrix_set(CVodeIntegrator self, char preconditioner_matrix)"},
+	 { "CVodeIntegrator_preconditioner_matrix_get", _wrap_CVodeIntegrator_preconditioner_matrix_get, METH_O, "CVodeIntegrator_preconditioner_matrix_get(CVodeIntegrator self) -> char"},
 	 { "CVodeIntegrator_MaxNonLinearIterations_set", _wrap_CVodeIntegrator_MaxNonLinearIterations_set, METH_VARARGS, "CVodeIntegrator_MaxNonLinearIterations_set(CVodeIntegrator self, int MaxNonLinearIterations)"},
 	 { "CVodeIntegrator_MaxNonLinearIterations_get", _wrap_CVodeIntegrator_MaxNonLinearIterations_get, METH_O, "CVodeIntegrator_MaxNonLinearIterations_get(CVodeIntegrator self) -> int"},
 	 { "CVodeIntegrator_MaxConvergenceFailures_set", _wrap_CVodeIntegrator_MaxConvergenceFailures_set, METH_VARARGS, "CVodeIntegrator_MaxConvergenceFailures_set(CVodeIntegrator self, int MaxConvergenceFailures)"},
@@ -98306,6 +104209,14 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 	 { "CVodeIntegrator_MaxOrder_get", _wrap_CVodeIntegrator_MaxOrder_get, METH_O, "CVodeIntegrator_MaxOrder_get(CVodeIntegrator self) -> int"},
 	 { "CVodeIntegrator_max_step_set", _wrap_CVodeIntegrator_max_step_set, METH_VARARGS, "CVodeIntegrator_max_step_set(CVodeIntegrator self, Time max_step)"},
 	 { "CVodeIntegrator_max_step_get", _wrap_CVodeIntegrator_max_step_get, METH_O, "CVodeIntegrator_max_step_get(CVodeIntegrator self) -> Time"},
+	 { "CVodeIntegrator_use_dense_output_set", _wrap_CVodeIntegrator_use_dense_output_set, METH_VARARGS, "CVodeIntegrator_use_dense_output_set(CVodeIntegrator self, bool use_dense_output)"},
+	 { "CVodeIntegrator_use_dense_output_get", _wrap_CVodeIntegrator_use_dense_output_get, METH_O, "CVodeIntegrator_use_dense_output_get(CVodeIntegrator self) -> bool"},
+	 { "CVodeIntegrator_profile_errors_set", _wrap_CVodeIntegrator_profile_errors_set, METH_VARARGS, "CVodeIntegrator_profile_errors_set(CVodeIntegrator self, bool profile_errors)"},
+	 { "CVodeIntegrator_profile_errors_get", _wrap_CVodeIntegrator_profile_errors_get, METH_O, "CVodeIntegrator_profile_errors_get(CVodeIntegrator self) -> bool"},
+	 { "CVodeIntegrator_get_error_dominance", _wrap_CVodeIntegrator_get_error_dominance, METH_O, "get_error_dominance(CVodeIntegrator self) -> cmf::math::num_array"},
+	 { "CVodeIntegrator_get_error_share", _wrap_CVodeIntegrator_get_error_share, METH_O, "get_error_share(CVodeIntegrator self) -> cmf::math::num_array"},
+	 { "CVodeIntegrator_get_error_profile", (PyCFunction)(void(*)(void))_wrap_CVodeIntegrator_get_error_profile, METH_VARARGS|METH_KEYWORDS, "get_error_profile(CVodeIntegrator self, size_t count=10) -> std::string"},
+	 { "CVodeIntegrator_clear_error_profile", _wrap_CVodeIntegrator_clear_error_profile, METH_O, "clear_error_profile(CVodeIntegrator self)"},
 	 { "CVodeIntegrator_get_order", _wrap_CVodeIntegrator_get_order, METH_O, "\n"
 		"get_order(CVodeIntegrator self) -> int\n"
 		"int\n"
@@ -98382,6 +104293,9 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 		"\n"
 		"Polymorphic copy constructor. \n"
 		""},
+	 { "MultiIntegrator_set_rate", (PyCFunction)(void(*)(void))_wrap_MultiIntegrator_set_rate, METH_VARARGS|METH_KEYWORDS, "set_rate(MultiIntegrator self, int integrator_position, int rate)"},
+	 { "MultiIntegrator_get_rate", (PyCFunction)(void(*)(void))_wrap_MultiIntegrator_get_rate, METH_VARARGS|METH_KEYWORDS, "get_rate(MultiIntegrator self, int integrator_position) -> int"},
+	 { "MultiIntegrator_get_coupling_count", _wrap_MultiIntegrator_get_coupling_count, METH_O, "get_coupling_count(MultiIntegrator self) -> size_t"},
 	 { "MultiIntegrator_add_states_to_integrator", (PyCFunction)(void(*)(void))_wrap_MultiIntegrator_add_states_to_integrator, METH_VARARGS|METH_KEYWORDS, "\n"
 		"add_states_to_integrator(MultiIntegrator self, StateVariableOwner stateOwner, int integrator_position)\n"
 		"void\n"
@@ -98390,8 +104304,11 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 		"\n"
 		"Add state variables from a StateVariableOwner. \n"
 		""},
-	 { "new_MultiIntegrator", (PyCFunction)(void(*)(void))_wrap_new_MultiIntegrator, METH_VARARGS|METH_KEYWORDS, "\n"
-		"new_MultiIntegrator(Integrator template_integrator, int count) -> MultiIntegrator\n"
+	 { "MultiIntegrator_distribute_states", (PyCFunction)(void(*)(void))_wrap_MultiIntegrator_distribute_states, METH_VARARGS|METH_KEYWORDS, "distribute_states(MultiIntegrator self, StateVariableOwner stateOwner) -> size_t"},
+	 { "MultiIntegrator_get_state_count", (PyCFunction)(void(*)(void))_wrap_MultiIntegrator_get_state_count, METH_VARARGS|METH_KEYWORDS, "get_state_count(MultiIntegrator self, int integrator_position) -> size_t"},
+	 { "new_MultiIntegrator", _wrap_new_MultiIntegrator, METH_VARARGS, "\n"
+		"MultiIntegrator(Integrator template_integrator, int count)\n"
+		"new_MultiIntegrator(Integrator template_integrator, int count, StateVariableOwner states) -> MultiIntegrator\n"
 		"MultiIntegrator(const cmf::math::Integrator &template_integrator, int\n"
 		"count)\n"
 		"\n"
@@ -98445,6 +104362,91 @@ static PyMethodDef SwigMethods_proxydocs[] = {
 		""},
 	 { "SoluteWaterIntegrator_swigregister", SoluteWaterIntegrator_swigregister, METH_O, NULL},
 	 { "SoluteWaterIntegrator_swiginit", SoluteWaterIntegrator_swiginit, METH_VARARGS, NULL},
+	 { "SparseJacobian_use_flux_derivatives_set", _wrap_SparseJacobian_use_flux_derivatives_set, METH_VARARGS, "SparseJacobian_use_flux_derivatives_set(SparseJacobian self, bool use_flux_derivatives)"},
+	 { "SparseJacobian_use_flux_derivatives_get", _wrap_SparseJacobian_use_flux_derivatives_get, METH_O, "SparseJacobian_use_flux_derivatives_get(SparseJacobian self) -> bool"},
+	 { "new_SparseJacobian", (PyCFunction)(void(*)(void))_wrap_new_SparseJacobian, METH_VARARGS|METH_KEYWORDS, "new_SparseJacobian(Integrator integ) -> SparseJacobian"},
+	 { "SparseJacobian_size", _wrap_SparseJacobian_size, METH_O, "size(SparseJacobian self) -> size_t"},
+	 { "SparseJacobian_nonzeros", _wrap_SparseJacobian_nonzeros, METH_O, "nonzeros(SparseJacobian self) -> size_t"},
+	 { "SparseJacobian_color_count", _wrap_SparseJacobian_color_count, METH_O, "color_count(SparseJacobian self) -> size_t"},
+	 { "SparseJacobian_derived_columns", _wrap_SparseJacobian_derived_columns, METH_O, "derived_columns(SparseJacobian self) -> size_t"},
+	 { "SparseJacobian_calculate", (PyCFunction)(void(*)(void))_wrap_SparseJacobian_calculate, METH_VARARGS|METH_KEYWORDS, "calculate(SparseJacobian self, Integrator integ, Time t, real delta=1e-6)"},
+	 { "SparseJacobian_get", (PyCFunction)(void(*)(void))_wrap_SparseJacobian_get, METH_VARARGS|METH_KEYWORDS, "get(SparseJacobian self, size_t i, size_t j) -> real"},
+	 { "SparseJacobian_get_values", _wrap_SparseJacobian_get_values, METH_O, "get_values(SparseJacobian self) -> cmf::math::num_array"},
+	 { "SparseJacobian_get_columns", _wrap_SparseJacobian_get_columns, METH_O, "get_columns(SparseJacobian self) -> cmf::math::num_array"},
+	 { "SparseJacobian_get_row_start", _wrap_SparseJacobian_get_row_start, METH_O, "get_row_start(SparseJacobian self) -> cmf::math::num_array"},
+	 { "delete_SparseJacobian", _wrap_delete_SparseJacobian, METH_O, "delete_SparseJacobian(SparseJacobian self)"},
+	 { "SparseJacobian_swigregister", SparseJacobian_swigregister, METH_O, NULL},
+	 { "SparseJacobian_swiginit", SparseJacobian_swiginit, METH_VARARGS, NULL},
+	 { "new_SparseLU", (PyCFunction)(void(*)(void))_wrap_new_SparseLU, METH_VARARGS|METH_KEYWORDS, "new_SparseLU(cmf::math::num_array const & row_start, cmf::math::num_array const & columns) -> SparseLU"},
+	 { "SparseLU_size", _wrap_SparseLU_size, METH_O, "size(SparseLU self) -> size_t"},
+	 { "SparseLU_nonzeros", _wrap_SparseLU_nonzeros, METH_O, "nonzeros(SparseLU self) -> size_t"},
+	 { "SparseLU_factorize", (PyCFunction)(void(*)(void))_wrap_SparseLU_factorize, METH_VARARGS|METH_KEYWORDS, "factorize(SparseLU self, cmf::math::num_array const & values) -> bool"},
+	 { "SparseLU_solve", (PyCFunction)(void(*)(void))_wrap_SparseLU_solve, METH_VARARGS|METH_KEYWORDS, "solve(SparseLU self, cmf::math::num_array const & b) -> cmf::math::num_array"},
+	 { "delete_SparseLU", _wrap_delete_SparseLU, METH_O, "delete_SparseLU(SparseLU self)"},
+	 { "SparseLU_swigregister", SparseLU_swigregister, METH_O, NULL},
+	 { "SparseLU_swiginit", SparseLU_swiginit, METH_VARARGS, NULL},
+	 { "IMEXIntegrator_dt_min_set", _wrap_IMEXIntegrator_dt_min_set, METH_VARARGS, "IMEXIntegrator_dt_min_set(IMEXIntegrator self, Time dt_min)"},
+	 { "IMEXIntegrator_dt_min_get", _wrap_IMEXIntegrator_dt_min_get, METH_O, "IMEXIntegrator_dt_min_get(IMEXIntegrator self) -> Time"},
+	 { "IMEXIntegrator_max_newton_iterations_set", _wrap_IMEXIntegrator_max_newton_iterations_set, METH_VARARGS, "IMEXIntegrator_max_newton_iterations_set(IMEXIntegrator self, int max_newton_iterations)"},
+	 { "IMEXIntegrator_max_newton_iterations_get", _wrap_IMEXIntegrator_max_newton_iterations_get, METH_O, "IMEXIntegrator_max_newton_iterations_get(IMEXIntegrator self) -> int"},
+	 { "IMEXIntegrator_set_implicit", (PyCFunction)(void(*)(void))_wrap_IMEXIntegrator_set_implicit, METH_VARARGS|METH_KEYWORDS, "set_implicit(IMEXIntegrator self, int position, bool implicit)"},
+	 { "IMEXIntegrator_is_implicit", (PyCFunction)(void(*)(void))_wrap_IMEXIntegrator_is_implicit, METH_VARARGS|METH_KEYWORDS, "is_implicit(IMEXIntegrator self, int position) -> bool"},
+	 { "IMEXIntegrator_get_implicit_count", _wrap_IMEXIntegrator_get_implicit_count, METH_O, "get_implicit_count(IMEXIntegrator self) -> size_t"},
+	 { "IMEXIntegrator_set_implicit_by_type", _wrap_IMEXIntegrator_set_implicit_by_type, METH_O, "set_implicit_by_type(IMEXIntegrator self)"},
+	 { "IMEXIntegrator_set_implicit_by_stiffness", (PyCFunction)(void(*)(void))_wrap_IMEXIntegrator_set_implicit_by_stiffness, METH_VARARGS|METH_KEYWORDS, "set_implicit_by_stiffness(IMEXIntegrator self, Time dt)"},
+	 { "IMEXIntegrator_get_rhsevals", _wrap_IMEXIntegrator_get_rhsevals, METH_O, "get_rhsevals(IMEXIntegrator self) -> int"},
+	 { "new_IMEXIntegrator", _wrap_new_IMEXIntegrator, METH_VARARGS, "\n"
+		"IMEXIntegrator(StateVariableOwner states, real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
+		"IMEXIntegrator(real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
+		"new_IMEXIntegrator(Integrator templ) -> IMEXIntegrator\n"
+		""},
+	 { "delete_IMEXIntegrator", _wrap_delete_IMEXIntegrator, METH_O, "delete_IMEXIntegrator(IMEXIntegrator self)"},
+	 { "IMEXIntegrator_swigregister", IMEXIntegrator_swigregister, METH_O, NULL},
+	 { "IMEXIntegrator_swiginit", IMEXIntegrator_swiginit, METH_VARARGS, NULL},
+	 { "ROS2_dt_min_set", _wrap_ROS2_dt_min_set, METH_VARARGS, "ROS2_dt_min_set(ROS2 self, Time dt_min)"},
+	 { "ROS2_dt_min_get", _wrap_ROS2_dt_min_get, METH_O, "ROS2_dt_min_get(ROS2 self) -> Time"},
+	 { "ROS2_max_jacobian_age_set", _wrap_ROS2_max_jacobian_age_set, METH_VARARGS, "ROS2_max_jacobian_age_set(ROS2 self, int max_jacobian_age)"},
+	 { "ROS2_max_jacobian_age_get", _wrap_ROS2_max_jacobian_age_get, METH_O, "ROS2_max_jacobian_age_get(ROS2 self) -> int"},
+	 { "ROS2_get_rhsevals", _wrap_ROS2_get_rhsevals, METH_O, "get_rhsevals(ROS2 self) -> int"},
+	 { "ROS2_get_jacevals", _wrap_ROS2_get_jacevals, METH_O, "get_jacevals(ROS2 self) -> int"},
+	 { "new_ROS2", _wrap_new_ROS2, METH_VARARGS, "\n"
+		"ROS2(StateVariableOwner states, real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
+		"ROS2(real epsilon=1e-9, Time tStepMin=cmf::math::timespan(10))\n"
+		"new_ROS2(Integrator templ) -> ROS2\n"
+		""},
+	 { "delete_ROS2", _wrap_delete_ROS2, METH_O, "delete_ROS2(ROS2 self)"},
+	 { "ROS2_swigregister", ROS2_swigregister, METH_O, NULL},
+	 { "ROS2_swiginit", ROS2_swiginit, METH_VARARGS, NULL},
+	 { "EnsembleIntegrator_copy", _wrap_EnsembleIntegrator_copy, METH_O, "copy(EnsembleIntegrator self) -> EnsembleIntegrator"},
+	 { "EnsembleIntegrator_add_member", (PyCFunction)(void(*)(void))_wrap_EnsembleIntegrator_add_member, METH_VARARGS|METH_KEYWORDS, "add_member(EnsembleIntegrator self, StateVariableOwner member) -> size_t"},
+	 { "EnsembleIntegrator_get_member_count", _wrap_EnsembleIntegrator_get_member_count, METH_O, "get_member_count(EnsembleIntegrator self) -> size_t"},
+	 { "EnsembleIntegrator_get_member_size", _wrap_EnsembleIntegrator_get_member_size, METH_O, "get_member_size(EnsembleIntegrator self) -> size_t"},
+	 { "EnsembleIntegrator_get_member", (PyCFunction)(void(*)(void))_wrap_EnsembleIntegrator_get_member, METH_VARARGS|METH_KEYWORDS, "get_member(EnsembleIntegrator self, int member) -> StateVariableList"},
+	 { "EnsembleIntegrator_get_member_states", (PyCFunction)(void(*)(void))_wrap_EnsembleIntegrator_get_member_states, METH_VARARGS|METH_KEYWORDS, "get_member_states(EnsembleIntegrator self, int member) -> cmf::math::num_array"},
+	 { "new_EnsembleIntegrator", (PyCFunction)(void(*)(void))_wrap_new_EnsembleIntegrator, METH_VARARGS|METH_KEYWORDS, "new_EnsembleIntegrator(Integrator template_integrator) -> EnsembleIntegrator"},
+	 { "delete_EnsembleIntegrator", _wrap_delete_EnsembleIntegrator, METH_O, "delete_EnsembleIntegrator(EnsembleIntegrator self)"},
+	 { "EnsembleIntegrator_swigregister", EnsembleIntegrator_swigregister, METH_O, NULL},
+	 { "EnsembleIntegrator_swiginit", EnsembleIntegrator_swiginit, METH_VARARGS, NULL},
+	 { "SteadyStateSolver_pseudo_dt_set", _wrap_SteadyStateSolver_pseudo_dt_set, METH_VARARGS, "SteadyStateSolver_pseudo_dt_set(SteadyStateSolver self, Time pseudo_dt)"},
+	 { "SteadyStateSolver_pseudo_dt_get", _wrap_SteadyStateSolver_pseudo_dt_get, METH_O, "SteadyStateSolver_pseudo_dt_get(SteadyStateSolver self) -> Time"},
+	 { "SteadyStateSolver_period_set", _wrap_SteadyStateSolver_period_set, METH_VARARGS, "SteadyStateSolver_period_set(SteadyStateSolver self, Time period)"},
+	 { "SteadyStateSolver_period_get", _wrap_SteadyStateSolver_period_get, METH_O, "SteadyStateSolver_period_get(SteadyStateSolver self) -> Time"},
+	 { "SteadyStateSolver_samples_set", _wrap_SteadyStateSolver_samples_set, METH_VARARGS, "SteadyStateSolver_samples_set(SteadyStateSolver self, int samples)"},
+	 { "SteadyStateSolver_samples_get", _wrap_SteadyStateSolver_samples_get, METH_O, "SteadyStateSolver_samples_get(SteadyStateSolver self) -> int"},
+	 { "SteadyStateSolver_max_iterations_set", _wrap_SteadyStateSolver_max_iterations_set, METH_VARARGS, "SteadyStateSolver_max_iterations_set(SteadyStateSolver self, int max_iterations)"},
+	 { "SteadyStateSolver_max_iterations_get", _wrap_SteadyStateSolver_max_iterations_get, METH_O, "SteadyStateSolver_max_iterations_get(SteadyStateSolver self) -> int"},
+	 { "SteadyStateSolver_get_residual", _wrap_SteadyStateSolver_get_residual, METH_O, "get_residual(SteadyStateSolver self) -> real"},
+	 { "SteadyStateSolver_get_rhsevals", _wrap_SteadyStateSolver_get_rhsevals, METH_O, "get_rhsevals(SteadyStateSolver self) -> int"},
+	 { "SteadyStateSolver_get_jacevals", _wrap_SteadyStateSolver_get_jacevals, METH_O, "get_jacevals(SteadyStateSolver self) -> int"},
+	 { "SteadyStateSolver_solve", (PyCFunction)(void(*)(void))_wrap_SteadyStateSolver_solve, METH_VARARGS|METH_KEYWORDS, "solve(SteadyStateSolver self, Time t) -> int"},
+	 { "new_SteadyStateSolver", _wrap_new_SteadyStateSolver, METH_VARARGS, "\n"
+		"SteadyStateSolver(StateVariableOwner states, real epsilon=1e-6)\n"
+		"SteadyStateSolver(real epsilon=1e-6)\n"
+		"new_SteadyStateSolver(Integrator templ) -> SteadyStateSolver\n"
+		""},
+	 { "delete_SteadyStateSolver", _wrap_delete_SteadyStateSolver, METH_O, "delete_SteadyStateSolver(SteadyStateSolver self)"},
+	 { "SteadyStateSolver_swigregister", SteadyStateSolver_swigregister, METH_O, NULL},
+	 { "SteadyStateSolver_swiginit", SteadyStateSolver_swiginit, METH_VARARGS, NULL},
 	 { NULL, NULL, 0, NULL }
 };
 
@@ -99092,6 +105094,21 @@ static void *_p_cmf__math__MultiIntegratorTo_p_cmf__math__Integrator(void *x, in
 static void *_p_cmf__math__SoluteWaterIntegratorTo_p_cmf__math__Integrator(void *x, int *SWIGUNUSEDPARM(newmemory)) {
     return (void *)((cmf::math::Integrator *)  ((cmf::math::SoluteWaterIntegrator *) x));
 }
+static void *_p_cmf__math__IMEXIntegratorTo_p_cmf__math__Integrator(void *x, int *SWIGUNUSEDPARM(newmemory)) {
+    return (void *)((cmf::math::Integrator *)  ((cmf::math::IMEXIntegrator *) x));
+}
+static void *_p_cmf__math__ROS2To_p_cmf__math__Integrator(void *x, int *SWIGUNUSEDPARM(newmemory)) {
+    return (void *)((cmf::math::Integrator *)  ((cmf::math::ROS2 *) x));
+}
+static void *_p_cmf__math__EnsembleIntegratorTo_p_cmf__math__Integrator(void *x, int *SWIGUNUSEDPARM(newmemory)) {
+    return (void *)((cmf::math::Integrator *)  ((cmf::math::EnsembleIntegrator *) x));
+}
+static void *_p_cmf__math__SteadyStateSolverTo_p_cmf__math__Integrator(void *x, int *SWIGUNUSEDPARM(newmemory)) {
+    return (void *)((cmf::math::Integrator *)  ((cmf::math::SteadyStateSolver *) x));
+}
+static void *_p_cmf__math__step_recordTo_p_cmf__math__solver_counters(void *x, int *SWIGUNUSEDPARM(newmemory)) {
+    return (void *)((cmf::math::solver_counters *)  ((cmf::math::step_record *) x));
+}
 static void *_p_cmf__water__NullAdsorptionTo_p_cmf__water__Adsorption(void *x, int *SWIGUNUSEDPARM(newmemory)) {
     return (void *)((cmf::water::Adsorption *)  ((cmf::water::NullAdsorption *) x));
 }
@@ -99127,21 +105144,30 @@ static swig_type_info _swigt__p_cmf__geometry__point_vector = {"_p_cmf__geometry
 static swig_type_info _swigt__p_cmf__math__BDF2 = {"_p_cmf__math__BDF2", "cmf::math::BDF2 *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__CVodeIntegrator = {"_p_cmf__math__CVodeIntegrator", "cmf::math::CVodeIntegrator *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__Date = {"_p_cmf__math__Date", "cmf::math::Date *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_cmf__math__EnsembleIntegrator = {"_p_cmf__math__EnsembleIntegrator", "cmf::math::EnsembleIntegrator *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__ExplicitEuler_fixed = {"_p_cmf__math__ExplicitEuler_fixed", "cmf::math::ExplicitEuler_fixed *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__HeunIntegrator = {"_p_cmf__math__HeunIntegrator", "cmf::math::HeunIntegrator *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_cmf__math__IMEXIntegrator = {"_p_cmf__math__IMEXIntegrator", "cmf::math::IMEXIntegrator *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__ImplicitEuler = {"_p_cmf__math__ImplicitEuler", "cmf::math::ImplicitEuler *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__Integrator = {"_p_cmf__math__Integrator", "cmf::math::Integrator *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__MultiIntegrator = {"_p_cmf__math__MultiIntegrator", "cmf::math::MultiIntegrator *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__RKFIntegrator = {"_p_cmf__math__RKFIntegrator", "cmf::math::RKFIntegrator *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_cmf__math__ROS2 = {"_p_cmf__math__ROS2", "cmf::math::ROS2 *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__SoluteWaterIntegrator = {"_p_cmf__math__SoluteWaterIntegrator", "cmf::math::SoluteWaterIntegrator *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_cmf__math__SolverStatistics = {"_p_cmf__math__SolverStatistics", "cmf::math::SolverStatistics *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_cmf__math__SparseJacobian = {"_p_cmf__math__SparseJacobian", "cmf::math::SparseJacobian *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_cmf__math__SparseLU = {"_p_cmf__math__SparseLU", "cmf::math::SparseLU *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__StateVariable = {"_p_cmf__math__StateVariable", "cmf::math::StateVariable *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__StateVariableList = {"_p_cmf__math__StateVariableList", "cmf::math::StateVariableList *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__StateVariableOwner = {"_p_cmf__math__StateVariableOwner", "cmf::math::StateVariableOwner *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_cmf__math__SteadyStateSolver = {"_p_cmf__math__SteadyStateSolver", "cmf::math::SteadyStateSolver *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__Time = {"_p_cmf__math__Time", "cmf::math::Time *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__cubicspline = {"_p_cmf__math__cubicspline", "cmf::math::cubicspline *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__integratable = {"_p_cmf__math__integratable", "cmf::math::integratable *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__integratable_list = {"_p_cmf__math__integratable_list", "cmf::math::integratable_list *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__num_array = {"_p_cmf__math__num_array", "cmf::math::num_array *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_cmf__math__solver_counters = {"_p_cmf__math__solver_counters", "cmf::math::solver_counters *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_cmf__math__step_record = {"_p_cmf__math__step_record", "cmf::math::step_record *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__math__timeseries = {"_p_cmf__math__timeseries", "cmf::math::timeseries *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__project = {"_p_cmf__project", "cmf::project *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_cmf__river__Channel = {"_p_cmf__river__Channel", "cmf::river::Channel *", 0, 0, (void*)0, 0};
@@ -99283,6 +105309,7 @@ static swig_type_info _swigt__p_std__shared_ptrT_cmf__atmosphere__RainfallStatio
 static swig_type_info _swigt__p_std__shared_ptrT_cmf__atmosphere__RainfallStation_t = {"_p_std__shared_ptrT_cmf__atmosphere__RainfallStation_t", "std::shared_ptr< cmf::atmosphere::RainfallStation > *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__shared_ptrT_cmf__atmosphere__TimeseriesRainSource_t = {"_p_std__shared_ptrT_cmf__atmosphere__TimeseriesRainSource_t", "std::shared_ptr< cmf::atmosphere::TimeseriesRainSource > *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__shared_ptrT_cmf__atmosphere__aerodynamic_resistance_t = {"_p_std__shared_ptrT_cmf__atmosphere__aerodynamic_resistance_t", "std::shared_ptr< cmf::atmosphere::aerodynamic_resistance > *|cmf::atmosphere::aerodynamic_resistance::ptr *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_std__shared_ptrT_cmf__math__SolverStatistics_t = {"_p_std__shared_ptrT_cmf__math__SolverStatistics_t", "std::shared_ptr< cmf::math::SolverStatistics > *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__shared_ptrT_cmf__math__StateVariable_t = {"_p_std__shared_ptrT_cmf__math__StateVariable_t", "cmf::math::StateVariable::ptr *|std::shared_ptr< cmf::math::StateVariable > *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__shared_ptrT_cmf__math__integratable_t = {"_p_std__shared_ptrT_cmf__math__integratable_t", "cmf::math::integratable::ptr *|std::shared_ptr< cmf::math::integratable > *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__shared_ptrT_cmf__river__OpenWaterStorage_t = {"_p_std__shared_ptrT_cmf__river__OpenWaterStorage_t", "std::shared_ptr< cmf::river::OpenWaterStorage > *", 0, 0, (void*)0, 0};
@@ -99338,21 +105365,30 @@ static swig_type_info *swig_type_initial[] = {
   &_swigt__p_cmf__math__BDF2,
   &_swigt__p_cmf__math__CVodeIntegrator,
   &_swigt__p_cmf__math__Date,
+  &_swigt__p_cmf__math__EnsembleIntegrator,
   &_swigt__p_cmf__math__ExplicitEuler_fixed,
   &_swigt__p_cmf__math__HeunIntegrator,
+  &_swigt__p_cmf__math__IMEXIntegrator,
   &_swigt__p_cmf__math__ImplicitEuler,
   &_swigt__p_cmf__math__Integrator,
   &_swigt__p_cmf__math__MultiIntegrator,
   &_swigt__p_cmf__math__RKFIntegrator,
+  &_swigt__p_cmf__math__ROS2,
   &_swigt__p_cmf__math__SoluteWaterIntegrator,
+  &_swigt__p_cmf__math__SolverStatistics,
+  &_swigt__p_cmf__math__SparseJacobian,
+  &_swigt__p_cmf__math__SparseLU,
   &_swigt__p_cmf__math__StateVariable,
   &_swigt__p_cmf__math__StateVariableList,
   &_swigt__p_cmf__math__StateVariableOwner,
+  &_swigt__p_cmf__math__SteadyStateSolver,
   &_swigt__p_cmf__math__Time,
   &_swigt__p_cmf__math__cubicspline,
   &_swigt__p_cmf__math__integratable,
   &_swigt__p_cmf__math__integratable_list,
   &_swigt__p_cmf__math__num_array,
+  &_swigt__p_cmf__math__solver_counters,
+  &_swigt__p_cmf__math__step_record,
   &_swigt__p_cmf__math__timeseries,
   &_swigt__p_cmf__project,
   &_swigt__p_cmf__river__Channel,
@@ -99494,6 +105530,7 @@ static swig_type_info *swig_type_initial[] = {
   &_swigt__p_std__shared_ptrT_cmf__atmosphere__RainfallStation_t,
   &_swigt__p_std__shared_ptrT_cmf__atmosphere__TimeseriesRainSource_t,
   &_swigt__p_std__shared_ptrT_cmf__atmosphere__aerodynamic_resistance_t,
+  &_swigt__p_std__shared_ptrT_cmf__math__SolverStatistics_t,
   &_swigt__p_std__shared_ptrT_cmf__math__StateVariable_t,
   &_swigt__p_std__shared_ptrT_cmf__math__integratable_t,
   &_swigt__p_std__shared_ptrT_cmf__river__OpenWaterStorage_t,
@@ -99549,21 +105586,30 @@ static swig_cast_info _swigc__p_cmf__geometry__point_vector[] = {  {&_swigt__p_c
 static swig_cast_info _swigc__p_cmf__math__BDF2[] = {  {&_swigt__p_cmf__math__BDF2, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__CVodeIntegrator[] = {  {&_swigt__p_cmf__math__CVodeIntegrator, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__Date[] = {  {&_swigt__p_cmf__math__Date, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_cmf__math__EnsembleIntegrator[] = {  {&_swigt__p_cmf__math__EnsembleIntegrator, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__ExplicitEuler_fixed[] = {  {&_swigt__p_cmf__math__ExplicitEuler_fixed, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__HeunIntegrator[] = {  {&_swigt__p_cmf__math__HeunIntegrator, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_cmf__math__IMEXIntegrator[] = {  {&_swigt__p_cmf__math__IMEXIntegrator, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__ImplicitEuler[] = {  {&_swigt__p_cmf__math__ImplicitEuler, 0, 0, 0},{0, 0, 0, 0}};
-static swig_cast_info _swigc__p_cmf__math__Integrator[] = {  {&_swigt__p_cmf__math__BDF2, _p_cmf__math__BDF2To_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__ExplicitEuler_fixed, _p_cmf__math__ExplicitEuler_fixedTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__ImplicitEuler, _p_cmf__math__ImplicitEulerTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__Integrator, 0, 0, 0},  {&_swigt__p_cmf__math__HeunIntegrator, _p_cmf__math__HeunIntegratorTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__RKFIntegrator, _p_cmf__math__RKFIntegratorTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__CVodeIntegrator, _p_cmf__math__CVodeIntegratorTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__MultiIntegrator, _p_cmf__math__MultiIntegratorTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__SoluteWaterIntegrator, _p_cmf__math__SoluteWaterIntegratorTo_p_cmf__math__Integrator, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_cmf__math__Integrator[] = {  {&_swigt__p_cmf__math__BDF2, _p_cmf__math__BDF2To_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__ExplicitEuler_fixed, _p_cmf__math__ExplicitEuler_fixedTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__ImplicitEuler, _p_cmf__math__ImplicitEulerTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__Integrator, 0, 0, 0},  {&_swigt__p_cmf__math__HeunIntegrator, _p_cmf__math__HeunIntegratorTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__RKFIntegrator, _p_cmf__math__RKFIntegratorTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__CVodeIntegrator, _p_cmf__math__CVodeIntegratorTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__MultiIntegrator, _p_cmf__math__MultiIntegratorTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__SoluteWaterIntegrator, _p_cmf__math__SoluteWaterIntegratorTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__IMEXIntegrator, _p_cmf__math__IMEXIntegratorTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__ROS2, _p_cmf__math__ROS2To_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__EnsembleIntegrator, _p_cmf__math__EnsembleIntegratorTo_p_cmf__math__Integrator, 0, 0},  {&_swigt__p_cmf__math__SteadyStateSolver, _p_cmf__math__SteadyStateSolverTo_p_cmf__math__Integrator, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__MultiIntegrator[] = {  {&_swigt__p_cmf__math__MultiIntegrator, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__RKFIntegrator[] = {  {&_swigt__p_cmf__math__RKFIntegrator, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_cmf__math__ROS2[] = {  {&_swigt__p_cmf__math__ROS2, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__SoluteWaterIntegrator[] = {  {&_swigt__p_cmf__math__SoluteWaterIntegrator, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_cmf__math__SolverStatistics[] = {  {&_swigt__p_cmf__math__SolverStatistics, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_cmf__math__SparseJacobian[] = {  {&_swigt__p_cmf__math__SparseJacobian, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_cmf__math__SparseLU[] = {  {&_swigt__p_cmf__math__SparseLU, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__StateVariable[] = {  {&_swigt__p_cmf__math__StateVariable, 0, 0, 0},  {&_swigt__p_cmf__river__Reach, _p_cmf__river__ReachTo_p_cmf__math__StateVariable, 0, 0},  {&_swigt__p_cmf__upslope__SurfaceWater, _p_cmf__upslope__SurfaceWaterTo_p_cmf__math__StateVariable, 0, 0},  {&_swigt__p_cmf__upslope__SoilLayer, _p_cmf__upslope__SoilLayerTo_p_cmf__math__StateVariable, 0, 0},  {&_swigt__p_cmf__upslope__MacroPore, _p_cmf__upslope__MacroPoreTo_p_cmf__math__StateVariable, 0, 0},  {&_swigt__p_cmf__water__SoluteStorage, _p_cmf__water__SoluteStorageTo_p_cmf__math__StateVariable, 0, 0},  {&_swigt__p_cmf__water__WaterStorage, _p_cmf__water__WaterStorageTo_p_cmf__math__StateVariable, 0, 0},  {&_swigt__p_cmf__river__OpenWaterStorage, _p_cmf__river__OpenWaterStorageTo_p_cmf__math__StateVariable, 0, 0},  {&_swigt__p_cmf__upslope__aquifer, _p_cmf__upslope__aquiferTo_p_cmf__math__StateVariable, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__StateVariableList[] = {  {&_swigt__p_cmf__math__StateVariableList, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__StateVariableOwner[] = {  {&_swigt__p_cmf__upslope__cell_vector, _p_cmf__upslope__cell_vectorTo_p_cmf__math__StateVariableOwner, 0, 0},  {&_swigt__p_cmf__math__StateVariableOwner, 0, 0, 0},  {&_swigt__p_cmf__river__Reach, _p_cmf__river__ReachTo_p_cmf__math__StateVariableOwner, 0, 0},  {&_swigt__p_cmf__upslope__SurfaceWater, _p_cmf__upslope__SurfaceWaterTo_p_cmf__math__StateVariableOwner, 0, 0},  {&_swigt__p_cmf__upslope__SoilLayer, _p_cmf__upslope__SoilLayerTo_p_cmf__math__StateVariableOwner, 0, 0},  {&_swigt__p_cmf__upslope__MacroPore, _p_cmf__upslope__MacroPoreTo_p_cmf__math__StateVariableOwner, 0, 0},  {&_swigt__p_cmf__math__StateVariableList, _p_cmf__math__StateVariableListTo_p_cmf__math__StateVariableOwner, 0, 0},  {&_swigt__p_cmf__water__WaterStorage, _p_cmf__water__WaterStorageTo_p_cmf__math__StateVariableOwner, 0, 0},  {&_swigt__p_cmf__river__OpenWaterStorage, _p_cmf__river__OpenWaterStorageTo_p_cmf__math__StateVariableOwner, 0, 0},  {&_swigt__p_cmf__upslope__Cell, _p_cmf__upslope__CellTo_p_cmf__math__StateVariableOwner, 0, 0},  {&_swigt__p_cmf__water__node_list, _p_cmf__water__node_listTo_p_cmf__math__StateVariableOwner, 0, 0},  {&_swigt__p_cmf__upslope__aquifer, _p_cmf__upslope__aquiferTo_p_cmf__math__StateVariableOwner, 0, 0},  {&_swigt__p_cmf__project, _p_cmf__projectTo_p_cmf__math__StateVariableOwner, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_cmf__math__SteadyStateSolver[] = {  {&_swigt__p_cmf__math__SteadyStateSolver, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__Time[] = {  {&_swigt__p_cmf__math__Time, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__cubicspline[] = {  {&_swigt__p_cmf__math__cubicspline, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__integratable[] = {  {&_swigt__p_cmf__math__integratable, 0, 0, 0},  {&_swigt__p_cmf__water__waterbalance_integrator, _p_cmf__water__waterbalance_integratorTo_p_cmf__math__integratable, 0, 0},  {&_swigt__p_cmf__water__flux_integrator, _p_cmf__water__flux_integratorTo_p_cmf__math__integratable, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__integratable_list[] = {  {&_swigt__p_cmf__math__integratable_list, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__num_array[] = {  {&_swigt__p_cmf__math__num_array, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_cmf__math__solver_counters[] = {  {&_swigt__p_cmf__math__solver_counters, 0, 0, 0},  {&_swigt__p_cmf__math__step_record, _p_cmf__math__step_recordTo_p_cmf__math__solver_counters, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_cmf__math__step_record[] = {  {&_swigt__p_cmf__math__step_record, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__math__timeseries[] = {  {&_swigt__p_cmf__math__timeseries, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__project[] = {  {&_swigt__p_cmf__project, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_cmf__river__Channel[] = {  {&_swigt__p_cmf__river__Channel, 0, 0, 0},{0, 0, 0, 0}};
@@ -99705,6 +105751,7 @@ static swig_cast_info _swigc__p_std__shared_ptrT_cmf__atmosphere__RainfallStatio
 static swig_cast_info _swigc__p_std__shared_ptrT_cmf__atmosphere__RainfallStation_t[] = {  {&_swigt__p_std__shared_ptrT_cmf__atmosphere__RainfallStation_t, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__shared_ptrT_cmf__atmosphere__TimeseriesRainSource_t[] = {  {&_swigt__p_std__shared_ptrT_cmf__atmosphere__TimeseriesRainSource_t, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__shared_ptrT_cmf__atmosphere__aerodynamic_resistance_t[] = {  {&_swigt__p_std__shared_ptrT_cmf__upslope__ET__ShuttleworthWallace_t, _p_std__shared_ptrT_cmf__upslope__ET__ShuttleworthWallace_tTo_p_std__shared_ptrT_cmf__atmosphere__aerodynamic_resistance_t, 0, 0},  {&_swigt__p_std__shared_ptrT_cmf__atmosphere__aerodynamic_resistance_t, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_std__shared_ptrT_cmf__math__SolverStatistics_t[] = {  {&_swigt__p_std__shared_ptrT_cmf__math__SolverStatistics_t, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__shared_ptrT_cmf__math__StateVariable_t[] = {  {&_swigt__p_std__shared_ptrT_cmf__water__SoluteStorage_t, _p_std__shared_ptrT_cmf__water__SoluteStorage_tTo_p_std__shared_ptrT_cmf__math__StateVariable_t, 0, 0},  {&_swigt__p_std__shared_ptrT_cmf__water__WaterStorage_t, _p_std__shared_ptrT_cmf__water__WaterStorage_tTo_p_std__shared_ptrT_cmf__math__StateVariable_t, 0, 0},  {&_swigt__p_std__shared_ptrT_cmf__river__OpenWaterStorage_t, _p_std__shared_ptrT_cmf__river__OpenWaterStorage_tTo_p_std__shared_ptrT_cmf__math__StateVariable_t, 0, 0},  {&_swigt__p_std__shared_ptrT_cmf__upslope__MacroPore_t, _p_std__shared_ptrT_cmf__upslope__MacroPore_tTo_p_std__shared_ptrT_cmf__math__StateVariable_t, 0, 0},  {&_swigt__p_std__shared_ptrT_cmf__math__StateVariable_t, 0, 0, 0},  {&_swigt__p_std__shared_ptrT_cmf__upslope__SurfaceWater_t, _p_std__shared_ptrT_cmf__upslope__SurfaceWater_tTo_p_std__shared_ptrT_cmf__math__StateVariable_t, 0, 0},  {&_swigt__p_std__shared_ptrT_cmf__upslope__SoilLayer_t, _p_std__shared_ptrT_cmf__upslope__SoilLayer_tTo_p_std__shared_ptrT_cmf__math__StateVariable_t, 0, 0},  {&_swigt__p_std__shared_ptrT_cmf__river__Reach_t, _p_std__shared_ptrT_cmf__river__Reach_tTo_p_std__shared_ptrT_cmf__math__StateVariable_t, 0, 0},  {&_swigt__p_std__shared_ptrT_cmf__upslope__aquifer_t, _p_std__shared_ptrT_cmf__upslope__aquifer_tTo_p_std__shared_ptrT_cmf__math__StateVariable_t, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__shared_ptrT_cmf__math__integratable_t[] = {  {&_swigt__p_std__shared_ptrT_cmf__water__flux_integrator_t, _p_std__shared_ptrT_cmf__water__flux_integrator_tTo_p_std__shared_ptrT_cmf__math__integratable_t, 0, 0},  {&_swigt__p_std__shared_ptrT_cmf__water__waterbalance_integrator_t, _p_std__shared_ptrT_cmf__water__waterbalance_integrator_tTo_p_std__shared_ptrT_cmf__math__integratable_t, 0, 0},  {&_swigt__p_std__shared_ptrT_cmf__math__integratable_t, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__shared_ptrT_cmf__river__OpenWaterStorage_t[] = {  {&_swigt__p_std__shared_ptrT_cmf__river__OpenWaterStorage_t, 0, 0, 0},  {&_swigt__p_std__shared_ptrT_cmf__upslope__SurfaceWater_t, _p_std__shared_ptrT_cmf__upslope__SurfaceWater_tTo_p_std__shared_ptrT_cmf__river__OpenWaterStorage_t, 0, 0},  {&_swigt__p_std__shared_ptrT_cmf__river__Reach_t, _p_std__shared_ptrT_cmf__river__Reach_tTo_p_std__shared_ptrT_cmf__river__OpenWaterStorage_t, 0, 0},{0, 0, 0, 0}};
@@ -99760,21 +105807,30 @@ static swig_cast_info *swig_cast_initial[] = {
   _swigc__p_cmf__math__BDF2,
   _swigc__p_cmf__math__CVodeIntegrator,
   _swigc__p_cmf__math__Date,
+  _swigc__p_cmf__math__EnsembleIntegrator,
   _swigc__p_cmf__math__ExplicitEuler_fixed,
   _swigc__p_cmf__math__HeunIntegrator,
+  _swigc__p_cmf__math__IMEXIntegrator,
   _swigc__p_cmf__math__ImplicitEuler,
   _swigc__p_cmf__math__Integrator,
   _swigc__p_cmf__math__MultiIntegrator,
   _swigc__p_cmf__math__RKFIntegrator,
+  _swigc__p_cmf__math__ROS2,
   _swigc__p_cmf__math__SoluteWaterIntegrator,
+  _swigc__p_cmf__math__SolverStatistics,
+  _swigc__p_cmf__math__SparseJacobian,
+  _swigc__p_cmf__math__SparseLU,
   _swigc__p_cmf__math__StateVariable,
   _swigc__p_cmf__math__StateVariableList,
   _swigc__p_cmf__math__StateVariableOwner,
+  _swigc__p_cmf__math__SteadyStateSolver,
   _swigc__p_cmf__math__Time,
   _swigc__p_cmf__math__cubicspline,
   _swigc__p_cmf__math__integratable,
   _swigc__p_cmf__math__integratable_list,
   _swigc__p_cmf__math__num_array,
+  _swigc__p_cmf__math__solver_counters,
+  _swigc__p_cmf__math__step_record,
   _swigc__p_cmf__math__timeseries,
   _swigc__p_cmf__project,
   _swigc__p_cmf__river__Channel,
@@ -99916,6 +105972,7 @@ static swig_cast_info *swig_cast_initial[] = {
   _swigc__p_std__shared_ptrT_cmf__atmosphere__RainfallStation_t,
   _swigc__p_std__shared_ptrT_cmf__atmosphere__TimeseriesRainSource_t,
   _swigc__p_std__shared_ptrT_cmf__atmosphere__aerodynamic_resistance_t,
+  _swigc__p_std__shared_ptrT_cmf__math__SolverStatistics_t,
   _swigc__p_std__shared_ptrT_cmf__math__StateVariable_t,
   _swigc__p_std__shared_ptrT_cmf__math__integratable_t,
   _swigc__p_std__shared_ptrT_cmf__river__OpenWaterStorage_t,
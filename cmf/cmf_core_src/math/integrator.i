@@ -1,5 +1,6 @@
 %{
 #include "math/statevariable.h"
+#include "math/integrators/solver_statistics.h"
 #include "math/integrators/integrator.h"
 #include "math/integrators/bdf2.h"
 #include "math/integrators/explicit_euler.h"
@@ -8,12 +9,20 @@
 #include "math/integrators/cvodeintegrator.h"
 #include "math/integrators/multiintegrator.h"
 #include "math/integrators/WaterSoluteIntegrator.h"
+#include "math/integrators/sparse_jacobian.h"
+#include "math/integrators/sparse_lu.h"
+#include "math/integrators/imexintegrator.h"
+#include "math/integrators/ros2.h"
+#include "math/integrators/ensembleintegrator.h"
+#include "math/integrators/steady_state.h"
 %}
 
+%shared_ptr(cmf::math::SolverStatistics);
 %attribute(cmf::math::CVode,int,order,get_order);
 %rename(__getitem__) cmf::math::Integrator::operator[];
 %state_downcast(cmf::math::StateVariable::ptr cmf::math::Integrator::operator[])
 
+%include "math/integrators/solver_statistics.h"
 %include "math/integrators/integrator.h"
 %include "math/integrators/bdf2.h"
 %include "math/integrators/explicit_euler.h"
@@ -22,6 +31,12 @@
 %include "math/integrators/cvodeintegrator.h"
 %include "math/integrators/multiintegrator.h"
 %include "math/integrators/WaterSoluteIntegrator.h"
+%include "math/integrators/sparse_jacobian.h"
+%include "math/integrators/sparse_lu.h"
+%include "math/integrators/imexintegrator.h"
+%include "math/integrators/ros2.h"
+%include "math/integrators/ensembleintegrator.h"
+%include "math/integrators/steady_state.h"
 
 
 %extend__repr__(cmf::math::Integrator);
@@ -1,13 +1,42 @@
 #include "integrator.h"
+#include "../../water/flux_graph.h"
+#include "../../upslope/SoilLayer.h"
+#include "../../water/boundary_condition.h"
+#include "../../atmosphere/precipitation.h"
+#include "../../atmosphere/meteorology.h"
+#include "../../project.h"
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+#include <set>
+#include <chrono>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
 
 
+cmf::math::StateBuffer* cmf::math::Integrator::get_state_buffer() const
+{
+	if (!use_contiguous_states || m_buffer_failed) return 0;
+	if (!m_buffer)
+		m_buffer.reset(new StateBuffer(m_States));
+	if (m_buffer->is_valid()) 
+		return m_buffer.get();
+	// A state is twice in the integrator or has been bound by another buffer. Use the states
+	// directly until the states of the integrator change, instead of binding them again at each call
+	m_buffer.reset();
+	m_buffer_failed = true;
+	return 0;
+}
+
 void cmf::math::Integrator::copy_states( num_array & destination ) const
 {
 	if (destination.size()!=(ptrdiff_t)size())
 		destination.resize(size());
+	if (StateBuffer* buffer = get_state_buffer()) {
+		buffer->copy_to(destination.begin());
+		return;
+	}
 	if (use_OpenMP)
 	{
 #pragma omp parallel for
@@ -28,6 +57,10 @@ void cmf::math::Integrator::copy_states( num_array & destination ) const
 
 void cmf::math::Integrator::copy_states( real * destination ) const
 {
+	if (StateBuffer* buffer = get_state_buffer()) {
+		buffer->copy_to(destination);
+		return;
+	}
 	if (use_OpenMP)
 	{
 #pragma omp parallel for
@@ -49,6 +82,12 @@ void cmf::math::Integrator::copy_dxdt( Time time,num_array & destination,real fa
 {
 	if (destination.size()!=(ptrdiff_t)size())
 		destination.resize(size());
+	if (use_flux_graph) {
+		copy_dxdt(time,destination.begin(),factor);
+		return;
+	}
+	++m_rhs_count;
+	if (m_external) m_external->update(time);
 	std::string err_msg;
 	bool err=false;
 	if (use_OpenMP)
@@ -109,8 +148,132 @@ void cmf::math::Integrator::copy_dxdt( Time time,num_array & destination,real fa
 	}
 }
 
+const cmf::water::flux_graph& cmf::math::Integrator::get_flux_graph() const
+{
+	if (!m_graph || !m_graph->is_valid())
+		m_graph.reset(new cmf::water::flux_graph(m_States));
+	return *m_graph;
+}
+
+namespace {
+	typedef std::vector<std::vector<size_t> > adjacency;
+	// Sorts the neighbours by increasing degree, as required by the Cuthill-McKee ordering
+	struct by_degree {
+		const adjacency& adj;
+		by_degree(const adjacency& _adj) : adj(_adj) {}
+		bool operator()(size_t a, size_t b) const {
+			return adj[a].size() < adj[b].size() || (adj[a].size() == adj[b].size() && a < b);
+		}
+	};
+	// Breadth first search from start through the nodes not yet ordered. Appends the visited nodes 
+	// to queue, with the neighbours of each node by increasing degree, and returns the number of levels
+	size_t breadth_first(const adjacency& adj, size_t start, const std::vector<char>& ordered, 
+	                     std::vector<size_t>& queue, std::vector<size_t>& level)
+	{
+		const size_t none = size_t(-1);
+		size_t first = queue.size();
+		queue.push_back(start);
+		level[start] = 0;
+		size_t levels = 1;
+		std::vector<size_t> next;
+		for (size_t q = first; q < queue.size(); ++q) {
+			size_t i = queue[q];
+			next.clear();
+			for (size_t k = 0; k < adj[i].size(); ++k) {
+				size_t j = adj[i][k];
+				if (!ordered[j] && level[j] == none) next.push_back(j);
+			}
+			std::sort(next.begin(), next.end(), by_degree(adj));
+			for (size_t k = 0; k < next.size(); ++k) {
+				level[next[k]] = level[i] + 1;
+				levels = std::max(levels, level[i] + 2);
+				queue.push_back(next[k]);
+			}
+		}
+		return levels;
+	}
+}
+
+void cmf::math::Integrator::reorder_states()
+{
+	const size_t n = size(), none = size_t(-1);
+	std::vector<size_t> row_start, columns;
+	get_flux_graph().get_sparsity(row_start, columns);
+	// Symmetric adjacency of the states
+	adjacency adj(n);
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t p = row_start[i]; p < row_start[i + 1]; ++p) {
+			if (columns[p] == i) continue;
+			adj[i].push_back(columns[p]);
+			adj[columns[p]].push_back(i);
+		}
+	}
+	for (size_t i = 0; i < n; ++i) {
+		std::sort(adj[i].begin(), adj[i].end());
+		adj[i].erase(std::unique(adj[i].begin(), adj[i].end()), adj[i].end());
+	}
+	std::vector<char> ordered(n, 0);
+	std::vector<size_t> order, queue, level(n, none);
+	order.reserve(n);
+	for (size_t i = 0; i < n; ++i) {
+		if (ordered[i]) continue;
+		// Find a pseudo-peripheral start node of the component: Start with the node of minimal degree
+		// and move to a node of minimal degree in the last level, as long as the number of levels grows
+		queue.clear();
+		breadth_first(adj, i, ordered, queue, level);
+		size_t start = *std::min_element(queue.begin(), queue.end(), by_degree(adj));
+		size_t levels = 0;
+		for (;;) {
+			for (size_t q = 0; q < queue.size(); ++q) level[queue[q]] = none;
+			queue.clear();
+			size_t new_levels = breadth_first(adj, start, ordered, queue, level);
+			if (new_levels <= levels) break;
+			levels = new_levels;
+			size_t candidate = none;
+			for (size_t q = 0; q < queue.size(); ++q) {
+				if (level[queue[q]] == levels - 1 && (candidate == none || by_degree(adj)(queue[q], candidate)))
+					candidate = queue[q];
+			}
+			if (candidate == start) break;
+			start = candidate;
+		}
+		// The last search from start is the Cuthill-McKee order of the component
+		for (size_t q = 0; q < queue.size(); ++q) {
+			level[queue[q]] = none;
+			ordered[queue[q]] = 1;
+		}
+		order.insert(order.end(), queue.begin(), queue.end());
+	}
+	// Reverse the order and apply it to the states
+	state_vector states(n);
+	for (size_t k = 0; k < n; ++k)
+		states[k] = m_States[order[n - 1 - k]];
+	m_States.swap(states);
+	m_graph.reset();
+	m_buffer.reset();
+	m_buffer_failed = false;
+}
+
+size_t cmf::math::Integrator::get_bandwidth() const
+{
+	std::vector<size_t> row_start, columns;
+	get_flux_graph().get_sparsity(row_start, columns);
+	size_t bandwidth = 0;
+	for (size_t i = 0; i + 1 < row_start.size(); ++i) {
+		for (size_t p = row_start[i]; p < row_start[i + 1]; ++p)
+			bandwidth = std::max(bandwidth, columns[p] > i ? columns[p] - i : i - columns[p]);
+	}
+	return bandwidth;
+}
+
 void cmf::math::Integrator::copy_dxdt( Time time,real * destination,real factor/*=1*/ ) const
 {
+	++m_rhs_count;
+	if (m_external) m_external->update(time);
+	if (use_flux_graph) {
+		get_flux_graph().copy_dxdt(time,destination,factor,use_OpenMP);
+		return;
+	}
 	std::string err_msg;
 	bool err=false;
 	if (use_OpenMP)		{
@@ -167,6 +330,10 @@ void cmf::math::Integrator::copy_dxdt( Time time,real * destination,real factor/
 }
 void cmf::math::Integrator::set_states(const num_array & newStates )
 {
+	if (StateBuffer* buffer = get_state_buffer()) {
+		buffer->set(newStates.begin(),use_OpenMP);
+		return;
+	}
 	if (use_OpenMP)
 	{
 #pragma omp parallel for
@@ -187,6 +354,10 @@ void cmf::math::Integrator::set_states(const num_array & newStates )
 
 void cmf::math::Integrator::set_states( real * newStates )
 {
+	if (StateBuffer* buffer = get_state_buffer()) {
+		buffer->set(newStates,use_OpenMP);
+		return;
+	}
 	if (use_OpenMP)
 	{
 #pragma omp parallel for
@@ -232,10 +403,155 @@ void cmf::math::Integrator::integrate_until( cmf::math::Time t_max,cmf::math::Ti
 	if (!dt) dt=m_dt;
 	if (reset_integratables) integratables.reset(start);
 	while (m_t < t_max) {
-		
-		integrate(t_max,dt);
-		integratables.integrate(m_t);
-		++i;
+		// Stop at the next jump of the forcing
+		Time stop = t_max, jump = use_forcing_breakpoints ? get_next_breakpoint(m_t) : never;
+		if (jump > m_t && jump < t_max) stop = jump;
+		while (m_t < stop) {
+			if (statistics) {
+				solver_counters before = get_counters();
+				Time t0 = m_t;
+				std::chrono::steady_clock::time_point wall = std::chrono::steady_clock::now();
+				integrate(stop,dt);
+				std::chrono::duration<double> wall_time = std::chrono::steady_clock::now() - wall;
+				statistics->record(m_t, m_t - t0, wall_time.count(), before, get_counters());
+			} else {
+				integrate(stop,dt);
+			}
+			integratables.integrate(m_t);
+			++i;
+		}
+		if (stop == jump) reset();
 	}
 	if (i>0) m_dt = (t_max - start)/i;
 }
+
+cmf::math::solver_counters cmf::math::Integrator::get_counters() const
+{
+	solver_counters result;
+	result.rhsevals = m_rhs_count;
+	return result;
+}
+
+void cmf::math::Integrator::add_forcing( const timeseries& data ) const
+{
+	if (data.is_empty() || data.size() < 2 || data.interpolationpower() != 0)
+		return;
+	for (size_t i = 0; i < m_forcing.size(); ++i)
+		if (m_forcing[i].data.adress() == data.adress())
+			return;
+	m_forcing.push_back(forcing_jump(data));
+}
+
+void cmf::math::Integrator::collect_forcing() const
+{
+	m_forcing.clear();
+	std::set<const cmf::project*> projects;
+	for (size_t i = 0; i < size(); ++i) {
+		cmf::water::flux_node* node = dynamic_cast<cmf::water::flux_node*>(m_States[i].get());
+		if (!node) continue;
+		// Boundary conditions and rain sources connected to the state
+		cmf::water::connection_list connections = node->get_connections();
+		for (cmf::water::connection_list::const_iterator con = connections.begin(); con != connections.end(); ++con) {
+			cmf::water::flux_node::ptr target = (**con).get_target(*node);
+			if (cmf::water::NeumannBoundary* nbc = dynamic_cast<cmf::water::NeumannBoundary*>(target.get()))
+				add_forcing(nbc->get_flux());
+			else if (cmf::atmosphere::TimeseriesRainSource* rain = dynamic_cast<cmf::atmosphere::TimeseriesRainSource*>(target.get()))
+				add_forcing(rain->data);
+		}
+		// The stations of the project
+		const cmf::project& p = node->get_project();
+		if (!projects.insert(&p).second) continue;
+		for (size_t s = 0; s < p.rainfall_stations.size(); ++s)
+			add_forcing(p.rainfall_stations[ptrdiff_t(s)]->data);
+		for (size_t s = 0; s < p.meteo_stations.size(); ++s) {
+			cmf::atmosphere::MeteoStation::ptr meteo = p.meteo_stations[ptrdiff_t(s)];
+			add_forcing(meteo->T); add_forcing(meteo->Tmax); add_forcing(meteo->Tmin); add_forcing(meteo->Tground);
+			add_forcing(meteo->Windspeed); add_forcing(meteo->rHmean); add_forcing(meteo->rHmin); add_forcing(meteo->rHmax);
+			add_forcing(meteo->Tdew); add_forcing(meteo->Sunshine); add_forcing(meteo->Rs); add_forcing(meteo->T_lapse);
+		}
+	}
+	m_forcing_collected = true;
+}
+
+cmf::math::Time cmf::math::Integrator::get_next_breakpoint( cmf::math::Time t ) const
+{
+	if (!m_forcing_collected) collect_forcing();
+	Time next = never;
+	for (size_t i = 0; i < m_forcing.size(); ++i) {
+		forcing_jump& f = m_forcing[i];
+		// The last search is still valid, if it started before t and found no jump until t
+		if (f.after == never || t < f.after || (f.next != never && f.next <= t)) {
+			f.after = t;
+			f.next = f.data.next_jump(t);
+		}
+		if (f.next != never && (next == never || f.next < next))
+			next = f.next;
+	}
+	return next;
+}
+
+namespace {
+	// Identifies a checkpoint file of cmf
+	const char checkpoint_magic[8] = {'c','m','f','-','c','h','k','1'};
+}
+
+void cmf::math::Integrator::write_checkpoint( std::ostream& out ) const
+{
+	out.write(checkpoint_magic, 8);
+	write_binary(out, (long long)(size()));
+	write_binary(out, m_t.AsMilliseconds());
+	write_binary(out, m_dt.AsMilliseconds());
+	for (size_t i = 0; i < size(); ++i)
+		write_binary(out, get_state(i));
+	// Ice fractions of the soil layers in the order of the states
+	for (size_t i = 0; i < size(); ++i)
+		if (const cmf::upslope::SoilLayer* layer = dynamic_cast<const cmf::upslope::SoilLayer*>(m_States[i].get()))
+			write_binary(out, layer->get_ice_fraction());
+	write_binary(out, (long long)(integratables.size()));
+	for (size_t i = 0; i < integratables.size(); ++i)
+		integratables[int(i)]->write_checkpoint(out);
+}
+
+void cmf::math::Integrator::read_checkpoint( std::istream& in )
+{
+	char magic[8];
+	in.read(magic, 8);
+	if (!in || std::memcmp(magic, checkpoint_magic, 8))
+		throw std::runtime_error("Checkpoint: Not a checkpoint of cmf");
+	if (read_binary<long long>(in) != (long long)(size()))
+		throw std::runtime_error("Checkpoint: The number of states differs from the number of states of the integrator");
+	Time t(read_binary<long long>(in));
+	Time dt(read_binary<long long>(in));
+	num_array states(size());
+	for (size_t i = 0; i < size(); ++i)
+		states[i] = read_binary<real>(in);
+	set_states(states);
+	for (size_t i = 0; i < size(); ++i)
+		if (cmf::upslope::SoilLayer* layer = dynamic_cast<cmf::upslope::SoilLayer*>(m_States[i].get()))
+			layer->set_ice_fraction(read_binary<real>(in));
+	if (read_binary<long long>(in) != (long long)(integratables.size()))
+		throw std::runtime_error("Checkpoint: The number of integratables differs from the integratables of the integrator");
+	for (size_t i = 0; i < integratables.size(); ++i)
+		integratables[int(i)]->read_checkpoint(in);
+	m_dt = dt;
+	// Forget the history of the integrator
+	set_t(t);
+}
+
+void cmf::math::Integrator::save_checkpoint( std::string filename ) const
+{
+	std::ofstream out(filename.c_str(), std::ios::binary);
+	if (!out) 
+		throw std::runtime_error("Checkpoint: Could not open " + filename);
+	write_checkpoint(out);
+	if (!out)
+		throw std::runtime_error("Checkpoint: Could not write " + filename);
+}
+
+void cmf::math::Integrator::load_checkpoint( std::string filename )
+{
+	std::ifstream in(filename.c_str(), std::ios::binary);
+	if (!in) 
+		throw std::runtime_error("Checkpoint: Could not open " + filename);
+	read_checkpoint(in);
+}
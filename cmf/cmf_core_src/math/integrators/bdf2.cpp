@@ -17,6 +17,7 @@
 //   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
 //   
 #include "bdf2.h"
+#include "newton_krylov.h"
 #include <cmath>
 #ifdef _OPENMP
 #include <omp.h>
@@ -28,7 +29,7 @@
 
 // Creates a new Integrator w/o states
 cmf::math::BDF2::BDF2( real epsilon/*=1e-9*/,cmf::math::Time tStepMin/*=Time::Seconds(10)*/) 
-: Integrator(epsilon),	order(1),stepNo(0), dt_min(tStepMin), error_position(-1),max_order(2)
+: Integrator(epsilon),	order(1),stepNo(0), dt_min(tStepMin), error_position(-1),max_order(2),use_newton(false)
 { 
 	// Assessing multistep functions
 	calc_newState[0] = &cmf::math::BDF2::Gear1newState; // impl. Euler
@@ -36,7 +37,7 @@ cmf::math::BDF2::BDF2( real epsilon/*=1e-9*/,cmf::math::Time tStepMin/*=Time::Se
 }
 
 cmf::math::BDF2::BDF2( const Integrator& templ) :
-cmf::math::Integrator(templ),order(1),stepNo(0), error_position(-1),max_order(2)
+cmf::math::Integrator(templ),order(1),stepNo(0), error_position(-1),max_order(2),use_newton(false)
 {
 
 	// Assessing multistep functions
@@ -45,7 +46,7 @@ cmf::math::Integrator(templ),order(1),stepNo(0), error_position(-1),max_order(2)
 }
 
 cmf::math::BDF2::BDF2( cmf::math::StateVariableOwner& states, real epsilon/*=1e-9*/,cmf::math::Time tStepMin/*=Time::Milliseconds(10)*/ )
- : Integrator(states,epsilon), order(1),stepNo(0), dt_min(tStepMin), error_position(-1),max_order(2)
+ : Integrator(states,epsilon), order(1),stepNo(0), dt_min(tStepMin), error_position(-1),max_order(2),use_newton(false)
 {
 	// Assessing multistep functions
 	calc_newState[0] = &cmf::math::BDF2::Gear1newState; // impl. Euler
@@ -60,6 +61,7 @@ void cmf::math::BDF2::add_states( cmf::math::StateVariableOwner& stateOwner )
 	// Resize helper vectors (convergence check,derivatives and history)
 	compareStates.resize(size());
 	dxdt.resize(size());
+	dxdt_start.resize(size());
 	for (int i = 0; i < 2 ; i++)
 		pastStatesArray[i].resize(size());
 }
@@ -98,6 +100,32 @@ void cmf::math::BDF2::Gear1newState( real h )
 	}
 }
 
+// Newton-Krylov iteration for the Gear formulas
+// First order: x_(n+1) = x_(n) + h dxdt
+// Second order: x_(n+1) = ((p+1)^2 x_(n) - p^2 x_(n-1) + h (p+1) dxdt) / (1 + 2p)
+int cmf::math::BDF2::newton_iteration( Time h )
+{
+	if (!m_newton) m_newton.reset(new NewtonKrylov);
+	real beta = h.AsDays();
+	compareStates.resize(size());
+	dxdt.resize(size());
+	if (order == 2)
+	{
+		const real 
+			p    = h.AsDays()/get_dt().AsDays(),
+			p1   = 1 + p;
+		beta *= p1 / (1.0 + 2.0*p);
+		for (ptrdiff_t i = 0; i < ptrdiff_t(size()) ; i++)
+			compareStates[i] = (p1 * p1 * pastStates(0)[i] - p * p * pastStates(1)[i]) / (1.0 + 2.0*p);
+	}
+	else
+		compareStates = pastStates(0);
+	// The Newton updates are scaled by the error tolerance of error_exceedance
+	for (ptrdiff_t i = 0; i < ptrdiff_t(size()) ; i++)
+		dxdt[i] = 1 / (Epsilon + fabs(pastStates(0)[i]) * Epsilon);
+	return m_newton->solve(*this, get_t() + h, beta, compareStates, dxdt);
+}
+
 // Second order
 void cmf::math::BDF2::Gear2newState(real h)
 {
@@ -191,7 +219,55 @@ int cmf::math::BDF2::integrate( cmf::math::Time MaxTime,cmf::math::Time timestep
 	real old_err_ex=REAL_MAX;
 	real err_ex=REAL_MAX/2;
 	m_Iterations=0;
-	do 
+	if (use_newton) 
+	{
+		copy_dxdt(get_t(), dxdt_start);
+		// Without the limit of the fixpoint iteration, the time step is controlled by the local error. The error is estimated
+		// from the difference to the predictor through x_(n-1), x_(n) and dxdt(x_(n)), which is (1+p)/(2+3p) times the 
+		// difference for the second order (p = h/h_(n-1)) and 1/2 for the first order. Halve the time step if the Newton 
+		// iteration fails
+		while (true)
+		{
+			iter = newton_iteration(h);
+			if (iter >= 0)
+			{
+				const real 
+					hd = h.AsDays(),
+					ho = get_dt().AsDays(),
+					p = hd / ho;
+				// dxdt holds the weights of the Newton iteration (see newton_iteration)
+				real err = 0;
+				for (ptrdiff_t i = 0; i < ptrdiff_t(size()) ; i++)
+				{
+					real predicted = pastStates(0)[i] + hd * dxdt_start[i], estimate;
+					if (order == 2)
+					{
+						predicted += hd * hd * (pastStates(1)[i] - pastStates(0)[i] + ho * dxdt_start[i]) / (ho * ho);
+						estimate = (1 + p) / (2 + 3 * p) * (get_state(i) - predicted);
+					}
+					else
+						estimate = 0.5 * (get_state(i) - predicted);
+					err = std::max(err, fabs(estimate) * dxdt[i]);
+				}
+				// BDF2 is L-stable: At the minimal time step the step is taken regardless of the error
+				if (err <= 1 || h <= dt_min) break;
+				h *= std::max(0.2, 0.9 * pow(err, -1.0 / (order + 1)));
+				if (h < dt_min) h = dt_min;
+			}
+			else
+			{
+				h /= 2;
+				if (h<dt_min)
+				{
+					std::cerr << "No convergence! Time=" << get_t().AsDate().to_string() << std::endl;
+					throw std::runtime_error("No convergence with a time step > minimal time step");
+				}
+			}
+			set_states(pastStates(0));
+		}
+		m_Iterations = iter;
+	}
+	else do 
 	{
 		// Remember the current state for convergence criterion
 		copy_states(compareStates);
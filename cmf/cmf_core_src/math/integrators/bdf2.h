@@ -23,9 +23,14 @@
 #include "../real.h"
 namespace cmf {
 	namespace math {
+		class NewtonKrylov;
 
 		/// An order 2 BDF-Method with fixed-point iteration and variable step size
 		///
+		/// With use_newton, the implicit Gear formula is solved by a Jacobian-free Newton-Krylov iteration (NewtonKrylov)
+		/// instead of the fixed-point iteration, which converges for much larger time steps on stiff problems. The time step is
+		/// then controlled by an estimate of the local error
+		///
 		///
 		/// Derived from 
 		///  - Roussel C. and Roussel M. (2003) "Generic Object-Oriented Differential Equation Integrators", 
@@ -44,6 +49,8 @@ namespace cmf {
 			num_array compareStates;
 			/// Array to store the derivatives
 			num_array dxdt;
+			/// Array to store the derivatives at the start of a step for the error estimate of the Newton iteration
+			num_array dxdt_start;
 
 			///History of the last states
 			num_array pastStatesArray[2];
@@ -81,6 +88,10 @@ namespace cmf {
 			//@}
 			real error_exceedance( const num_array& compare,int * biggest_error_position=0);
 			int error_position;
+			/// Newton-Krylov solver, if use_newton is true
+			std::shared_ptr<NewtonKrylov> m_newton;
+			/// Solves the Gear formula of the current order with the Newton-Krylov solver
+			int newton_iteration(Time h);
 		public:
 
 			/// Add state variables from a StateVariableOwner
@@ -92,6 +103,8 @@ namespace cmf {
 			}
 			/// Maximum order, can be 1 (implicit euler) or 2 (BDF2)
 			int max_order;
+			/// If true, the Gear formula is solved by Newton iterations with GMRES instead of a fixed-point iteration (default false)
+			bool use_newton;
 			virtual void reset() {
 				order=1;
 				stepNo = 0;
@@ -114,6 +127,7 @@ namespace cmf {
 			{
 				BDF2* newBDF2 = new BDF2(*this);
 				newBDF2->max_order = max_order;
+				newBDF2->m_newton.reset();
 				return newBDF2;
 			}
 
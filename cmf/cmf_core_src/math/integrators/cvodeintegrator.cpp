@@ -26,6 +26,18 @@
 #include <cvode/cvode_diag.h>
 #include <cvode/cvode_sptfqmr.h>
 #include <nvector/nvector_serial.h>       /* serial N_Vector types, fct. and macros */
+#include <nvector/nvector_openmp.h>       /* OpenMP N_Vector, using the content of the serial vector */
+#include "sundials_cvode/src/cvode_impl.h"  /* for the sparse linear solver */
+#include "sundials_cvode/src/cvode_direct_impl.h" /* for the Jacobian age in checkpoints */
+#include "sundials_cvode/src/cvode_spils_impl.h"
+#include "sparse_jacobian.h"
+#include "sparse_lu.h"
+#include "../../upslope/cell.h"
+#include "../../upslope/surfacewater.h"
+#include <map>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
 #include <sundials/sundials_dense.h> /* use generic DENSE solver in preconditioning */
 #include <sundials/sundials_types.h> /* definition of realtype */
 #include <sundials/sundials_math.h>  /* contains the macros ABS and SQR */
@@ -38,36 +50,249 @@ int cmf::math::CVodeIntegrator::f( realtype t, N_Vector u, N_Vector udot, void *
 	// Get the pointers to the data of the vectors u and udot
 	realtype * udata=NV_DATA_S(u);
 	realtype * dudata=NV_DATA_S(udot);
-	// Get size of the problem
-	int nsize=int(integ->size());
-	// Update the states from the state vector
+	int res = 0;
+	Time T=cmf::math::day * t;
 	try {
+		// Update the states from the state vector. With contiguous states this is a single pass over the state memory
 		integ->set_states(udata);
-	}	catch (std::exception& e) {
+		// Get the derivatives at time T
+		integ->copy_dxdt(T,dudata);
+	} catch (std::exception& e) {
 		std::cerr << e.what() << std::endl;
 		integ->error_msg=e.what();
-		return -8;
+		res = -8;
 	}
-	Time T=cmf::math::day * t;
-	Time T_model = integ->get_t();
-	real sec_local = (T - T_model)/sec;
-	// Get the derivatives at time T
+	return res;
+}
+
+// The sparse linear solver for CVODE. The Jacobian is calculated by a SparseJacobian and reused
+// as long as the dense solver of CVODE would reuse it. The symbolic factorization of I - gamma*J 
+// is done once and only the numeric factorization is repeated
+struct cmf::math::CVodeIntegrator::sparse_solver {
+	SparseJacobian jac;
+	SparseLU lu;
+	// The entries of I - gamma*J
+	std::vector<real> M;
+	// Position of the diagonal entries in the pattern
+	std::vector<size_t> diag;
+	long int nstlj;
+	sparse_solver(const CVodeIntegrator& integ)
+	: jac(integ), lu(jac.row_start(), jac.columns()), M(jac.nonzeros()), diag(jac.size()), nstlj(0)
+	{
+		for (size_t i = 0; i < jac.size(); ++i)
+			diag[i] = std::lower_bound(jac.columns().begin() + jac.row_start()[i], jac.columns().begin() + jac.row_start()[i + 1], i) - jac.columns().begin();
+	}
+	static int linit(CVodeMem cv_mem) {
+		return 0;
+	}
+	static int lsetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred, booleantype *jcurPtr, 
+	                 N_Vector vtemp1, N_Vector vtemp2, N_Vector vtemp3)
+	{
+		CVodeIntegrator* integ = static_cast<CVodeIntegrator*>(cv_mem->cv_user_data);
+		sparse_solver& solver = *integ->m_sparse;
+		// Same criteria for a new Jacobian as the dense solver of CVODE
+		real dgamma = std::abs(cv_mem->cv_gamma / cv_mem->cv_gammap - 1);
+		bool jbad = (cv_mem->cv_nst == 0) || (cv_mem->cv_nst > solver.nstlj + 50) ||
+			((convfail == CV_FAIL_BAD_J) && (dgamma < 0.2)) || (convfail == CV_FAIL_OTHER);
+		*jcurPtr = jbad;
+		if (jbad) {
+			solver.nstlj = cv_mem->cv_nst;
+			int res = integ->calculate_jacobian(solver.jac, NV_DATA_S(ypred), cv_mem->cv_tn);
+			if (res) return res;
+		}
+		// M = I - gamma * J
+		const std::vector<real>& J = solver.jac.values();
+		for (size_t k = 0; k < J.size(); ++k)
+			solver.M[k] = -cv_mem->cv_gamma * J[k];
+		for (size_t i = 0; i < solver.diag.size(); ++i)
+			solver.M[solver.diag[i]] += 1.0;
+		// A zero pivot is a recoverable failure, CVODE retries with a smaller step
+		return solver.lu.factorize(&solver.M[0]) ? 0 : 1;
+	}
+	static int lsolve(CVodeMem cv_mem, N_Vector b, N_Vector weight, N_Vector ycur, N_Vector fcur) 
+	{
+		CVodeIntegrator* integ = static_cast<CVodeIntegrator*>(cv_mem->cv_user_data);
+		integ->m_sparse->lu.solve(NV_DATA_S(b));
+		// Scale the correction to account for the change of gamma (as in CVODE's direct solvers)
+		if (cv_mem->cv_gamrat != 1.0)
+			N_VScale(2.0 / (1.0 + cv_mem->cv_gamrat), b, b);
+		return 0;
+	}
+	static void lfree(CVodeMem cv_mem) {
+		cv_mem->cv_lmem = 0;
+	}
+};
+
+// The block diagonal preconditioner for the Krylov solvers. The states are grouped by the cells 
+// owning them, the blocks of I - gamma*J are copied from a SparseJacobian and factorized as dense matrices
+struct cmf::math::CVodeIntegrator::block_preconditioner {
+	// The block of each state and the entries of the Jacobian within the blocks
+	std::vector<size_t> block;
+	SparseJacobian jac;
+	// The states of each block (compressed rows)
+	std::vector<size_t> block_start;
+	std::vector<size_t> block_state;
+	// Position of the dense matrix (column major) of each block in matrix
+	std::vector<size_t> matrix_start;
+	std::vector<real> matrix;
+	std::vector<realtype*> columns;
+	std::vector<int> pivots;
+	// Entries of the Jacobian inside the blocks, with their position in matrix
+	std::vector<size_t> jac_entry;
+	std::vector<size_t> matrix_entry;
+	// Positions of the diagonal in matrix
+	std::vector<size_t> diag_entry;
+	std::vector<real> work;
+	// Groups the states by the cells owning them
+	static std::vector<size_t> cell_blocks(const CVodeIntegrator& integ)
+	{
+		using namespace cmf::upslope;
+		const size_t n = integ.size();
+		// Find the cells of the soil layers and surface waters
+		std::map<const StateVariable*, size_t> cell_block;
+		std::map<const Cell*, size_t> cells;
+		for (size_t i = 0; i < n; ++i) {
+			const Cell* cell = 0;
+			if (const SoilLayer* layer = dynamic_cast<const SoilLayer*>(integ.m_States[i].get()))
+				cell = &layer->cell;
+			else if (const SurfaceWater* sw = dynamic_cast<const SurfaceWater*>(integ.m_States[i].get()))
+				cell = &sw->get_cell();
+			if (cell && cells.find(cell) == cells.end()) {
+				size_t b = cells.size();
+				cells[cell] = b;
+				StateVariableList cell_states = const_cast<Cell*>(cell)->get_states();
+				for (std::vector<StateVariable::ptr>::const_iterator it = cell_states.begin(); it != cell_states.end(); ++it)
+					cell_block[it->get()] = b;
+			}
+		}
+		// Assign the states to the blocks of their cells, or to a block of their own
+		std::vector<size_t> block(n);
+		size_t blocks = cells.size();
+		for (size_t i = 0; i < n; ++i) {
+			std::map<const StateVariable*, size_t>::const_iterator it = cell_block.find(integ.m_States[i].get());
+			block[i] = it == cell_block.end() ? blocks++ : it->second;
+		}
+		return block;
+	}
+	block_preconditioner(const CVodeIntegrator& integ) 
+	: block(cell_blocks(integ)), jac(integ, block)
+	{
+		const size_t n = block.size();
+		size_t blocks = n ? *std::max_element(block.begin(), block.end()) + 1 : 0;
+		block_start.assign(blocks + 1, 0);
+		for (size_t i = 0; i < n; ++i)
+			++block_start[block[i] + 1];
+		matrix_start.assign(blocks + 1, 0);
+		for (size_t b = 0; b < blocks; ++b) {
+			size_t m = block_start[b + 1];
+			matrix_start[b + 1] = matrix_start[b] + m * m;
+			block_start[b + 1] += block_start[b];
+		}
+		block_state.resize(n);
+		// Position of each state in its block
+		std::vector<size_t> local(n);
+		std::vector<size_t> fill(block_start.begin(), block_start.end() - 1);
+		for (size_t i = 0; i < n; ++i) {
+			local[i] = fill[block[i]] - block_start[block[i]];
+			block_state[fill[block[i]]++] = i;
+		}
+		matrix.assign(matrix_start.back(), 0.0);
+		columns.resize(n);
+		diag_entry.resize(n);
+		for (size_t b = 0; b < blocks; ++b) {
+			size_t m = block_start[b + 1] - block_start[b];
+			for (size_t k = 0; k < m; ++k) {
+				columns[block_start[b] + k] = &matrix[matrix_start[b] + k * m];
+				diag_entry[block_start[b] + k] = matrix_start[b] + k * m + k;
+			}
+		}
+		pivots.resize(n);
+		work.resize(n);
+		// Map the entries of the sparse Jacobian within a block to the dense matrix of the block
+		for (size_t i = 0; i < n; ++i) {
+			size_t m = block_start[block[i] + 1] - block_start[block[i]];
+			for (size_t p = jac.row_start()[i]; p < jac.row_start()[i + 1]; ++p) {
+				size_t j = jac.columns()[p];
+				if (block[j] != block[i]) continue;
+				jac_entry.push_back(p);
+				matrix_entry.push_back(matrix_start[block[i]] + local[j] * m + local[i]);
+			}
+		}
+	}
+	size_t block_count() const {return block_start.size() - 1;}
+	// Calculates the Jacobian, if the old one cannot be used, and factorizes the blocks of I - gamma*J
+	static int psetup(realtype t, N_Vector y, N_Vector fy, booleantype jok, booleantype *jcurPtr, 
+	                  realtype gamma, void *user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+	{
+		CVodeIntegrator* integ = static_cast<CVodeIntegrator*>(user_data);
+		block_preconditioner& prec = *integ->m_blocks;
+		*jcurPtr = !jok;
+		if (!jok) {
+			int res = integ->calculate_jacobian(prec.jac, NV_DATA_S(y), t);
+			if (res) return res;
+		}
+		std::fill(prec.matrix.begin(), prec.matrix.end(), 0.0);
+		const std::vector<real>& J = prec.jac.values();
+		for (size_t k = 0; k < prec.jac_entry.size(); ++k)
+			prec.matrix[prec.matrix_entry[k]] = -gamma * J[prec.jac_entry[k]];
+		for (size_t i = 0; i < prec.diag_entry.size(); ++i)
+			prec.matrix[prec.diag_entry[i]] += 1.0;
+		bool singular = false;
+		#pragma omp parallel for if(integ->use_OpenMP) schedule(guided)
+		for (ptrdiff_t b = 0; b < ptrdiff_t(prec.block_count()); ++b) {
+			int m = int(prec.block_start[b + 1] - prec.block_start[b]);
+			if (denseGETRF(&prec.columns[prec.block_start[b]], m, m, &prec.pivots[prec.block_start[b]])) {
+				#pragma omp critical
+				singular = true;
+			}
+		}
+		// A singular block is a recoverable failure, CVODE retries with a new Jacobian or a smaller step
+		return singular ? 1 : 0;
+	}
+	// Solves the block diagonal system P z = r
+	static int psolve(realtype t, N_Vector y, N_Vector fy, N_Vector r, N_Vector z, 
+	                  realtype gamma, realtype delta, int lr, void *user_data, N_Vector tmp)
+	{
+		CVodeIntegrator* integ = static_cast<CVodeIntegrator*>(user_data);
+		block_preconditioner& prec = *integ->m_blocks;
+		const realtype* rdata = NV_DATA_S(r);
+		realtype* zdata = NV_DATA_S(z);
+		#pragma omp parallel for if(integ->use_OpenMP) schedule(guided)
+		for (ptrdiff_t b = 0; b < ptrdiff_t(prec.block_count()); ++b) {
+			size_t start = prec.block_start[b], m = prec.block_start[b + 1] - start;
+			real* x = &prec.work[start];
+			for (size_t k = 0; k < m; ++k)
+				x[k] = rdata[prec.block_state[start + k]];
+			denseGETRS(&prec.columns[start], int(m), &prec.pivots[start], x);
+			for (size_t k = 0; k < m; ++k)
+				zdata[prec.block_state[start + k]] = x[k];
+		}
+		return 0;
+	}
+};
+
+int cmf::math::CVodeIntegrator::calculate_jacobian( SparseJacobian& jac, real * y, realtype t )
+{
+	int res = 0;
 	try {
-		integ->copy_dxdt(T,dudata);
+		set_states(y);
+		jac.calculate(*this, day * t, sqrt(UNIT_ROUNDOFF));
+		++m_jacevals;
 	} catch (std::exception& e) {
-		std::cerr << e.what() << std::endl;
-		integ->error_msg=e.what();
-		return -8;
+		error_msg = e.what();
+		res = -1;
 	}
-	return 0;
+	return res;
 }
 
 void cmf::math::CVodeIntegrator::release()
 {
 	// If saved vector exists, destroy it
-	if (m_y!=0) N_VDestroy_Serial(m_y);
+	if (m_y!=0) N_VDestroy(m_y);
 	// Destroys any existent solver
 	if (cvode_mem!=0) CVodeFree(&cvode_mem); 
+	m_sparse.reset();
+	m_blocks.reset();
 }
 
 void cmf::math::CVodeIntegrator::initialize()
@@ -75,19 +300,20 @@ void cmf::math::CVodeIntegrator::initialize()
 	release();
 	// size of problem
 	int N=int(m_States.size());              
-	// Allocate vector y
-	m_y=N_VNew_Serial(N);
-	// Pointer to data of vector y
-	realtype * y_data = NV_DATA_S(m_y);      
+	// Allocate vector y. y has its own memory, since CVODE uses y as work vector in the Newton iteration
+	// and evaluates f for other vectors in between. With use_OpenMP, the vector operations of CVODE are 
+	// calculated in parallel. All vectors of CVODE are clones of y
+	m_y = use_OpenMP ? N_VNew_OpenMP(N) : N_VNew_Serial(N);
 	// Copy states to y
-	copy_states(y_data);					 
+	copy_states(NV_DATA_S(m_y));
+
 	// Create a implicit (CV_BDF) solver with Newton iteration (CV_NEWTON)
 	cvode_mem = CVodeCreate(CV_BDF,CV_NEWTON);
 	// Set this wrapper as user data of the solver
 	CVodeSetUserData(cvode_mem,(void *) this);
 	// Local copy of Epsilon needed for CVodeSVtolerances
 	realtype reltol=Epsilon;
-	N_Vector abstol=N_VNew_Serial(N);
+	N_Vector abstol=N_VClone(m_y);
 	realtype * abstol_data=NV_DATA_S(abstol);
 	for (int i = 0; i < N ; ++i)
 		abstol_data[i] = m_States[i]->get_abs_errtol(reltol*1e-3);
@@ -95,6 +321,8 @@ void cmf::math::CVodeIntegrator::initialize()
 	// Allocate memory for solver and set the right hand side function, start time and error tolerance
 	flag=CVodeInit(cvode_mem,cmf::math::CVodeIntegrator::f,get_t().AsDays(),m_y);
 	flag=CVodeSVtolerances(cvode_mem,reltol,abstol);
+	// CVODE keeps a copy of the tolerances
+	N_VDestroy(abstol);
 	if (MaxOrder>2) flag=CVodeSetStabLimDet(cvode_mem,1);
 	flag=CVodeSetMaxOrd(cvode_mem,MaxOrder);
 	flag=CVodeSetMaxNonlinIters(cvode_mem,MaxNonLinearIterations);
@@ -112,23 +340,36 @@ void cmf::math::CVodeIntegrator::initialize()
 	case 2 : flag=CVDiag(cvode_mem);                  break;
 	case 3 : 
 		flag=CVSpgmr(cvode_mem,PREC,maxl);
-		// Create a banded preconditioner
-		flag = CVBandPrecInit(cvode_mem,N,maxl,maxl);
-		// Set GMRS with banded preconditioner
 		break;
 	case 4 : 
 		flag=CVSpbcg(cvode_mem,PREC,maxl);
-		// Create a banded preconditioner
-		flag = CVBandPrecInit(cvode_mem,N,maxl,maxl);
-		// Set GMRS with banded preconditioner
 		break;
 	case 5 : 
 		flag=CVSptfqmr(cvode_mem,PREC,maxl);
-		// Create a banded preconditioner
-		flag = CVBandPrecInit(cvode_mem,N,maxl,maxl);
-		// Set GMRS with banded preconditioner
 		break;
-	default: throw std::runtime_error("Linear solver type not in 0..5");
+	case 6 :
+		{
+			m_sparse.reset(new sparse_solver(*this));
+			CVodeMem cv_mem = static_cast<CVodeMem>(cvode_mem);
+			cv_mem->cv_linit = sparse_solver::linit;
+			cv_mem->cv_lsetup = sparse_solver::lsetup;
+			cv_mem->cv_lsolve = sparse_solver::lsolve;
+			cv_mem->cv_lfree = sparse_solver::lfree;
+			cv_mem->cv_lmem = m_sparse.get();
+			cv_mem->cv_setupNonNull = TRUE;
+		}
+		break;
+	default: throw std::runtime_error("Linear solver type not in 0..6");
+	}
+	if (LinearSolver >= 3 && LinearSolver <= 5 && flag >= 0) {
+		if (preconditioner_matrix == 'C') {
+			// Create a block diagonal preconditioner with the cells as blocks
+			m_blocks.reset(new block_preconditioner(*this));
+			flag = CVSpilsSetPreconditioner(cvode_mem, block_preconditioner::psetup, block_preconditioner::psolve);
+		} else {
+			// Create a banded preconditioner
+			flag = CVBandPrecInit(cvode_mem,N,maxl,maxl);
+		}
 	}
 	if (flag<0) throw std::runtime_error("Could not create CVODE solver");
 
@@ -138,7 +379,7 @@ cmf::math::CVodeIntegrator::~CVodeIntegrator()
 {																																																																					
 	// Destroy y
 	if (m_y)
-		N_VDestroy_Serial(m_y);
+		N_VDestroy(m_y);
 	// Destroy solver
 	if (cvode_mem) CVodeFree(&cvode_mem);
 
@@ -159,9 +400,21 @@ int cmf::math::CVodeIntegrator::integrate( cmf::math::Time MaxTime,cmf::math::Ti
 	// Time step, needed as return value
 	realtype t_ret=this->get_t().AsDays(),
 		t_step=0;
-	CVodeSetStopTime(cvode_mem,MaxTime.AsDays());
 	error_msg="";
-	int res = CVode(cvode_mem,MaxTime.AsDays(),m_y, &t_ret, CV_ONE_STEP);
+	int res = CV_SUCCESS;
+	bool stepped = true;
+	if (use_dense_output) {
+		// The solver steps past MaxTime without a stop time. If the last step reached MaxTime already,
+		// no step is taken and the states are interpolated only
+		static_cast<CVodeMem>(cvode_mem)->cv_tstopset = FALSE;
+		CVodeGetCurrentTime(cvode_mem, &t_ret);
+		stepped = t_ret < MaxTime.AsDays();
+		if (stepped)
+			res = CVode(cvode_mem,MaxTime.AsDays(),m_y, &t_ret, CV_ONE_STEP);
+	} else {
+		CVodeSetStopTime(cvode_mem,MaxTime.AsDays());
+		res = CVode(cvode_mem,MaxTime.AsDays(),m_y, &t_ret, CV_ONE_STEP);
+	}
 	if (res<0) {
 		set_states(y_data);
 		if (error_msg!="")
@@ -183,6 +436,14 @@ int cmf::math::CVodeIntegrator::integrate( cmf::math::Time MaxTime,cmf::math::Ti
 				+ MaxTime.to_string() + "). Please inform cmf maintainer");
 		}
 		m_t = MaxTime;
+	} else if (use_dense_output && t_ret >= MaxTime.AsDays()) {
+		// Interpolate the states at MaxTime with the polynomial of the last step. y is only the output 
+		// vector of CVODE, the internal state of the solver remains at t_ret
+		if (CVodeGetDky(cvode_mem,MaxTime.AsDays(),0,m_y) < 0) {
+			throw std::runtime_error("CVode can not interpolate the states at " + MaxTime.to_string() 
+				+ ", the time is not within the last step (" + (day*(t_ret - t_step)).to_string() + " - " + (day*t_ret).to_string() + ")");
+		}
+		m_t = MaxTime;
 	} else {
 		m_t = t_ret*day;
 	}
@@ -190,9 +451,132 @@ int cmf::math::CVodeIntegrator::integrate( cmf::math::Time MaxTime,cmf::math::Ti
 
 	// Copy result to state variables
 	set_states(y_data);
+	if (profile_errors && stepped)
+		profile_step(m_t.AsDays());
 	return res;
 }
 
+struct cmf::math::CVodeIntegrator::error_profile {
+	// Number of steps with the largest weighted error and the summed shares of the squared WRMS error of each state
+	std::vector<long long> dominance;
+	std::vector<double> share;
+	// Summed absolute fluxes of the connections of the dominating states by the type of the connection
+	std::map<size_t, std::map<std::string, double> > feeding;
+	long long steps;
+	// Memory for the local error and the error weights
+	std::vector<realtype> error, weight;
+	error_profile(size_t n) : dominance(n), share(n), steps(0), error(n), weight(n) {}
+};
+
+void cmf::math::CVodeIntegrator::profile_step( realtype t )
+{
+	size_t n = size();
+	if (!m_profile || m_profile->dominance.size() != n)
+		m_profile.reset(new error_profile(n));
+	error_profile& prof = *m_profile;
+	N_Vector ele = N_VMake_Serial(long(n), &prof.error[0]), ewt = N_VMake_Serial(long(n), &prof.weight[0]);
+	bool valid = CVodeGetEstLocalErrors(cvode_mem, ele) == CV_SUCCESS && CVodeGetErrWeights(cvode_mem, ewt) == CV_SUCCESS;
+	N_VDestroy(ele);
+	N_VDestroy(ewt);
+	if (!valid) return;
+	// The squared weighted errors and the dominating state
+	real sum = 0, largest = -1;
+	size_t dominant = 0;
+	for (size_t i = 0; i < n; ++i) {
+		real e = std::abs(prof.error[i] * prof.weight[i]);
+		prof.error[i] = e * e;
+		sum += e * e;
+		if (e > largest) {
+			largest = e;
+			dominant = i;
+		}
+	}
+	if (!(sum > 0)) return;
+	++prof.steps;
+	for (size_t i = 0; i < n; ++i)
+		prof.share[i] += prof.error[i] / sum;
+	++prof.dominance[dominant];
+	// The connections feeding the dominating state
+	if (cmf::water::flux_node* node = dynamic_cast<cmf::water::flux_node*>(m_States[dominant].get())) {
+		std::map<std::string, double>& types = prof.feeding[dominant];
+		cmf::water::connection_list connections = node->get_connections();
+		for (cmf::water::connection_list::const_iterator con = connections.begin(); con != connections.end(); ++con) {
+			try {
+				types[(**con).type] += std::abs((**con).q(*node, day * t));
+			} catch (std::exception&) {
+				// The profile does not stop the integration
+			}
+		}
+	}
+}
+
+cmf::math::num_array cmf::math::CVodeIntegrator::get_error_dominance() const
+{
+	num_array result(size());
+	if (m_profile && m_profile->dominance.size() == size())
+		for (size_t i = 0; i < size(); ++i)
+			result[i] = real(m_profile->dominance[i]);
+	return result;
+}
+
+cmf::math::num_array cmf::math::CVodeIntegrator::get_error_share() const
+{
+	num_array result(size());
+	if (m_profile && m_profile->steps && m_profile->share.size() == size())
+		for (size_t i = 0; i < size(); ++i)
+			result[i] = m_profile->share[i] / m_profile->steps;
+	return result;
+}
+
+namespace {
+	// Orders the states by the number of dominated steps, descending
+	struct more_dominant {
+		const std::vector<long long>& dominance;
+		more_dominant(const std::vector<long long>& _dominance) : dominance(_dominance) {}
+		bool operator()(size_t a, size_t b) const {
+			return dominance[a] > dominance[b];
+		}
+	};
+	// Orders the connection types by their summed flux, descending
+	bool larger_flux(const std::pair<std::string, double>& a, const std::pair<std::string, double>& b) {
+		return a.second > b.second;
+	}
+}
+
+std::string cmf::math::CVodeIntegrator::get_error_profile( size_t count/*=10*/ ) const
+{
+	if (!m_profile || !m_profile->steps || m_profile->dominance.size() != size())
+		return "No steps profiled";
+	const error_profile& prof = *m_profile;
+	std::vector<size_t> order(size());
+	for (size_t i = 0; i < order.size(); ++i)
+		order[i] = i;
+	count = std::min(count, order.size());
+	std::partial_sort(order.begin(), order.begin() + count, order.end(), more_dominant(prof.dominance));
+	std::stringstream out;
+	out << prof.steps << " steps profiled";
+	for (size_t k = 0; k < count && prof.dominance[order[k]] > 0; ++k) {
+		size_t i = order[k];
+		out << "\n" << m_States[i]->to_string() << ": dominates " << prof.dominance[i] << " steps (" 
+			<< 100.0 * prof.dominance[i] / prof.steps << "%), mean error share " << 100.0 * prof.share[i] / prof.steps << "%";
+		std::map<size_t, std::map<std::string, double> >::const_iterator feeding = prof.feeding.find(i);
+		if (feeding == prof.feeding.end()) continue;
+		std::vector<std::pair<std::string, double> > types(feeding->second.begin(), feeding->second.end());
+		std::sort(types.begin(), types.end(), larger_flux);
+		double total = 0;
+		for (size_t j = 0; j < types.size(); ++j)
+			total += types[j].second;
+		for (size_t j = 0; j < types.size() && total > 0; ++j)
+			out << "\n    " << types[j].first << ": " << 100.0 * types[j].second / total << "% of the flux";
+	}
+	return out.str();
+}
+
+void cmf::math::CVodeIntegrator::clear_error_profile()
+{
+	m_profile.reset();
+}
+
 void cmf::math::CVodeIntegrator::reset()
 {
 	if (cvode_mem) {
@@ -202,6 +586,103 @@ void cmf::math::CVodeIntegrator::reset()
 	}
 }
 
+void cmf::math::CVodeIntegrator::write_checkpoint( std::ostream& out ) const
+{
+	Integrator::write_checkpoint(out);
+	CVodeMem cv_mem = static_cast<CVodeMem>(cvode_mem);
+	// Only a solver with at least one step has a history
+	long long history = cv_mem && cv_mem->cv_nst > 0 ? 1 : 0;
+	write_binary(out, history);
+	if (!history) return;
+	int ints[] = {cv_mem->cv_qmax, cv_mem->cv_q, cv_mem->cv_qprime, cv_mem->cv_next_q, cv_mem->cv_qwait, cv_mem->cv_L,
+		cv_mem->cv_qu, cv_mem->cv_nscon};
+	for (size_t i = 0; i < sizeof(ints) / sizeof(int); ++i)
+		write_binary(out, ints[i]);
+	write_binary(out, (long long)(cv_mem->cv_nst));
+	realtype reals[] = {cv_mem->cv_tn, cv_mem->cv_h, cv_mem->cv_hprime, cv_mem->cv_next_h, cv_mem->cv_eta, cv_mem->cv_hscale, 
+		cv_mem->cv_hu, cv_mem->cv_saved_tq5, cv_mem->cv_etamax, cv_mem->cv_gamma, cv_mem->cv_gammap, cv_mem->cv_crate};
+	for (size_t i = 0; i < sizeof(reals) / sizeof(realtype); ++i)
+		write_binary(out, reals[i]);
+	for (int i = 0; i <= L_MAX; ++i) 
+		write_binary(out, cv_mem->cv_tau[i]);
+	for (int i = 0; i <= NUM_TESTS; ++i) 
+		write_binary(out, cv_mem->cv_tq[i]);
+	for (int i = 0; i < 6; ++i) 
+		for (int j = 0; j < 4; ++j) 
+			write_binary(out, cv_mem->cv_ssdat[i][j]);
+	// The Nordsieck array, including the saved correction in zn[qmax]
+	for (int j = 0; j <= cv_mem->cv_qmax; ++j)
+		out.write(reinterpret_cast<const char*>(NV_DATA_S(cv_mem->cv_zn[j])), size() * sizeof(realtype));
+}
+
+void cmf::math::CVodeIntegrator::read_checkpoint( std::istream& in )
+{
+	Integrator::read_checkpoint(in);
+	// Checkpoints of other integrators have no history
+	if (in.peek() == std::char_traits<char>::eof() || !read_binary<long long>(in)) return;
+	if (!cvode_mem || !m_y) initialize();
+	CVodeMem cv_mem = static_cast<CVodeMem>(cvode_mem);
+	int ints[8];
+	for (size_t i = 0; i < 8; ++i)
+		ints[i] = read_binary<int>(in);
+	long long nst = read_binary<long long>(in);
+	realtype reals[12];
+	for (size_t i = 0; i < 12; ++i)
+		reals[i] = read_binary<realtype>(in);
+	realtype tau[L_MAX + 1], tq[NUM_TESTS + 1], ssdat[6][4];
+	for (int i = 0; i <= L_MAX; ++i) 
+		tau[i] = read_binary<realtype>(in);
+	for (int i = 0; i <= NUM_TESTS; ++i) 
+		tq[i] = read_binary<realtype>(in);
+	for (int i = 0; i < 6; ++i) 
+		for (int j = 0; j < 4; ++j) 
+			ssdat[i][j] = read_binary<realtype>(in);
+	int qmax = ints[0];
+	std::vector<realtype> zn(size() * (qmax + 1));
+	if (!zn.empty()) 
+		in.read(reinterpret_cast<char*>(&zn[0]), zn.size() * sizeof(realtype));
+	if (!in) 
+		throw std::runtime_error("Checkpoint: Unexpected end of file");
+	// With a different maximum order the history can not be used, the solver starts anew
+	if (qmax != cv_mem->cv_qmax) return;
+	cv_mem->cv_q = ints[1]; cv_mem->cv_qprime = ints[2]; cv_mem->cv_next_q = ints[3]; 
+	cv_mem->cv_qwait = ints[4]; cv_mem->cv_L = ints[5]; cv_mem->cv_qu = ints[6]; cv_mem->cv_nscon = ints[7];
+	cv_mem->cv_tn = reals[0]; cv_mem->cv_h = reals[1]; cv_mem->cv_hprime = reals[2]; cv_mem->cv_next_h = reals[3]; 
+	cv_mem->cv_eta = reals[4]; cv_mem->cv_hscale = reals[5]; cv_mem->cv_hu = reals[6]; cv_mem->cv_saved_tq5 = reals[7]; 
+	cv_mem->cv_etamax = reals[8]; cv_mem->cv_gamma = reals[9]; cv_mem->cv_gammap = reals[10]; cv_mem->cv_crate = reals[11];
+	cv_mem->cv_tretlast = cv_mem->cv_tn;
+	std::copy(tau, tau + L_MAX + 1, cv_mem->cv_tau);
+	std::copy(tq, tq + NUM_TESTS + 1, cv_mem->cv_tq);
+	for (int i = 0; i < 6; ++i) 
+		std::copy(ssdat[i], ssdat[i] + 4, cv_mem->cv_ssdat[i]);
+	for (int j = 0; j <= qmax; ++j)
+		std::copy(zn.begin() + j * size(), zn.begin() + (j + 1) * size(), NV_DATA_S(cv_mem->cv_zn[j]));
+	cv_mem->cv_nst = nst;
+	cv_mem->cv_h0u = cv_mem->cv_hu;
+	// CVODE skips its initial setup for a solver with steps. Set the data of the error weights and initialize the linear solver
+	cv_mem->cv_e_data = cv_mem;
+	if (cv_mem->cv_linit && cv_mem->cv_linit(cv_mem) != 0)
+		throw std::runtime_error("Checkpoint: The linear solver of CVODE could not be initialized");
+	// The Jacobians of the linear solvers are not saved. An outdated setup (20 steps) and Jacobian 
+	// (50 steps) make the first step after the checkpoint calculate a new Jacobian
+	cv_mem->cv_nstlp = nst - 20;
+	switch (LinearSolver)
+	{
+	case 0 : 
+	case 1 : 
+		static_cast<CVDlsMem>(cv_mem->cv_lmem)->d_nstlj = nst - CVD_MSBJ - 1; 
+		break;
+	case 3 :
+	case 4 :
+	case 5 :
+		static_cast<CVSpilsMem>(cv_mem->cv_lmem)->s_nstlpre = nst - CVSPILS_MSBPRE - 1;
+		break;
+	case 6 :
+		m_sparse->nstlj = nst - 51;
+		break;
+	}
+}
+
 int cmf::math::CVodeIntegrator::get_order() const
 {
 	int result;
@@ -211,15 +692,16 @@ int cmf::math::CVodeIntegrator::get_order() const
 
 cmf::math::num_array cmf::math::CVodeIntegrator::get_error() const
 {
-	N_Vector ele = N_VNew_Serial(long(size()));
-	N_Vector eweight = N_VNew_Serial(long(size()));
+	N_Vector ele = N_VClone(m_y);
+	N_Vector eweight = N_VClone(m_y);
 	CVodeGetEstLocalErrors(cvode_mem,ele);
 	CVodeGetErrWeights(cvode_mem,eweight);
-	N_Vector result = N_VNew_Serial(long(size()));
+	N_Vector result = N_VClone(m_y);
 	N_VProd(ele,eweight,result);
 	num_array res(NV_DATA_S(result),NV_DATA_S(result)+size());
-	N_VDestroy_Serial(ele);
-	N_VDestroy_Serial(eweight);
+	N_VDestroy(ele);
+	N_VDestroy(eweight);
+	N_VDestroy(result);
 	return res;
 
 }
@@ -235,6 +717,33 @@ int cmf::math::CVodeIntegrator::get_nonlinear_iterations() const
 	}
 }
 
+cmf::math::solver_counters cmf::math::CVodeIntegrator::get_counters() const
+{
+	solver_counters result = Integrator::get_counters();
+	result.jacevals = m_jacevals;
+	if (!cvode_mem) return result;
+	long value = 0;
+	CVodeGetNumNonlinSolvIters(cvode_mem, &value);
+	result.nonlinear_iterations = value;
+	CVodeGetNumErrTestFails(cvode_mem, &value);
+	result.error_test_failures = value;
+	CVodeGetNumNonlinSolvConvFails(cvode_mem, &value);
+	result.convergence_failures = value;
+	CVodeGetLastOrder(cvode_mem, &result.order);
+	if (LinearSolver == 0 || LinearSolver == 1) {
+		// Dense and banded Jacobians of CVODE
+		if (CVDlsGetNumJacEvals(cvode_mem, &value) == CVDLS_SUCCESS)
+			result.jacevals += value;
+	} else if (LinearSolver >= 3 && LinearSolver <= 5) {
+		if (CVSpilsGetNumLinIters(cvode_mem, &value) == CVSPILS_SUCCESS)
+			result.linear_iterations = value;
+		// The banded preconditioner of CVODE
+		if (preconditioner != 'N' && preconditioner_matrix == 'B' && CVSpilsGetNumPrecEvals(cvode_mem, &value) == CVSPILS_SUCCESS)
+			result.jacevals += value;
+	}
+	return result;
+}
+
 int cmf::math::CVodeIntegrator::get_rhsevals() const
 {
 	if (cvode_mem) {
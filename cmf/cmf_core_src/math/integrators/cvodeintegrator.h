@@ -24,13 +24,36 @@
 #include "integrator.h"
 namespace cmf {
 	namespace math {
+#ifndef SWIG
+		class SparseJacobian;
+#endif
 		/// A wrapper class for the CVODE integrator from the SUNDIALS library
 		///
 		/// https://computation.llnl.gov/casc/sundials/main.html
+		///
+		/// With use_contiguous_states, the states are updated for each evaluation of the right hand side 
+		/// by a single pass over the state memory
 		class CVodeIntegrator : public Integrator
 		{
 		private:
 			N_Vector m_y;
+#ifndef SWIG
+			/// The sparse direct linear solver (LinearSolver=6)
+			struct sparse_solver;
+			std::shared_ptr<sparse_solver> m_sparse;
+			/// The block diagonal preconditioner of the Krylov solvers (preconditioner_matrix='C')
+			struct block_preconditioner;
+			std::shared_ptr<block_preconditioner> m_blocks;
+			/// Calculates the Jacobian at the states y
+			int calculate_jacobian(SparseJacobian& jac, real * y, realtype t);
+			/// Number of sparse Jacobians calculated by calculate_jacobian
+			long long m_jacevals;
+			/// The tally of the states dominating the local error (profile_errors)
+			struct error_profile;
+			std::shared_ptr<error_profile> m_profile;
+			/// Adds the local error of the last step to the error profile
+			void profile_step(realtype t);
+#endif
 			void * cvode_mem, * precond_mem;
 			/// The right handside function f in eq. \f$\frac{dy}{dt}=f(t,y)\f$
 			static int f(realtype t, N_Vector u, N_Vector udot, void *f_data);
@@ -41,6 +64,12 @@ namespace cmf {
 			/// - 'L' Left hand side banded preconditioning
 			/// - 'R' Right hand side preconditioning
 			char preconditioner;
+			/// Matrix used as preconditioner by the Krylov solvers (LinearSolver 3..5). Must have one of the following values:
+			/// - 'B' Banded matrix with maxl diagonals above and below the main diagonal (default)
+			/// - 'C' Block diagonal matrix with one dense block for the states of each cell (the soil layers, the surface water and the
+			///       other storages of the cell with their solutes). The blocks are taken from the sparse Jacobian (see cmf::math::SparseJacobian),
+			///       factorized and solved in parallel. Other states get a block of their own
+			char preconditioner_matrix;
 			/// Specifies the maximum number of nonlinear solver iterations at one step
 			int MaxNonLinearIterations;
 			/// Specifies the maximum number of nonlinear solver convergence failures at one step
@@ -56,11 +85,42 @@ namespace cmf {
 			/// - 3 = Iterative Krylov solver with scaled preconditioned GMRES
 			/// - 4 = Iterative Krylov solver with scaled preconditioned Bi-CGStab
 			/// - 5 = Iterative Krylov solver with scaled preconditioned TFQMR
+			/// - 6 = Sparse direct solver (LU factorization) with a finite difference Jacobian, using the 
+			///       connections of the states as sparsity pattern (see cmf::math::SparseJacobian)
 			int LinearSolver;
 			/// Maximal order of the solver
 			int MaxOrder;
 			/// Maximal size of a time step
 			cmf::math::Time max_step;
+			/// If true, the solver is not stopped at the end time of integrate, but steps freely beyond it. The states at the end 
+			/// time are interpolated from the polynomial of the last step (CVodeGetDky), and following end times within the last 
+			/// step are interpolated without a new step. Default is false.
+			///
+			/// The interpolated states are written to the state variables for output only, the solver continues from its own 
+			/// internal state. Hence, changes of the model between the calls of integrate (eg. new boundary conditions) are not
+			/// recognized by steps already taken. Use this option, if the forcing is known in advance, eg. for hourly output of 
+			/// a model driven by timeseries.
+			bool use_dense_output;
+			/// @brief If true, each step tallies the states dominating its local error. Default is false
+			///
+			/// After each step, the state with the largest weighted local error (see get_error) is counted as the dominating state,
+			/// and the absolute fluxes of its connections are summed up by the type of the connection. The squared weighted 
+			/// errors of all states are summed up as their share of the WRMS error. The tally shows the storages, which limit
+			/// the step size, eg. nearly empty surface water storages or macropores, and the connections feeding them 
+			/// (see get_error_profile). Steps rejected by the error test are not seen.
+			bool profile_errors;
+			/// Returns for each state the number of steps, where the state had the largest weighted local error (see profile_errors)
+			cmf::math::num_array get_error_dominance() const;
+			/// Returns for each state the mean share of its squared weighted local error in the squared WRMS error of the steps
+			cmf::math::num_array get_error_share() const;
+			/// @brief Returns a report of the states dominating the local error most often (see profile_errors)
+			///
+			/// Each line names the state with its number of dominated steps and its mean share of the error, followed by the 
+			/// types of the connections feeding the state, with their share of the summed absolute fluxes at the dominated steps
+			/// @param count Number of states in the report
+			std::string get_error_profile(size_t count=10) const;
+			/// Clears the tally of the error profile
+			void clear_error_profile();
 			/// Returns the last order of the solver used, may be smaller than MaxOrder due to the number of steps already taken or to fullfill stability limit
 			int get_order() const;
 			/// Initializes the solver. Do not add or remove state variables after initialization. The solver is automatically intialized when integrating
@@ -71,16 +131,23 @@ namespace cmf {
 			virtual int integrate(cmf::math::Time t_max,cmf::math::Time dt);
 			/// Resets the multi-step integrator. External changes to the state variables get recognized by the solver. Parameter changes of solver are ignored.
 			virtual void reset();
+#ifndef SWIG
+			/// Writes the state of the integration and the history of CVODE (the Nordsieck array, the order and the step size) to a stream
+			virtual void write_checkpoint(std::ostream& out) const;
+			/// Reads the state of the integration from a stream. A saved history of CVODE is restored, hence the integration
+			/// continues with the step size and order of the checkpoint. The Jacobian is calculated at the first step
+			virtual void read_checkpoint(std::istream& in);
+#endif
 			
 			/// Create a new CVODE integrator
 			/// @param epsilon relative and absolute error tolerance
 			/// @param _preconditioner [R]ight, [L]eft, [B]oth side Krylov preconditioner or [N]o preconditioner
 			CVodeIntegrator(real epsilon=1e-9,char _preconditioner='R') 
 			:	Integrator(epsilon), 
-				m_y(0),cvode_mem(0),precond_mem(0),
-				preconditioner(_preconditioner),maxl(5),LinearSolver(3),
+				m_y(0),m_jacevals(0),cvode_mem(0),precond_mem(0),
+				preconditioner(_preconditioner),preconditioner_matrix('B'),maxl(5),LinearSolver(3),
 				MaxOrder(5),MaxNonLinearIterations(3),MaxErrorTestFailures(10),MaxConvergenceFailures(7),
-				max_step(day)
+				max_step(day), use_dense_output(false), profile_errors(false)
 			{	
 				cvode_mem=0;
 			}
@@ -89,8 +156,9 @@ namespace cmf {
 			/// @param epsilon relative and absolute error tolerance
 			/// @param _preconditioner [R]ight, [L]eft, [B]oth side Krylov preconditioner or [N]o preconditioner
 			CVodeIntegrator(cmf::math::StateVariableOwner& states, real epsilon=1e-9,char _preconditioner='R') 
-				: Integrator(states,epsilon), m_y(0),cvode_mem(0),precond_mem(0),preconditioner(_preconditioner),maxl(5),LinearSolver(3),
-				MaxOrder(5),MaxNonLinearIterations(3),MaxErrorTestFailures(10),MaxConvergenceFailures(7), error_msg("")
+				: Integrator(states,epsilon), m_y(0),m_jacevals(0),cvode_mem(0),precond_mem(0),preconditioner(_preconditioner),preconditioner_matrix('B'),maxl(5),LinearSolver(3),
+				MaxOrder(5),MaxNonLinearIterations(3),MaxErrorTestFailures(10),MaxConvergenceFailures(7), error_msg(""),
+				use_dense_output(false), profile_errors(false)
 			{
 				if (epsilon<=0.0 || epsilon>1e-3) {
 					throw std::runtime_error("CVodeIntegrator: 0.0 < epsilon < 1e-3 not fullfilled");
@@ -100,9 +168,9 @@ namespace cmf {
 
 			/// copy constructor, creates a new CVODE integrator similiar to the given, but without statevariables
 			CVodeIntegrator(const CVodeIntegrator & templ) 
-				: Integrator(templ),preconditioner(templ.preconditioner),maxl(templ.maxl),m_y(0),cvode_mem(0),precond_mem(0),LinearSolver(templ.LinearSolver),
+				: Integrator(templ),preconditioner(templ.preconditioner),preconditioner_matrix(templ.preconditioner_matrix),maxl(templ.maxl),m_y(0),m_jacevals(0),cvode_mem(0),precond_mem(0),LinearSolver(templ.LinearSolver),
 				MaxOrder(templ.MaxOrder),MaxNonLinearIterations(templ.MaxNonLinearIterations),MaxErrorTestFailures(templ.MaxErrorTestFailures),
-				MaxConvergenceFailures(templ.MaxConvergenceFailures),max_step(templ.max_step),error_msg("")
+				MaxConvergenceFailures(templ.MaxConvergenceFailures),max_step(templ.max_step),use_dense_output(templ.use_dense_output),profile_errors(templ.profile_errors),error_msg("")
 			{
 				cvode_mem=0;
 			}
@@ -113,6 +181,9 @@ namespace cmf {
 			int get_nonlinear_iterations() const;
 			/// Returns the number of evaluations of the right hand side of the ODE. Calls CVodeGetNumRhsEvals
 			int get_rhsevals() const;
+			/// Returns the cumulative counters with the Jacobians, the iterations and the failures of CVODE. The counters of
+			/// CVODE, except the Jacobians, start again after a reset
+			virtual cmf::math::solver_counters get_counters() const;
 
 			CVodeIntegrator * copy() const
 			{
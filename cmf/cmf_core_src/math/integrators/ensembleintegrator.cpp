@@ -0,0 +1,95 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#include "ensembleintegrator.h"
+#include "cvodeintegrator.h"
+#include <typeinfo>
+
+size_t cmf::math::EnsembleIntegrator::add_member( cmf::math::StateVariableOwner& member )
+{
+	StateVariableList sq = member.get_states();
+	state_vector states(sq.begin(), sq.end());
+	if (m_members.size()) {
+		const state_vector& first = m_members[0];
+		if (states.size() != first.size())
+			throw std::runtime_error("The member of the ensemble has a different number of states than the first member");
+		for (size_t i = 0; i < states.size(); ++i) {
+			if (typeid(*states[i]) != typeid(*first[i]))
+				throw std::runtime_error("The member of the ensemble has a different structure than the first member: " 
+					+ states[i]->to_string() + " at the position of " + first[i]->to_string());
+		}
+	}
+	m_members.push_back(states);
+	// The integrator is created for the new ensemble at the next integration
+	m_integ.reset();
+	m_States.clear();
+	m_graph.reset();
+	m_buffer.reset();
+	m_buffer_failed = false;
+	return m_members.size() - 1;
+}
+
+void cmf::math::EnsembleIntegrator::build()
+{
+	size_t n = get_member_size();
+	StateVariableList states;
+	m_States.clear();
+	for (size_t i = 0; i < n; ++i) {
+		for (member_vector::const_iterator it = m_members.begin(); it != m_members.end(); ++it) {
+			states.append((*it)[i]);
+			m_States.push_back((*it)[i]);
+		}
+	}
+	m_integ.reset(m_template->copy());
+	// The dense, banded and preconditioner matrices of CVODE span all members, the sparse solver only the member blocks
+	CVodeIntegrator* cvode = dynamic_cast<CVodeIntegrator*>(m_integ.get());
+	if (cvode && cvode->LinearSolver != 2) cvode->LinearSolver = 6;
+	m_integ->use_flux_graph = true;
+	m_integ->use_OpenMP = use_OpenMP;
+	m_integ->reset_integratables = false;
+	m_integ->add_states(states);
+	m_integ->set_t(m_t);
+}
+
+int cmf::math::EnsembleIntegrator::integrate( cmf::math::Time t_max,cmf::math::Time dt )
+{
+	if (m_members.empty())
+		throw std::out_of_range("No members to integrate!");
+	if (!m_integ) build();
+	if (m_integ->get_t() != m_t) m_integ->set_t(m_t);
+	int res = m_integ->integrate(t_max, dt);
+	m_t = m_integ->get_t();
+	m_dt = m_integ->get_dt();
+	return res;
+}
+
+cmf::math::StateVariableList cmf::math::EnsembleIntegrator::get_member( int member ) const
+{
+	const state_vector& states = m_members.at(member < 0 ? member + m_members.size() : member);
+	StateVariableList res;
+	for (state_vector::const_iterator it = states.begin(); it != states.end(); ++it)
+		res.append(*it);
+	return res;
+}
+
+cmf::math::num_array cmf::math::EnsembleIntegrator::get_member_states( int member ) const
+{
+	const state_vector& states = m_members.at(member < 0 ? member + m_members.size() : member);
+	num_array res(ptrdiff_t(states.size()));
+	for (size_t i = 0; i < states.size(); ++i)
+		res[i] = states[i]->get_state();
+	return res;
+}
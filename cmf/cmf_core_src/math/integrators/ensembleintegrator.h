@@ -0,0 +1,98 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#ifndef ensembleintegrator_h__
+#define ensembleintegrator_h__
+#include "integrator.h"
+#include "../../cmfmemory.h"
+namespace cmf {
+	namespace math {
+		/// @brief Integrates the members of an ensemble, eg. the parameter sets of a calibration, in lockstep with one integrator
+		///
+		/// The members are models of the same structure with different parameters or initial states, built independently 
+		/// (eg. one project per parameter set). Their states are ordered by state and member ([state][member]), and a copy of 
+		/// the template integrator integrates the states of all members as one system, with the compiled connections of all
+		/// members (cmf::water::flux_graph). Hence the graph is built once for the ensemble, connections of the same type
+		/// are calculated in chunks across the members, and the connections of the members are visited once per evaluation of 
+		/// the right hand side. Since the members are not connected, the coloring of the sparse Jacobian (SparseJacobian) of 
+		/// the ensemble needs as many colors as the Jacobian of one member, and the Jacobian of all members costs the evaluations 
+		/// of one member, eg. for ROS2 or the sparse solver of the CVodeIntegrator. A CVodeIntegrator template is switched to the
+		/// sparse solver (LinearSolver=6), unless it uses the diagonal Jacobian.
+		///
+		/// All members take the same time steps. For integrators with an error controlled time step, the step is limited by 
+		/// the member with the largest error. Hence the ensemble pays off for small models (eg. lumped models), where the costs
+		/// of a solver step exceed the calculation of the fluxes. For larger models, the common steps may need more evaluations 
+		/// than the steps of the members alone.
+		///
+		/// The states of the ensemble integrator (eg. size and operator[]) are ordered at the first integration after adding 
+		/// members, use get_member to access the states of a member.
+		class EnsembleIntegrator : public cmf::math::Integrator
+		{
+			typedef std::vector<state_vector> member_vector;
+			/// The states of each member in their order
+			member_vector m_members;
+			std::unique_ptr<cmf::math::Integrator> m_template;
+			/// The integrator of all members, created on demand by integrate
+			std::unique_ptr<cmf::math::Integrator> m_integ;
+			/// Orders the states by state and member and creates the integrator for them
+			void build();
+		public:
+			int integrate(cmf::math::Time t_max,cmf::math::Time dt);
+			virtual cmf::math::EnsembleIntegrator* copy() const
+			{
+				return new EnsembleIntegrator(*m_template);
+			}
+			/// Resets the integrator of the members
+			virtual void reset()
+			{
+				if (m_integ) m_integ->set_t(m_t);
+			}
+			/// Only there to override Integrator::add_states. Throws an exception. Use add_member instead
+			void add_states(cmf::math::StateVariableOwner& stateOwner)
+			{
+				throw std::runtime_error("States can only be added as a member of the ensemble. Use add_member");
+			}
+			/// Only there to override Integrator::add_single_state. Throws an exception. Use add_member instead
+			void add_single_state(cmf::math::StateVariable::ptr state)
+			{
+				throw std::runtime_error("States can only be added as a member of the ensemble. Use add_member");
+			}
+			/// @brief Adds the states of a model as a new member of the ensemble
+			///
+			/// The member needs the same number and types of states in the same order as the first member
+			/// @returns The position of the member
+			size_t add_member(cmf::math::StateVariableOwner& member);
+			/// Returns the number of members
+			size_t get_member_count() const {
+				return m_members.size();
+			}
+			/// Returns the number of states of each member
+			size_t get_member_size() const {
+				return m_members.size() ? m_members[0].size() : 0;
+			}
+			/// Returns the states of a member in the order of the member
+			cmf::math::StateVariableList get_member(int member) const;
+			/// Returns the values of the states of a member in the order of the member
+			cmf::math::num_array get_member_states(int member) const;
+			/// Creates a new EnsembleIntegrator without members
+			/// @param template_integrator Template for the integrator of the members
+			EnsembleIntegrator(const cmf::math::Integrator& template_integrator)
+				: Integrator(), m_template(template_integrator.copy())
+			{}
+		};
+	}
+}
+#endif // ensembleintegrator_h__
@@ -0,0 +1,299 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#include "imexintegrator.h"
+#include "sparse_jacobian.h"
+#include "sparse_lu.h"
+#include "../../upslope/SoilLayer.h"
+#include "../../upslope/macropore.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+	// Coefficients of ARS(2,2,2)
+	const real ars_gamma = 1.0 - 1.0 / std::sqrt(2.0);
+	const real ars_delta = 1.0 - 1.0 / (2.0 * ars_gamma);
+}
+
+cmf::math::IMEXIntegrator::IMEXIntegrator( cmf::math::StateVariableOwner& states, real epsilon/*=1e-9*/, cmf::math::Time tStepMin/*=timespan(10)*/ )
+: Integrator(states, epsilon), m_factorized_gh(0), m_jac_age(-1), m_rhsevals(0), dt_min(tStepMin), max_newton_iterations(5)
+{
+	set_implicit_by_type();
+}
+
+cmf::math::IMEXIntegrator::IMEXIntegrator( real epsilon/*=1e-9*/, cmf::math::Time tStepMin/*=timespan(10)*/ )
+: Integrator(epsilon), m_factorized_gh(0), m_jac_age(-1), m_rhsevals(0), dt_min(tStepMin), max_newton_iterations(5)
+{
+}
+
+cmf::math::IMEXIntegrator::IMEXIntegrator( const Integrator& templ )
+: Integrator(templ), m_factorized_gh(0), m_jac_age(-1), m_rhsevals(0), dt_min(timespan(10)), max_newton_iterations(5)
+{
+	const IMEXIntegrator* imex = dynamic_cast<const IMEXIntegrator*>(&templ);
+	if (imex) {
+		dt_min = imex->dt_min;
+		max_newton_iterations = imex->max_newton_iterations;
+	}
+}
+
+void cmf::math::IMEXIntegrator::add_by_type( StateVariable::ptr state )
+{
+	// The water storage of a soil layer or macropore and its solutes
+	if (dynamic_cast<cmf::upslope::SoilLayer*>(state.get()) || dynamic_cast<cmf::upslope::MacroPore*>(state.get())) {
+		StateVariableList states = dynamic_cast<StateVariableOwner&>(*state).get_states();
+		for (std::vector<StateVariable::ptr>::const_iterator it = states.begin(); it != states.end(); ++it)
+			m_implicit.insert(it->get());
+	}
+}
+
+void cmf::math::IMEXIntegrator::add_states( cmf::math::StateVariableOwner& stateOwner )
+{
+	StateVariableList states = stateOwner.get_states();
+	Integrator::add_states(states);
+	for (std::vector<StateVariable::ptr>::const_iterator it = states.begin(); it != states.end(); ++it)
+		add_by_type(*it);
+}
+
+void cmf::math::IMEXIntegrator::add_single_state( cmf::math::StateVariable::ptr state )
+{
+	Integrator::add_single_state(state);
+	add_by_type(state);
+}
+
+void cmf::math::IMEXIntegrator::set_implicit( int position, bool implicit )
+{
+	const StateVariable* state = (*this)[position].get();
+	if (implicit)
+		m_implicit.insert(state);
+	else
+		m_implicit.erase(state);
+	m_prepared.clear();
+}
+
+bool cmf::math::IMEXIntegrator::is_implicit( int position ) const
+{
+	if (position < 0) position += int(size());
+	return m_implicit.count(m_States.at(position).get()) > 0;
+}
+
+size_t cmf::math::IMEXIntegrator::get_implicit_count() const
+{
+	size_t count = 0;
+	for (size_t i = 0; i < size(); ++i)
+		count += m_implicit.count(m_States[i].get());
+	return count;
+}
+
+void cmf::math::IMEXIntegrator::set_implicit_by_type()
+{
+	m_implicit.clear();
+	for (size_t i = 0; i < size(); ++i)
+		add_by_type(m_States[i]);
+	m_prepared.clear();
+}
+
+void cmf::math::IMEXIntegrator::set_implicit_by_stiffness( cmf::math::Time dt )
+{
+	SparseJacobian jac(*this);
+	jac.calculate(*this, get_t());
+	m_implicit.clear();
+	for (size_t i = 0; i < size(); ++i)
+		if (std::abs(jac.get(i, i)) * dt.AsDays() > 1.0)
+			m_implicit.insert(m_States[i].get());
+	m_prepared.clear();
+}
+
+void cmf::math::IMEXIntegrator::reset()
+{
+	m_prepared.clear();
+	m_h = Time();
+}
+
+bool cmf::math::IMEXIntegrator::prepared() const
+{
+	if (!m_jac || m_prepared.size() != size()) return false;
+	for (size_t i = 0; i < size(); ++i)
+		if (m_prepared[i] != m_States[i].get()) return false;
+	return true;
+}
+
+void cmf::math::IMEXIntegrator::prepare()
+{
+	size_t n = size();
+	m_prepared.resize(n);
+	m_implicit_position.clear();
+	// Only the entries between implicit states are calculated, each explicit state is a block of its own
+	std::vector<size_t> local(n, size_t(-1)), blocks(n);
+	for (size_t i = 0; i < n; ++i) {
+		m_prepared[i] = m_States[i].get();
+		if (m_implicit.count(m_prepared[i])) {
+			local[i] = m_implicit_position.size();
+			m_implicit_position.push_back(i);
+			blocks[i] = 0;
+		} else {
+			blocks[i] = i + 1;
+		}
+	}
+	m_jac.reset(new SparseJacobian(*this, blocks));
+	// The pattern of the Newton matrix I - gamma*h*J of the implicit states
+	m_row_start.assign(1, 0);
+	m_columns.clear();
+	m_entry.clear();
+	m_diagonal.clear();
+	const std::vector<size_t>& row_start = m_jac->row_start();
+	const std::vector<size_t>& columns = m_jac->columns();
+	for (size_t k = 0; k < m_implicit_position.size(); ++k) {
+		size_t i = m_implicit_position[k];
+		for (size_t p = row_start[i]; p < row_start[i + 1]; ++p) {
+			if (local[columns[p]] == size_t(-1)) continue;
+			m_columns.push_back(local[columns[p]]);
+			m_entry.push_back(p);
+			m_diagonal.push_back(columns[p] == i);
+		}
+		m_row_start.push_back(m_columns.size());
+	}
+	m_lu.reset(new SparseLU(m_row_start, m_columns));
+	m_matrix.resize(m_columns.size());
+	m_factorized_gh = 0;
+	m_jac_age = -1;
+	m_abstol.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		m_abstol[i] = m_States[i]->get_abs_errtol(Epsilon * 1e-3);
+}
+
+bool cmf::math::IMEXIntegrator::newton( real* Y, const real* r, Time t, real gh )
+{
+	size_t n = size(), m = m_implicit_position.size();
+	if (m == 0) return true;
+	std::vector<real> f(n), d(m);
+	real last_norm = REAL_MAX;
+	for (int iter = 0; iter < max_newton_iterations; ++iter) {
+		set_states(Y);
+		copy_dxdt(t, &f[0]);
+		++m_rhsevals;
+		// Solve (I - gh*J) d = -(Y - r - gh*f) for the implicit states
+		for (size_t k = 0; k < m; ++k) {
+			size_t i = m_implicit_position[k];
+			d[k] = r[i] + gh * f[i] - Y[i];
+		}
+		m_lu->solve(&d[0]);
+		real norm = 0.0;
+		for (size_t k = 0; k < m; ++k) {
+			size_t i = m_implicit_position[k];
+			Y[i] += d[k];
+			norm = std::max(norm, std::abs(d[k]) / (m_abstol[i] + Epsilon * std::abs(Y[i])));
+		}
+		if (!(norm < REAL_MAX) || norm > 2 * last_norm) return false;
+		if (norm <= 0.1) return true;
+		last_norm = norm;
+	}
+	return false;
+}
+
+int cmf::math::IMEXIntegrator::integrate( cmf::math::Time MaxTime, cmf::math::Time TimeStep )
+{
+	if (m_States.size()==0)
+		throw std::out_of_range("No states to integrate!");
+	if (!prepared()) prepare();
+	size_t n = size(), m = m_implicit_position.size();
+	std::vector<real> y0(n), f0(n), Y(n), r(n), KE0(n), KE1(n), KI1(n, 0.0), KI2(n, 0.0);
+	copy_states(&y0[0]);
+	copy_dxdt(get_t(), &f0[0]);
+	++m_rhsevals;
+	// The explicit part of the derivatives
+	KE0 = f0;
+	for (size_t k = 0; k < m; ++k)
+		KE0[m_implicit_position[k]] = 0.0;
+	Time h = m_h > Time() ? m_h : (TimeStep > Time() ? TimeStep : MaxTime - get_t());
+	AdjustTimestep(h, MaxTime);
+	while (true) {
+		real hd = h.AsDays(), gh = ars_gamma * hd;
+		// A new Jacobian at the start of the step, if it is outdated or old
+		bool fresh = false;
+		if (m && (m_jac_age < 0 || m_jac_age > 20)) {
+			m_jac->calculate(*this, get_t());
+			m_jac_age = 0;
+			m_factorized_gh = 0;
+			fresh = true;
+		}
+		bool converged = true;
+		if (m && gh != m_factorized_gh) {
+			const std::vector<real>& J = m_jac->values();
+			for (size_t k = 0; k < m_matrix.size(); ++k)
+				m_matrix[k] = (m_diagonal[k] ? 1.0 : 0.0) - gh * J[m_entry[k]];
+			converged = m_lu->factorize(&m_matrix[0]);
+			m_factorized_gh = converged ? gh : 0;
+		}
+		// Stage 1 at t + gamma*h: The explicit states are known, the implicit states start from an Euler predictor
+		for (size_t i = 0; i < n; ++i) {
+			r[i] = y0[i] + gh * KE0[i];
+			Y[i] = y0[i] + gh * f0[i];
+		}
+		converged = converged && newton(&Y[0], &r[0], get_t() + h * ars_gamma, gh);
+		if (converged) {
+			for (size_t k = 0; k < m; ++k) {
+				size_t i = m_implicit_position[k];
+				KI1[i] = (Y[i] - r[i]) / gh;
+			}
+			set_states(&Y[0]);
+			copy_dxdt(get_t() + h * ars_gamma, &KE1[0]);
+			++m_rhsevals;
+			for (size_t k = 0; k < m; ++k)
+				KE1[m_implicit_position[k]] = 0.0;
+			// Stage 2 at t + h, the result of the step
+			for (size_t i = 0; i < n; ++i) {
+				r[i] = y0[i] + hd * (ars_delta * KE0[i] + (1 - ars_delta) * KE1[i] + (1 - ars_gamma) * KI1[i]);
+				Y[i] = r[i] + gh * KI1[i];
+			}
+			converged = newton(&Y[0], &r[0], get_t() + h, gh);
+		}
+		if (!converged) {
+			set_states(&y0[0]);
+			// Try again with a new Jacobian or with a smaller step
+			if (fresh || m_jac_age < 0) {
+				h /= 4;
+			} else {
+				m_jac_age = -1;
+			}
+			if (h < dt_min)
+				throw std::runtime_error("IMEXIntegrator: No convergence of the Newton iteration with a time step > minimal time step");
+			continue;
+		}
+		for (size_t k = 0; k < m; ++k) {
+			size_t i = m_implicit_position[k];
+			KI2[i] = (Y[i] - r[i]) / gh;
+		}
+		// The embedded first order solution is y0 + h*KE0 + h*KI1
+		real error = 0.0;
+		for (size_t i = 0; i < n; ++i) {
+			real e = hd * ((1 - ars_delta) * (KE1[i] - KE0[i]) + ars_gamma * (KI2[i] - KI1[i]));
+			error = std::max(error, std::abs(e) / (m_abstol[i] + Epsilon * std::max(std::abs(y0[i]), std::abs(Y[i]))));
+		}
+		if (!(error <= 1.0)) {
+			set_states(&y0[0]);
+			h *= std::max(0.2, error < REAL_MAX ? 0.9 / std::sqrt(error) : 0.0);
+			if (h < dt_min)
+				throw std::runtime_error("IMEXIntegrator: The error exceeds the tolerance with a time step > minimal time step");
+			continue;
+		}
+		set_states(&Y[0]);
+		m_dt = h;
+		m_t += h;
+		if (m_jac_age >= 0) ++m_jac_age;
+		m_h = h * std::min(5.0, std::max(0.2, error > 0 ? 0.9 / std::sqrt(error) : 5.0));
+		return 1;
+	}
+}
@@ -0,0 +1,117 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#ifndef imexintegrator_h__
+#define imexintegrator_h__
+
+#include "integrator.h"
+#include "../real.h"
+#include <vector>
+#include <set>
+namespace cmf {
+	namespace math {
+		class SparseJacobian;
+		class SparseLU;
+		/// @brief An additive Runge-Kutta method, which integrates the stiff states implicitly and the other states explicitly (IMEX)
+		///
+		/// The right hand side is split by the states: The derivatives of the implicit states are the implicit part and the
+		/// derivatives of the explicit states are the explicit part. By default, the water storages of soil layers and macropores
+		/// and their solutes are implicit, while eg. canopy, snow and simple reservoirs are explicit (see set_implicit_by_type).
+		/// The implicit states can also be selected by their local stiffness (see set_implicit_by_stiffness) or one by one.
+		///
+		/// A step uses the stiffly accurate, L-stable second order scheme ARS(2,2,2) (Ascher, Ruuth and Spiteri 1997, Applied
+		/// Numerical Mathematics 25, 151-167) with two stages of the same diagonal coefficient. The stage equations are solved by
+		/// a simplified Newton iteration for the implicit states only, using the Jacobian of the implicit states (SparseJacobian)
+		/// and its sparse LU factorization (SparseLU), which are reused over several steps. The local error is estimated by
+		/// the difference to an embedded first order solution and controls the time step. Hence the time step is limited by the
+		/// accuracy and the stability of the explicit states.
+		class IMEXIntegrator : public Integrator
+		{
+		private:
+			// The implicit states
+			std::set<const StateVariable*> m_implicit;
+			// The states and the positions of the implicit states at the creation of the Jacobian
+			std::vector<const StateVariable*> m_prepared;
+			std::vector<size_t> m_implicit_position;
+			// The Jacobian of the implicit states, the pattern of the Newton matrix and its factorization
+			std::shared_ptr<SparseJacobian> m_jac;
+			std::shared_ptr<SparseLU> m_lu;
+			std::vector<size_t> m_row_start, m_columns, m_entry;
+			std::vector<char> m_diagonal;
+			std::vector<real> m_matrix;
+			// gamma*h of the factorization, 0 if the matrix needs to be factorized
+			real m_factorized_gh;
+			// Number of steps since the last Jacobian, -1 if the Jacobian is outdated
+			int m_jac_age;
+			// Absolute error tolerance
+			std::vector<real> m_abstol;
+			// The proposed next time step
+			Time m_h;
+			int m_rhsevals;
+			void add_by_type(StateVariable::ptr state);
+			bool prepared() const;
+			void prepare();
+			bool newton(real* Y, const real* r, Time t, real gh);
+		public:
+			/// The shortest allowed timestep
+			Time dt_min;
+			/// Maximum number of Newton iterations per stage (default 5)
+			int max_newton_iterations;
+			/// Add state variables from a StateVariableOwner. Soil layers and macropores and their solutes are implicit
+			void add_states(cmf::math::StateVariableOwner& stateOwner);
+			/// Adds a single state variable, implicit for soil layers and macropores
+			void add_single_state(cmf::math::StateVariable::ptr state);
+			/// Sets a state to be integrated implicitly or explicitly
+			void set_implicit(int position, bool implicit);
+			/// Returns true, if the state is integrated implicitly
+			bool is_implicit(int position) const;
+			/// Returns the number of implicitly integrated states
+			size_t get_implicit_count() const;
+			/// Integrates the water storages of soil layers and macropores and their solutes implicitly, all others explicitly
+			void set_implicit_by_type();
+			/// @brief Integrates the states implicitly, which are stiff for a time step
+			///
+			/// A state is stiff, if its local rate of change, the diagonal of the Jacobian at the current states and time,
+			/// exceeds 1/dt. An explicit step of dt would be unstable or inaccurate for this state
+			/// @param dt The intended time step of the explicit states
+			void set_implicit_by_stiffness(cmf::math::Time dt);
+			/// Returns the number of evaluations of the right hand side by the integration, without the Jacobian
+			int get_rhsevals() const {return m_rhsevals;}
+			/// Resets the Jacobian and the time step
+			virtual void reset();
+			/// Constructs a new IMEXIntegrator
+			/// @param states States to be added to the solver
+			/// @param epsilon relative error tolerance per time step (default=1e-9)
+			/// @param tStepMin minimum time step (default=10s)
+			IMEXIntegrator(cmf::math::StateVariableOwner& states, real epsilon=1e-9, cmf::math::Time tStepMin=cmf::math::timespan(10));
+			/// Constructs a new IMEXIntegrator
+			/// @param epsilon relative error tolerance per time step (default=1e-9)
+			/// @param tStepMin minimum time step (default=10s)
+			IMEXIntegrator(real epsilon=1e-9, cmf::math::Time tStepMin=cmf::math::timespan(10));
+			/// Constructs a new IMEXIntegrator from a template, without states
+			IMEXIntegrator(const Integrator& templ);
+			virtual Integrator * copy() const
+			{
+				return new IMEXIntegrator(static_cast<const Integrator&>(*this));
+			}
+			/// @brief Takes one step with the ARS(2,2,2) scheme
+			/// @param MaxTime The time, the step should not exceed
+			/// @param TimeStep The first time step, later steps are controlled by the local error
+			int integrate(cmf::math::Time MaxTime, cmf::math::Time TimeStep);
+		};
+	}
+}
+#endif // imexintegrator_h__
@@ -17,6 +17,7 @@
 //   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
 //   
 #include "implicit_euler.h"
+#include "newton_krylov.h"
 #include <iostream>
 #ifdef _OPENMP
 #include <omp.h>
@@ -25,7 +26,7 @@ using namespace std;
 cmf::math::ImplicitEuler::ImplicitEuler(StateVariableOwner& states, 
 										real epsilon/*=1e-9*/,
 										cmf::math::Time tStepMin/*=10.0/(3600.0*24.0)*/ ) 
-: Integrator(states,epsilon),dt_min(tStepMin)
+: Integrator(states,epsilon),dt_min(tStepMin),use_newton(false)
 {
 	oldStates      = num_array(ptrdiff_t(m_States.size()),0);
 	compareStates  = num_array(ptrdiff_t(m_States.size()),0);
@@ -33,12 +34,12 @@ cmf::math::ImplicitEuler::ImplicitEuler(StateVariableOwner& states,
 	set_abstol();
 }
 cmf::math::ImplicitEuler::ImplicitEuler( real epsilon/*=1e-9*/,cmf::math::Time tStepMin/*=10.0/(3600.0*24.0)*/ ) : 
-Integrator(epsilon), dt_min(tStepMin)
+Integrator(epsilon), dt_min(tStepMin), use_newton(false)
 {
 }
 
 cmf::math::ImplicitEuler::ImplicitEuler( const cmf::math::Integrator& forCopy) 
-: cmf::math::Integrator(forCopy)
+: cmf::math::Integrator(forCopy), use_newton(false)
 {
 
 }
@@ -106,6 +107,45 @@ int cmf::math::ImplicitEuler::integrate(cmf::math::Time MaxTime,cmf::math::Time
 	real err_ex=REAL_MAX/2;
 	real old_err_ex=REAL_MAX;
 	m_Iterations=0;
+	if (use_newton)
+	{
+		if (!m_newton) m_newton.reset(new NewtonKrylov);
+		// The Newton updates are scaled by the error tolerance
+		for (ptrdiff_t i = 0; i < ptrdiff_t(size()) ; i++)
+			compareStates[i] = 1 / (abstol[i] + fabs(oldStates[i]) * Epsilon);
+		// The derivatives at the start of the step for the error estimate
+		copy_dxdt(get_t(), dxdt);
+		// Solve x_(n+1) = x_(n) + h dxdt(x_(n+1)). Without the limit of the fixpoint iteration, the time step is controlled by
+		// the local error (x_(n+1) - x_(n) - h dxdt(x_(n)))/2 of the Euler step. Halve the time step if the Newton iteration fails
+		while (true)
+		{
+			iter = m_newton->solve(*this, get_t() + h, h.AsDays(), oldStates, compareStates);
+			if (iter >= 0)
+			{
+				real err = 0;
+				for (ptrdiff_t i = 0; i < ptrdiff_t(size()) ; i++)
+					err = std::max(err, fabs(get_state(i) - oldStates[i] - h.AsDays() * dxdt[i]) * 0.5 * compareStates[i]);
+				// The implicit Euler method is L-stable: At the minimal time step the step is taken regardless of the error
+				if (err <= 1 || h <= dt_min) break;
+				h *= std::max(0.2, 0.9 / sqrt(err));
+				if (h < dt_min) h = dt_min;
+			}
+			else
+			{
+				h /= 2;
+				if (h < dt_min)
+				{
+					std::cerr << "No convergence! Time=" << get_t().AsDate().to_string() << std::endl;
+					throw std::runtime_error("No convergence with a time step > minimal time step");
+				}
+			}
+			set_states(oldStates);
+		}
+		m_Iterations = int(iter);
+		m_dt=h;
+		set_t(get_t() + h);
+		return int(iter);
+	}
 	do 
 	{
 		// Remember the current state for convergence criterion
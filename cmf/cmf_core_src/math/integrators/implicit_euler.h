@@ -27,7 +27,12 @@
 
 namespace cmf {
 	namespace math {
+		class NewtonKrylov;
 		/// An implicit (backward) Euler integrator using fixpoint iteration
+		///
+		/// With use_newton, the implicit equation is solved by a Jacobian-free Newton-Krylov iteration (NewtonKrylov)
+		/// instead, which converges for much larger time steps on stiff problems. The time step is then controlled by an 
+		/// estimate of the local error
 		class ImplicitEuler : public Integrator
 		{
 			//@}
@@ -42,6 +47,8 @@ namespace cmf {
 			num_array dxdt;
 			/// Absolute error tolerance
 			num_array abstol;
+			/// Newton-Krylov solver, if use_newton is true
+			std::shared_ptr<NewtonKrylov> m_newton;
 
 			//@}
 
@@ -52,6 +59,8 @@ namespace cmf {
 		public:
 			/// The shortest allowed timestep
 			Time dt_min;
+			/// If true, the implicit equation is solved by Newton iterations with GMRES instead of a fixpoint iteration (default false)
+			bool use_newton;
 			/// Add state variables from a StateVariableOwner
 			void add_states(cmf::math::StateVariableOwner& stateOwner);
 			/// Constructs a new FixPointImplicitEuler from a pointer to a vector of state variables
@@ -70,7 +79,9 @@ namespace cmf {
 
 			virtual Integrator * copy() const
 			{
-				return new ImplicitEuler(*this);
+				ImplicitEuler* res = new ImplicitEuler(*this);
+				res->m_newton.reset();
+				return res;
 			}
 			///Integrates the vector of state variables
 			/// @param MaxTime To stop the model (if running in a model framework) at time steps of value exchange e.g. full hours, the next value exchange time can be given
@@ -21,10 +21,27 @@
 
 #include "../num_array.h"
 #include "../statevariable.h"
+#include "../timeseries.h"
+#include "solver_statistics.h"
 #include "../real.h"
 #include <stdexcept>
 namespace cmf {
+	namespace water {
+		class flux_graph;
+	}
 	namespace math {
+#ifndef SWIG
+		/// @brief States outside of an integrator, which are a function of time during the integration
+		///
+		/// Used by the multirate scheme of the MultiIntegrator to interpolate the states of slower partitions
+		/// for the evaluation of the fluxes to the states of a faster partition
+		class external_states {
+		public:
+			/// Sets the external states to their values at time t
+			virtual void update(Time t)=0;
+			virtual ~external_states() {}
+		};
+#endif
 		/// Base class for any kind of integrator
 		///
 		/// Pure virtual functions:
@@ -36,6 +53,31 @@ namespace cmf {
 		protected:
 			typedef std::vector<StateVariable::ptr> state_vector;
 			state_vector m_States;
+#ifndef SWIG
+			/// The compiled connections of the states, used if use_flux_graph is true. Built on demand by copy_dxdt
+			mutable std::shared_ptr<cmf::water::flux_graph> m_graph;
+			/// The contiguous storage of the state values, used if use_contiguous_states is true
+			mutable std::shared_ptr<StateBuffer> m_buffer;
+			/// True, if the states could not be bound to a buffer. Reset, when the states change
+			mutable bool m_buffer_failed;
+			/// Returns the state buffer, if use_contiguous_states is true and the states could be bound, else 0
+			StateBuffer* get_state_buffer() const;
+			/// States outside of the integrator, updated before each evaluation of the right hand side
+			std::shared_ptr<external_states> m_external;
+			/// A forcing timeseries with a jump, with the time of the last search and the jump found after it
+			struct forcing_jump {
+				timeseries data;
+				Time after, next;
+				explicit forcing_jump(const timeseries& _data) : data(_data), after(never), next(never) {}
+			};
+			/// The forcing of the states, collected on demand by get_next_breakpoint
+			mutable std::vector<forcing_jump> m_forcing;
+			mutable bool m_forcing_collected;
+			/// Number of evaluations of the right hand side by copy_dxdt
+			mutable long long m_rhs_count;
+			void add_forcing(const timeseries& data) const;
+			void collect_forcing() const;
+#endif
 
 			/// Copies the states to a numeric vector using use_OpenMP
 		public:
@@ -58,6 +100,13 @@ namespace cmf {
 			
 			/// Adds the values in operands to the current states
 			void add_values_to_states(const num_array& operands);
+			/// Returns the compiled connections of the states. The graph is rebuilt, if the connections have changed
+			const cmf::water::flux_graph& get_flux_graph() const;
+			/// Sets the states outside of the integrator, which are updated to the time of each evaluation of the right hand side.
+			/// Use an empty pointer to remove them
+			void set_external_states(std::shared_ptr<external_states> states) {
+				m_external = states;
+			}
 
 #endif
 			StateVariable::ptr operator[](int position) {
@@ -82,11 +131,32 @@ namespace cmf {
 			virtual void add_states(cmf::math::StateVariableOwner& stateOwner) {
 				StateVariableList sq = stateOwner.get_states();
 				m_States.insert(m_States.end(),sq.begin(),sq.end());
+				m_graph.reset();
+				m_buffer.reset();
+				m_buffer_failed = false;
+				m_forcing_collected = false;
 			}
 			/// Adds a single state variable to the integrator
 			virtual void add_single_state(cmf::math::StateVariable::ptr state) {
 				m_States.push_back(state);
+				m_graph.reset();
+				m_buffer.reset();
+				m_buffer_failed = false;
+				m_forcing_collected = false;
 			}
+			/// @brief Reorders the state variables to reduce the bandwidth of the Jacobian
+			///
+			/// The order of the states is given by the order of the state variable owners, eg. the cells and reaches of a project, 
+			/// and states connected to each other can be far apart. This function sorts the states with the reverse Cuthill-McKee 
+			/// algorithm, using the connections between the states (see cmf::water::flux_graph::get_sparsity) as adjacency.
+			/// Hence, connected states get near positions, which makes banded solvers and preconditioners (maxl >= get_bandwidth())
+			/// applicable and improves the locality of the state vector. 
+			///
+			/// Call this function after adding the states and before the first integration. Positions of states used before 
+			/// (eg. by operator[]) are not valid afterwards.
+			void reorder_states();
+			/// @brief Returns the bandwidth of the Jacobian, the maximum distance of two connected states in the state vector
+			size_t get_bandwidth() const;
 			
 			/// Public access to integratables
 			integratable_list integratables;
@@ -99,6 +169,38 @@ namespace cmf {
 			//@}
 			/// if true (default), OpenMP is used calculate the right hand side function f(y,t) in parallel
 			bool use_OpenMP;
+			/// If true, the right hand side function is calculated from a flattened graph of the connections 
+			/// (cmf::water::flux_graph), which calculates every flux only once per call. Default is false
+			///
+			/// With use_OpenMP the fluxes are calculated in parallel without concurrent access to shared flux caches, 
+			/// and the results are independent of the number of threads
+			bool use_flux_graph;
+			/// If true, the values of the state variables are stored in one contiguous array owned by the integrator,
+			/// and copying the states from and to the solver does not need to visit each state variable. Default is false
+			///
+			/// A state variable can only be stored by one integrator. Do not use this option for several
+			/// solvers sharing the same states.
+			bool use_contiguous_states;
+			/// @brief If true, integrate_until stops the solver at each jump of the forcing and resets it. Default is false
+			///
+			/// The forcing are the nearest neighbor timeseries (interpolationpower 0) of the rainfall and meteorological stations
+			/// of the project and the fluxes of Neumann boundary conditions and timeseries rain sources connected to the states.
+			/// A solver with error control detects a jump of the forcing within a step only by failed error tests, and a multistep
+			/// solver (CVodeIntegrator, BDF2) carries its history over the jump. Stopped and reset at the jump, the solver 
+			/// restarts with a short first order step. The forcing is collected at the first use after adding states
+			bool use_forcing_breakpoints;
+			/// Returns the first time after t, where a forcing of the states jumps, or cmf::math::never (see use_forcing_breakpoints)
+			cmf::math::Time get_next_breakpoint(cmf::math::Time t) const;
+			/// @brief Collects the statistics of the steps of integrate_until, if set. Default is empty
+			///
+			/// Each call of integrate by integrate_until is recorded with its wall time, step size and the differences of 
+			/// the counters of the integrator (see get_counters). Steps of the integrators of a MultiIntegrator are not recorded
+			std::shared_ptr<cmf::math::SolverStatistics> statistics;
+			/// @brief Returns the cumulative counters of the integrator
+			///
+			/// The evaluations of the right hand side are counted for every integrator. Integrators with more information
+			/// (eg. CVodeIntegrator) add their counts of Jacobians, iterations and failures
+			virtual cmf::math::solver_counters get_counters() const;
 
 			/// returns the number of state variables
 			size_t size() const
@@ -169,17 +271,21 @@ namespace cmf {
 			/// @param epsilon relative error tolerance per time step (default=1e-9)
 			Integrator(real epsilon=1e-9) 
 				: m_States(), Epsilon(epsilon),m_dt(day),m_t(day),
-				  use_OpenMP(true), reset_integratables(true)
+				  use_OpenMP(true), reset_integratables(true), use_flux_graph(false), use_contiguous_states(false),
+				  use_forcing_breakpoints(false), m_buffer_failed(false), m_forcing_collected(false), m_rhs_count(0)
 			{}
 			Integrator(cmf::math::StateVariableOwner& states,real epsilon=1e-9)
 				: m_States(),Epsilon(epsilon),m_dt(day),m_t(day*0),
-				  use_OpenMP(true), reset_integratables(true)
+				  use_OpenMP(true), reset_integratables(true), use_flux_graph(false), use_contiguous_states(false),
+				  use_forcing_breakpoints(false), m_buffer_failed(false), m_forcing_collected(false), m_rhs_count(0)
 			{
 				this->add_states(states);
 			}
 			Integrator(const cmf::math::Integrator& other) 
 				: m_States(), Epsilon(other.Epsilon), m_dt(other.m_dt), m_t(other.m_t), 
-				  reset_integratables(other.reset_integratables), use_OpenMP(other.use_OpenMP)
+				  reset_integratables(other.reset_integratables), use_OpenMP(other.use_OpenMP),
+				  use_flux_graph(other.use_flux_graph), use_contiguous_states(other.use_contiguous_states),
+				  use_forcing_breakpoints(other.use_forcing_breakpoints), m_buffer_failed(false), m_forcing_collected(false), m_rhs_count(0)
 			{}
 			/// Polymorphic copy constructor
 			virtual Integrator * copy() const=0;
@@ -196,8 +302,33 @@ namespace cmf {
 			/// @param t_max Time, the solver should run to
 			/// @param dt Time step (may be omitted)
 			/// @param reset If true, solver is reseted before integration starts
+			///
+			/// With use_forcing_breakpoints, the solver is stopped and reset at the jumps of the forcing until t_max
 			void integrate_until(cmf::math::Time t_max,cmf::math::Time dt=Time(),bool reset=false);
 			//@}
+
+			///@name Checkpoints
+			//@{
+
+			/// @brief Saves the state of the integration to a binary file
+			///
+			/// The checkpoint contains the time and the last time step of the integrator, the values of the states, the ice 
+			/// fraction of soil layers among the states and the integrals of the integratables (eg. flux_integrator). Integrators 
+			/// with a history (CVodeIntegrator) save their history, to continue the integration without a new start. 
+			/// The parameters and the structure of the model are not saved.
+			void save_checkpoint(std::string filename) const;
+			/// @brief Loads the state of the integration from a binary file written by save_checkpoint
+			///
+			/// The integrator needs the same states and integratables in the same order as the integrator of the checkpoint, 
+			/// eg. a model built by the same script. Integrators without a saved history are reset
+			void load_checkpoint(std::string filename);
+#ifndef SWIG
+			/// Writes the state of the integration to a stream, see save_checkpoint
+			virtual void write_checkpoint(std::ostream& out) const;
+			/// Reads the state of the integration from a stream, see load_checkpoint
+			virtual void read_checkpoint(std::istream& in);
+#endif
+			//@}
 		};
 	}
 }
@@ -17,26 +17,374 @@
 //   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
 //   
 #include "multiintegrator.h"
+#include "../../water/WaterStorage.h"
+#include "../../water/SoluteStorage.h"
+#include "../../water/system_bridge.h"
+#include "../../water/flux_graph.h"
+#include <map>
+#include <set>
+#include <algorithm>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
 
+namespace cmf {
+	namespace math {
+		/// @brief The water or solute exchanged over a connection between two partitions of a multirate MultiIntegrator
+		///
+		/// The state is the amount exchanged from the left to the right node since its creation. Since it is integrated by the 
+		/// integrator of one partition together with the storage at the end of the connection, the integrated exchange 
+		/// matches the change of the storage by the connection for every integration method
+		class exchange_state : public StateVariable {
+			std::weak_ptr<cmf::water::flux_connection> m_connection;
+			const cmf::water::solute* m_solute;
+		public:
+			exchange_state(cmf::water::flux_connection::ptr connection, const cmf::water::solute* solute)
+				: StateVariable(0.0), m_connection(connection), m_solute(solute) {}
+			real dxdt(const Time& t) {
+				cmf::water::flux_connection::ptr con = m_connection.lock();
+				if (!con) return 0.0;
+				real q = con->q(*con->get_target(1), t);
+				return m_solute ? q * con->conc(t, *m_solute) : q;
+			}
+			std::string to_string() const {
+				cmf::water::flux_connection::ptr con = m_connection.lock();
+				std::string exchange = m_solute ? m_solute->Name + " exchange" : "water exchange";
+				return con ? exchange + " over " + con->to_string() : exchange + " over a deleted connection";
+			}
+		};
+		/// The connections between the partitions of a multirate MultiIntegrator and the history of the interpolated states
+		class multirate_coupling {
+		public:
+			// A state of a slower partition, which is interpolated for faster partitions
+			struct history_state {
+				StateVariable::ptr state;
+				real start, end;
+			};
+			// A connection between two partitions. Index 0 is the left and index 1 the right side. The exchange of each side 
+			// (water and solutes) is integrated by the partition of the storage on that side
+			struct coupling_flux {
+				cmf::water::flux_connection::ptr connection;
+				cmf::water::WaterStorage::ptr storage[2];
+				size_t partition[2];
+				std::vector<const cmf::water::solute*> solutes;
+				std::vector<StateVariable::ptr> exchange[2];
+				std::vector<real> start[2];
+			};
+			// Sets the interpolated states of slower partitions for the integration of a partition
+			class interpolation : public external_states {
+				multirate_coupling& m_coupling;
+				size_t m_partition;
+			public:
+				interpolation(multirate_coupling& coupling, size_t partition)
+					: m_coupling(coupling), m_partition(partition) {}
+				void update(Time t) {
+					const std::vector<size_t>& interpolated = m_coupling.interpolated[m_partition];
+					real w = m_coupling.t1 > m_coupling.t0 ? (t - m_coupling.t0) / (m_coupling.t1 - m_coupling.t0) : 1.0;
+					w = std::min(std::max(w, 0.0), 1.0);
+					for (size_t k = 0; k < interpolated.size(); ++k) {
+						history_state& h = m_coupling.history[interpolated[k]];
+						h.state->set_state(h.start + w * (h.end - h.start));
+					}
+				}
+			};
+			// The exchange states of each connection and partition, by connection id. Kept, when the coupling is rebuilt, since
+			// they can not be removed from the integrators
+			std::map<std::pair<int, size_t>, std::vector<StateVariable::ptr> > exchange_states;
+			std::vector<history_state> history;
+			std::vector<coupling_flux> fluxes;
+			// For each partition: the interpolated history states and the own history states
+			std::vector<std::vector<size_t> > interpolated, owned;
+			// The partitions of each rate, in the order of the rates, and whether they can be integrated in parallel
+			std::vector<std::vector<size_t> > levels;
+			std::vector<char> parallel;
+			Time t0, t1;
+			void build(MultiIntegrator& integ);
+			void integrate_partition(MultiIntegrator& integ, size_t partition);
+			// Integrates one synchronization interval of the length dt, but not beyond t_max
+			void integrate(MultiIntegrator& integ, Time t_max, Time dt);
+		};
+	}
+}
+
+void cmf::math::multirate_coupling::build( MultiIntegrator& integ )
+{
+	size_t n = integ.m_integrators.size();
+	history.clear();
+	fluxes.clear();
+	levels.clear();
+	parallel.clear();
+	interpolated.assign(n, std::vector<size_t>());
+	owned.assign(n, std::vector<size_t>());
+	std::map<const StateVariable*, size_t> owner;
+	for (size_t p = 0; p < n; ++p) {
+		StateVariableList states = integ.m_integrators[p]->get_states();
+		for (std::vector<StateVariable::ptr>::const_iterator it = states.begin(); it != states.end(); ++it)
+			owner[it->get()] = p;
+	}
+	std::set<const cmf::water::flux_connection*> known;
+	std::map<const StateVariable*, size_t> history_index;
+	for (size_t p = 0; p < n; ++p) {
+		StateVariableList states = integ.m_integrators[p]->get_states();
+		for (std::vector<StateVariable::ptr>::const_iterator it = states.begin(); it != states.end(); ++it) {
+			cmf::water::WaterStorage::ptr storage = std::dynamic_pointer_cast<cmf::water::WaterStorage>(*it);
+			if (!storage) continue;
+			cmf::water::connection_list connections = storage->get_connections();
+			for (cmf::water::connection_list::const_iterator con = connections.begin(); con != connections.end(); ++con) {
+				cmf::water::flux_node::ptr target = (**con).get_target(*storage);
+				std::map<const StateVariable*, size_t>::const_iterator target_owner = 
+					owner.find(dynamic_cast<const StateVariable*>(target.get()));
+				if (target_owner == owner.end() || target_owner->second == p || known.count(con->get())) continue;
+				known.insert(con->get());
+				coupling_flux f;
+				f.connection = *con;
+				for (int side = 0; side < 2; ++side) {
+					f.storage[side] = std::dynamic_pointer_cast<cmf::water::WaterStorage>((**con).get_target(side));
+					f.partition[side] = owner[f.storage[side].get()];
+				}
+				if (integ.m_rate[f.partition[0]] == integ.m_rate[f.partition[1]])
+					throw std::runtime_error("MultiIntegrator: " + (**con).to_string() + " connects two integrators of the same rate");
+				StateVariableList storage_states = f.storage[0]->get_states();
+				for (std::vector<StateVariable::ptr>::const_iterator s = storage_states.begin(); s != storage_states.end(); ++s) {
+					const cmf::water::SoluteStorage* solute_storage = dynamic_cast<const cmf::water::SoluteStorage*>(s->get());
+					if (solute_storage) f.solutes.push_back(&solute_storage->Solute);
+				}
+				// The exchange of each side is integrated by its partition
+				for (int side = 0; side < 2; ++side) {
+					std::vector<StateVariable::ptr>& exchange = exchange_states[std::make_pair((**con).connection_id, f.partition[side])];
+					if (exchange.empty()) {
+						exchange.push_back(StateVariable::ptr(new exchange_state(*con, 0)));
+						for (size_t s = 0; s < f.solutes.size(); ++s)
+							exchange.push_back(StateVariable::ptr(new exchange_state(*con, f.solutes[s])));
+						for (size_t s = 0; s < exchange.size(); ++s)
+							integ.m_integrators[f.partition[side]]->add_single_state(exchange[s]);
+					}
+					f.exchange[side] = exchange;
+				}
+				// The water and solute states of the slower storage are interpolated for the faster partition
+				int slow = integ.m_rate[f.partition[0]] < integ.m_rate[f.partition[1]] ? 0 : 1;
+				StateVariableList slow_states = f.storage[slow]->get_states();
+				for (std::vector<StateVariable::ptr>::const_iterator s = slow_states.begin(); s != slow_states.end(); ++s) {
+					std::map<const StateVariable*, size_t>::const_iterator s_owner = owner.find(s->get());
+					if (s_owner == owner.end() || s_owner->second != f.partition[slow]) continue;
+					if (!history_index.count(s->get())) {
+						history_index[s->get()] = history.size();
+						owned[f.partition[slow]].push_back(history.size());
+						history_state h = {*s, 0.0, 0.0};
+						history.push_back(h);
+					}
+					interpolated[f.partition[1 - slow]].push_back(history_index[s->get()]);
+				}
+				fluxes.push_back(f);
+			}
+		}
+	}
+	for (size_t p = 0; p < n; ++p) {
+		std::sort(interpolated[p].begin(), interpolated[p].end());
+		interpolated[p].erase(std::unique(interpolated[p].begin(), interpolated[p].end()), interpolated[p].end());
+	}
+	// Partitions of the same rate are integrated in parallel, if they do not interpolate the same states
+	std::map<int, std::vector<size_t> > by_rate;
+	for (size_t p = 0; p < n; ++p)
+		by_rate[integ.m_rate[p]].push_back(p);
+	for (std::map<int, std::vector<size_t> >::const_iterator it = by_rate.begin(); it != by_rate.end(); ++it) {
+		levels.push_back(it->second);
+		std::set<size_t> used;
+		size_t count = 0;
+		for (size_t i = 0; i < it->second.size(); ++i) {
+			used.insert(interpolated[it->second[i]].begin(), interpolated[it->second[i]].end());
+			count += interpolated[it->second[i]].size();
+		}
+		parallel.push_back(used.size() == count);
+	}
+}
+
+void cmf::math::multirate_coupling::integrate_partition( MultiIntegrator& integ, size_t partition )
+{
+	Integrator& sub = *integ.m_integrators[partition];
+	if (!sub.size()) return;
+	if (interpolated[partition].size()) 
+		sub.set_external_states(std::shared_ptr<external_states>(new interpolation(*this, partition)));
+	sub.integrate_until(t1, (t1 - t0) / integ.m_rate[partition]);
+	sub.set_external_states(std::shared_ptr<external_states>());
+	// The interpolated states get the values of the end of the interval again
+	for (size_t k = 0; k < interpolated[partition].size(); ++k) {
+		history_state& h = history[interpolated[partition][k]];
+		h.state->set_state(h.end);
+	}
+	for (size_t k = 0; k < owned[partition].size(); ++k) {
+		history_state& h = history[owned[partition][k]];
+		h.end = h.state->get_state();
+	}
+}
+
+void cmf::math::multirate_coupling::integrate( MultiIntegrator& integ, Time t_max, Time dt )
+{
+	t0 = integ.get_t();
+	t1 = (dt > Time() && t0 + dt < t_max) ? t0 + dt : t_max;
+	for (size_t k = 0; k < history.size(); ++k)
+		history[k].start = history[k].end = history[k].state->get_state();
+	for (size_t k = 0; k < fluxes.size(); ++k) {
+		for (int side = 0; side < 2; ++side) {
+			std::vector<real>& start = fluxes[k].start[side];
+			start.resize(fluxes[k].exchange[side].size());
+			for (size_t s = 0; s < start.size(); ++s)
+				start[s] = fluxes[k].exchange[side][s]->get_state();
+		}
+	}
+	for (size_t l = 0; l < levels.size(); ++l) {
+		const std::vector<size_t>& level = levels[l];
+		if (integ.use_OpenMP && parallel[l]) {
+#pragma omp parallel for
+			for (int i = 0; i < (int)level.size(); ++i)
+				integrate_partition(integ, level[i]);
+		} else {
+			for (size_t i = 0; i < level.size(); ++i)
+				integrate_partition(integ, level[i]);
+		}
+	}
+	// The slower side takes over the exchange of the faster side. A flux from left to right is a loss for the left side.
+	// The first exchange state is the water, the others are the solutes
+	std::vector<char> corrected(integ.m_integrators.size(), 0);
+	for (size_t k = 0; k < fluxes.size(); ++k) {
+		coupling_flux& f = fluxes[k];
+		int slow = integ.m_rate[f.partition[0]] < integ.m_rate[f.partition[1]] ? 0 : 1, fast = 1 - slow;
+		real sign = slow == 0 ? 1.0 : -1.0;
+		cmf::water::WaterStorage& storage = *f.storage[slow];
+		for (size_t s = 0; s < f.exchange[slow].size(); ++s) {
+			real 
+				slow_exchange = f.exchange[slow][s]->get_state() - f.start[slow][s],
+				fast_exchange = f.exchange[fast][s]->get_state() - f.start[fast][s],
+				correction = sign * (slow_exchange - fast_exchange);
+			if (correction == 0.0) continue;
+			if (s == 0) {
+				storage.set_volume(std::max(storage.get_volume() + correction, 0.0));
+			} else {
+				cmf::water::SoluteStorage& solute_storage = storage.Solute(*f.solutes[s - 1]);
+				solute_storage.set_state(std::max(solute_storage.get_state() + correction, 0.0));
+			}
+			// The slower side has exchanged the same amount as the faster side
+			f.exchange[slow][s]->set_state(f.start[slow][s] + fast_exchange);
+			corrected[f.partition[slow]] = 1;
+		}
+	}
+	// Multistep methods start again from the corrected states
+	for (size_t p = 0; p < corrected.size(); ++p)
+		if (corrected[p]) integ.m_integrators[p]->reset();
+}
+
+namespace {
+	// Orders components by decreasing size
+	struct by_component_size {
+		const std::vector<std::vector<size_t> >& components;
+		by_component_size(const std::vector<std::vector<size_t> >& _components) : components(_components) {}
+		bool operator()(size_t a, size_t b) const {
+			return components[a].size() > components[b].size();
+		}
+	};
+}
+
+bool cmf::math::MultiIntegrator::is_multirate() const
+{
+	for (size_t i = 1; i < m_rate.size(); ++i)
+		if (m_rate[i] != m_rate[0]) return true;
+	return false;
+}
+
+size_t cmf::math::MultiIntegrator::distribute_states( cmf::math::StateVariableOwner& stateOwner )
+{
+	// The connections of the states are taken from an integrator holding all states
+	std::unique_ptr<Integrator> all(m_template->copy());
+	all->add_states(stateOwner);
+	size_t n = all->size();
+	std::vector<size_t> row_start, columns;
+	all->get_flux_graph().get_sparsity(row_start, columns);
+	// Connected components with union-find
+	std::vector<size_t> root(n);
+	for (size_t i = 0; i < n; ++i) root[i] = i;
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t k = row_start[i]; k < row_start[i + 1]; ++k) {
+			size_t a = i, b = columns[k];
+			while (root[a] != a) a = root[a] = root[root[a]];
+			while (root[b] != b) b = root[b] = root[root[b]];
+			if (a != b) root[std::max(a, b)] = std::min(a, b);
+		}
+	}
+	std::vector<std::vector<size_t> > components;
+	std::vector<size_t> component_of(n);
+	for (size_t i = 0; i < n; ++i) {
+		size_t r = i;
+		while (root[r] != r) r = root[r];
+		if (r == i) {
+			component_of[i] = components.size();
+			components.push_back(std::vector<size_t>());
+		} else {
+			component_of[i] = component_of[r];
+		}
+		components[component_of[i]].push_back(i);
+	}
+	// The largest remaining component goes to the integrator with the fewest states
+	std::vector<size_t> order(components.size());
+	for (size_t c = 0; c < order.size(); ++c) order[c] = c;
+	std::stable_sort(order.begin(), order.end(), by_component_size(components));
+	std::vector<size_t> load(m_integrators.size()), integrator_of(n);
+	for (size_t p = 0; p < load.size(); ++p) load[p] = m_integrators[p]->size();
+	for (size_t k = 0; k < order.size(); ++k) {
+		const std::vector<size_t>& component = components[order[k]];
+		size_t p = std::min_element(load.begin(), load.end()) - load.begin();
+		for (size_t i = 0; i < component.size(); ++i) {
+			m_integrators[p]->add_single_state((*all)[int(component[i])]);
+			integrator_of[component[i]] = p;
+		}
+		load[p] += component.size();
+	}
+	// The flux over a system bridge is integrated by the integrator of the upper node
+	for (size_t i = 0; i < n; ++i) {
+		cmf::water::flux_node* node = dynamic_cast<cmf::water::flux_node*>((*all)[int(i)].get());
+		if (!node) continue;
+		cmf::water::connection_list connections = node->get_connections();
+		for (cmf::water::connection_list::const_iterator con = connections.begin(); con != connections.end(); ++con) {
+			cmf::water::SystemBridge* bridge = dynamic_cast<cmf::water::SystemBridge*>((**con).get_target(*node).get());
+			if (bridge && bridge->get_upper_node().get() == node)
+				m_integrators[integrator_of[i]]->integratables.append(bridge->down_flux_integrator());
+		}
+	}
+	m_coupling_outdated = true;
+	return components.size();
+}
+
+size_t cmf::math::MultiIntegrator::get_coupling_count() const
+{
+	return m_coupling ? m_coupling->fluxes.size() : 0;
+}
 
 int cmf::math::MultiIntegrator::integrate( cmf::math::Time MaxTime,cmf::math::Time TimeStep )
 {
-	if (use_OpenMP)
+	if (is_multirate())
+	{
+		if (!m_coupling) m_coupling.reset(new multirate_coupling);
+		if (m_coupling_outdated) m_coupling->build(*this);
+		m_coupling_outdated = false;
+		m_coupling->integrate(*this, MaxTime, TimeStep);
+		m_t = m_coupling->t1;
+		return 1;
+	}
+	else if (use_OpenMP)
 	{
 #pragma omp parallel for
 		for (int i = 0; i < (int)m_integrators.size() ; ++i)
 		{
-			m_integrators[i]->integrate_until(MaxTime,TimeStep);
+			if (m_integrators[i]->size())
+				m_integrators[i]->integrate_until(MaxTime,TimeStep);
 		}
 	}
 	else
 	{
+		// Integrators without states (eg. more integrators than components in distribute_states) are skipped
 		for(integ_vector::iterator it = m_integrators.begin(); it != m_integrators.end(); ++it)
 		{
-			(**it).integrate_until(MaxTime,TimeStep);
+			if ((**it).size())
+				(**it).integrate_until(MaxTime,TimeStep);
 		}
 	}
 	m_t=MaxTime;
@@ -22,27 +22,75 @@
 #include "../../cmfmemory.h"
 namespace cmf {
 	namespace math {
-		/// The MultiIntegrator is a wrapper for a bunch integrators. The states of the integrators should not have direct connections over integrator boundaries
+#ifndef SWIG
+		class multirate_coupling;
+#endif
+		/// @brief The MultiIntegrator is a wrapper for a bunch integrators. 
+		///
+		/// If all integrators have the same rate (default), they are integrated in parallel to the same time and the states 
+		/// of the integrators should not have direct connections over integrator boundaries. 
+		///
+		/// With different rates (see set_rate), the integrators are partitions of a multirate scheme and may be connected: 
+		/// Each time step of integrate_until is a synchronization interval. The partitions are integrated in the order of their rates,
+		/// each with a time step of the interval divided by its rate. Hence slow partitions (eg. deep layers and aquifers) take 
+		/// large steps and are integrated first, fast partitions (eg. surface water and reaches) take small steps afterwards.
+		/// During the integration of a partition, the states of connected slower partitions are linearly interpolated between 
+		/// their values at the start and at the end of the interval, and the states of connected faster partitions keep their 
+		/// values of the start of the interval. The water and solutes exchanged over the connections between the partitions 
+		/// are integrated by both sides as additional states of their integrators. At the end of the interval, the storages 
+		/// of the slower side are corrected by the difference of the exchanged amounts to the faster side, which has calculated
+		/// the exchange with the interpolated history of the slower side. Hence the exchange is conservative, and the slower 
+		/// partitions are reset, if they are corrected.
+		///
+		/// Connected partitions need different rates. Partitions of the same rate are integrated in parallel, if they do not
+		/// interpolate the same states. The connections are collected at the first integration after a change of the rates,
+		/// the states or the time. Integrators with a fixed number of states (eg. CVodeIntegrator) need to be released, if new 
+		/// connections between the partitions are found.
 		class MultiIntegrator : public cmf::math::Integrator
 		{
 			typedef std::shared_ptr<cmf::math::Integrator> integ_ptr;
 			typedef std::vector<integ_ptr> integ_vector;
 			integ_vector m_integrators;
 			std::unique_ptr<cmf::math::Integrator> m_template;
+			std::vector<int> m_rate;
+#ifndef SWIG
+			friend class multirate_coupling;
+			/// The connections between the partitions, built on demand by integrate
+			std::shared_ptr<multirate_coupling> m_coupling;
+#endif
+			bool m_coupling_outdated;
+			bool is_multirate() const;
 		public:
 			int integrate(cmf::math::Time t_max,cmf::math::Time dt);
 			virtual cmf::math::MultiIntegrator* copy() const
 			{
-				return new MultiIntegrator(*m_template,int(m_integrators.size()));
+				MultiIntegrator* result = new MultiIntegrator(*m_template,int(m_integrators.size()));
+				result->m_rate = m_rate;
+				return result;
 			}
-			/// Resets the integrator
+			/// Resets the integrator. The connections between the partitions are collected again at the next integration
 			virtual void reset()
 			{
 				for(integ_vector::iterator it = m_integrators.begin(); it != m_integrators.end(); ++it)
 				{
 				    (**it).set_t(m_t);
 				}
+				m_coupling_outdated = true;
 			}
+			/// @brief Sets the rate of an integrator, the number of time steps per synchronization interval
+			///
+			/// For integrators with an adaptive time step, the resulting time step is the first time step of the interval
+			void set_rate(int integrator_position, int rate) {
+				if (rate < 1) throw std::runtime_error("The rate of an integrator must be at least 1");
+				m_rate.at(integrator_position<0 ? m_rate.size()+integrator_position : integrator_position) = rate;
+				m_coupling_outdated = true;
+			}
+			/// Returns the rate of an integrator (see set_rate)
+			int get_rate(int integrator_position) const {
+				return m_rate.at(integrator_position<0 ? m_rate.size()+integrator_position : integrator_position);
+			}
+			/// Returns the number of connections between the integrators used by the last synchronization interval
+			size_t get_coupling_count() const;
 			/// Only there to override Integrator::AddStatesFromOwner. Throws an exception. Use add_states_to_integrator instead
 			void add_states(cmf::math::StateVariableOwner& stateOwner)
 			{
@@ -53,12 +101,25 @@ namespace cmf {
 			{
 				integ_ptr& integ=m_integrators.at(integrator_position<0 ? m_integrators.size()-integrator_position : integrator_position);
 				integ->add_states(stateOwner);
+				m_coupling_outdated = true;
+			}
+			/// @brief Distributes the state variables of a StateVariableOwner as independent subsystems to the integrators
+			///
+			/// The states are split into the connected components of their connections (see cmf::water::flux_graph::get_sparsity).
+			/// Subsystems coupled only by a cmf::water::SystemBridge are independent components, and the flux over the bridge 
+			/// is integrated by the integrator of the upper node. The components are distributed by their size, the largest 
+			/// component first to the integrator with the fewest states. Add all connected states with one call.
+			/// @returns The number of components
+			size_t distribute_states(cmf::math::StateVariableOwner& stateOwner);
+			/// Returns the number of states of an integrator
+			size_t get_state_count(int integrator_position) const {
+				return m_integrators.at(integrator_position<0 ? m_integrators.size()+integrator_position : integrator_position)->size();
 			}
 			/// Creates a new MultiIntegrator
 			/// @param template_integrator Template for the integrators
 			/// @param count Number of integrators
 			MultiIntegrator(const cmf::math::Integrator& template_integrator,int count)
-				: Integrator(), m_template(template_integrator.copy())
+				: Integrator(), m_template(template_integrator.copy()), m_rate(count, 1), m_coupling_outdated(true)
 			{
 				for (int i = 0; i < count ; ++i)
 				{
@@ -67,6 +128,19 @@ namespace cmf {
 					m_integrators.push_back(Integ);
 				}
 			}
+			/// Creates a new MultiIntegrator and distributes the states as independent subsystems to the integrators (see distribute_states)
+			/// @param template_integrator Template for the integrators
+			/// @param count Number of integrators, eg. the number of threads
+			/// @param states The states to integrate
+			MultiIntegrator(const cmf::math::Integrator& template_integrator,int count,cmf::math::StateVariableOwner& states)
+				: Integrator(), m_template(template_integrator.copy()), m_rate(count, 1), m_coupling_outdated(true)
+			{
+				for (int i = 0; i < count ; ++i)
+				{
+					m_integrators.push_back(integ_ptr(m_template->copy()));
+				}
+				distribute_states(states);
+			}
 		};
 
 	}
@@ -0,0 +1,115 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#include "newton_krylov.h"
+#include <sundials/sundials_spgmr.h>
+#include <nvector/nvector_serial.h>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+cmf::math::NewtonKrylov::NewtonKrylov()
+: m_spgmr(0), m_x(0), m_b(0), m_weight(0), m_integ(0), m_beta(0), m_linear_iterations(0), m_rhsevals(0),
+  max_iterations(10), krylov_dimension(20), max_restarts(2)
+{
+
+}
+
+cmf::math::NewtonKrylov::~NewtonKrylov()
+{
+	free();
+}
+
+void cmf::math::NewtonKrylov::free()
+{
+	if (m_spgmr) SpgmrFree(SpgmrMem(m_spgmr));
+	if (m_x) N_VDestroy_Serial(m_x);
+	if (m_b) N_VDestroy_Serial(m_b);
+	if (m_weight) N_VDestroy_Serial(m_weight);
+	m_spgmr = 0; m_x = m_b = m_weight = 0;
+}
+
+int cmf::math::NewtonKrylov::atimes( void *A_data, N_Vector v, N_Vector z )
+{
+	NewtonKrylov& nk = *static_cast<NewtonKrylov*>(A_data);
+	ptrdiff_t n = nk.m_y.size();
+	real *vd = NV_DATA_S(v), *zd = NV_DATA_S(z);
+	// The difference increment is scaled to the error tolerance of the states, as in CVSPGMR
+	real sig = 1 / N_VWrmsNorm(v, nk.m_weight);
+	if (!(sig < REAL_MAX)) {
+		N_VConst(0.0, z);
+		return 0;
+	}
+	for (ptrdiff_t i = 0; i < n; ++i)
+		nk.m_v[i] = nk.m_y[i] + sig * vd[i];
+	nk.m_integ->set_states(nk.m_v);
+	nk.m_integ->copy_dxdt(nk.m_t, nk.m_fv);
+	++nk.m_rhsevals;
+	// (I - beta J) v
+	for (ptrdiff_t i = 0; i < n; ++i)
+		zd[i] = vd[i] - nk.m_beta * (nk.m_fv[i] - nk.m_f[i]) / sig;
+	return 0;
+}
+
+int cmf::math::NewtonKrylov::solve( Integrator& integ, Time t, real beta, const num_array& c, const num_array& weight )
+{
+	ptrdiff_t n = integ.size();
+	if (m_y.size() != n || !m_spgmr) {
+		free();
+		m_y.resize(n); m_f.resize(n); m_v.resize(n); m_fv.resize(n);
+		m_x = N_VNew_Serial(long(n));
+		m_b = N_VNew_Serial(long(n));
+		m_weight = N_VNew_Serial(long(n));
+		m_spgmr = SpgmrMalloc(std::min(krylov_dimension, int(n)), m_x);
+		if (!m_spgmr)
+			throw std::runtime_error("NewtonKrylov: GMRES memory could not be allocated");
+	}
+	m_integ = &integ;
+	m_t = t;
+	m_beta = beta;
+	std::copy(weight.begin(), weight.end(), NV_DATA_S(m_weight));
+	real *x = NV_DATA_S(m_x), *b = NV_DATA_S(m_b);
+	real old_norm = REAL_MAX;
+	for (int iter = 1; iter <= max_iterations; ++iter) {
+		integ.copy_states(m_y);
+		integ.copy_dxdt(t, m_f);
+		++m_rhsevals;
+		// b = -G(y)
+		for (ptrdiff_t i = 0; i < n; ++i)
+			b[i] = c[i] + beta * m_f[i] - m_y[i];
+		N_VConst(0.0, m_x);
+		real res_norm = 0;
+		int nli = 0, nps = 0;
+		int flag = SpgmrSolve(SpgmrMem(m_spgmr), this, m_x, m_b, PREC_NONE, MODIFIED_GS, 0.1, max_restarts,
+			0, m_weight, m_weight, atimes, 0, &res_norm, &nli, &nps);
+		m_linear_iterations += nli;
+		if (flag != SPGMR_SUCCESS && flag != SPGMR_RES_REDUCED) {
+			integ.set_states(m_y);
+			return -1;
+		}
+		// New states and the scaled max norm of the update
+		real norm = 0;
+		for (ptrdiff_t i = 0; i < n; ++i) {
+			m_y[i] += x[i];
+			norm = std::max(norm, std::abs(x[i]) * weight[i]);
+		}
+		integ.set_states(m_y);
+		if (!(norm < REAL_MAX) || norm >= old_norm) return -1;
+		if (norm <= 1) return iter;
+		old_norm = norm;
+	}
+	return -1;
+}
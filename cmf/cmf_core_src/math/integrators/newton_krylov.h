@@ -0,0 +1,76 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#ifndef newton_krylov_h__
+#define newton_krylov_h__
+
+#include "integrator.h"
+#include "../real.h"
+#include <sundials/sundials_nvector.h>
+
+namespace cmf {
+	namespace math {
+		/// @brief Solves the implicit equation of a multistep formula with a Newton iteration, where the linear systems are solved
+		/// by GMRES with Jacobian-vector products from directional finite differences (Jacobian-free Newton-Krylov)
+		///
+		/// The equation is \f$ G(y) = y - c - \beta f(t, y) = 0\f$, eg. with \f$c=y_n, \beta = h\f$ for the implicit Euler method.
+		/// Each Newton iteration solves \f$ (I - \beta J) \delta = -G(y)\f$ with the scaled GMRES of SUNDIALS (SpgmrSolve), where
+		/// \f$ J v \approx (f(t, y + \sigma v) - f(t, y))/\sigma \f$ costs one evaluation of the right hand side. The Jacobian is never
+		/// stored. The iteration converges, when the scaled max norm of the Newton update is below 1.
+		class NewtonKrylov
+		{
+		private:
+			// Memory of the GMRES solver and the vectors of the linear system
+			void * m_spgmr;
+			N_Vector m_x, m_b, m_weight;
+			// The integrator, the states, their derivatives and the parameters of the linear operator
+			Integrator* m_integ;
+			num_array m_y, m_f, m_v, m_fv;
+			Time m_t;
+			real m_beta;
+			int m_linear_iterations, m_rhsevals;
+			void free();
+			static int atimes(void *A_data, N_Vector v, N_Vector z);
+		public:
+			/// Maximum number of Newton iterations (default 10)
+			int max_iterations;
+			/// Maximum dimension of the Krylov subspace (default 20)
+			int krylov_dimension;
+			/// Maximum number of GMRES restarts (default 2)
+			int max_restarts;
+			/// @brief Solves \f$ y - c - \beta f(t, y) = 0\f$, starting at the current states of integ
+			///
+			/// @returns the number of Newton iterations or -1, if the iteration fails to converge. If the iteration converges,
+			/// the states of integ are the solution
+			/// @param integ The integrator of the states
+			/// @param t Time of the right hand side
+			/// @param beta Factor of the right hand side in days
+			/// @param c Constant part of the equation
+			/// @param weight The inverse of the error tolerance of each state
+			int solve(Integrator& integ, Time t, real beta, const num_array& c, const num_array& weight);
+			/// Returns the number of GMRES iterations of all solves
+			int get_linear_iterations() const {return m_linear_iterations;}
+			/// Returns the number of evaluations of the right hand side of all solves
+			int get_rhsevals() const {return m_rhsevals;}
+			NewtonKrylov();
+			~NewtonKrylov();
+		private:
+			NewtonKrylov(const NewtonKrylov&);
+			NewtonKrylov& operator=(const NewtonKrylov&);
+		};
+	}
+}
+#endif // newton_krylov_h__
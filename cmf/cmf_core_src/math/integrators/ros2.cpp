@@ -0,0 +1,154 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#include "ros2.h"
+#include "sparse_jacobian.h"
+#include "sparse_lu.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+	const real ros2_gamma = 1.0 + 1.0 / std::sqrt(2.0);
+}
+
+cmf::math::ROS2::ROS2( cmf::math::StateVariableOwner& states, real epsilon/*=1e-9*/, cmf::math::Time tStepMin/*=timespan(10)*/ )
+: Integrator(states, epsilon), m_jac_age(-1), m_rhsevals(0), m_jacevals(0), m_rejected(0), dt_min(tStepMin), max_jacobian_age(5)
+{
+}
+
+cmf::math::ROS2::ROS2( real epsilon/*=1e-9*/, cmf::math::Time tStepMin/*=timespan(10)*/ )
+: Integrator(epsilon), m_jac_age(-1), m_rhsevals(0), m_jacevals(0), m_rejected(0), dt_min(tStepMin), max_jacobian_age(5)
+{
+}
+
+cmf::math::ROS2::ROS2( const Integrator& templ )
+: Integrator(templ), m_jac_age(-1), m_rhsevals(0), m_jacevals(0), m_rejected(0), dt_min(timespan(10)), max_jacobian_age(5)
+{
+	const ROS2* ros2 = dynamic_cast<const ROS2*>(&templ);
+	if (ros2) {
+		dt_min = ros2->dt_min;
+		max_jacobian_age = ros2->max_jacobian_age;
+	}
+}
+
+cmf::math::solver_counters cmf::math::ROS2::get_counters() const
+{
+	solver_counters result = Integrator::get_counters();
+	result.jacevals = m_jacevals;
+	result.error_test_failures = m_rejected;
+	result.order = 2;
+	return result;
+}
+
+void cmf::math::ROS2::reset()
+{
+	m_jac_age = -1;
+	m_h = Time();
+}
+
+bool cmf::math::ROS2::prepared() const
+{
+	if (!m_jac || m_prepared.size() != size()) return false;
+	for (size_t i = 0; i < size(); ++i)
+		if (m_prepared[i] != m_States[i].get()) return false;
+	return true;
+}
+
+void cmf::math::ROS2::prepare()
+{
+	size_t n = size();
+	m_prepared.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		m_prepared[i] = m_States[i].get();
+	m_jac.reset(new SparseJacobian(*this));
+	m_lu.reset(new SparseLU(m_jac->row_start(), m_jac->columns()));
+	m_matrix.resize(m_jac->nonzeros());
+	m_diag.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		m_diag[i] = std::lower_bound(m_jac->columns().begin() + m_jac->row_start()[i], m_jac->columns().begin() + m_jac->row_start()[i + 1], i) - m_jac->columns().begin();
+	m_jac_age = -1;
+	m_abstol.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		m_abstol[i] = m_States[i]->get_abs_errtol(Epsilon * 1e-3);
+}
+
+int cmf::math::ROS2::integrate( cmf::math::Time MaxTime, cmf::math::Time TimeStep )
+{
+	if (m_States.size()==0)
+		throw std::out_of_range("No states to integrate!");
+	if (!prepared()) prepare();
+	size_t n = size();
+	std::vector<real> y0(n), f0(n), Y(n), k1(n), k2(n);
+	copy_states(&y0[0]);
+	copy_dxdt(get_t(), &f0[0]);
+	++m_rhsevals;
+	Time h = m_h > Time() ? m_h : (TimeStep > Time() ? TimeStep : MaxTime - get_t());
+	AdjustTimestep(h, MaxTime);
+	while (true) {
+		real hd = h.AsDays();
+		bool fresh = false;
+		if (m_jac_age < 0 || m_jac_age >= max_jacobian_age) {
+			m_jac->calculate(*this, get_t());
+			++m_jacevals;
+			m_jac_age = 0;
+			fresh = true;
+		}
+		// M = I - gamma*h*J
+		const std::vector<real>& J = m_jac->values();
+		for (size_t k = 0; k < J.size(); ++k)
+			m_matrix[k] = -ros2_gamma * hd * J[k];
+		for (size_t i = 0; i < n; ++i)
+			m_matrix[m_diag[i]] += 1.0;
+		real error = REAL_MAX;
+		if (m_lu->factorize(&m_matrix[0])) {
+			k1 = f0;
+			m_lu->solve(&k1[0]);
+			for (size_t i = 0; i < n; ++i)
+				Y[i] = y0[i] + hd * k1[i];
+			set_states(&Y[0]);
+			copy_dxdt(get_t() + h, &k2[0]);
+			++m_rhsevals;
+			for (size_t i = 0; i < n; ++i)
+				k2[i] -= 2 * k1[i];
+			m_lu->solve(&k2[0]);
+			// The difference to the embedded solution y0 + h*k1
+			error = 0.0;
+			for (size_t i = 0; i < n; ++i) {
+				Y[i] = y0[i] + hd * (1.5 * k1[i] + 0.5 * k2[i]);
+				real e = 0.5 * hd * (k1[i] + k2[i]);
+				error = std::max(error, std::abs(e) / (m_abstol[i] + Epsilon * std::max(std::abs(y0[i]), std::abs(Y[i]))));
+			}
+		}
+		if (!(error <= 1.0)) {
+			set_states(&y0[0]);
+			++m_rejected;
+			// A rejected step with an older Jacobian is repeated with a new Jacobian
+			if (fresh)
+				h *= std::max(0.2, error < REAL_MAX ? 0.9 / std::sqrt(error) : 0.0);
+			else
+				m_jac_age = -1;
+			if (h < dt_min)
+				throw std::runtime_error("ROS2: The error exceeds the tolerance with a time step > minimal time step");
+			continue;
+		}
+		set_states(&Y[0]);
+		m_dt = h;
+		m_t += h;
+		++m_jac_age;
+		m_h = h * std::min(5.0, std::max(0.2, error > 0 ? 0.9 / std::sqrt(error) : 5.0));
+		return 1;
+	}
+}
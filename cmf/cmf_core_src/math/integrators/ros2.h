@@ -0,0 +1,96 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#ifndef ros2_h__
+#define ros2_h__
+
+#include "integrator.h"
+#include "../real.h"
+#include <vector>
+namespace cmf {
+	namespace math {
+		class SparseJacobian;
+		class SparseLU;
+		/// @brief A linearly implicit, L-stable Rosenbrock method of second order (ROS2) with the sparse Jacobian
+		///
+		/// A step solves two linear systems with the same matrix \f$I - \gamma h J\f$, \f$\gamma = 1 + 1/\sqrt{2}\f$
+		/// (Verwer, Spee, Blom and Hundsdorfer 1999, SIAM Journal on Scientific Computing 20, 1456-1480):
+		///  - \f$ (I - \gamma h J) k_1 = f(t_n, y_n) \f$
+		///  - \f$ (I - \gamma h J) k_2 = f(t_n + h, y_n + h k_1) - 2 k_1 \f$
+		///  - \f$ y_{n+1} = y_n + \frac 3 2 h k_1 + \frac 1 2 h k_2 \f$
+		///
+		/// The Jacobian J is the SparseJacobian of the states, and the matrix is factorized once per step with a SparseLU.
+		/// No nonlinear iteration is needed. The method keeps its order for any approximation of J (W-method), hence a Jacobian
+		/// can be used for several steps (see max_jacobian_age). The difference to the embedded first order solution
+		/// \f$ y_n + h k_1\f$ estimates the local error and controls the time step.
+		///
+		/// As a one step method, ROS2 has no history: After a discontinuity of the forcing the steps are only limited by
+		/// the local error. Call reset after a discontinuity to forget the Jacobian and to restart with the time step of the call.
+		class ROS2 : public Integrator
+		{
+		private:
+			// The states at the creation of the Jacobian
+			std::vector<const StateVariable*> m_prepared;
+			std::shared_ptr<SparseJacobian> m_jac;
+			std::shared_ptr<SparseLU> m_lu;
+			// Position of the diagonal entries in the pattern and the entries of I - gamma*h*J
+			std::vector<size_t> m_diag;
+			std::vector<real> m_matrix;
+			// Number of steps with the current Jacobian, -1 if the Jacobian is outdated
+			int m_jac_age;
+			// Absolute error tolerance
+			std::vector<real> m_abstol;
+			// The proposed next time step
+			Time m_h;
+			int m_rhsevals, m_jacevals, m_rejected;
+			bool prepared() const;
+			void prepare();
+		public:
+			/// The shortest allowed timestep
+			Time dt_min;
+			/// The number of steps a Jacobian is used for (default 5). A rejected step with an older Jacobian gets a new Jacobian
+			int max_jacobian_age;
+			/// Returns the number of evaluations of the right hand side by the steps, without the Jacobian
+			int get_rhsevals() const {return m_rhsevals;}
+			/// Returns the number of calculated Jacobians
+			int get_jacevals() const {return m_jacevals;}
+			/// Returns the cumulative counters with the Jacobians and the rejected steps
+			virtual cmf::math::solver_counters get_counters() const;
+			/// Forgets the Jacobian and the time step
+			virtual void reset();
+			/// Constructs a new ROS2 integrator
+			/// @param states States to be added to the solver
+			/// @param epsilon relative error tolerance per time step (default=1e-9)
+			/// @param tStepMin minimum time step (default=10s)
+			ROS2(cmf::math::StateVariableOwner& states, real epsilon=1e-9, cmf::math::Time tStepMin=cmf::math::timespan(10));
+			/// Constructs a new ROS2 integrator
+			/// @param epsilon relative error tolerance per time step (default=1e-9)
+			/// @param tStepMin minimum time step (default=10s)
+			ROS2(real epsilon=1e-9, cmf::math::Time tStepMin=cmf::math::timespan(10));
+			/// Constructs a new ROS2 integrator from a template, without states
+			ROS2(const Integrator& templ);
+			virtual Integrator * copy() const
+			{
+				return new ROS2(static_cast<const Integrator&>(*this));
+			}
+			/// @brief Takes one step
+			/// @param MaxTime The time, the step should not exceed
+			/// @param TimeStep The first time step, later steps are controlled by the local error
+			int integrate(cmf::math::Time MaxTime, cmf::math::Time TimeStep);
+		};
+	}
+}
+#endif // ros2_h__
@@ -0,0 +1,126 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#include "solver_statistics.h"
+#include "../statevariable.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+cmf::math::SolverStatistics::SolverStatistics( size_t capacity/*=10000*/ )
+: m_capacity(capacity), m_next(0), m_steps(0)
+{
+}
+
+namespace {
+	// The difference of a counter, which may have been reset by the integrator during the step
+	long long counted( long long before, long long after )
+	{
+		return after >= before ? after - before : after;
+	}
+}
+
+void cmf::math::SolverStatistics::record( Time t, Time dt, double wall_time, const solver_counters& before, const solver_counters& after )
+{
+	step_record r;
+	r.t = t;
+	r.dt = dt;
+	r.wall_time = wall_time;
+	r.order = after.order;
+	r.rhsevals = counted(before.rhsevals, after.rhsevals);
+	r.jacevals = counted(before.jacevals, after.jacevals);
+	r.nonlinear_iterations = counted(before.nonlinear_iterations, after.nonlinear_iterations);
+	r.linear_iterations = counted(before.linear_iterations, after.linear_iterations);
+	r.error_test_failures = counted(before.error_test_failures, after.error_test_failures);
+	r.convergence_failures = counted(before.convergence_failures, after.convergence_failures);
+	// Totals
+	++m_steps;
+	m_total.t = t;
+	m_total.dt += dt;
+	m_total.wall_time += wall_time;
+	m_total.order = r.order;
+	m_total.rhsevals += r.rhsevals;
+	m_total.jacevals += r.jacevals;
+	m_total.nonlinear_iterations += r.nonlinear_iterations;
+	m_total.linear_iterations += r.linear_iterations;
+	m_total.error_test_failures += r.error_test_failures;
+	m_total.convergence_failures += r.convergence_failures;
+	// Ring buffer
+	if (m_capacity) {
+		if (m_records.size() < m_capacity)
+			m_records.push_back(r);
+		else
+			m_records[m_next] = r;
+		m_next = (m_next + 1) % m_capacity;
+	}
+	if (m_log) {
+		std::ostream& out = *m_log;
+		write_binary(out, r.t.AsMilliseconds());
+		write_binary(out, r.dt.AsMilliseconds());
+		write_binary(out, r.wall_time);
+		write_binary(out, (long long)(r.order));
+		write_binary(out, r.rhsevals);
+		write_binary(out, r.jacevals);
+		write_binary(out, r.nonlinear_iterations);
+		write_binary(out, r.linear_iterations);
+		write_binary(out, r.error_test_failures);
+		write_binary(out, r.convergence_failures);
+	}
+}
+
+cmf::math::step_record cmf::math::SolverStatistics::get_record( ptrdiff_t index ) const
+{
+	ptrdiff_t n = ptrdiff_t(m_records.size());
+	if (index < 0) index += n;
+	if (index < 0 || index >= n)
+		throw std::out_of_range("SolverStatistics: No record at this position");
+	// The oldest record is at m_next, if the buffer is full
+	if (n == ptrdiff_t(m_capacity))
+		index = (index + ptrdiff_t(m_next)) % n;
+	return m_records[index];
+}
+
+void cmf::math::SolverStatistics::open_log( std::string filename )
+{
+	std::shared_ptr<std::ofstream> log(new std::ofstream(filename.c_str(), std::ios::binary));
+	if (!*log)
+		throw std::runtime_error("SolverStatistics: Can not open " + filename);
+	log->write("cmf-sta1", 8);
+	m_log = log;
+}
+
+void cmf::math::SolverStatistics::close_log()
+{
+	m_log.reset();
+}
+
+void cmf::math::SolverStatistics::clear()
+{
+	m_records.clear();
+	m_next = 0;
+	m_steps = 0;
+	m_total = step_record();
+}
+
+std::string cmf::math::SolverStatistics::to_string() const
+{
+	std::stringstream out;
+	out << m_steps << " steps over " << m_total.dt.AsDays() << " days in " << m_total.wall_time << " s: "
+		<< m_total.rhsevals << " rhs evaluations, " << m_total.jacevals << " Jacobians, "
+		<< m_total.nonlinear_iterations << " nonlinear and " << m_total.linear_iterations << " linear iterations, "
+		<< m_total.error_test_failures << " error test and " << m_total.convergence_failures << " convergence failures";
+	return out.str();
+}
@@ -0,0 +1,109 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#ifndef solver_statistics_h__
+#define solver_statistics_h__
+
+#include "../time.h"
+#include <vector>
+#include <string>
+#include <memory>
+#include <iosfwd>
+namespace cmf {
+	namespace math {
+		/// @brief Cumulative counters of an integrator (see Integrator::get_counters)
+		///
+		/// Counters not provided by an integrator are zero
+		struct solver_counters {
+			/// Evaluations of the right hand side, including the evaluations for finite difference Jacobians
+			long long rhsevals;
+			/// Evaluations of the Jacobian or of the preconditioner matrix
+			long long jacevals;
+			/// Iterations of the nonlinear solver
+			long long nonlinear_iterations;
+			/// Iterations of the linear solver (Krylov methods)
+			long long linear_iterations;
+			/// Steps rejected by the error test
+			long long error_test_failures;
+			/// Steps rejected by a failure of the nonlinear solver
+			long long convergence_failures;
+			/// Order of the last step
+			int order;
+			solver_counters() 
+				: rhsevals(0), jacevals(0), nonlinear_iterations(0), linear_iterations(0), 
+				  error_test_failures(0), convergence_failures(0), order(0) 
+			{}
+		};
+		/// @brief The record of a step (one call of Integrator::integrate) in SolverStatistics
+		struct step_record : public solver_counters {
+			/// Time at the end of the step
+			Time t;
+			/// Length of the step
+			Time dt;
+			/// Wall time of the step in seconds
+			double wall_time;
+			step_record() : wall_time(0) {}
+		};
+		/// @brief Collects the statistics of the steps of an integrator
+		///
+		/// Set the statistics of an integrator (Integrator::statistics) to collect them. Each step of Integrator::integrate_until 
+		/// is recorded with its wall time, step size, order and the differences of the counters of the integrator (see 
+		/// solver_counters). The last records are kept in a ring buffer, and all records can be streamed to a binary log.
+		/// The totals over all recorded steps are available with get_total, get_steps, get_wall_time and get_time.
+		class SolverStatistics
+		{
+		private:
+			std::vector<step_record> m_records;
+			size_t m_capacity, m_next;
+			step_record m_total;
+			long long m_steps;
+			std::shared_ptr<std::ostream> m_log;
+		public:
+			/// Records a step from the counters of the integrator before and after the step
+			void record(Time t, Time dt, double wall_time, const solver_counters& before, const solver_counters& after);
+			/// Number of records in the ring buffer
+			size_t size() const {return m_records.size();}
+			/// Maximum number of records in the ring buffer
+			size_t get_capacity() const {return m_capacity;}
+			/// Returns a record of the ring buffer, 0 is the oldest and -1 the last step
+			step_record get_record(ptrdiff_t index) const;
+			/// Returns the sums of the counters over all recorded steps, the order is the order of the last step
+			solver_counters get_total() const {return m_total;}
+			/// Number of recorded steps
+			long long get_steps() const {return m_steps;}
+			/// Wall time of all recorded steps in seconds
+			double get_wall_time() const {return m_total.wall_time;}
+			/// Integrated time of all recorded steps
+			Time get_time() const {return m_total.dt;}
+			/// @brief Streams all following records to a binary file
+			///
+			/// The file starts with the 8 characters "cmf-sta1", followed by a record of 10 values with 8 bytes in native byte order 
+			/// for each step: t and dt in ms (int64), wall time in s (float64), order, rhsevals, jacevals, nonlinear iterations, 
+			/// linear iterations, error test failures and convergence failures (int64)
+			void open_log(std::string filename);
+			/// Closes the binary log
+			void close_log();
+			/// Removes all records and resets the totals
+			void clear();
+			/// A summary of the totals
+			std::string to_string() const;
+			/// Creates a new statistics collector
+			/// @param capacity Number of steps kept in the ring buffer (default 10000)
+			SolverStatistics(size_t capacity=10000);
+		};
+	}
+}
+#endif // solver_statistics_h__
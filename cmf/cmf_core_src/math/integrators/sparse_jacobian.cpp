@@ -0,0 +1,236 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#include "sparse_jacobian.h"
+#include "../../water/flux_graph.h"
+#include <algorithm>
+#include <cmath>
+
+cmf::math::SparseJacobian::SparseJacobian( const Integrator& integ )
+: m_derived_columns(0), use_flux_derivatives(true)
+{
+	create(integ);
+}
+
+cmf::math::SparseJacobian::SparseJacobian( const Integrator& integ, const std::vector<size_t>& blocks )
+: m_derived_columns(0), m_block(blocks), use_flux_derivatives(true)
+{
+	if (blocks.size() != integ.size())
+		throw std::runtime_error("SparseJacobian: The number of blocks differs from the number of states");
+	create(integ);
+}
+
+void cmf::math::SparseJacobian::create( const Integrator& integ )
+{
+	const cmf::water::flux_graph& graph = integ.get_flux_graph();
+	graph.get_sparsity(m_row_start, m_columns);
+	m_values.assign(m_columns.size(), 0.0);
+	size_t n = size();
+	// Transpose the pattern
+	m_column_start.assign(n + 1, 0);
+	for (size_t k = 0; k < m_columns.size(); ++k)
+		++m_column_start[m_columns[k] + 1];
+	for (size_t j = 0; j < n; ++j)
+		m_column_start[j + 1] += m_column_start[j];
+	m_column_row.resize(m_columns.size());
+	m_column_entry.resize(m_columns.size());
+	std::vector<size_t> fill(m_column_start.begin(), m_column_start.end() - 1);
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t k = m_row_start[i]; k < m_row_start[i + 1]; ++k) {
+			size_t pos = fill[m_columns[k]]++;
+			m_column_row[pos] = i;
+			m_column_entry[pos] = k;
+		}
+	}
+	// The connections of each state and the position of their entries
+	size_t edges = graph.edge_count();
+	m_state_edge_start.assign(n + 1, 0);
+	m_edge_entry.assign(4 * edges, -1);
+	for (size_t e = 0; e < edges; ++e) {
+		ptrdiff_t ends[2] = {graph.left_index(e), graph.right_index(e)};
+		for (int a = 0; a < 2; ++a) {
+			if (ends[a] < 0) continue;
+			++m_state_edge_start[ends[a] + 1];
+			for (int b = 0; b < 2; ++b) {
+				if (ends[b] < 0) continue;
+				std::vector<size_t>::const_iterator
+					begin = m_columns.begin() + m_row_start[ends[a]],
+					end = m_columns.begin() + m_row_start[ends[a] + 1],
+					it = std::lower_bound(begin, end, size_t(ends[b]));
+				if (it != end && *it == size_t(ends[b]))
+					m_edge_entry[4 * e + 2 * a + b] = it - m_columns.begin();
+			}
+		}
+	}
+	for (size_t j = 0; j < n; ++j)
+		m_state_edge_start[j + 1] += m_state_edge_start[j];
+	m_state_edge.resize(m_state_edge_start.back());
+	fill.assign(m_state_edge_start.begin(), m_state_edge_start.end() - 1);
+	for (size_t e = 0; e < edges; ++e) {
+		if (graph.left_index(e) >= 0) m_state_edge[fill[graph.left_index(e)]++] = e;
+		if (graph.right_index(e) >= 0) m_state_edge[fill[graph.right_index(e)]++] = e;
+	}
+	// A column can be assembled from the flux derivatives, if it belongs to a storage integrating its volume,
+	// and the only entries of the column are the storages at the ends of its independent connections
+	m_derivable.assign(n, 0);
+	for (size_t j = 0; j < n; ++j) {
+		if (!graph.is_volume_state(j)) continue;
+		bool derivable = true;
+		std::vector<size_t> rows(1, j);
+		for (size_t k = m_state_edge_start[j]; k < m_state_edge_start[j + 1] && derivable; ++k) {
+			size_t e = m_state_edge[k];
+			ptrdiff_t other = graph.left_index(e) == ptrdiff_t(j) ? graph.right_index(e) : graph.left_index(e);
+			derivable = graph.is_independent(e) && (other < 0 || graph.is_volume_state(other));
+			if (other >= 0) rows.push_back(other);
+		}
+		std::sort(rows.begin(), rows.end());
+		rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+		m_derivable[j] = derivable && rows.size() == m_column_start[j + 1] - m_column_start[j];
+	}
+	// Greedy coloring: A column gets the smallest color not used by any column sharing a row with it, if 
+	// the row is calculated for one of the two columns
+	const size_t no_color = size_t(-1);
+	std::vector<size_t> color(n, no_color);
+	std::vector<size_t> used_by(n, no_color);
+	// The columns, which can be derived, are colored after the others with their own colors. Hence the
+	// right hand side is only evaluated for the colors of the other columns, if all derivatives are available
+	size_t colors = 0;
+	for (int pass = 0; pass < 2; ++pass) {
+		size_t first_color = colors;
+		for (size_t j = 0; j < n; ++j) {
+			if (m_derivable[j] != pass) continue;
+			for (size_t p = m_column_start[j]; p < m_column_start[j + 1]; ++p) {
+				size_t i = m_column_row[p];
+				for (size_t k = m_row_start[i]; k < m_row_start[i + 1]; ++k) {
+					size_t c = color[m_columns[k]];
+					if (c != no_color && (in_block(i, j) || in_block(i, m_columns[k]))) used_by[c] = j;
+				}
+			}
+			size_t c = first_color;
+			while (c < colors && used_by[c] == j) ++c;
+			if (c == colors) ++colors;
+			color[j] = c;
+		}
+	}
+	m_color_start.assign(colors + 1, 0);
+	for (size_t j = 0; j < n; ++j)
+		++m_color_start[color[j] + 1];
+	for (size_t c = 0; c < colors; ++c)
+		m_color_start[c + 1] += m_color_start[c];
+	m_color_column.resize(n);
+	fill.assign(m_color_start.begin(), m_color_start.end() - 1);
+	for (size_t j = 0; j < n; ++j)
+		m_color_column[fill[color[j]]++] = j;
+}
+
+void cmf::math::SparseJacobian::calculate( Integrator& integ, cmf::math::Time t, real delta/*=1e-6*/ )
+{
+	if (integ.size() != size())
+		throw std::runtime_error("SparseJacobian: The number of states of the integrator has changed");
+	size_t n = size();
+	num_array x0(n), x(n), f0(n), f(n), h(n);
+	integ.copy_states(x0);
+	integ.copy_dxdt(t, f0);
+	// Columns calculated from the derivatives of the fluxes
+	std::vector<char> derived(n, 0);
+	m_derived_columns = 0;
+	if (use_flux_derivatives && std::find(m_derivable.begin(), m_derivable.end(), 1) != m_derivable.end()) {
+		const cmf::water::flux_graph& graph = integ.get_flux_graph();
+		size_t edges = graph.edge_count();
+		if (4 * edges != m_edge_entry.size())
+			throw std::runtime_error("SparseJacobian: The connections of the integrator have changed");
+		std::vector<real> dq_dleft(edges), dq_dright(edges);
+		std::vector<char> available(edges);
+		if (edges) 
+			graph.copy_dq_dV(t, &dq_dleft[0], &dq_dright[0], &available[0], integ.use_OpenMP);
+		for (size_t j = 0; j < n; ++j) {
+			derived[j] = m_derivable[j];
+			for (size_t k = m_state_edge_start[j]; k < m_state_edge_start[j + 1] && derived[j]; ++k)
+				derived[j] = available[m_state_edge[k]];
+			if (!derived[j]) continue;
+			++m_derived_columns;
+			for (size_t q = m_column_start[j]; q < m_column_start[j + 1]; ++q)
+				m_values[m_column_entry[q]] = 0.0;
+		}
+		// A flux from left to right is a loss for the left and a gain for the right storage
+		for (size_t e = 0; e < edges; ++e) {
+			ptrdiff_t ends[2] = {graph.left_index(e), graph.right_index(e)};
+			real dq[2] = {dq_dleft[e], dq_dright[e]};
+			for (int b = 0; b < 2; ++b) {
+				if (ends[b] < 0 || !derived[ends[b]]) continue;
+				if (ends[0] >= 0) m_values[m_edge_entry[4 * e + b]] -= dq[b];
+				if (ends[1] >= 0) m_values[m_edge_entry[4 * e + 2 + b]] += dq[b];
+			}
+		}
+	}
+	// The other columns are approximated by finite differences
+	for (size_t c = 0; c < color_count(); ++c) {
+		x = x0;
+		bool perturbed = false;
+		for (size_t p = m_color_start[c]; p < m_color_start[c + 1]; ++p) {
+			size_t j = m_color_column[p];
+			if (derived[j]) continue;
+			perturbed = true;
+			// Use the representable difference as step size
+			x[j] = x0[j] + delta * std::max(std::abs(x0[j]), real(1));
+			h[j] = x[j] - x0[j];
+		}
+		if (!perturbed) continue;
+		integ.set_states(x);
+		integ.copy_dxdt(t, f);
+		for (size_t p = m_color_start[c]; p < m_color_start[c + 1]; ++p) {
+			size_t j = m_color_column[p];
+			if (derived[j]) continue;
+			for (size_t q = m_column_start[j]; q < m_column_start[j + 1]; ++q) {
+				size_t i = m_column_row[q];
+				m_values[m_column_entry[q]] = in_block(i, j) ? (f[i] - f0[i]) / h[j] : 0.0;
+			}
+		}
+	}
+	integ.set_states(x0);
+}
+
+real cmf::math::SparseJacobian::get( size_t i, size_t j ) const
+{
+	if (i >= size() || j >= size())
+		throw std::out_of_range("SparseJacobian: Index out of range");
+	std::vector<size_t>::const_iterator
+		begin = m_columns.begin() + m_row_start[i],
+		end = m_columns.begin() + m_row_start[i + 1],
+		it = std::lower_bound(begin, end, j);
+	return (it != end && *it == j) ? m_values[it - m_columns.begin()] : 0.0;
+}
+
+cmf::math::num_array cmf::math::SparseJacobian::get_values() const
+{
+	num_array res(m_values.size());
+	std::copy(m_values.begin(), m_values.end(), res.begin());
+	return res;
+}
+
+cmf::math::num_array cmf::math::SparseJacobian::get_columns() const
+{
+	num_array res(m_columns.size());
+	std::copy(m_columns.begin(), m_columns.end(), res.begin());
+	return res;
+}
+
+cmf::math::num_array cmf::math::SparseJacobian::get_row_start() const
+{
+	num_array res(m_row_start.size());
+	std::copy(m_row_start.begin(), m_row_start.end(), res.begin());
+	return res;
+}
@@ -0,0 +1,115 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#ifndef sparse_jacobian_h__
+#define sparse_jacobian_h__
+
+#include "integrator.h"
+#include <vector>
+namespace cmf {
+	namespace math {
+		/// @brief The sparse Jacobian \f$J_{ij} = \frac{\partial f_i}{\partial x_j}\f$ of the states of an integrator,
+		/// approximated by finite differences
+		///
+		/// The sparsity pattern is taken from the connections between the states (see cmf::water::flux_graph::get_sparsity)
+		/// and is stored in compressed rows (CSR). The columns are colored, such that no two columns of the same color have
+		/// an entry in the same row. All columns of one color are perturbed together, hence the Jacobian is calculated with
+		/// one evaluation of the right hand side per color, which is about the maximum number of connected states
+		/// per state, instead of one evaluation per state.
+		///
+		/// If use_flux_derivatives is true, the columns of water storages are assembled from the analytic derivatives of 
+		/// the fluxes of their connections (see cmf::water::flux_graph::copy_dq_dV) with a single pass over the connections. 
+		/// Only the remaining columns are approximated by finite differences: columns of other states, of storages with a 
+		/// connection without derivatives, sharing its calculation or touching a storage integrating its head, and of storages with
+		/// solutes, since the solute fluxes depend on the water fluxes.
+		///
+		/// If the states are grouped into blocks, only the entries within the blocks are calculated, eg. for a block diagonal
+		/// preconditioner. Two columns may then share a color, if they do not meet in a row of the block of one of them, 
+		/// which needs less colors.
+		///
+		/// The pattern reflects the connections at creation time. Create a new SparseJacobian, if the connections change.
+		class SparseJacobian {
+		private:
+			std::vector<size_t> m_row_start;
+			std::vector<size_t> m_columns;
+			std::vector<real> m_values;
+			// The entries of each column (compressed columns): row and position in m_values
+			std::vector<size_t> m_column_start;
+			std::vector<size_t> m_column_row;
+			std::vector<size_t> m_column_entry;
+			// The columns of each color (compressed rows)
+			std::vector<size_t> m_color_start;
+			std::vector<size_t> m_color_column;
+			// The connections of each state (compressed rows) and the position of the entries 
+			// (left,left), (left,right), (right,left), (right,right) of each connection in m_values
+			std::vector<size_t> m_state_edge_start;
+			std::vector<size_t> m_state_edge;
+			std::vector<ptrdiff_t> m_edge_entry;
+			// Columns, that can be assembled from the derivatives of the fluxes
+			std::vector<char> m_derivable;
+			size_t m_derived_columns;
+			// The block of each state, empty if all entries are calculated
+			std::vector<size_t> m_block;
+			void create(const Integrator& integ);
+			bool in_block(size_t i, size_t j) const {return m_block.empty() || m_block[i] == m_block[j];}
+		public:
+			/// If true (default), the columns of water storages are calculated from the derivatives of the fluxes, where available
+			bool use_flux_derivatives;
+			/// Creates the sparsity pattern and the coloring of the Jacobian for the states of integ
+			SparseJacobian(const Integrator& integ);
+#ifndef SWIG
+			/// @brief Creates the sparsity pattern and the coloring for the entries of the Jacobian within blocks of states
+			///
+			/// The other entries of the pattern remain 0
+			/// @param integ The integrator
+			/// @param blocks The block of each state of integ
+			SparseJacobian(const Integrator& integ, const std::vector<size_t>& blocks);
+#endif
+			/// Number of rows and columns
+			size_t size() const {return m_row_start.size() - 1;}
+			/// Number of entries of the sparsity pattern
+			size_t nonzeros() const {return m_columns.size();}
+			/// Number of colors, the maximum number of right hand side evaluations in calculate
+			size_t color_count() const {return m_color_start.size() - 1;}
+			/// Number of columns calculated from the derivatives of the fluxes by the last call of calculate
+			size_t derived_columns() const {return m_derived_columns;}
+			/// @brief Calculates the entries of the Jacobian from the derivatives of the fluxes and with finite differences
+			///
+			/// The states of integ are restored afterwards
+			/// @param integ The integrator used to create the Jacobian
+			/// @param t Time of the evaluation
+			/// @param delta Relative perturbation of a state, the absolute perturbation of a state x is delta*max(|x|,1)
+			void calculate(Integrator& integ, cmf::math::Time t, real delta=1e-6);
+			/// Returns the entry at row i and column j, 0 if the entry is not in the sparsity pattern
+			real get(size_t i, size_t j) const;
+			/// Returns the values of the entries in compressed row order
+			cmf::math::num_array get_values() const;
+			/// Returns the column indices of the entries in compressed row order
+			cmf::math::num_array get_columns() const;
+			/// Returns the position of the first entry of each row, with size()+1 entries
+			cmf::math::num_array get_row_start() const;
+#ifndef SWIG
+			/// The position of the first entry of each row
+			const std::vector<size_t>& row_start() const {return m_row_start;}
+			/// The column indices of the entries
+			const std::vector<size_t>& columns() const {return m_columns;}
+			/// The values of the entries
+			const std::vector<real>& values() const {return m_values;}
+#endif
+		};
+	}
+}
+#endif // sparse_jacobian_h__
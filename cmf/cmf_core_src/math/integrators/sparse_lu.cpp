@@ -0,0 +1,156 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#include "sparse_lu.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+static std::vector<size_t> to_indices(const cmf::math::num_array& a)
+{
+	std::vector<size_t> res(a.size());
+	for (size_t i = 0; i < res.size(); ++i)
+		res[i] = size_t(a[i]);
+	return res;
+}
+
+cmf::math::SparseLU::SparseLU( const num_array& row_start, const num_array& columns )
+: SparseLU(to_indices(row_start), to_indices(columns))
+{
+}
+
+cmf::math::SparseLU::SparseLU( const std::vector<size_t>& row_start, const std::vector<size_t>& columns )
+: m_n(row_start.size() - 1)
+{
+	const size_t none = size_t(-1);
+	m_row_start.assign(1, 0);
+	m_diag.resize(m_n);
+	// Marks the columns already in the current row
+	std::vector<size_t> in_row(m_n, none);
+	std::vector<size_t> row;
+	for (size_t i = 0; i < m_n; ++i)
+	{
+		// Row i of L+U is the pattern of row i of the matrix, merged with the upper part of
+		// the rows k<i of U for each k in the lower part of row i. The lower columns are visited
+		// in ascending order, since the merge adds new lower columns greater than k
+		row.clear();
+		std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t> > lower;
+		for (size_t p = row_start[i]; p < row_start[i + 1]; ++p) {
+			size_t j = columns[p];
+			in_row[j] = i;
+			row.push_back(j);
+			if (j < i) lower.push(j);
+		}
+		if (in_row[i] != i)
+			throw std::runtime_error("SparseLU: The diagonal is not part of the pattern");
+		while (!lower.empty()) {
+			size_t k = lower.top();
+			lower.pop();
+			for (size_t p = m_diag[k] + 1; p < m_row_start[k + 1]; ++p) {
+				size_t j = m_columns[p];
+				if (in_row[j] != i) {
+					in_row[j] = i;
+					row.push_back(j);
+					if (j < i) lower.push(j);
+				}
+			}
+		}
+		std::sort(row.begin(), row.end());
+		m_diag[i] = m_columns.size() + (std::lower_bound(row.begin(), row.end(), i) - row.begin());
+		m_columns.insert(m_columns.end(), row.begin(), row.end());
+		m_row_start.push_back(m_columns.size());
+	}
+	m_values.assign(m_columns.size(), 0.0);
+	m_work.assign(m_n, 0.0);
+	// Map the entries of the matrix into L+U
+	m_matrix_entry.resize(columns.size());
+	for (size_t i = 0; i < m_n; ++i) {
+		for (size_t p = row_start[i]; p < row_start[i + 1]; ++p) {
+			m_matrix_entry[p] = std::lower_bound(m_columns.begin() + m_row_start[i], m_columns.begin() + m_row_start[i + 1], columns[p]) - m_columns.begin();
+		}
+	}
+}
+
+bool cmf::math::SparseLU::factorize( const real* values )
+{
+	std::fill(m_values.begin(), m_values.end(), 0.0);
+	for (size_t p = 0; p < m_matrix_entry.size(); ++p)
+		m_values[m_matrix_entry[p]] = values[p];
+	for (size_t i = 0; i < m_n; ++i)
+	{
+		// Scatter row i and find its largest entry for the pivot test
+		real row_max = 0.0;
+		for (size_t p = m_row_start[i]; p < m_row_start[i + 1]; ++p) {
+			m_work[m_columns[p]] = m_values[p];
+			row_max = std::max(row_max, std::abs(m_values[p]));
+		}
+		// Eliminate the lower part with the rows above
+		for (size_t p = m_row_start[i]; p < m_diag[i]; ++p) {
+			size_t k = m_columns[p];
+			real l = m_work[k] / m_values[m_diag[k]];
+			m_work[k] = l;
+			if (l == 0.0) continue;
+			for (size_t q = m_diag[k] + 1; q < m_row_start[k + 1]; ++q)
+				m_work[m_columns[q]] -= l * m_values[q];
+		}
+		// Gather row i
+		for (size_t p = m_row_start[i]; p < m_row_start[i + 1]; ++p) {
+			m_values[p] = m_work[m_columns[p]];
+			m_work[m_columns[p]] = 0.0;
+		}
+		// Without row exchanges a tiny pivot amplifies the rounding errors of the elimination. 
+		// Reject it, the caller retries with a smaller step
+		real pivot = std::abs(m_values[m_diag[i]]);
+		if (pivot == 0.0 || pivot < 1e-14 * row_max) return false;
+	}
+	return true;
+}
+
+bool cmf::math::SparseLU::factorize( const num_array& values )
+{
+	if (size_t(values.size()) != m_matrix_entry.size())
+		throw std::runtime_error("SparseLU: The number of values does not match the pattern");
+	return factorize(values.begin());
+}
+
+cmf::math::num_array cmf::math::SparseLU::solve( const num_array& b ) const
+{
+	if (size_t(b.size()) != m_n)
+		throw std::runtime_error("SparseLU: The size of the right hand side does not match the matrix");
+	num_array res(b);
+	solve(res.begin());
+	return res;
+}
+
+void cmf::math::SparseLU::solve( real* b ) const
+{
+	// Forward substitution with the unit lower triangle
+	for (size_t i = 0; i < m_n; ++i) {
+		real sum = b[i];
+		for (size_t p = m_row_start[i]; p < m_diag[i]; ++p)
+			sum -= m_values[p] * b[m_columns[p]];
+		b[i] = sum;
+	}
+	// Backward substitution with the upper triangle
+	for (size_t i = m_n; i-- > 0; ) {
+		real sum = b[i];
+		for (size_t p = m_diag[i] + 1; p < m_row_start[i + 1]; ++p)
+			sum -= m_values[p] * b[m_columns[p]];
+		b[i] = sum / m_values[m_diag[i]];
+	}
+}
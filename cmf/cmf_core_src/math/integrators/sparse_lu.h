@@ -0,0 +1,81 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#ifndef sparse_lu_h__
+#define sparse_lu_h__
+
+#include "../real.h"
+#include "../num_array.h"
+#include <vector>
+#include <cstddef>
+namespace cmf {
+	namespace math {
+		/// @brief A sparse LU factorization of a matrix with a fixed sparsity pattern in compressed rows
+		///
+		/// The factorization is split in a symbolic part, done once in the constructor, which finds the
+		/// pattern of L and U including the fill-in, and a numeric part (factorize), which can be repeated for
+		/// new values of the matrix with the same pattern. The elimination uses the diagonal as pivot without
+		/// row exchanges, which is suitable for the iteration matrices \f$I - \gamma J\f$ of implicit solvers.
+		/// All diagonal entries need to be part of the pattern. A pivot smaller than 1e-14 times the largest
+		/// entry of its row is rejected, which is not expected for a small step size \f$\gamma\f$.
+		///
+		/// The fill-in is not minimized here, it stays within the band of the matrix. Use 
+		/// Integrator::reorder_states before the solver is created to keep the bandwidth and the fill-in small.
+		class SparseLU {
+		private:
+			size_t m_n;
+			// Pattern of L (strict lower part, unit diagonal implied) and U in compressed rows
+			std::vector<size_t> m_row_start;
+			std::vector<size_t> m_columns;
+			// Position of the diagonal of each row in m_columns
+			std::vector<size_t> m_diag;
+			std::vector<real> m_values;
+			// Position of each entry of the matrix pattern in m_values
+			std::vector<size_t> m_matrix_entry;
+			std::vector<real> m_work;
+		public:
+#ifndef SWIG
+			/// @brief Creates the symbolic factorization of a pattern
+			/// @param row_start Position of the first entry of each row, size n+1
+			/// @param columns Sorted column indices of the entries of each row
+			SparseLU(const std::vector<size_t>& row_start, const std::vector<size_t>& columns);
+#endif
+			/// @brief Creates the symbolic factorization of a pattern, eg. from SparseJacobian::get_row_start and get_columns
+			/// @param row_start Position of the first entry of each row, size n+1
+			/// @param columns Sorted column indices of the entries of each row
+			SparseLU(const cmf::math::num_array& row_start, const cmf::math::num_array& columns);
+			/// Number of rows and columns
+			size_t size() const {return m_n;}
+			/// Number of entries of L and U, including the fill-in
+			size_t nonzeros() const {return m_columns.size();}
+			/// @brief Factorizes a matrix with the pattern of the constructor
+			/// @param values The entries of the matrix in the order of the pattern
+			/// @returns false, if a pivot is zero or small compared to its row
+#ifndef SWIG
+			bool factorize(const real* values);
+			/// Solves LUx=b in place, after a successful factorize
+			void solve(real* b) const;
+#endif
+			/// @brief Factorizes a matrix with the pattern of the constructor
+			/// @param values The entries of the matrix in the order of the pattern, eg. from SparseJacobian::get_values
+			/// @returns false, if a pivot is zero or small compared to its row
+			bool factorize(const cmf::math::num_array& values);
+			/// Returns the solution x of LUx=b, after a successful factorize
+			cmf::math::num_array solve(const cmf::math::num_array& b) const;
+		};
+	}
+}
+#endif // sparse_lu_h__
@@ -0,0 +1,197 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#include "steady_state.h"
+#include "sparse_jacobian.h"
+#include "sparse_lu.h"
+#include <algorithm>
+#include <cmath>
+
+cmf::math::SteadyStateSolver::SteadyStateSolver( cmf::math::StateVariableOwner& states, real epsilon/*=1e-6*/ )
+: Integrator(states, epsilon), m_residual(REAL_MAX), m_rhsevals(0), m_jacevals(0), 
+  pseudo_dt(day), period(), samples(12), max_iterations(200)
+{
+}
+
+cmf::math::SteadyStateSolver::SteadyStateSolver( real epsilon/*=1e-6*/ )
+: Integrator(epsilon), m_residual(REAL_MAX), m_rhsevals(0), m_jacevals(0), 
+  pseudo_dt(day), period(), samples(12), max_iterations(200)
+{
+}
+
+cmf::math::SteadyStateSolver::SteadyStateSolver( const Integrator& templ )
+: Integrator(templ), m_residual(REAL_MAX), m_rhsevals(0), m_jacevals(0), 
+  pseudo_dt(day), period(), samples(12), max_iterations(200)
+{
+	const SteadyStateSolver* sss = dynamic_cast<const SteadyStateSolver*>(&templ);
+	if (sss) {
+		pseudo_dt = sss->pseudo_dt;
+		period = sss->period;
+		samples = sss->samples;
+		max_iterations = sss->max_iterations;
+	}
+}
+
+bool cmf::math::SteadyStateSolver::prepared() const
+{
+	if (!m_jac || m_prepared.size() != size()) return false;
+	for (size_t i = 0; i < size(); ++i)
+		if (m_prepared[i] != m_States[i].get()) return false;
+	return true;
+}
+
+void cmf::math::SteadyStateSolver::prepare()
+{
+	size_t n = size();
+	m_prepared.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		m_prepared[i] = m_States[i].get();
+	m_jac.reset(new SparseJacobian(*this));
+	m_lu.reset(new SparseLU(m_jac->row_start(), m_jac->columns()));
+	m_jmean.resize(m_jac->nonzeros());
+	m_matrix.resize(m_jac->nonzeros());
+	m_diag.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		m_diag[i] = std::lower_bound(m_jac->columns().begin() + m_jac->row_start()[i], m_jac->columns().begin() + m_jac->row_start()[i + 1], i) - m_jac->columns().begin();
+	m_abstol.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		m_abstol[i] = m_States[i]->get_abs_errtol(Epsilon * 1e-3);
+}
+
+void cmf::math::SteadyStateSolver::mean_dxdt( cmf::math::Time t, real * f )
+{
+	size_t n = size();
+	if (period <= Time() || samples < 2) {
+		copy_dxdt(t, f);
+		++m_rhsevals;
+		return;
+	}
+	std::vector<real> fs(n);
+	std::fill(f, f + n, 0.0);
+	for (int s = 0; s < samples; ++s) {
+		copy_dxdt(t + period * (real(s) / samples), &fs[0]);
+		++m_rhsevals;
+		for (size_t i = 0; i < n; ++i)
+			f[i] += fs[i] / samples;
+	}
+}
+
+void cmf::math::SteadyStateSolver::mean_jacobian( cmf::math::Time t )
+{
+	if (period <= Time() || samples < 2) {
+		m_jac->calculate(*this, t);
+		++m_jacevals;
+		m_jmean = m_jac->values();
+		return;
+	}
+	std::fill(m_jmean.begin(), m_jmean.end(), 0.0);
+	for (int s = 0; s < samples; ++s) {
+		m_jac->calculate(*this, t + period * (real(s) / samples));
+		++m_jacevals;
+		const std::vector<real>& J = m_jac->values();
+		for (size_t k = 0; k < J.size(); ++k)
+			m_jmean[k] += J[k] / samples;
+	}
+}
+
+int cmf::math::SteadyStateSolver::solve( cmf::math::Time t )
+{
+	if (m_States.size()==0)
+		throw std::out_of_range("No states to solve!");
+	if (!prepared()) prepare();
+	size_t n = size();
+	std::vector<real> y(n), f(n), y_new(n), f_new(n), y_best(n), delta(n);
+	copy_states(&y[0]);
+	mean_dxdt(t, &f[0]);
+	// The scaled max norm decides the convergence, the scaled euclidean norm controls the pseudo time step
+	real residual = 0, norm = 0;
+	for (size_t i = 0; i < n; ++i) {
+		real r = std::abs(f[i]) / (m_abstol[i] + Epsilon * std::abs(y[i]));
+		residual = std::max(residual, r);
+		norm += r * r;
+	}
+	norm = std::sqrt(norm);
+	if (!(norm < REAL_MAX))
+		throw std::runtime_error("SteadyStateSolver: The derivatives of the initial states are not finite");
+	real best = residual;
+	y_best = y;
+	real tau = pseudo_dt.AsDays();
+	int iter = 0;
+	while (residual > 1.0 && iter < max_iterations) {
+		++iter;
+		mean_jacobian(t);
+		bool accepted = false;
+		while (!accepted) {
+			if (tau < 1e-12)
+				break;
+			// M = I/tau - J
+			for (size_t k = 0; k < m_jmean.size(); ++k)
+				m_matrix[k] = -m_jmean[k];
+			for (size_t i = 0; i < n; ++i)
+				m_matrix[m_diag[i]] += 1.0 / tau;
+			if (!m_lu->factorize(&m_matrix[0])) {
+				tau /= 4;
+				continue;
+			}
+			delta = f;
+			m_lu->solve(&delta[0]);
+			for (size_t i = 0; i < n; ++i)
+				y_new[i] = y[i] + delta[i];
+			set_states(&y_new[0]);
+			mean_dxdt(t, &f_new[0]);
+			real new_residual = 0, new_norm = 0;
+			for (size_t i = 0; i < n; ++i) {
+				real r = std::abs(f_new[i]) / (m_abstol[i] + Epsilon * std::abs(y_new[i]));
+				new_residual = std::max(new_residual, r);
+				new_norm += r * r;
+			}
+			new_norm = std::sqrt(new_norm);
+			if (!(new_norm <= 10 * norm)) {
+				// Repeat the iteration closer to the transient path
+				set_states(&y[0]);
+				tau /= 4;
+				continue;
+			}
+			accepted = true;
+			// Switched evolution relaxation: The pseudo time step grows with the reduction of the residual
+			tau = new_norm > 0 ? tau * std::min(norm / new_norm, 1e3) : tau * 1e3;
+			y.swap(y_new);
+			f.swap(f_new);
+			residual = new_residual;
+			norm = new_norm;
+			if (residual < best) {
+				best = residual;
+				y_best = y;
+			}
+		}
+		if (!accepted) break;
+	}
+	m_residual = best;
+	if (best > 1.0) {
+		set_states(&y_best[0]);
+		throw std::runtime_error("SteadyStateSolver: No steady state found, the scaled residual is " + std::to_string(best));
+	}
+	set_states(&y_best[0]);
+	return iter;
+}
+
+int cmf::math::SteadyStateSolver::integrate( cmf::math::Time MaxTime, cmf::math::Time TimeStep )
+{
+	int iter = solve(MaxTime);
+	m_dt = MaxTime - m_t;
+	m_t = MaxTime;
+	return iter;
+}
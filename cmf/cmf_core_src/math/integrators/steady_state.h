@@ -0,0 +1,105 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#ifndef steady_state_h__
+#define steady_state_h__
+
+#include "integrator.h"
+#include "../real.h"
+#include <vector>
+namespace cmf {
+	namespace math {
+		class SparseJacobian;
+		class SparseLU;
+		/// @brief Finds the steady state of the states, where their derivatives vanish, with Newton iterations and 
+		/// pseudo-transient continuation
+		///
+		/// The solver replaces a spin-up run over years of repeated forcing. Each iteration solves 
+		/// \f$ (I/\tau - J)\delta = f(y)\f$ with the sparse Jacobian J (SparseJacobian) and its LU factorization (SparseLU) 
+		/// and updates \f$ y \leftarrow y + \delta\f$. The pseudo time step \f$\tau\f$ starts with pseudo_dt and grows with the
+		/// reduction of the residual (switched evolution relaxation, Kelley and Keyes 1998, SIAM Journal on Numerical Analysis 35, 
+		/// 508-523). Hence the first iterations are implicit Euler steps of the transient problem, which find the basin of the 
+		/// steady state, and the last iterations are Newton iterations. An iteration increasing the residual tenfold or producing
+		/// invalid derivatives is repeated with a quarter of the pseudo time step.
+		///
+		/// The steady state is found, if \f$ |f_i| \le a_i + \epsilon |y_i| \f$ for all states, ie. the states change less than their 
+		/// error tolerance per day. With a period, the derivatives are the mean of the derivatives at a number of times (samples) 
+		/// evenly distributed over the period, eg. the seasonal cycle of a forcing. This state is not the mean of the periodic 
+		/// solution, since the fluxes depend nonlinearly on the states, but a close start for a short spin-up over a few periods.
+		/// The result is written to the states. If the iteration fails, the states with the smallest residual are kept and an 
+		/// exception is thrown.
+		///
+		/// Storages without an outflow, which accumulate the forcing, have no steady state.
+		class SteadyStateSolver : public Integrator
+		{
+		private:
+			// The states at the creation of the Jacobian
+			std::vector<const StateVariable*> m_prepared;
+			std::shared_ptr<SparseJacobian> m_jac;
+			std::shared_ptr<SparseLU> m_lu;
+			// Position of the diagonal entries in the pattern, the mean Jacobian and the entries of I/tau - J
+			std::vector<size_t> m_diag;
+			std::vector<real> m_jmean, m_matrix;
+			// Absolute error tolerance
+			std::vector<real> m_abstol;
+			real m_residual;
+			int m_rhsevals, m_jacevals;
+			bool prepared() const;
+			void prepare();
+			// The (mean) derivatives of the current states
+			void mean_dxdt(cmf::math::Time t, real * f);
+			// The (mean) Jacobian of the current states in m_jmean
+			void mean_jacobian(cmf::math::Time t);
+		public:
+			/// The first pseudo time step (default 1 day)
+			Time pseudo_dt;
+			/// Length of the period of the forcing. If the period is zero (default), the forcing at the time of the solution is used
+			Time period;
+			/// Number of times per period to calculate the mean derivatives (default 12)
+			int samples;
+			/// Maximum number of iterations (default 200)
+			int max_iterations;
+			/// Returns the scaled residual \f$\max_i |f_i|/(a_i + \epsilon |y_i|)\f$ of the last solution, the steady state is found for values <= 1
+			real get_residual() const {return m_residual;}
+			/// Returns the number of evaluations of the right hand side, without the Jacobian
+			int get_rhsevals() const {return m_rhsevals;}
+			/// Returns the number of calculated Jacobians
+			int get_jacevals() const {return m_jacevals;}
+			/// @brief Sets the states to the steady state for the forcing at time t, or the mean forcing of the period starting at t
+			///
+			/// @returns The number of iterations
+			int solve(cmf::math::Time t);
+			/// Constructs a new SteadyStateSolver
+			/// @param states States to be added to the solver
+			/// @param epsilon relative error tolerance of the derivatives per day (default=1e-6)
+			SteadyStateSolver(cmf::math::StateVariableOwner& states, real epsilon=1e-6);
+			/// Constructs a new SteadyStateSolver
+			/// @param epsilon relative error tolerance of the derivatives per day (default=1e-6)
+			SteadyStateSolver(real epsilon=1e-6);
+			/// Constructs a new SteadyStateSolver from a template, without states
+			SteadyStateSolver(const Integrator& templ);
+			virtual Integrator * copy() const
+			{
+				return new SteadyStateSolver(static_cast<const Integrator&>(*this));
+			}
+			/// @brief Sets the states to the steady state for the forcing at MaxTime (see solve) and the time of the solver to MaxTime
+			/// @param MaxTime The time of the forcing
+			/// @param TimeStep Ignored
+			int integrate(cmf::math::Time MaxTime, cmf::math::Time TimeStep);
+		};
+	}
+}
+#endif // steady_state_h__
@@ -0,0 +1,94 @@
+/*
+ * -----------------------------------------------------------------
+ * This is the header file for the OpenMP implementation of the
+ * NVECTOR module, added to the SUNDIALS files bundled with cmf.
+ *
+ * The vector is a serial vector in shared memory, where the vector
+ * operations are calculated by all threads of OpenMP. The content
+ * structure is the content structure of the serial vector, hence
+ * the accessor macros of the serial vector (NV_DATA_S, NV_LENGTH_S,
+ * NV_OWN_DATA_S, NV_Ith_S) can be used for both vector types. The
+ * macros NV_CONTENT_O, NV_DATA_O, NV_OWN_DATA_O, NV_LENGTH_O and
+ * NV_Ith_O are defined for convenience.
+ *
+ * Notes:
+ *
+ *   - Vectors up to OMP_BLOCK_LENGTH components are calculated
+ *     serially, since the overhead of a parallel region exceeds
+ *     the work.
+ *
+ *   - Sums (dot products and norms) are calculated in blocks of a
+ *     fixed length, and the partial sums of the blocks are added
+ *     in their order. Hence the results do not depend on the number
+ *     of threads. For vectors up to OMP_BLOCK_LENGTH components the
+ *     results are identical to the results of the serial vector.
+ * -----------------------------------------------------------------
+ */
+
+#ifndef _NVECTOR_OPENMP_H
+#define _NVECTOR_OPENMP_H
+
+#include <nvector/nvector_serial.h>
+
+#ifdef __cplusplus  /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* Length of the blocks calculated by one thread */
+#define OMP_BLOCK_LENGTH 4096L
+
+typedef N_VectorContent_Serial N_VectorContent_OpenMP;
+
+#define NV_CONTENT_O(v)  ( (N_VectorContent_OpenMP)(v->content) )
+#define NV_LENGTH_O(v)   ( NV_CONTENT_O(v)->length )
+#define NV_OWN_DATA_O(v) ( NV_CONTENT_O(v)->own_data )
+#define NV_DATA_O(v)     ( NV_CONTENT_O(v)->data )
+#define NV_Ith_O(v,i)    ( NV_DATA_O(v)[i] )
+
+/*
+ * -----------------------------------------------------------------
+ * Functions : N_VNew_OpenMP, N_VNewEmpty_OpenMP, N_VMake_OpenMP
+ * -----------------------------------------------------------------
+ * Create a new OpenMP vector with allocated data, without data, or
+ * with a user-supplied data array, as the serial counterparts.
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT N_Vector N_VNew_OpenMP(long int vec_length);
+SUNDIALS_EXPORT N_Vector N_VNewEmpty_OpenMP(long int vec_length);
+SUNDIALS_EXPORT N_Vector N_VMake_OpenMP(long int vec_length, realtype *v_data);
+
+/*
+ * -----------------------------------------------------------------
+ * OpenMP implementations of the vector operations
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT N_Vector N_VCloneEmpty_OpenMP(N_Vector w);
+SUNDIALS_EXPORT N_Vector N_VClone_OpenMP(N_Vector w);
+SUNDIALS_EXPORT void N_VDestroy_OpenMP(N_Vector v);
+SUNDIALS_EXPORT void N_VLinearSum_OpenMP(realtype a, N_Vector x, realtype b, N_Vector y, N_Vector z);
+SUNDIALS_EXPORT void N_VConst_OpenMP(realtype c, N_Vector z);
+SUNDIALS_EXPORT void N_VProd_OpenMP(N_Vector x, N_Vector y, N_Vector z);
+SUNDIALS_EXPORT void N_VDiv_OpenMP(N_Vector x, N_Vector y, N_Vector z);
+SUNDIALS_EXPORT void N_VScale_OpenMP(realtype c, N_Vector x, N_Vector z);
+SUNDIALS_EXPORT void N_VAbs_OpenMP(N_Vector x, N_Vector z);
+SUNDIALS_EXPORT void N_VInv_OpenMP(N_Vector x, N_Vector z);
+SUNDIALS_EXPORT void N_VAddConst_OpenMP(N_Vector x, realtype b, N_Vector z);
+SUNDIALS_EXPORT realtype N_VDotProd_OpenMP(N_Vector x, N_Vector y);
+SUNDIALS_EXPORT realtype N_VMaxNorm_OpenMP(N_Vector x);
+SUNDIALS_EXPORT realtype N_VWrmsNorm_OpenMP(N_Vector x, N_Vector w);
+SUNDIALS_EXPORT realtype N_VWrmsNormMask_OpenMP(N_Vector x, N_Vector w, N_Vector id);
+SUNDIALS_EXPORT realtype N_VMin_OpenMP(N_Vector x);
+SUNDIALS_EXPORT realtype N_VWL2Norm_OpenMP(N_Vector x, N_Vector w);
+SUNDIALS_EXPORT realtype N_VL1Norm_OpenMP(N_Vector x);
+SUNDIALS_EXPORT void N_VCompare_OpenMP(realtype c, N_Vector x, N_Vector z);
+SUNDIALS_EXPORT booleantype N_VInvTest_OpenMP(N_Vector x, N_Vector z);
+SUNDIALS_EXPORT booleantype N_VConstrMask_OpenMP(N_Vector c, N_Vector x, N_Vector m);
+SUNDIALS_EXPORT realtype N_VMinQuotient_OpenMP(N_Vector num, N_Vector denom);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,623 @@
+/*
+ * -----------------------------------------------------------------
+ * This is the implementation file for an OpenMP implementation
+ * of the NVECTOR package, added to the SUNDIALS files bundled with
+ * cmf. The arithmetic follows nvector_serial.cpp, but the loops are
+ * shared by the threads of OpenMP.
+ * -----------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <nvector/nvector_openmp.h>
+#include <sundials/sundials_math.h>
+
+#define ZERO   RCONST(0.0)
+#define HALF   RCONST(0.5)
+#define ONE    RCONST(1.0)
+#define ONEPT5 RCONST(1.5)
+
+/* Use the threads of OpenMP for vectors longer than one block */
+#define PARALLEL(N) ((N) > OMP_BLOCK_LENGTH)
+
+/*
+ * -----------------------------------------------------------------
+ * private functions for reductions
+ * -----------------------------------------------------------------
+ * The vector is split into blocks of OMP_BLOCK_LENGTH components.
+ * Each block is reduced serially by one thread, and the results of
+ * the blocks are combined in the order of the blocks. Hence the
+ * result does not depend on the number of threads.
+ */
+
+static long int BlockCount(long int N)
+{
+  return (N + OMP_BLOCK_LENGTH - 1) / OMP_BLOCK_LENGTH;
+}
+
+/* Sum of term(i) for i in 0..N-1 */
+template<class Term> static realtype BlockSum(long int N, const Term& term)
+{
+  long int b, i, nblocks;
+  realtype sum, *partial;
+
+  sum = ZERO;
+  nblocks = BlockCount(N);
+  if (nblocks <= 1) {
+    for (i = 0; i < N; i++) sum += term(i);
+    return(sum);
+  }
+  partial = (realtype *) malloc(nblocks * sizeof(realtype));
+#pragma omp parallel for private(i) schedule(static)
+  for (b = 0; b < nblocks; b++) {
+    realtype s = ZERO;
+    long int end = MIN((b + 1) * OMP_BLOCK_LENGTH, N);
+    for (i = b * OMP_BLOCK_LENGTH; i < end; i++) s += term(i);
+    partial[b] = s;
+  }
+  for (b = 0; b < nblocks; b++) sum += partial[b];
+  free(partial);
+  return(sum);
+}
+
+struct ProdTerm {
+  const realtype *xd, *yd;
+  realtype operator()(long int i) const { return xd[i]*yd[i]; }
+};
+
+struct SquaredProdTerm {
+  const realtype *xd, *wd;
+  realtype operator()(long int i) const { realtype prodi = xd[i]*wd[i]; return SQR(prodi); }
+};
+
+struct SquaredProdMaskTerm {
+  const realtype *xd, *wd, *idd;
+  realtype operator()(long int i) const {
+    realtype prodi = xd[i]*wd[i];
+    return idd[i] > ZERO ? SQR(prodi) : ZERO;
+  }
+};
+
+struct AbsTerm {
+  const realtype *xd;
+  realtype operator()(long int i) const { return ABS(xd[i]); }
+};
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new empty OpenMP vector
+ */
+
+N_Vector N_VNewEmpty_OpenMP(long int length)
+{
+  N_Vector v;
+
+  /* The serial vector provides the content and the operations without loops */
+  v = NULL;
+  v = N_VNewEmpty_Serial(length);
+  if (v == NULL) return(NULL);
+
+  v->ops->nvclone           = N_VClone_OpenMP;
+  v->ops->nvcloneempty      = N_VCloneEmpty_OpenMP;
+  v->ops->nvdestroy         = N_VDestroy_OpenMP;
+  v->ops->nvlinearsum       = N_VLinearSum_OpenMP;
+  v->ops->nvconst           = N_VConst_OpenMP;
+  v->ops->nvprod            = N_VProd_OpenMP;
+  v->ops->nvdiv             = N_VDiv_OpenMP;
+  v->ops->nvscale           = N_VScale_OpenMP;
+  v->ops->nvabs             = N_VAbs_OpenMP;
+  v->ops->nvinv             = N_VInv_OpenMP;
+  v->ops->nvaddconst        = N_VAddConst_OpenMP;
+  v->ops->nvdotprod         = N_VDotProd_OpenMP;
+  v->ops->nvmaxnorm         = N_VMaxNorm_OpenMP;
+  v->ops->nvwrmsnormmask    = N_VWrmsNormMask_OpenMP;
+  v->ops->nvwrmsnorm        = N_VWrmsNorm_OpenMP;
+  v->ops->nvmin             = N_VMin_OpenMP;
+  v->ops->nvwl2norm         = N_VWL2Norm_OpenMP;
+  v->ops->nvl1norm          = N_VL1Norm_OpenMP;
+  v->ops->nvcompare         = N_VCompare_OpenMP;
+  v->ops->nvinvtest         = N_VInvTest_OpenMP;
+  v->ops->nvconstrmask      = N_VConstrMask_OpenMP;
+  v->ops->nvminquotient     = N_VMinQuotient_OpenMP;
+
+  return(v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new OpenMP vector
+ */
+
+N_Vector N_VNew_OpenMP(long int length)
+{
+  N_Vector v;
+  realtype *data;
+
+  v = NULL;
+  v = N_VNewEmpty_OpenMP(length);
+  if (v == NULL) return(NULL);
+
+  /* Create data */
+  if (length > 0) {
+
+    /* Allocate memory */
+    data = NULL;
+    data = (realtype *) malloc(length * sizeof(realtype));
+    if(data == NULL) { N_VDestroy_OpenMP(v); return(NULL); }
+
+    /* Attach data */
+    NV_OWN_DATA_O(v) = TRUE;
+    NV_DATA_O(v)     = data;
+
+  }
+
+  return(v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create an OpenMP N_Vector with user data component
+ */
+
+N_Vector N_VMake_OpenMP(long int length, realtype *v_data)
+{
+  N_Vector v;
+
+  v = NULL;
+  v = N_VNewEmpty_OpenMP(length);
+  if (v == NULL) return(NULL);
+
+  if (length > 0) {
+    /* Attach data */
+    NV_OWN_DATA_O(v) = FALSE;
+    NV_DATA_O(v)     = v_data;
+  }
+
+  return(v);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of vector operations
+ * -----------------------------------------------------------------
+ */
+
+N_Vector N_VCloneEmpty_OpenMP(N_Vector w)
+{
+  /* The serial clone copies the operations of w */
+  return(N_VCloneEmpty_Serial(w));
+}
+
+N_Vector N_VClone_OpenMP(N_Vector w)
+{
+  return(N_VClone_Serial(w));
+}
+
+void N_VDestroy_OpenMP(N_Vector v)
+{
+  N_VDestroy_Serial(v);
+}
+
+void N_VLinearSum_OpenMP(realtype a, N_Vector x, realtype b, N_Vector y, N_Vector z)
+{
+  long int i, N;
+  realtype c, *xd, *yd, *zd;
+  N_Vector v1, v2;
+  booleantype test;
+
+  N  = NV_LENGTH_O(x);
+
+  if ((b == ONE) && (z == y)) {    /* BLAS usage: axpy y <- ax+y */
+    xd = NV_DATA_O(x);
+    yd = NV_DATA_O(y);
+    if (a == ONE) {
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+      for (i = 0; i < N; i++) yd[i] += xd[i];
+    } else if (a == -ONE) {
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+      for (i = 0; i < N; i++) yd[i] -= xd[i];
+    } else {
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+      for (i = 0; i < N; i++) yd[i] += a*xd[i];
+    }
+    return;
+  }
+
+  if ((a == ONE) && (z == x)) {    /* BLAS usage: axpy x <- by+x */
+    N_VLinearSum_OpenMP(b, y, ONE, x, x);
+    return;
+  }
+
+  xd = NV_DATA_O(x);
+  yd = NV_DATA_O(y);
+  zd = NV_DATA_O(z);
+
+  /* Case: a == b == 1.0 */
+
+  if ((a == ONE) && (b == ONE)) {
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+    for (i = 0; i < N; i++) zd[i] = xd[i]+yd[i];
+    return;
+  }
+
+  /* Cases: (1) a == 1.0, b = -1.0, (2) a == -1.0, b == 1.0 */
+
+  if ((test = ((a == ONE) && (b == -ONE))) || ((a == -ONE) && (b == ONE))) {
+    v1 = test ? y : x;
+    v2 = test ? x : y;
+    realtype *d1 = NV_DATA_O(v1), *d2 = NV_DATA_O(v2);
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+    for (i = 0; i < N; i++) zd[i] = d2[i]-d1[i];
+    return;
+  }
+
+  /* Cases: (1) a == 1.0, b == other or 0.0, (2) a == other or 0.0, b == 1.0 */
+
+  if ((test = (a == ONE)) || (b == ONE)) {
+    c  = test ? b : a;
+    v1 = test ? y : x;
+    v2 = test ? x : y;
+    realtype *d1 = NV_DATA_O(v1), *d2 = NV_DATA_O(v2);
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+    for (i = 0; i < N; i++) zd[i] = (c*d1[i])+d2[i];
+    return;
+  }
+
+  /* Cases: (1) a == -1.0, b != 1.0, (2) a != 1.0, b == -1.0 */
+
+  if ((test = (a == -ONE)) || (b == -ONE)) {
+    c = test ? b : a;
+    v1 = test ? y : x;
+    v2 = test ? x : y;
+    realtype *d1 = NV_DATA_O(v1), *d2 = NV_DATA_O(v2);
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+    for (i = 0; i < N; i++) zd[i] = (c*d1[i])-d2[i];
+    return;
+  }
+
+  /* Case: a == b */
+
+  if (a == b) {
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+    for (i = 0; i < N; i++) zd[i] = a*(xd[i]+yd[i]);
+    return;
+  }
+
+  /* Case: a == -b */
+
+  if (a == -b) {
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+    for (i = 0; i < N; i++) zd[i] = a*(xd[i]-yd[i]);
+    return;
+  }
+
+  /* All other cases */
+
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+  for (i = 0; i < N; i++)
+    zd[i] = (a*xd[i])+(b*yd[i]);
+
+  return;
+}
+
+void N_VConst_OpenMP(realtype c, N_Vector z)
+{
+  long int i, N;
+  realtype *zd;
+
+  N  = NV_LENGTH_O(z);
+  zd = NV_DATA_O(z);
+
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+  for (i = 0; i < N; i++) zd[i] = c;
+
+  return;
+}
+
+void N_VProd_OpenMP(N_Vector x, N_Vector y, N_Vector z)
+{
+  long int i, N;
+  realtype *xd, *yd, *zd;
+
+  N  = NV_LENGTH_O(x);
+  xd = NV_DATA_O(x);
+  yd = NV_DATA_O(y);
+  zd = NV_DATA_O(z);
+
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+  for (i = 0; i < N; i++)
+    zd[i] = xd[i]*yd[i];
+
+  return;
+}
+
+void N_VDiv_OpenMP(N_Vector x, N_Vector y, N_Vector z)
+{
+  long int i, N;
+  realtype *xd, *yd, *zd;
+
+  N  = NV_LENGTH_O(x);
+  xd = NV_DATA_O(x);
+  yd = NV_DATA_O(y);
+  zd = NV_DATA_O(z);
+
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+  for (i = 0; i < N; i++)
+    zd[i] = xd[i]/yd[i];
+
+  return;
+}
+
+void N_VScale_OpenMP(realtype c, N_Vector x, N_Vector z)
+{
+  long int i, N;
+  realtype *xd, *zd;
+
+  N  = NV_LENGTH_O(x);
+  xd = NV_DATA_O(x);
+  zd = NV_DATA_O(z);
+
+  if (z == x) {  /* BLAS usage: scale x <- cx */
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+    for (i = 0; i < N; i++) xd[i] *= c;
+  } else if (c == ONE) {
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+    for (i = 0; i < N; i++) zd[i] = xd[i];
+  } else if (c == -ONE) {
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+    for (i = 0; i < N; i++) zd[i] = -xd[i];
+  } else {
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+    for (i = 0; i < N; i++) zd[i] = c*xd[i];
+  }
+
+  return;
+}
+
+void N_VAbs_OpenMP(N_Vector x, N_Vector z)
+{
+  long int i, N;
+  realtype *xd, *zd;
+
+  N  = NV_LENGTH_O(x);
+  xd = NV_DATA_O(x);
+  zd = NV_DATA_O(z);
+
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+  for (i = 0; i < N; i++)
+    zd[i] = ABS(xd[i]);
+
+  return;
+}
+
+void N_VInv_OpenMP(N_Vector x, N_Vector z)
+{
+  long int i, N;
+  realtype *xd, *zd;
+
+  N  = NV_LENGTH_O(x);
+  xd = NV_DATA_O(x);
+  zd = NV_DATA_O(z);
+
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+  for (i = 0; i < N; i++)
+    zd[i] = ONE/xd[i];
+
+  return;
+}
+
+void N_VAddConst_OpenMP(N_Vector x, realtype b, N_Vector z)
+{
+  long int i, N;
+  realtype *xd, *zd;
+
+  N  = NV_LENGTH_O(x);
+  xd = NV_DATA_O(x);
+  zd = NV_DATA_O(z);
+
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+  for (i = 0; i < N; i++)
+    zd[i] = xd[i]+b;
+
+  return;
+}
+
+realtype N_VDotProd_OpenMP(N_Vector x, N_Vector y)
+{
+  ProdTerm term = {NV_DATA_O(x), NV_DATA_O(y)};
+  return(BlockSum(NV_LENGTH_O(x), term));
+}
+
+realtype N_VMaxNorm_OpenMP(N_Vector x)
+{
+  long int b, i, N, nblocks;
+  realtype max, *xd, *partial;
+
+  N  = NV_LENGTH_O(x);
+  xd = NV_DATA_O(x);
+  nblocks = BlockCount(N);
+  partial = (realtype *) malloc(MAX(nblocks, 1) * sizeof(realtype));
+
+#pragma omp parallel for if(nblocks > 1) private(i) schedule(static)
+  for (b = 0; b < nblocks; b++) {
+    realtype m = ZERO;
+    long int end = MIN((b + 1) * OMP_BLOCK_LENGTH, N);
+    for (i = b * OMP_BLOCK_LENGTH; i < end; i++) {
+      if (ABS(xd[i]) > m) m = ABS(xd[i]);
+    }
+    partial[b] = m;
+  }
+  max = ZERO;
+  for (b = 0; b < nblocks; b++) {
+    if (partial[b] > max) max = partial[b];
+  }
+  free(partial);
+
+  return(max);
+}
+
+realtype N_VWrmsNorm_OpenMP(N_Vector x, N_Vector w)
+{
+  long int N = NV_LENGTH_O(x);
+  SquaredProdTerm term = {NV_DATA_O(x), NV_DATA_O(w)};
+  return(RSqrt(BlockSum(N, term)/N));
+}
+
+realtype N_VWrmsNormMask_OpenMP(N_Vector x, N_Vector w, N_Vector id)
+{
+  long int N = NV_LENGTH_O(x);
+  SquaredProdMaskTerm term = {NV_DATA_O(x), NV_DATA_O(w), NV_DATA_O(id)};
+  return(RSqrt(BlockSum(N, term) / N));
+}
+
+realtype N_VMin_OpenMP(N_Vector x)
+{
+  long int b, i, N, nblocks;
+  realtype min, *xd, *partial;
+
+  N  = NV_LENGTH_O(x);
+  xd = NV_DATA_O(x);
+  nblocks = BlockCount(N);
+  partial = (realtype *) malloc(MAX(nblocks, 1) * sizeof(realtype));
+
+#pragma omp parallel for if(nblocks > 1) private(i) schedule(static)
+  for (b = 0; b < nblocks; b++) {
+    long int start = b * OMP_BLOCK_LENGTH, end = MIN(start + OMP_BLOCK_LENGTH, N);
+    realtype m = xd[start];
+    for (i = start + 1; i < end; i++) {
+      if (xd[i] < m) m = xd[i];
+    }
+    partial[b] = m;
+  }
+  min = nblocks > 0 ? partial[0] : xd[0];
+  for (b = 1; b < nblocks; b++) {
+    if (partial[b] < min) min = partial[b];
+  }
+  free(partial);
+
+  return(min);
+}
+
+realtype N_VWL2Norm_OpenMP(N_Vector x, N_Vector w)
+{
+  SquaredProdTerm term = {NV_DATA_O(x), NV_DATA_O(w)};
+  return(RSqrt(BlockSum(NV_LENGTH_O(x), term)));
+}
+
+realtype N_VL1Norm_OpenMP(N_Vector x)
+{
+  AbsTerm term = {NV_DATA_O(x)};
+  return(BlockSum(NV_LENGTH_O(x), term));
+}
+
+void N_VCompare_OpenMP(realtype c, N_Vector x, N_Vector z)
+{
+  long int i, N;
+  realtype *xd, *zd;
+
+  N  = NV_LENGTH_O(x);
+  xd = NV_DATA_O(x);
+  zd = NV_DATA_O(z);
+
+#pragma omp parallel for if(PARALLEL(N)) schedule(static)
+  for (i = 0; i < N; i++) {
+    zd[i] = (ABS(xd[i]) >= c) ? ONE : ZERO;
+  }
+
+  return;
+}
+
+booleantype N_VInvTest_OpenMP(N_Vector x, N_Vector z)
+{
+  long int i, N;
+  int test;
+  realtype *xd, *zd;
+
+  N  = NV_LENGTH_O(x);
+  xd = NV_DATA_O(x);
+  zd = NV_DATA_O(z);
+
+  test = TRUE;
+
+#pragma omp parallel for if(PARALLEL(N)) schedule(static) reduction(&&:test)
+  for (i = 0; i < N; i++) {
+    if (xd[i] == ZERO) test = FALSE;
+    else zd[i] = ONE/xd[i];
+  }
+
+  return(test ? TRUE : FALSE);
+}
+
+booleantype N_VConstrMask_OpenMP(N_Vector c, N_Vector x, N_Vector m)
+{
+  long int i, N;
+  int test;
+  realtype *cd, *xd, *md;
+
+  N  = NV_LENGTH_O(x);
+  xd = NV_DATA_O(x);
+  cd = NV_DATA_O(c);
+  md = NV_DATA_O(m);
+
+  test = TRUE;
+
+#pragma omp parallel for if(PARALLEL(N)) schedule(static) reduction(&&:test)
+  for (i = 0; i < N; i++) {
+    md[i] = ZERO;
+    if (cd[i] == ZERO) continue;
+    if (cd[i] > ONEPT5 || cd[i] < -ONEPT5) {
+      if ( xd[i]*cd[i] <= ZERO) { test = FALSE; md[i] = ONE; }
+      continue;
+    }
+    if ( cd[i] > HALF || cd[i] < -HALF) {
+      if (xd[i]*cd[i] < ZERO ) { test = FALSE; md[i] = ONE; }
+    }
+  }
+
+  return(test ? TRUE : FALSE);
+}
+
+realtype N_VMinQuotient_OpenMP(N_Vector num, N_Vector denom)
+{
+  long int b, i, N, nblocks;
+  realtype *nd, *dd, *partial, min;
+  char *found;
+
+  N  = NV_LENGTH_O(num);
+  nd = NV_DATA_O(num);
+  dd = NV_DATA_O(denom);
+  nblocks = BlockCount(N);
+  partial = (realtype *) malloc(MAX(nblocks, 1) * sizeof(realtype));
+  found = (char *) malloc(MAX(nblocks, 1) * sizeof(char));
+
+#pragma omp parallel for if(nblocks > 1) private(i) schedule(static)
+  for (b = 0; b < nblocks; b++) {
+    realtype m = BIG_REAL;
+    char f = 0;
+    long int end = MIN((b + 1) * OMP_BLOCK_LENGTH, N);
+    for (i = b * OMP_BLOCK_LENGTH; i < end; i++) {
+      if (dd[i] == ZERO) continue;
+      m = f ? MIN(m, nd[i]/dd[i]) : nd[i]/dd[i];
+      f = 1;
+    }
+    partial[b] = m;
+    found[b] = f;
+  }
+
+  /* Combine the blocks as the serial loop combines the components */
+  min = BIG_REAL;
+  char notEvenOnce = 1;
+  for (b = 0; b < nblocks; b++) {
+    if (!found[b]) continue;
+    min = notEvenOnce ? partial[b] : MIN(min, partial[b]);
+    notEvenOnce = 0;
+  }
+  free(partial);
+  free(found);
+
+  return(min);
+}
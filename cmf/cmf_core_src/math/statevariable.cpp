@@ -51,7 +51,90 @@ void cmf::math::StateVariable::set_state(real newState) {
 	if (!std::isfinite(newState)) {
 		throw std::runtime_error("New state of " + this->to_string() + " is not finite");
 	}
-	m_State = newState;
+	*m_StatePointer = newState;
+	if (m_Buffer) m_Buffer->m_notified[m_BufferIndex] = newState;
 	m_StateIsNew = true;
 	if (m_StateIsNew) StateChangeAction();
 }
+
+cmf::math::StateVariable::~StateVariable()
+{
+	if (m_Buffer) m_Buffer->detach(*this);
+}
+
+cmf::math::StateBuffer::StateBuffer( const state_vector& states )
+: m_values(states.size()), m_notified(states.size()), m_states(states.size()), m_valid(true)
+{
+	for (size_t i = 0; i < states.size(); ++i)
+	{
+		StateVariable& sv = *states[i];
+		m_values[i] = m_notified[i] = sv.get_state();
+		if (sv.m_Buffer == this) {
+			// The state is twice in the vector, keep the first position
+			m_valid = false;
+			continue;
+		}
+		if (sv.m_Buffer) sv.m_Buffer->detach(sv);
+		sv.m_Buffer = this;
+		sv.m_BufferIndex = i;
+		sv.m_StatePointer = &m_values[i];
+		m_states[i] = &sv;
+	}
+}
+
+cmf::math::StateBuffer::~StateBuffer()
+{
+	for (size_t i = 0; i < m_states.size(); ++i)
+	{
+		StateVariable* sv = m_states[i];
+		if (sv && sv->m_Buffer == this) {
+			sv->m_State = m_values[i];
+			sv->m_StatePointer = &sv->m_State;
+			sv->m_Buffer = 0;
+		}
+	}
+}
+
+void cmf::math::StateBuffer::detach( StateVariable& state )
+{
+	state.m_State = *state.m_StatePointer;
+	state.m_StatePointer = &state.m_State;
+	state.m_Buffer = 0;
+	m_states[state.m_BufferIndex] = 0;
+	m_valid = false;
+}
+
+void cmf::math::StateBuffer::copy_to( real * destination ) const
+{
+	if (size() && destination != m_values.data()) 
+		std::copy(m_values.begin(), m_values.end(), destination);
+}
+
+void cmf::math::StateBuffer::set( const real * values, bool use_OpenMP )
+{
+	std::string err_msg;
+	bool err=false;
+	#pragma omp parallel for if(use_OpenMP)
+	for (ptrdiff_t i = 0; i < (ptrdiff_t)size(); ++i)
+	{
+		real v = values[i];
+		StateVariable* sv = m_states[i];
+		if (!std::isfinite(v)) {
+			#pragma omp critical
+			{
+				err_msg = "New state of " + sv->to_string() + " is not finite";
+				err = true;
+			}
+			continue;
+		}
+		m_values[i] = v;
+		// The values might have been written directly, hence compare with the last notified value
+		if (v == m_notified[i]) continue;
+		m_notified[i] = v;
+		sv->m_StateIsNew = true;
+		sv->StateChangeAction();
+	}
+	if (err) {
+		throw std::runtime_error(err_msg);
+	}
+}
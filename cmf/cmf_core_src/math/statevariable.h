@@ -26,6 +26,9 @@
 #include <cmath>
 #include "num_array.h"
 #include "real.h"
+#include <istream>
+#include <ostream>
+#include <stdexcept>
 namespace cmf {
 	/// Contains classes for numerical solving of ODE's
   namespace math {
@@ -34,6 +37,17 @@ namespace cmf {
 	  public:
 		  virtual void do_action(Time t, bool use_OpenMP = true)=0;
 	  };
+	  /// Writes a value in its binary representation to a checkpoint
+	  template<typename T> void write_binary(std::ostream& out, const T& value) {
+		  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	  }
+	  /// Reads a value in its binary representation from a checkpoint. Throws, if the checkpoint ends
+	  template<typename T> T read_binary(std::istream& in) {
+		  T value;
+		  in.read(reinterpret_cast<char*>(&value), sizeof(T));
+		  if (!in) throw std::runtime_error("Checkpoint: Unexpected end of file");
+		  return value;
+	  }
 
 #endif
 
@@ -54,6 +68,12 @@ namespace cmf {
 		  virtual double sum() const =0;
 		  /// Returns average of the integrated variable (eg. flux) from the last reset until the last call of integrate
 		  virtual double avg() const =0;
+#ifndef SWIG
+		  /// Writes the integral to a checkpoint (see cmf::math::Integrator::save_checkpoint)
+		  virtual void write_checkpoint(std::ostream& out) const {}
+		  /// Reads the integral from a checkpoint written by write_checkpoint
+		  virtual void read_checkpoint(std::istream& in) {}
+#endif
 	  };
 	  /// A list of cmf::math::integratable objects
 	  ///
@@ -97,11 +117,20 @@ namespace cmf {
 		///		};
 		///		@endcode
 		///
+#ifndef SWIG
+	  class StateBuffer;
+#endif
 	  class StateVariable {
 		private:
 			bool m_StateIsNew;
-			/// Holds the value of the Statevariable
+			/// Holds the value of the Statevariable, if it is not stored in a StateBuffer
 			real m_State;
+			/// Points to the storage of the value, either m_State or an element of a StateBuffer
+			real* m_StatePointer;
+			/// The buffer holding the value and the position in the buffer
+			StateBuffer* m_Buffer;
+			size_t m_BufferIndex;
+			friend class StateBuffer;
 
 		protected:
 			virtual void StateChangeAction() {}
@@ -118,7 +147,7 @@ namespace cmf {
 			/// Returns the derivate of the state variable at time @c time
 			virtual real dxdt(const cmf::math::Time& time)=0;
 			/// Returns the current state of the variable
-			real get_state() const {return m_State;}
+			real get_state() const {return *m_StatePointer;}
 			/// Gives access to the state variable
 			void set_state(real newState);
 
@@ -128,11 +157,64 @@ namespace cmf {
 			virtual std::string to_string() const=0;
 			/// ctor
 			StateVariable(real InitialState=0, real scale=1) 
-				: m_State(InitialState),m_StateIsNew(true), m_Scale(scale)
+				: m_State(InitialState),m_StateIsNew(true), m_Scale(scale), 
+				  m_StatePointer(&m_State), m_Buffer(0), m_BufferIndex(0)
 			{}
+			/// A copy has its own storage
+			StateVariable(const StateVariable& copy)
+				: m_State(copy.get_state()),m_StateIsNew(true), m_Scale(copy.m_Scale), 
+				  m_StatePointer(&m_State), m_Buffer(0), m_BufferIndex(0)
+			{}
+			StateVariable& operator=(const StateVariable& copy) {
+				*m_StatePointer = copy.get_state();
+				m_Scale = copy.m_Scale;
+				m_StateIsNew = true;
+				return *this;
+			}
 
-			virtual ~StateVariable() {}
+			virtual ~StateVariable();
 		};
+#ifndef SWIG
+		/// @brief A contiguous array holding the values of a vector of state variables
+		///
+		/// On creation, the values of the state variables are moved into the buffer and the state variables
+		/// are redirected to their position in the buffer. Copying the values from and to a solver is then a 
+		/// single pass over contiguous memory. A state variable can only be stored in one buffer. If it is
+		/// bound to another buffer, this buffer becomes invalid (see is_valid). On destruction,
+		/// the values are moved back to the state variables still bound to this buffer.
+		class StateBuffer {
+		private:
+			std::vector<real> m_values;
+			// The values of the last StateChangeAction of each state
+			std::vector<real> m_notified;
+			std::vector<StateVariable*> m_states;
+			bool m_valid;
+			StateBuffer(const StateBuffer&);
+			StateBuffer& operator=(const StateBuffer&);
+			// Removes a state from the buffer and invalidates the buffer
+			void detach(StateVariable& state);
+			friend class StateVariable;
+		public:
+			typedef std::vector<StateVariable::ptr> state_vector;
+			/// Moves the values of the states into the buffer
+			explicit StateBuffer(const state_vector& states);
+			/// Moves the values back to the states
+			~StateBuffer();
+			/// True, if all states of the buffer are still stored in this buffer
+			bool is_valid() const {return m_valid;}
+			/// Number of values in the buffer
+			size_t size() const {return m_values.size();}
+			/// Returns the values of the state variables
+			const real* data() const {return m_values.data();}
+			/// Copies the values to destination
+			void copy_to(real * destination) const;
+			/// @brief Sets new values for the states. values may point to data()
+			///
+			/// Only states with a value different from their last notification are marked as changed. 
+			/// Throws, if a value is not finite
+			void set(const real * values, bool use_OpenMP=true);
+		};
+#endif
 
 		class StateVariableList;
 		/// An abstract class, that owns one or more state variables, that can add them to a vector of state variables in a certain order
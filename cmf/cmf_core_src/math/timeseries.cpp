@@ -78,6 +78,22 @@ double cmf::math::timeseries::interpolate( cmf::math::Time t,double n ) const
 		}
 	}
 }
+cmf::math::Time cmf::math::timeseries::next_jump( cmf::math::Time t ) const
+{
+	if (is_empty() || interpolationpower() != 0 || step() <= Time())
+		return never;
+	// The value of record k is used until halfway to record k+1 (see interpolate)
+	Time half = step() - step() / 2;
+	ptrdiff_t n = ptrdiff_t(size()), k = 0;
+	if (t > begin())
+		k = std::max(ptrdiff_t((t - begin()) / step()) - 1, ptrdiff_t(0));
+	for (; k < n - 1; ++k) {
+		Time jump = begin() + step() * (long long)(k) + half;
+		if (jump > t && m_data->values[k] != m_data->values[k + 1])
+			return jump;
+	}
+	return never;
+}
 cmf::math::timeseries& cmf::math::timeseries::operator-=( double _Right )
 {
 #pragma omp parallel for
@@ -165,6 +165,11 @@ namespace cmf {
 			{
 				return m_data->values.at(i<0 ? size()+i :i);
 			}
+			/// @brief Returns the first time after t, where the value of a nearest neighbor timeseries (interpolationpower 0) jumps
+			///
+			/// The value jumps halfway between two records with different values. Returns cmf::math::never, if the value does not
+			/// change after t or if the timeseries is interpolated
+			cmf::math::Time next_jump(cmf::math::Time t) const;
 			void set_t(cmf::math::Time t,double value);
 			void set_i(ptrdiff_t i,double value);
 			cmf::math::timeseries get_slice(cmf::math::Time _begin,cmf::math::Time _end,cmf::math::Time _step=cmf::math::Time());
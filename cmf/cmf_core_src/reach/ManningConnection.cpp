@@ -25,12 +25,11 @@ using namespace cmf::water;
 
 real cmf::river::Manning::calc_q( cmf::math::Time t )
 { 
-	flux_node::ptr lnode = left_node(), rnode=right_node();
-	OpenWaterStorage::ptr ows1=w1.lock(),ows2=w2.lock();
-	real d=lnode->position.distanceTo(rnode->position);
-	const IChannel *cast = dynamic_cast<const IChannel *>(&flux_geometry);
-	if (cast) 
-		d=cast->get_length();
+	const flux_node &lnode = *left_raw(), &rnode = *right_raw();
+	OpenWaterStorage *ows1=w1_raw, *ows2=w2_raw;
+	real d=lnode.position.distanceTo(rnode.position);
+	if (m_channel) 
+		d=m_channel->get_length();
 	real 
 		// Gradient of the reach
 		slope = get_slope(lnode,rnode,d),
@@ -38,7 +37,7 @@ real cmf::river::Manning::calc_q( cmf::math::Time t )
 	// No slope, no flux
 	if (abs_slope<=0) return 0.0;
 	// Get the source of the flow
-	OpenWaterStorage::ptr source=slope > 0 ? ows1 : ows2;
+	OpenWaterStorage* source=slope > 0 ? ows1 : ows2;
 	if (source==0) return 0; // Never generate flow from a flux node
 	// Wetted crossectional area, use mean volume of the water storages if both sides are water storages
 	real h;
@@ -53,6 +52,52 @@ real cmf::river::Manning::calc_q( cmf::math::Time t )
 	// Return flux with correct sign in m3/day
 	return prevent_negative_volume(qManning * sign(slope) * (24*60*60));
 }
+namespace {
+	// Derivative of the depth of an open water storage for its volume
+	real ddepth_dV(const OpenWaterStorage* ows) {
+		return ows && ows->get_volume() > 0 ? ows->get_dpotential_dV() : 0.0;
+	}
+}
+bool cmf::river::Manning::calc_dq_dV( cmf::math::Time t, real& dq_dVleft, real& dq_dVright )
+{
+	const flux_node &lnode = *left_raw(), &rnode = *right_raw();
+	OpenWaterStorage *ows1=w1_raw, *ows2=w2_raw;
+	dq_dVleft = dq_dVright = 0.0;
+	real d=lnode.position.distanceTo(rnode.position);
+	if (m_channel) 
+		d=m_channel->get_length();
+	real 
+		slope = get_slope(lnode,rnode,d),
+		abs_slope=fabs(slope);
+	// The flux of the diffusive wave is not differentiable for a zero slope
+	if (abs_slope<=0) return !is_diffusive_wave;
+	OpenWaterStorage* source=slope > 0 ? ows1 : ows2;
+	if (source==0) return true;
+	// Flow height and its derivatives, using the same cases as calc_q
+	real h = source->get_depth(), dh_dV1 = 0.0, dh_dV2 = 0.0;
+	(source == ows1 ? dh_dV1 : dh_dV2) = ddepth_dV(source);
+	if (is_diffusive_wave) {
+		real h_mean = ows2 ? mean(ows1->get_depth(),ows2->get_depth()) : ows1->get_depth();
+		if (h_mean < h) {
+			h = h_mean;
+			dh_dV1 = ows2 ? 0.5 * ddepth_dV(ows1) : ddepth_dV(ows1);
+			dh_dV2 = 0.5 * ddepth_dV(ows2);
+		}
+	}
+	if (h<=0) return true;
+	real 
+		qManning = flux_geometry.q(h,abs_slope),
+		// The Manning equation is proportional to the square root of the slope. The derivative for
+		// the depth depends on the wetted perimeter of the geometry and is calculated numerically
+		dq_ds = qManning / (2 * abs_slope),
+		dh = 1e-6 * h,
+		dq_dh = (flux_geometry.q(h + dh,abs_slope) - flux_geometry.q(h - dh,abs_slope)) / (2 * dh),
+		ds_dV1 = is_diffusive_wave ? lnode.get_dpotential_dV() / d : 0.0,
+		ds_dV2 = is_diffusive_wave ? -rnode.get_dpotential_dV() / d : 0.0;
+	dq_dVleft = (sign(slope) * dq_dh * dh_dV1 + dq_ds * ds_dV1) * (24*60*60);
+	dq_dVright = (sign(slope) * dq_dh * dh_dV2 + dq_ds * ds_dV2) * (24*60*60);
+	return prevent_negative_volume(qManning * sign(slope) * (24*60*60), dq_dVleft, dq_dVright);
+}
 Manning* create_manning( cmf::river::OpenWaterStorage::ptr left,cmf::water::flux_node::ptr right, const cmf::river::IChannel& reachtype,bool diffusive_wave )
 {
 	if (diffusive_wave) {
@@ -63,14 +108,14 @@ Manning* create_manning( cmf::river::OpenWaterStorage::ptr left,cmf::water::flux
 }
 
 
-real cmf::river::Manning_Kinematic::get_slope(cmf::water::flux_node::ptr lnode, cmf::water::flux_node::ptr rnode, real d)
+real cmf::river::Manning_Kinematic::get_slope(const cmf::water::flux_node& lnode, const cmf::water::flux_node& rnode, real d)
 {
-	return  (lnode->position.z - rnode->position.z)/d;	
+	return  (lnode.position.z - rnode.position.z)/d;	
 }
 
-real cmf::river::Manning_Diffusive::get_slope(cmf::water::flux_node::ptr lnode, cmf::water::flux_node::ptr rnode, real d)
+real cmf::river::Manning_Diffusive::get_slope(const cmf::water::flux_node& lnode, const cmf::water::flux_node& rnode, real d)
 {
-	real s = (lnode->get_potential()-rnode->get_potential())/d;
+	real s = (lnode.get_potential()-rnode.get_potential())/d;
 	if (this->linear_slope_width) {
 		real
 			// Only a shortcut for faster writing
@@ -87,3 +132,10 @@ real cmf::river::Manning_Diffusive::get_slope(cmf::water::flux_node::ptr lnode,
 		return s;
 	}
 }
+
+bool cmf::river::Manning_Diffusive::calc_dq_dV( cmf::math::Time t, real& dq_dVleft, real& dq_dVright )
+{
+	// The linearized slope is not derived
+	if (linear_slope_width) return false;
+	return Manning::calc_dq_dV(t, dq_dVleft, dq_dVright);
+}
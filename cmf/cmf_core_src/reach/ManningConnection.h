@@ -64,17 +64,25 @@ namespace cmf {
 		{
 		protected:
 
-			virtual real get_slope(cmf::water::flux_node::ptr lnode, cmf::water::flux_node::ptr rnode, real d)=0;
+			virtual real get_slope(const cmf::water::flux_node& lnode, const cmf::water::flux_node& rnode, real d)=0;
 			std::weak_ptr<cmf::river::OpenWaterStorage> w1,w2;
+			// Unlocked pointers to the nodes for calc_q
+			cmf::river::OpenWaterStorage *w1_raw, *w2_raw;
+			// The channel geometry of the connection, if the geometry is a channel (determined once)
+			const cmf::river::IChannel* m_channel;
 			virtual real calc_q(cmf::math::Time t);
+			virtual bool calc_dq_dV(cmf::math::Time t, real& dq_dVleft, real& dq_dVright);
 			void NewNodes()
 			{
 				w1=cmf::river::OpenWaterStorage::cast(left_node());
 				w2=cmf::river::OpenWaterStorage::cast(right_node());
+				w1_raw = w1.lock().get();
+				w2_raw = w2.lock().get();
 			}
 			Manning(cmf::river::OpenWaterStorage::ptr left,cmf::water::flux_node::ptr right,
 				const cmf::river::IVolumeHeightFunction& reachtype,bool diffusive_wave)
 				: flux_connection(left,right,diffusive_wave ? "Manning (diff. wave)" : "Manning (kin. wave)"),	flux_geometry(reachtype), is_diffusive_wave(diffusive_wave) {
+					m_channel = dynamic_cast<const cmf::river::IChannel *>(&flux_geometry);
 					NewNodes();
 			}
 
@@ -104,7 +112,8 @@ namespace cmf {
 		class Manning_Diffusive: public Manning
 		{
 		protected:
-			virtual real get_slope(cmf::water::flux_node::ptr lnode, cmf::water::flux_node::ptr rnode, real d);
+			virtual real get_slope(const cmf::water::flux_node& lnode, const cmf::water::flux_node& rnode, real d);
+			virtual bool calc_dq_dV(cmf::math::Time t, real& dq_dVleft, real& dq_dVright);
 		public:
 			typedef std::shared_ptr<Manning_Diffusive> ptr;
 			/// A parameter to linearize the dependency of q on slope during levelling out
@@ -135,7 +144,7 @@ namespace cmf {
 		class Manning_Kinematic: public Manning
 		{
 		protected:
-			virtual real get_slope(cmf::water::flux_node::ptr lnode, cmf::water::flux_node::ptr rnode, real d);
+			virtual real get_slope(const cmf::water::flux_node& lnode, const cmf::water::flux_node& rnode, real d);
 		public:
 			typedef std::shared_ptr<Manning_Kinematic> ptr;
 			/// Creates a kinematic wave connection between to open water storages.
@@ -72,6 +72,13 @@ real cmf::upslope::BrooksCoreyRetentionCurve::K( real wetness) const
 	return Ksat*minimum(pow(wetness,2*get_b()+3),1);
 }
 
+real cmf::upslope::BrooksCoreyRetentionCurve::dK_dW( real wetness ) const
+{
+	if (wetness<=0 || wetness>=1) return 0.0;
+	real e = 2*get_b()+3;
+	return Ksat*e*pow(wetness,e-1);
+}
+
 real cmf::upslope::BrooksCoreyRetentionCurve::Porosity( real depth ) const
 {
 	return m_Porosity*pow(1-m_PorosityDecay,depth);
@@ -137,6 +144,29 @@ real cmf::upslope::BrooksCoreyRetentionCurve::MatricPotential( real wetness ) co
 	}
 
 }
+real cmf::upslope::BrooksCoreyRetentionCurve::dPsiM_dW( real wetness ) const
+{
+	// Derivative of each part of MatricPotential
+	if (wetness<=1e-12)
+		return 0.0;
+	real w0=0.99;
+	if (wetness>0.99)
+	{
+		real p0=MatricPotential(w0);
+		real dp0=1e6*(p0-MatricPotential(w0-1e-6));
+		cmf::upslope::parabolic_extrapolation p(w0,p0,dp0);
+		return 2 * p.a * wetness + p.b;
+	}
+	else if (wetness>m_Wi)
+	{
+		return m_m*(wetness-m_n)*(1-wetness) < 1e6 ? -m_m*(1 + m_n - 2*wetness) : 0.0;
+	}
+	else
+	{
+		real psi = Psi_X * pow(wetness/wetness_X,-get_b());
+		return psi < 1e6 ? -get_b() * psi / wetness : 0.0;
+	}
+}
 real cmf::upslope::BrooksCoreyRetentionCurve::Wetness( real suction ) const
 {
 	real w0=0.99;
@@ -266,6 +296,20 @@ real cmf::upslope::VanGenuchtenMualem::K( real wetness) const
 	return Ksat*minimum(pow(wetness,l)*square(1-pow(1-pow(wetness,1/_m),_m)),1);
 }
 
+real cmf::upslope::VanGenuchtenMualem::dK_dW( real wetness ) const
+{
+	real _m = m<0 ? 1-1/n : m;
+	if (wetness<=0 || wetness>=1) return 0.0;
+	real 
+		u = pow(wetness,1/_m),
+		s = 1-pow(1-u,_m),
+		k = pow(wetness,l)*square(s);
+	if (k>=1) return 0.0;
+	// ds/dW = (1-W^(1/m))^(m-1) * W^(1/m-1)
+	real ds = pow(1-u,_m-1) * u / wetness;
+	return Ksat*(l*k/wetness + pow(wetness,l)*2*s*ds);
+}
+
 real cmf::upslope::VanGenuchtenMualem::VoidVolume( real upperDepth,real lowerDepth,real Area ) const
 {
 	return (lowerDepth-upperDepth)*Area*Porosity(upperDepth);
@@ -377,6 +421,12 @@ real cmf::upslope::LinearRetention::K( real wetness) const
 	return Ksat * pow((wetness - residual_wetness) / (1 - residual_wetness),beta);
 }
 
+real cmf::upslope::LinearRetention::dK_dW( real wetness ) const
+{
+	if (wetness<=residual_wetness || wetness>=1) return 0.0;
+	return Ksat * beta * pow((wetness - residual_wetness) / (1 - residual_wetness),beta-1) / (1 - residual_wetness);
+}
+
 real cmf::upslope::LinearRetention::Porosity( real depth ) const
 {
 	return porosity*pow(1-porosity_decay,depth);
@@ -432,6 +482,15 @@ real cmf::upslope::LinearRetention::MatricPotential( real wetness ) const
 	else
 		return -std::numeric_limits<real>::infinity();
 }
+real cmf::upslope::LinearRetention::dPsiM_dW( real wetness ) const
+{
+	if (wetness>residual_wetness)
+		return thickness/(1-residual_wetness);
+	else if (wetness>0)
+		return 1/wetness;
+	else
+		return std::numeric_limits<real>::infinity();
+}
 
 cmf::upslope::LinearRetention::LinearRetention( real _Ksat,real _Phi, real _thickness,real _residual_wetness/*=0.1*/ ) 
 : Ksat(_Ksat),porosity(_Phi),thickness(_thickness),residual_wetness(_residual_wetness) ,beta(1.0), porosity_decay(0.0)
@@ -112,6 +112,21 @@ namespace cmf {
 					res[i] = dPsiM_dW(wetness[i]);
 				return res;				
 			}
+			/// @brief Returns the derivative of the conductivity for the wetness \f$\tfrac{dK}{dW}\f$
+			///
+			/// If not overridden, the derivative is approximated with a central difference of K
+			virtual real dK_dW(real wetness) const {
+				real
+					w0 = minmax(wetness - 1e-6, 0, 1),
+					w1 = minmax(wetness + 1e-6, 0, 1);
+				return w1 > w0 ? (K(w1) - K(w0)) / (w1 - w0) : 0.0;
+			}
+			cmf::math::num_array dK_dW(const cmf::math::num_array& wetness) const {
+				cmf::math::num_array res(wetness.size());
+				for (ptrdiff_t i = 0; i < wetness.size() ; ++i)
+					res[i] = dK_dW(wetness[i]);
+				return res;				
+			}
 			/// returns the volumetric water content at a given pF value
 			real Wetness_pF(real pF) const {return Wetness(pF_to_waterhead(pF));}
 			cmf::math::num_array Wetness_pF(const cmf::math::num_array& pF) const {
@@ -166,6 +181,8 @@ namespace cmf {
 		public:
 			real Ksat;
 			virtual real K(real wetness) const;
+			/// returns \f$\tfrac{dK}{dW}\f$
+			virtual real dK_dW(real wetness) const;
 			/// real (Porosity)
 			real Porosity(real depth) const;
 			/// Sets the porosity (Volume of pores per volume of soil) and the exponential porosity decline with depth
@@ -191,6 +208,8 @@ namespace cmf {
 			}
 			/// Returns the suction pressure in m, use conversion functions waterhead_to_pressure and waterhead_to_pF fro conversions
 			real MatricPotential(real wetness) const;
+			/// returns \f$\tfrac{d\Psi_M}{dW}\f$
+			real dPsiM_dW(real wetness) const;
 			real Wetness(real suction) const;
 
 			/// Creates a brooks corey retention curve
@@ -270,6 +289,8 @@ namespace cmf {
 			///
 			/// \f[K(W) = K_{sat} \sqrt{W} \left(1-\left(1-W^{1/m}\right)^m\right)^2 \f]
 			virtual real K(real wetness) const;
+			/// returns \f$\tfrac{dK}{dW}\f$
+			virtual real dK_dW(real wetness) const;
 			virtual real VoidVolume(real upperDepth,real lowerDepth,real Area) const;
 			virtual real Transmissivity(real upperDepth,real lowerDepth,real wetness) const;
 			virtual real Porosity(real depth) const;
@@ -340,8 +361,12 @@ namespace cmf {
 			virtual real MatricPotential(real wetness) const;
 			/// Returns the wetness (water content per pore volume) at a given head
 			virtual real Wetness(real suction) const;
+			/// returns \f$\tfrac{d\Psi_M}{dW}\f$
+			virtual real dPsiM_dW(real wetness) const;
 			
 			virtual real K(real wetness) const;
+			/// returns \f$\tfrac{dK}{dW}\f$
+			virtual real dK_dW(real wetness) const;
 			virtual real VoidVolume(real upperDepth,real lowerDepth,real Area) const;
 			virtual real Transmissivity(real upperDepth,real lowerDepth,real wetness) const;
 			virtual real Porosity(real depth) const;
@@ -167,6 +167,27 @@ void SoilLayer::set_wetness( real wetness )
 		set_state(wetness * get_capacity());
 }
 
+real SoilLayer::get_dpotential_dV() const
+{
+	// Same conversion as volume_to_head
+	return get_soil().dPsiM_dW(get_volume() / get_capacity()) / get_capacity();
+}
+
+real SoilLayer::get_dK_dV( point direction ) const
+{
+	// The wetness for K is not negative
+	if (m_wet.V <= 0.0) return 0.0;
+	RetentionCurve& s = get_soil();
+	real dK = s.dK_dW(m_wet.W) / s.K(1) * m_wet.Ksat / m_wet.C;
+	if (direction.length()<=0.0) {
+		return dK;
+	} else {
+		point 
+			dir = direction/(direction.x+direction.y+direction.z);
+		return dK * fabs(dot(dir,anisotropic_kf));
+	}
+}
+
 real SoilLayer::get_K( point direction ) const
 {
 	if (direction.length()<=0.0) {
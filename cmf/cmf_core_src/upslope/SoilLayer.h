@@ -107,6 +107,8 @@ namespace cmf {
 			real get_K() const {return m_wet.K;}
 			/// Returns the actual anisotropic conductivity along a direction \f$K = (k_f \cdot d) K\f$
 			virtual real get_K(cmf::geometry::point direction) const;
+			/// Returns the derivative of the anisotropic conductivity for the volume \f$\frac{dK}{dV}\f$ in m/day/m3
+			real get_dK_dV(cmf::geometry::point direction) const;
 			cmf::geometry::point anisotropic_kf;
 			real get_Ksat() const {return m_wet.Ksat;}
 			/// Returns the wetness of the soil \f$ \frac{V_{H_2O}}{V_{pores}} \f$
@@ -126,6 +128,9 @@ namespace cmf {
 			/// Returns the total potential in m
 			/// \f[ \Psi = \Psi_M + \Psi_G \f]
 			virtual real get_potential() const;
+			/// Returns the derivative of the total potential for the volume
+			/// \f[ \frac{d\Psi}{dV} = \frac 1 C \frac{d\Psi_M}{dW} \f]
+			virtual real get_dpotential_dV() const;
 			/// Returns the depth for saturation
 			/// \f[ z_{sat,this} = \left\{z_{cell}-\Psi_{tot} \mbox{ if } W<1 \\ z_{sat,upper layer} \right. \f]
 			virtual real get_saturated_depth() const;
@@ -17,6 +17,8 @@
 //   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
 //   
 #include "Percolation.h"
+#include <typeinfo>
+#include <algorithm>
 
 using namespace cmf::water;
 void cmf::upslope::connections::Richards::use_for_cell( cmf::upslope::Cell & cell,bool no_override/*=true*/ )
@@ -34,26 +36,26 @@ real cmf::upslope::connections::Richards::calc_q( cmf::math::Time t )
 	using namespace cmf::upslope;
 	using namespace cmf::geometry;
 	// Richards flux
-	SoilLayer::ptr 
-		l1=sw1.lock(),
-		l2=sw2.lock();
-	conductable::ptr C2 = c2.lock();
-
+	SoilLayer
+		*l1=sw1_raw,
+		*l2=sw2_raw;
+	conductable* C2 = c2_raw;
+	flux_node* right = right_raw();
 
 	real
-		distance = fabs(l1->position.z - right_node()->position.z),
+		distance = fabs(l1->position.z - right->position.z),
 		Psi_t1=l1->get_potential(),
-		Psi_t2=right_node()->get_potential(),
+		Psi_t2=right->get_potential(),
 		gradient=(Psi_t1-Psi_t2)/distance,
 		K=0.0;
-	point direction =  l1->position - right_node()->position;
+	point direction =  l1->position - right->position;
 	if (distance == 0.0) distance = l1->get_thickness();
 	//K=gradient<0 && l2 ? l2->K() : l1->K();      
 	if (l2)
 		K = geo_mean(l1->get_K(direction),l2->get_K(direction));
 	else if (C2)
 		K = geo_mean(l1->get_K(direction),C2->get_K(direction));
-	else if (right_node()->is_empty() || right_node()->get_potential() < l1->get_gravitational_potential())
+	else if (right->is_empty() || right->get_potential() < l1->get_gravitational_potential())
 		K = l1->get_K(direction);
 	else
 		K = geo_mean(l1->get_K(direction),l1->get_Ksat());
@@ -62,6 +64,101 @@ real cmf::upslope::connections::Richards::calc_q( cmf::math::Time t )
 	real r_flow=K*gradient*l1->cell.get_area();
 	return prevent_negative_volume(r_flow);
 }
+
+bool cmf::upslope::connections::Richards::calc_dq_dV( cmf::math::Time t, real& dq_dVleft, real& dq_dVright )
+{
+	using namespace cmf::upslope;
+	using namespace cmf::geometry;
+	// Derivatives of the terms of calc_q
+	SoilLayer
+		*l1=sw1_raw,
+		*l2=sw2_raw;
+	conductable* C2 = c2_raw;
+	flux_node* right = right_raw();
+	point direction =  l1->position - right->position;
+	real
+		distance = fabs(l1->position.z - right->position.z),
+		gradient=(l1->get_potential()-right->get_potential())/distance,
+		K1 = l1->get_K(direction),
+		dK1 = l1->get_dK_dV(direction),
+		K, dK_dV1, dK_dV2 = 0.0;
+	// The geometric mean is not differentiable for K=0
+	if (K1 <= 0.0) return false;
+	if (l2) {
+		real K2 = l2->get_K(direction);
+		if (K2 <= 0.0) return false;
+		K = geo_mean(K1,K2);
+		dK_dV1 = 0.5 * K / K1 * dK1;
+		dK_dV2 = 0.5 * K / K2 * l2->get_dK_dV(direction);
+	} else if (C2) {
+		K = geo_mean(K1,C2->get_K(direction));
+		dK_dV1 = 0.5 * K / K1 * dK1;
+	} else if (right->is_empty() || right->get_potential() < l1->get_gravitational_potential()) {
+		K = K1;
+		dK_dV1 = dK1;
+	} else {
+		K = geo_mean(K1,l1->get_Ksat());
+		dK_dV1 = 0.5 * K / K1 * dK1;
+	}
+	real area = l1->cell.get_area();
+	dq_dVleft = (dK_dV1 * gradient + K * l1->get_dpotential_dV() / distance) * area;
+	dq_dVright = (dK_dV2 * gradient - K * right->get_dpotential_dV() / distance) * area;
+	return prevent_negative_volume(K*gradient*area, dq_dVleft, dq_dVright);
+}
+
+// Calculates the Richards fluxes between two soil layers in blocks. The properties of the layers are
+// gathered into packed arrays, the fluxes are calculated in a single loop over the arrays and are stored 
+// afterwards. Connections to other nodes are calculated by Richards::calc_q.
+class cmf::upslope::connections::Richards::kernel : public cmf::water::flux_kernel {
+public:
+	void calc_q(cmf::math::Time t, flux_connection* const* connections, real* q, size_t n) const
+	{
+		using namespace cmf::upslope;
+		const size_t block = 64;
+		real Psi_t1[block], Psi_t2[block], z1[block], z2[block], K1[block], K2[block], area[block], r_flow[block];
+		size_t index[block];
+		for (size_t begin = 0; begin < n; begin += block)
+		{
+			size_t end = std::min(n, begin + block), m = 0;
+			for (size_t i = begin; i < end; ++i)
+			{
+				Richards* con = static_cast<Richards*>(connections[i]);
+				if (!is_outdated(*con, t)) {
+					q[i] = cached_q(*con);
+				} else if (!con->sw2_raw) {
+					q[i] = store_q(*con, con->Richards::calc_q(t), t);
+				} else {
+					// SoilLayer has no subclasses, hence the virtual functions are called directly
+					SoilLayer *l1 = con->sw1_raw, *l2 = con->sw2_raw;
+					cmf::geometry::point direction = l1->position - l2->position;
+					index[m] = i;
+					Psi_t1[m] = l1->SoilLayer::get_potential();
+					Psi_t2[m] = l2->SoilLayer::get_potential();
+					z1[m] = l1->position.z;
+					z2[m] = l2->position.z;
+					K1[m] = l1->SoilLayer::get_K(direction);
+					K2[m] = l2->SoilLayer::get_K(direction);
+					area[m] = l1->cell.get_area();
+					++m;
+				}
+			}
+			// Same formula as Richards::calc_q for two soil layers
+			for (size_t j = 0; j < m; ++j)
+				r_flow[j] = sqrt(fabs(K1[j] * K2[j])) * ((Psi_t1[j] - Psi_t2[j]) / fabs(z1[j] - z2[j])) * area[j];
+			for (size_t j = 0; j < m; ++j) {
+				Richards* con = static_cast<Richards*>(connections[index[j]]);
+				q[index[j]] = store_q(*con, prevent_negative_volume(*con, r_flow[j]), t);
+			}
+		}
+	}
+};
+
+const flux_kernel* cmf::upslope::connections::Richards::get_kernel() const
+{
+	static const kernel richards_kernel;
+	// Subclasses may override calc_q
+	return typeid(*this) == typeid(Richards) ? &richards_kernel : 0;
+}
 void cmf::upslope::connections::SimplRichards::use_for_cell( cmf::upslope::Cell & cell,bool no_override/*=true*/ )
 {
 	for (int i = 0; i < cell.layer_count()-1 ; ++i)
@@ -76,15 +76,29 @@ namespace cmf {
 			protected:
 				std::weak_ptr<cmf::upslope::SoilLayer> sw1,sw2;
 				std::weak_ptr<cmf::upslope::conductable> c2;
+				// Unlocked pointers to the nodes for calc_q
+				cmf::upslope::SoilLayer *sw1_raw, *sw2_raw;
+				cmf::upslope::conductable* c2_raw;
 				void NewNodes()
 				{
 					sw1=cmf::upslope::SoilLayer::cast(left_node());
 					sw2=cmf::upslope::SoilLayer::cast(right_node());
 					c2=cmf::upslope::conductable::cast(right_node());
+					sw1_raw = sw1.lock().get();
+					sw2_raw = sw2.lock().get();
+					c2_raw = c2.lock().get();
 				}
 
 				virtual real calc_q(cmf::math::Time t) ;
+				virtual bool calc_dq_dV(cmf::math::Time t, real& dq_dVleft, real& dq_dVright);
+#ifndef SWIG
+				// Calculates the fluxes between soil layers in blocks
+				class kernel;
+#endif
 			public:
+#ifndef SWIG
+				virtual const cmf::water::flux_kernel* get_kernel() const;
+#endif
 				/// Creates a Richards equation connection between two soil layers (left and right, rather top and bottom) of the same cell
 				Richards(cmf::upslope::SoilLayer::ptr left,cmf::water::flux_node::ptr right)
 					: flux_connection(left,right,"Richards eq.")
@@ -71,6 +71,12 @@ namespace cmf {
 					: flux_connection(surfacewater,soilwater,"Richards eq. infiltration") {
 						NewNodes();
 				}
+#ifndef SWIG
+				/// Without a surface water storage, the infiltration depends on the other fluxes of the surface water
+				const void* get_shared_calculation() const {
+					return m_surfacewaterstorage.expired() ? left_node().get() : 0;
+				}
+#endif
 				/// Creates the connection between surfacewater and first soil layer
 				static void use_for_cell(cmf::upslope::Cell& c)
 				{
@@ -125,6 +131,12 @@ namespace cmf {
 					: flux_connection(surfacewater,soilwater,"Green Ampt infiltration"){
 						NewNodes();
 				}
+#ifndef SWIG
+				/// Without a surface water storage, the infiltration depends on the other fluxes of the surface water
+				const void* get_shared_calculation() const {
+					return m_surfacewaterstorage.expired() ? left_node().get() : 0;
+				}
+#endif
 				/// Creates the connection between surfacewater and first soil layer
 				static void use_for_cell(cmf::upslope::Cell& c) {
 					new cmf::upslope::connections::GreenAmptInfiltration(c.get_layer(0),c.get_surfacewater());
@@ -165,6 +177,12 @@ namespace cmf {
 				/// @param surfacewater the infiltration source
 				/// @param W0 the 50% saturation value
 				SimpleInfiltration(cmf::upslope::SoilLayer::ptr soilwater,cmf::water::flux_node::ptr surfacewater,real W0=0.9);
+#ifndef SWIG
+				/// The infiltration depends on the incoming fluxes of the surface water
+				const void* get_shared_calculation() const {
+					return left_node().get();
+				}
+#endif
 				
 				static void use_for_cell(cmf::upslope::Cell& c) {
 					new cmf::upslope::connections::SimpleInfiltration(c.get_layer(0),c.get_surfacewater());
@@ -19,6 +19,8 @@
 #include "subsurfacefluxes.h"
 #include "../../math/real.h"
 #include "../../geometry/geometry.h"
+#include <typeinfo>
+#include <algorithm>
 using namespace cmf::water;
 using namespace cmf::upslope;
 using namespace cmf::geometry;
@@ -47,15 +49,15 @@ void connections::Richards_lateral::usebaseflow(bool use) {
 }
 real connections::Richards_lateral::calc_q( cmf::math::Time t )
 {
-	SoilLayer::ptr 
-		l1=sw1.lock(),
-		l2=sw2.lock();
-	conductable::ptr C2=c2.lock();
+	SoilLayer
+		*l1=sw1_raw,
+		*l2=sw2_raw;
+	conductable* C2=c2_raw;
 	// Richards flux
-	point direction=left_node()->position - right_node()->position;
+	point direction=left_raw()->position - right_raw()->position;
 	real
 		Psi_t1=l1->get_potential(),
-		Psi_t2=right_node()->get_potential(),
+		Psi_t2=right_raw()->get_potential(),
 		gradient=(Psi_t1-Psi_t2)/distance,
 		K1=l1->get_K(direction),K2=0.0,
 		K=0.0, Ksat =.0;
@@ -89,12 +91,102 @@ real connections::Richards_lateral::calc_q( cmf::math::Time t )
 	return prevent_negative_volume(r_flow); 
 
 
+}
+bool connections::Richards_lateral::calc_dq_dV( cmf::math::Time t, real& dq_dVleft, real& dq_dVright )
+{
+	// The baseflow term is not derived
+	if (baseflow) return false;
+	SoilLayer
+		*l1=sw1_raw,
+		*l2=sw2_raw;
+	conductable* C2=c2_raw;
+	point direction=left_raw()->position - right_raw()->position;
+	real
+		Psi_t1=l1->get_potential(),
+		Psi_t2=right_raw()->get_potential(),
+		gradient=(Psi_t1-Psi_t2)/distance,
+		K1=l1->get_K(direction),
+		dK1=l1->get_dK_dV(direction),
+		K, dK_dV1, dK_dV2=0.0;
+	// The geometric mean is not differentiable for K=0
+	if (K1<=0.0) return false;
+	if (l2) {
+		real K2=l2->get_K(direction);
+		if (K2<=0.0) return false;
+		K = geo_mean(K1,K2);
+		dK_dV1 = 0.5 * K / K1 * dK1;
+		dK_dV2 = 0.5 * K / K2 * l2->get_dK_dV(direction);
+	} else if (C2) {
+		K = geo_mean(K1,C2->get_K(direction));
+		dK_dV1 = 0.5 * K / K1 * dK1;
+	} else if (wet_right_node && Psi_t1<=Psi_t2) {
+		K = geo_mean(K1,l1->get_Ksat());
+		dK_dV1 = 0.5 * K / K1 * dK1;
+	} else {
+		K = K1;
+		dK_dV1 = dK1;
+	}
+	real area = flow_width * flow_thickness;
+	dq_dVleft = (dK_dV1 * gradient + K * l1->get_dpotential_dV() / distance) * area;
+	dq_dVright = (dK_dV2 * gradient - K * right_raw()->get_dpotential_dV() / distance) * area;
+	return prevent_negative_volume(K * gradient * area, dq_dVleft, dq_dVright);
+}
+// Calculates the lateral Richards fluxes between two soil layers without baseflow in blocks of packed arrays,
+// like Richards::kernel. All other connections are calculated by Richards_lateral::calc_q.
+class connections::Richards_lateral::kernel : public cmf::water::flux_kernel {
+public:
+	void calc_q(cmf::math::Time t, flux_connection* const* connections, real* q, size_t n) const
+	{
+		const size_t block = 64;
+		real Psi_t1[block], Psi_t2[block], distance[block], K1[block], K2[block], flow_width[block], flow_thickness[block], r_flow[block];
+		size_t index[block];
+		for (size_t begin = 0; begin < n; begin += block)
+		{
+			size_t end = std::min(n, begin + block), m = 0;
+			for (size_t i = begin; i < end; ++i)
+			{
+				Richards_lateral* con = static_cast<Richards_lateral*>(connections[i]);
+				if (!is_outdated(*con, t)) {
+					q[i] = cached_q(*con);
+				} else if (!con->sw2_raw || baseflow) {
+					q[i] = store_q(*con, con->Richards_lateral::calc_q(t), t);
+				} else {
+					// SoilLayer has no subclasses, hence the virtual functions are called directly
+					SoilLayer *l1 = con->sw1_raw, *l2 = con->sw2_raw;
+					point direction = l1->position - l2->position;
+					index[m] = i;
+					Psi_t1[m] = l1->SoilLayer::get_potential();
+					Psi_t2[m] = l2->SoilLayer::get_potential();
+					distance[m] = con->distance;
+					K1[m] = l1->SoilLayer::get_K(direction);
+					K2[m] = l2->SoilLayer::get_K(direction);
+					flow_width[m] = con->flow_width;
+					flow_thickness[m] = con->flow_thickness;
+					++m;
+				}
+			}
+			// Same formula as Richards_lateral::calc_q for two soil layers
+			for (size_t j = 0; j < m; ++j)
+				r_flow[j] = sqrt(fabs(K1[j] * K2[j])) * ((Psi_t1[j] - Psi_t2[j]) / distance[j]) * flow_width[j] * flow_thickness[j];
+			for (size_t j = 0; j < m; ++j) {
+				Richards_lateral* con = static_cast<Richards_lateral*>(connections[index[j]]);
+				q[index[j]] = store_q(*con, prevent_negative_volume(*con, r_flow[j]), t);
+			}
+		}
+	}
+};
+
+const flux_kernel* connections::Richards_lateral::get_kernel() const
+{
+	static const kernel lateral_kernel;
+	// Subclasses may override calc_q
+	return typeid(*this) == typeid(Richards_lateral) ? &lateral_kernel : 0;
 }
 /************************************************************************/
 /* Lateral fluxes                                                       */
 /************************************************************************/
 // Darcy connection
-real get_flow_thick(SoilLayer::ptr l)
+real get_flow_thick(const SoilLayer* l)
 {
 	real 
 		thick=l->get_thickness(),
@@ -103,15 +195,23 @@ real get_flow_thick(SoilLayer::ptr l)
 		
 	return minmax(thick + mp /* w_eff*/ ,0.0,thick);
 }
+// Derivative of get_flow_thick for the volume of the layer
+real get_dflow_thick_dV(const SoilLayer* l)
+{
+	real
+		thick=l->get_thickness(),
+		ft = thick + l->get_matrix_potential();
+	return ft > 0.0 && ft < thick ? l->get_dpotential_dV() : 0.0;
+}
 real connections::Darcy::calc_q( cmf::math::Time t )	
 {
-	SoilLayer::ptr 
-		l1=sw1.lock(),
-		l2=sw2.lock();
+	SoilLayer
+		*l1=sw1_raw,
+		*l2=sw2_raw;
 	// Calculate the gradient
 	real
-		Psi_t1 = left_node()->get_potential(),
-		Psi_t2 = right_node()->get_potential(),
+		Psi_t1 = left_raw()->get_potential(),
+		Psi_t2 = right_raw()->get_potential(),
 		gradient=(Psi_t1-Psi_t2)/distance;
 
 
@@ -132,6 +232,33 @@ real connections::Darcy::calc_q( cmf::math::Time t )
 	return prevent_negative_volume(T*gradient*flow_width);
 
 }
+bool connections::Darcy::calc_dq_dV( cmf::math::Time t, real& dq_dVleft, real& dq_dVright )
+{
+	SoilLayer
+		*l1=sw1_raw,
+		*l2=sw2_raw;
+	real
+		Psi_t1 = left_raw()->get_potential(),
+		Psi_t2 = right_raw()->get_potential(),
+		gradient=(Psi_t1-Psi_t2)/distance,
+		flow_thick1 = get_flow_thick(l1), 
+		flow_thick2 = l2 ? get_flow_thick(l2) : l1->get_thickness();
+	if ((flow_thick1 + flow_thick2)<=0) {
+		dq_dVleft = dq_dVright = 0.0;
+		return true;
+	}
+	real
+		T1 = l1->get_Ksat() *  flow_thick1,
+		T2 = l2 
+			? l2->get_Ksat() * flow_thick2 
+			: l1->get_Ksat() * flow_thick2,
+		T = mean(T1,T2),
+		dT_dV1 = 0.5 * l1->get_Ksat() * get_dflow_thick_dV(l1),
+		dT_dV2 = l2 ? 0.5 * l2->get_Ksat() * get_dflow_thick_dV(l2) : 0.0;
+	dq_dVleft = (dT_dV1 * gradient + T * left_raw()->get_dpotential_dV() / distance) * flow_width;
+	dq_dVright = (dT_dV2 * gradient - T * right_raw()->get_dpotential_dV() / distance) * flow_width;
+	return prevent_negative_volume(T*gradient*flow_width, dq_dVleft, dq_dVright);
+}
 
 void connections::Darcy::connect_cells( Cell & cell1,Cell & cell2,ptrdiff_t start_at_layer/*=0*/ )
 {
@@ -154,9 +281,9 @@ const CellConnector connections::TopographicGradientDarcy::cell_connector=CellCo
 real connections::TopographicGradientDarcy::calc_q( cmf::math::Time t )
 {
 	// Darcy flux
-	SoilLayer::ptr 
-		l1=sw1.lock(),
-		l2=sw2.lock();
+	SoilLayer
+		*l1=sw1_raw,
+		*l2=sw2_raw;
 
 	real
 		flow_thick1=get_flow_thick(l1), // minimum(l1->get_thickness(),l1->get_lower_boundary()-l1->cell.get_saturated_depth()),
@@ -166,7 +293,7 @@ real connections::TopographicGradientDarcy::calc_q( cmf::math::Time t )
 		flow_thick=mean(flow_thick1,flow_thick2),
 		// Topographic gradient
 		Psi_t1=l1->cell.z,
-		Psi_t2=l2 ? l2->cell.z : right_node()->get_potential(),
+		Psi_t2=l2 ? l2->cell.z : right_raw()->get_potential(),
 		gradient=(Psi_t1-Psi_t2)/distance,
 		// Transmissivity
 		T1 = l1->get_Ksat() *  (l1->get_lower_boundary() - (l1->get_lower_boundary()-flow_thick1)),
@@ -195,15 +322,15 @@ void connections::TopographicGradientDarcy::connect_cells( Cell & cell1,Cell & c
 real connections::DarcyKinematic::calc_q( cmf::math::Time t )
 {
 	// Darcy flux
-	SoilLayer::ptr
-		l1=sw1.lock(),
-		l2=sw2.lock(),
-		source = (l2 && l1->cell.z < l2->cell.z) ? l2 : l1;
+	SoilLayer
+		*l1=sw1_raw,
+		*l2=sw2_raw,
+		*source = (l2 && l1->cell.z < l2->cell.z) ? l2 : l1;
 	real
 		K = source->get_K(),
 		// Topographic gradient
 		Psi_t1=l1->cell.z,
-		Psi_t2=l2 ? l2->cell.z : right_node()->get_potential(),
+		Psi_t2=l2 ? l2->cell.z : right_raw()->get_potential(),
 		gradient=(Psi_t1-Psi_t2)/distance,
 		flow=K*source->get_thickness()*flow_width*gradient;
 	return prevent_negative_volume(flow);
@@ -240,6 +367,9 @@ void connections::lateral_sub_surface_flux::NewNodes()
 	sw1 = l1;
 	sw2 = l2;
 	c2=conductable::cast(right_node());
+	sw1_raw = l1.get();
+	sw2_raw = l2.get();
+	c2_raw = c2.lock().get();
 
 }
 
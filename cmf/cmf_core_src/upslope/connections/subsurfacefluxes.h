@@ -37,6 +37,9 @@ namespace cmf {
 			protected:
 				std::weak_ptr<cmf::upslope::SoilLayer> sw1,sw2;
 				std::weak_ptr<cmf::upslope::conductable> c2;
+				// Unlocked pointers to the nodes for calc_q
+				cmf::upslope::SoilLayer *sw1_raw, *sw2_raw;
+				cmf::upslope::conductable* c2_raw;
 				real 
 					flow_width, distance;
 
@@ -59,6 +62,7 @@ namespace cmf {
 			class Darcy : public lateral_sub_surface_flux {
 			protected:
 				virtual real calc_q(cmf::math::Time t) ;
+				virtual bool calc_dq_dV(cmf::math::Time t, real& dq_dVleft, real& dq_dVright);
 				static void connect_cells(cmf::upslope::Cell & cell1,cmf::upslope::Cell & cell2,ptrdiff_t start_at_layer=0);
 			public:
 				static const CellConnector cell_connector;
@@ -138,8 +142,16 @@ namespace cmf {
 			protected:
 				static void connect_cells(cmf::upslope::Cell & cell1,cmf::upslope::Cell & cell2,ptrdiff_t start_at_layer=0);
 				virtual real calc_q(cmf::math::Time t) ;
+				virtual bool calc_dq_dV(cmf::math::Time t, real& dq_dVleft, real& dq_dVright);
+#ifndef SWIG
+				// Calculates the fluxes between soil layers in blocks
+				class kernel;
+#endif
 
 			public:
+#ifndef SWIG
+				virtual const cmf::water::flux_kernel* get_kernel() const;
+#endif
 				real flow_thickness;
 				bool wet_right_node;
 				/// @brief Creates the connection
@@ -107,6 +107,12 @@ namespace cmf {
 					: cmf::water::flux_connection(Canopy,target,"Rutter interception"),m_cell(cell) {
 						NewNodes();
 				}
+#ifndef SWIG
+				/// The interception depends on the rainfall flux to the canopy
+				const void* get_shared_calculation() const {
+					return static_cast<const cmf::water::flux_node*>(m_cell.get_rain_source().get());
+				}
+#endif
 				/// Creates a new connection between canopy and surfacewater and does a bunch of other things. 
 				/// 
 				/// * If no canopy storage is available, it is created
@@ -177,6 +177,11 @@ namespace cmf {
 				{
 					NewNodes();
 				}
+#ifndef SWIG
+				const void* get_shared_calculation() const {
+					return _owner.get();
+				}
+#endif
 			};
 
 			/// @brief Connection for Shuttleworth-Wallace ground evaporation
@@ -199,6 +204,11 @@ namespace cmf {
 				{
 					NewNodes();
 				}
+#ifndef SWIG
+				const void* get_shared_calculation() const {
+					return _owner.get();
+				}
+#endif
 			};
 
 			/// @brief Connection for Shuttleworth-Wallace canopy interception evaporation
@@ -221,6 +231,11 @@ namespace cmf {
 				{
 					NewNodes();
 				}
+#ifndef SWIG
+				const void* get_shared_calculation() const {
+					return _owner.get();
+				}
+#endif
 			};
 
 			/// @brief Connection for Shuttleworth-Wallace canopy interception evaporation
@@ -243,6 +258,11 @@ namespace cmf {
 				{
 					NewNodes();
 				}
+#ifndef SWIG
+				const void* get_shared_calculation() const {
+					return _owner.get();
+				}
+#endif
 			};
 
 
@@ -266,6 +286,11 @@ namespace cmf {
 				{
 					NewNodes();
 				}
+#ifndef SWIG
+				const void* get_shared_calculation() const {
+					return _owner.get();
+				}
+#endif
 			};
 
 		}
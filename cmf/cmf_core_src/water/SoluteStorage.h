@@ -56,6 +56,7 @@ namespace cmf {
 				adsorption.reset(newadsorption.copy(m));
 			}
 			friend class WaterStorage;
+			friend class flux_graph;
 			/// @brief Rate of decay of the solute (in 1/day)
 			real decay;
 			/// @brief A source or sink term of the solute as an absolute matter flux in state unit/day
@@ -18,6 +18,8 @@
 //   
 #include "WaterStorage.h"
 #include "../project.h"
+#include <algorithm>
+#include <cmath>
 
 using namespace cmf::water;
 
@@ -97,10 +99,22 @@ real cmf::water::WaterStorage::volume_to_head( real volume ) const
 	return position.z;
 }
 
+real cmf::water::WaterStorage::get_dpotential_dV() const
+{
+	real 
+		V = get_volume(),
+		dV = 1e-6 * std::max(fabs(V), 1e-3);
+	return (volume_to_head(V + dV) - volume_to_head(V - dV)) / (2 * dV);
+}
+
 real cmf::water::WaterStorage::dxdt( const cmf::math::Time& time )
 {
 	// Gets the net fluxes of this water storage in m3/day
-	real dVdt = waterbalance(time);
+	return dxdt_from_waterbalance(waterbalance(time));
+}
+
+real cmf::water::WaterStorage::dxdt_from_waterbalance( real dVdt ) const
+{
 	// If head is the integrated variable
 	if (get_state_variable_content()=='h')
 	{
@@ -66,6 +66,9 @@ namespace cmf {
 		protected:
 			virtual real head_to_volume(real head) const;
 			virtual real volume_to_head(real volume) const;
+			/// @brief Converts a net flux dV/dt in m3/day into the derivative of the integrated variable (volume or head)
+			real dxdt_from_waterbalance(real dVdt) const;
+			friend class flux_graph;
 	
 		public:
 			/// @brief A character indicating the integrated variable (either 'V' for Volume or 'h' for head)
@@ -124,6 +127,10 @@ namespace cmf {
 				else
 					return volume_to_head(get_state());
 			}
+			/// @brief Returns the derivative of the potential for the volume \f$\frac{d\Psi}{dV}\f$ in m/m3
+			///
+			/// If not overridden, it is approximated by a central difference of the volume to head conversion
+			virtual real get_dpotential_dV() const;
 
 			/// @brief Sets the volume of water in this storage in m<sup>3</sup>
 			virtual void set_volume(real newwatercontent)	{
@@ -27,16 +27,20 @@ using namespace cmf::water;
 using namespace cmf::math;
 
 int flux_connection::nextconnectionid=0;
+size_t flux_connection::topology_version=0;
 
 real flux_connection::q(cmf::math::Time t) {
-#ifndef NOQCACHE
-	if (RecalcAlways || m_left.lock()->RecalcFluxes(t) || m_right.lock()->RecalcFluxes(t))
-#endif
-	{
-		m_q = calc_q(t);
-		if (!std::isfinite(m_q)) {
-			throw std::runtime_error("Flux of " + this->to_string() + " at " + t.AsDate().to_string() + " is not finite");
-		}
+	if (q_outdated(t)) {
+		store_q(calc_q(t), t);
+	}
+	return m_q;
+}
+
+real flux_connection::store_q( real new_q, cmf::math::Time t )
+{
+	m_q = new_q;
+	if (!std::isfinite(m_q)) {
+		throw std::runtime_error("Flux of " + this->to_string() + " at " + t.AsDate().to_string() + " is not finite");
 	}
 	return m_q;
 }
@@ -49,11 +53,12 @@ flux_connection::~flux_connection()
 }
 
 flux_connection::flux_connection( flux_node::ptr left,flux_node::ptr right,std::string _type ) 
-: m_left(left),m_right(right),RecalcAlways(false),type(_type),connection_id(nextconnectionid++),m_tracer_filter(1.0)
+: m_left(left),m_right(right),m_left_raw(left.get()),m_right_raw(right.get()),RecalcAlways(false),type(_type),connection_id(nextconnectionid++),m_tracer_filter(1.0)
 {
 	if ((!left) || (!right)) 
 		throw std::runtime_error("Can't create " + this->type + " if a node is null");
 	const project& p=left->get_project();
+	++topology_version;
 	left->RegisterConnection(this);
 	right->RegisterConnection(this);
 }
@@ -61,6 +66,7 @@ flux_connection::flux_connection( flux_node::ptr left,flux_node::ptr right,std::
 void flux_connection::exchange_target( flux_node::ptr oldtarget,flux_node::ptr newTarget )
 {
 	flux_connection::ptr This(weak_this);
+	++topology_version;
 	left_node()->DeregisterConnection(this);
 	right_node()->DeregisterConnection(this);
 	if (oldtarget==left_node())
@@ -71,6 +77,8 @@ void flux_connection::exchange_target( flux_node::ptr oldtarget,flux_node::ptr n
 	{
 		m_right = std::weak_ptr<flux_node>(newTarget);
 	}
+	m_left_raw = m_left.lock().get();
+	m_right_raw = m_right.lock().get();
 	left_node()->RegisterConnection(this);
 	right_node()->RegisterConnection(this);
 	NewNodes();
@@ -125,10 +133,14 @@ bool flux_connection::kill_me()
 	flux_node::ptr 
 		left=left_node(),
 		right=right_node();
+	++topology_version;
 	if (left) 
 		left->DeregisterConnection(this);
 	if (right)
 		right->DeregisterConnection(this);
+	// A node, that is already destroyed, is not referenced any more
+	m_left_raw = left.get();
+	m_right_raw = right.get();
 	return weak_this.use_count() <= 1;
 }
 
@@ -176,6 +188,20 @@ void cmf::water::flux_integrator::reset( cmf::math::Time t )
 	_sum=0.0;
 }
 
+void cmf::water::flux_integrator::write_checkpoint( std::ostream& out ) const
+{
+	cmf::math::write_binary(out, _sum);
+	cmf::math::write_binary(out, _start_time.AsMilliseconds());
+	cmf::math::write_binary(out, _t.AsMilliseconds());
+}
+
+void cmf::water::flux_integrator::read_checkpoint( std::istream& in )
+{
+	_sum = cmf::math::read_binary<double>(in);
+	_start_time = cmf::math::Time(cmf::math::read_binary<long long>(in));
+	_t = cmf::math::Time(cmf::math::read_binary<long long>(in));
+}
+
 flux_connection::ptr cmf::water::flux_integrator::connection() const
 {
 	return _connection.lock();
@@ -31,6 +31,7 @@
 namespace cmf {
 	class project;
 	namespace water {
+		class flux_kernel;
 
 		/// @defgroup connections Flux connections
 		///
@@ -48,13 +49,20 @@ namespace cmf {
 		private:
 			friend class flux_node;
 			friend class flux_integrator;
+			friend class flux_graph;
+			friend class flux_kernel;
 			static int nextconnectionid;
+			// Incremented whenever a connection is created, deleted or redirected
+			static size_t topology_version;
 			flux_connection(const flux_connection& copy):connection_id(nextconnectionid) {
 				throw std::runtime_error("Never copy construct a flux_connection");
 			}
 			std::weak_ptr<flux_connection> weak_this;
 			weak_flux_node_ptr m_left;
 			weak_flux_node_ptr m_right;
+			// Raw pointers to the nodes for the flux calculation, kept in sync with m_left and m_right
+			flux_node* m_left_raw;
+			flux_node* m_right_raw;
 			real m_tracer_filter;
 			std::map < cmf::water::solute, real > m_tracer_filter_map;
 		protected:
@@ -63,14 +71,47 @@ namespace cmf {
 			virtual real calc_q(cmf::math::Time t) = 0;
 			real m_q; // Positive q means flux left to right
 			real q(cmf::math::Time t);
+			/// True, if the cached flux m_q needs to be recalculated at time t
+			bool q_outdated(cmf::math::Time t) {
+#ifndef NOQCACHE
+				return RecalcAlways || m_left_raw->RecalcFluxes(t) || m_right_raw->RecalcFluxes(t);
+#else
+				return true;
+#endif
+			}
+			/// Stores a newly calculated flux in m_q. Throws if the flux is not finite
+			real store_q(real new_q, cmf::math::Time t);
 			double prevent_negative_volume(double flow) {
 				real empty = 1.0;
 				if (flow>0)
-					empty=left_node()->is_empty();
+					empty=m_left_raw->is_empty();
 				else
-					empty=right_node()->is_empty();
+					empty=m_right_raw->is_empty();
 				return flow * (1 - empty);
 			}
+			/// @brief Calculates the partial derivatives of the flux for the water volume of the left and the right node
+			///
+			/// The potential of a node, which is not a water storage, is constant. Connections sharing their calculation 
+			/// are never asked for derivatives (see flux_graph::copy_dq_dV)
+			/// @returns false, if the connection has no analytic derivatives (default) or if they are not defined for the 
+			/// actual state. The Jacobian is then approximated by finite differences
+			virtual bool calc_dq_dV(cmf::math::Time t, real& dq_dVleft, real& dq_dVright) {
+				return false;
+			}
+			/// @brief Applies prevent_negative_volume(flow) to the derivatives of the flow
+			///
+			/// Returns false, if the source of the flow is partially empty, since the limitation depends on its volume
+			bool prevent_negative_volume(real flow, real& dq_dVleft, real& dq_dVright) {
+				real empty = flow>0 ? m_left_raw->is_empty() : m_right_raw->is_empty();
+				if (empty > 0.0 && empty < 1.0) return false;
+				dq_dVleft *= 1 - empty;
+				dq_dVright *= 1 - empty;
+				return true;
+			}
+			/// @brief Returns the left node without locking. For the flux calculation only, where the node is known to exist
+			flux_node* left_raw() const {return m_left_raw;}
+			/// @brief Returns the right node without locking. For the flux calculation only, where the node is known to exist
+			flux_node* right_raw() const {return m_right_raw;}
 
 
 		public:
@@ -108,8 +149,8 @@ namespace cmf {
 			
 			/// Returns the current flux through a connection. Negative signs mean out of the inquirer, positive are inflows to the inquirer
 			real q(const flux_node& inquirer,cmf::math::Time t) {
-				return inquirer==*left_node() ? -q(t) 
-					: inquirer==*right_node() ? q(t) : 0;  
+				return &inquirer==m_left_raw ? -q(t) 
+					: &inquirer==m_right_raw ? q(t) : 0;  
 			}
 			
 			/// @brief Returns the concentration of the flux. 
@@ -148,8 +189,62 @@ namespace cmf {
 			virtual bool is_waterbalance_source(const flux_node& inquirer) {
 			    return false;
 			}
+#ifndef SWIG
+			/// @brief Returns an object, whose state is shared by the flux calculation of several connections, or 0 for independent connections
+			///
+			/// Connections returning the same object, and connections touching a node returned by another connection,
+			/// are never calculated concurrently by cmf::water::flux_graph. Override this, if calc_q changes an object
+			/// shared with other connections or queries the fluxes of other connections.
+			virtual const void* get_shared_calculation() const {
+				return 0;
+			}
+			/// @brief Returns a kernel to calculate many connections of this type at once, or 0 if the connection is calculated alone
+			///
+			/// Only connections of exactly the type the kernel was made for may return it, since the kernel
+			/// may bypass the virtual functions of the connection.
+			virtual const flux_kernel* get_kernel() const {
+				return 0;
+			}
+#endif
 			virtual ~flux_connection();
 		};
+#ifndef SWIG
+		/// @ingroup connections
+		/// @brief Calculates the fluxes of many connections of one type in a single call
+		///
+		/// cmf::water::flux_graph collects independent connections returning the same kernel 
+		/// (see flux_connection::get_kernel) and passes them in batches to calc_q. A kernel
+		/// knows the concrete type of the connections and can evaluate them in tight loops over
+		/// packed arrays, instead of one virtual calc_q call per connection. The result for each 
+		/// connection must be the same as returned by flux_connection::q.
+		class flux_kernel {
+		protected:
+			/// True, if the flux of the connection needs to be recalculated
+			static bool is_outdated(flux_connection& con, cmf::math::Time t) {
+				return con.q_outdated(t);
+			}
+			/// The last calculated flux of the connection
+			static real cached_q(const flux_connection& con) {
+				return con.m_q;
+			}
+			/// Stores the new flux of the connection. Throws if the flux is not finite
+			static real store_q(flux_connection& con, real q, cmf::math::Time t) {
+				return con.store_q(q, t);
+			}
+			/// Sets the flux to zero, if the source of the flux is empty
+			static real prevent_negative_volume(flux_connection& con, real flow) {
+				return con.prevent_negative_volume(flow);
+			}
+		public:
+			/// @brief Calculates the fluxes of n connections
+			/// @param t Time of the calculation
+			/// @param connections n connections returning this kernel from get_kernel
+			/// @param q Array of size n for the fluxes
+			/// @param n Number of connections
+			virtual void calc_q(cmf::math::Time t, flux_connection* const* connections, real* q, size_t n) const=0;
+			virtual ~flux_kernel() {}
+		};
+#endif
 
 		int replace_node(cmf::water::flux_node::ptr oldnode,cmf::water::flux_node::ptr newnode);
 		
@@ -229,6 +324,10 @@ namespace cmf {
 			flux_connection::ptr connection() const;
 			/// @brief Integrates the flux a timestep further. Note: until is an absolute time. If until is before t0, the integration is initilized again
 			void integrate(cmf::math::Time until);
+#ifndef SWIG
+			void write_checkpoint(std::ostream& out) const;
+			void read_checkpoint(std::istream& in);
+#endif
 			/// @brief Creates a flux_integrator from an connection
 			flux_integrator(cmf::water::flux_connection& connection);
 			/// @brief Creates a flux_integrator from the endpoints of a connection. Throws if there is no connection between the endpoints
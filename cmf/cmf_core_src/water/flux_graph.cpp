@@ -0,0 +1,496 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#include "flux_graph.h"
+#include <map>
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+
+using namespace cmf::water;
+
+namespace {
+	// Returns the representative of a set of connections (union-find with path halving)
+	size_t find_group(std::vector<size_t>& parent, size_t e) {
+		while (parent[e] != e) {
+			parent[e] = parent[parent[e]];
+			e = parent[e];
+		}
+		return e;
+	}
+	// Joins the sets of two connections. The smaller index represents the set, to keep the order deterministic
+	void join_groups(std::vector<size_t>& parent, size_t a, size_t b) {
+		a = find_group(parent, a);
+		b = find_group(parent, b);
+		if (a < b) parent[b] = a;
+		else if (b < a) parent[a] = b;
+	}
+}
+
+flux_graph::flux_graph( const state_vector& states )
+: m_topology_version(flux_connection::topology_version)
+{
+	// Find the position of each water storage in the state vector
+	std::map<const flux_node*, ptrdiff_t> node_index;
+	m_storage_slot.assign(states.size(), -1);
+	for (ptrdiff_t i = 0; i < (ptrdiff_t)states.size(); ++i)
+	{
+		WaterStorage* ws = dynamic_cast<WaterStorage*>(states[i].get());
+		if (ws) {
+			node_index[ws] = i;
+			m_storage_slot[i] = m_storages.size();
+			m_storage_index.push_back(i);
+			m_storages.push_back(ws);
+		} else {
+			m_other_index.push_back(i);
+			m_others.push_back(states[i].get());
+		}
+	}
+	// Solute storages of water storages in the graph are calculated with the fluxes of the graph
+	std::vector< std::vector<ptrdiff_t> > solutes_of_storage(m_storages.size());
+	std::vector<ptrdiff_t> other_index;
+	std::vector<cmf::math::StateVariable*> others;
+	for (size_t k = 0; k < m_others.size(); ++k)
+	{
+		SoluteStorage* ss = dynamic_cast<SoluteStorage*>(m_others[k]);
+		std::map<const flux_node*, ptrdiff_t>::const_iterator water = 
+			ss ? node_index.find(ss->m_water) : node_index.end();
+		if (water != node_index.end()) {
+			solutes_of_storage[m_storage_slot[water->second]].push_back(m_other_index[k]);
+		} else {
+			other_index.push_back(m_other_index[k]);
+			others.push_back(m_others[k]);
+		}
+	}
+	m_other_index.swap(other_index);
+	m_others.swap(others);
+	m_solute_start.push_back(0);
+	for (size_t i = 0; i < m_storages.size(); ++i)
+	{
+		for (size_t k = 0; k < solutes_of_storage[i].size(); ++k)
+		{
+			ptrdiff_t index = solutes_of_storage[i][k];
+			SoluteStorage* ss = static_cast<SoluteStorage*>(states[index].get());
+			m_solute_storages.push_back(ss);
+			m_solute_index.push_back(index);
+			if (m_solutes.size() <= ss->Solute.Id) m_solutes.resize(ss->Solute.Id + 1, 0);
+			m_solutes[ss->Solute.Id] = &ss->Solute;
+		}
+		m_solute_start.push_back(m_solute_storages.size());
+	}
+
+	// Collect each connection of the storages once. The order is given by the order of
+	// the state vector and the connection map of each storage, hence it is deterministic
+	std::set<const flux_connection*> visited;
+	for (size_t i = 0; i < m_storages.size(); ++i)
+	{
+		const flux_node::ConnectionMap& connections = m_storages[i]->m_Connections;
+		for (flux_node::ConnectionMap::const_iterator it = connections.begin(); it != connections.end(); ++it)
+		{
+			const flux_connection::ptr& con = it->second;
+			if (!visited.insert(con.get()).second) continue;
+			std::map<const flux_node*, ptrdiff_t>::const_iterator
+				left = node_index.find(con->left_node().get()),
+				right = node_index.find(con->right_node().get());
+			m_connections.push_back(con);
+			m_left.push_back(left == node_index.end() ? -1 : left->second);
+			m_right.push_back(right == node_index.end() ? -1 : right->second);
+		}
+	}
+	size_t edges = m_connections.size();
+	m_flux.assign(edges, 0.0);
+	for (size_t e = 0; e < edges; ++e) {
+		m_left_slot.push_back(m_left[e] >= 0 ? m_storage_slot[m_left[e]] : -1);
+		m_right_slot.push_back(m_right[e] >= 0 ? m_storage_slot[m_right[e]] : -1);
+		if (m_left_slot[e] < 0 || m_right_slot[e] < 0) m_boundary_edge.push_back(e);
+	}
+	m_storage_conc.assign(m_storages.size() * m_solutes.size(), 0.0);
+	m_connection_conc.assign(edges * m_solutes.size(), 0.0);
+	m_solute_inflow.assign(m_solute_storages.size(), 0.0);
+	m_solute_outflow.assign(m_solute_storages.size(), 0.0);
+
+	// Gather lists: the connections of each storage in the order of the connections
+	m_gather_start.assign(m_storages.size() + 1, 0);
+	for (size_t e = 0; e < edges; ++e) {
+		if (m_left[e] >= 0) ++m_gather_start[m_storage_slot[m_left[e]] + 1];
+		if (m_right[e] >= 0) ++m_gather_start[m_storage_slot[m_right[e]] + 1];
+	}
+	for (size_t i = 0; i < m_storages.size(); ++i)
+		m_gather_start[i + 1] += m_gather_start[i];
+	m_gather_edge.resize(m_gather_start.back());
+	m_gather_sign.resize(m_gather_start.back());
+	std::vector<size_t> fill(m_gather_start.begin(), m_gather_start.end() - 1);
+	for (size_t e = 0; e < edges; ++e) {
+		if (m_left[e] >= 0) {
+			size_t k = fill[m_storage_slot[m_left[e]]]++;
+			m_gather_edge[k] = e;
+			m_gather_sign[k] = -1.0;
+		}
+		if (m_right[e] >= 0) {
+			size_t k = fill[m_storage_slot[m_right[e]]]++;
+			m_gather_edge[k] = e;
+			m_gather_sign[k] = 1.0;
+		}
+	}
+
+	// Group connections sharing a calculation. Connections touching a node, that is 
+	// used as a shared calculation by another connection, join the group of that node.
+	std::vector<size_t> parent(edges);
+	for (size_t e = 0; e < edges; ++e) parent[e] = e;
+	std::map<const void*, size_t> shared;
+	for (size_t e = 0; e < edges; ++e) {
+		const void* key = m_connections[e]->get_shared_calculation();
+		if (key) {
+			std::map<const void*, size_t>::iterator it = shared.find(key);
+			if (it == shared.end()) shared[key] = e;
+			else join_groups(parent, it->second, e);
+		}
+	}
+	for (size_t e = 0; e < edges; ++e) {
+		const void* nodes[2] = {m_connections[e]->left_node().get(), m_connections[e]->right_node().get()};
+		for (int n = 0; n < 2; ++n) {
+			std::map<const void*, size_t>::const_iterator it = shared.find(nodes[n]);
+			if (it != shared.end()) join_groups(parent, it->second, e);
+		}
+	}
+	std::vector<size_t> group_size(edges, 0);
+	for (size_t e = 0; e < edges; ++e)
+		++group_size[find_group(parent, e)];
+	for (size_t e = 0; e < edges; ++e)
+		m_independent.push_back(group_size[find_group(parent, e)] == 1);
+	// Connections not sharing their calculation are batched by their kernel
+	std::vector<const flux_kernel*> kernels;
+	std::map<const flux_kernel*, std::vector<size_t> > batches;
+	std::vector<ptrdiff_t> group_of_root(edges, -1);
+	std::vector<ptrdiff_t> group_of_edge(edges, -1);
+	size_t groups = 0;
+	for (size_t e = 0; e < edges; ++e) {
+		size_t root = find_group(parent, e);
+		const flux_kernel* kernel = group_size[root] == 1 ? m_connections[e]->get_kernel() : 0;
+		if (kernel) {
+			std::vector<size_t>& batch = batches[kernel];
+			if (batch.empty()) kernels.push_back(kernel);
+			batch.push_back(e);
+		} else {
+			if (group_of_root[root] < 0) group_of_root[root] = groups++;
+			group_of_edge[e] = group_of_root[root];
+		}
+	}
+	m_group_start.assign(groups + 1, 0);
+	for (size_t e = 0; e < edges; ++e)
+		if (group_of_edge[e] >= 0) ++m_group_start[group_of_edge[e] + 1];
+	for (size_t g = 0; g < groups; ++g)
+		m_group_start[g + 1] += m_group_start[g];
+	m_group_edge.resize(m_group_start.back());
+	fill.assign(m_group_start.begin(), m_group_start.end() - 1);
+	for (size_t e = 0; e < edges; ++e)
+		if (group_of_edge[e] >= 0) m_group_edge[fill[group_of_edge[e]]++] = e;
+	// The batches are split into chunks, to share them between threads
+	const size_t chunk_size = 256;
+	for (size_t k = 0; k < kernels.size(); ++k) {
+		const std::vector<size_t>& batch = batches[kernels[k]];
+		for (size_t i = 0; i < batch.size(); ++i) {
+			if (i % chunk_size == 0) {
+				m_chunk_start.push_back(m_batch_edge.size());
+				m_chunk_kernel.push_back(kernels[k]);
+			}
+			m_batch_edge.push_back(batch[i]);
+			m_batch_connection.push_back(m_connections[batch[i]].get());
+		}
+	}
+	m_chunk_start.push_back(m_batch_edge.size());
+	m_batch_flux.assign(m_batch_edge.size(), 0.0);
+}
+
+void flux_graph::calc_connection_conc( cmf::math::Time t, size_t e ) const
+{
+	const size_t solutes = m_solutes.size();
+	const flux_connection& con = *m_connections[e];
+	real q = m_flux[e];
+	ptrdiff_t source_slot = q > 0 ? m_left_slot[e] : m_right_slot[e];
+	const flux_node* source = q > 0 ? con.m_left_raw : con.m_right_raw;
+	for (size_t s = 0; s < solutes; ++s)
+	{
+		if (!m_solutes[s]) continue;
+		real c = source_slot >= 0 ? m_storage_conc[source_slot * solutes + s] : source->conc(t, *m_solutes[s]);
+		real filter = 1.0;
+		if (!con.m_tracer_filter_map.empty()) {
+			std::map<solute, real>::const_iterator it = con.m_tracer_filter_map.find(*m_solutes[s]);
+			if (it != con.m_tracer_filter_map.end()) filter = it->second;
+		}
+		m_connection_conc[e * solutes + s] = c * (filter * con.m_tracer_filter);
+	}
+}
+
+void flux_graph::copy_solute_dxdt( cmf::math::Time t, real * dxdt, real factor, bool use_OpenMP ) const
+{
+	const ptrdiff_t solutes = m_solutes.size();
+	// Phase 3: The concentrations of the water storages
+	#pragma omp parallel for if(use_OpenMP)
+	for (ptrdiff_t i = 0; i < (ptrdiff_t)m_storages.size(); ++i)
+	{
+		for (ptrdiff_t s = 0; s < solutes; ++s)
+			if (m_solutes[s]) m_storage_conc[i * solutes + s] = m_storages[i]->conc(t, *m_solutes[s]);
+	}
+	// Phase 4: The concentration of each flux is the concentration of its source, filtered by the connection
+	// (see flux_connection::conc). Fluxes from water storages of the graph are calculated in parallel
+	#pragma omp parallel for if(use_OpenMP)
+	for (ptrdiff_t e = 0; e < (ptrdiff_t)edge_count(); ++e)
+	{
+		real q = m_flux[e];
+		ptrdiff_t source_slot = q > 0 ? m_left_slot[e] : m_right_slot[e];
+		if (q != 0.0 && source_slot >= 0)
+			calc_connection_conc(t, e);
+	}
+	// Other nodes (eg. a flux_node mixing its inflows) may recalculate fluxes to get their concentration, 
+	// hence these connections are calculated in sequence
+	for (size_t k = 0; k < m_boundary_edge.size(); ++k)
+	{
+		size_t e = m_boundary_edge[k];
+		real q = m_flux[e];
+		ptrdiff_t source_slot = q > 0 ? m_left_slot[e] : m_right_slot[e];
+		if (q != 0.0 && source_slot < 0)
+			calc_connection_conc(t, e);
+	}
+	// Phase 5: Each water storage sums the matter fluxes of all its solutes in one pass over its connections
+	#pragma omp parallel for if(use_OpenMP)
+	for (ptrdiff_t i = 0; i < (ptrdiff_t)m_storages.size(); ++i)
+	{
+		size_t first = m_solute_start[i], last = m_solute_start[i + 1];
+		if (first == last) continue;
+		for (size_t r = first; r < last; ++r) 
+			m_solute_inflow[r] = m_solute_outflow[r] = 0.0;
+		for (size_t k = m_gather_start[i]; k < m_gather_start[i + 1]; ++k)
+		{
+			size_t e = m_gather_edge[k];
+			real q = m_gather_sign[k] * m_flux[e];
+			const real* c = &m_connection_conc[e * solutes];
+			if (q > 0) {
+				for (size_t r = first; r < last; ++r)
+					m_solute_inflow[r] += q * c[m_solute_storages[r]->Solute.Id];
+			} else if (q < 0) {
+				for (size_t r = first; r < last; ++r)
+					m_solute_outflow[r] += q * c[m_solute_storages[r]->Solute.Id];
+			}
+		}
+		// Same as SoluteStorage::dxdt
+		for (size_t r = first; r < last; ++r)
+		{
+			const SoluteStorage& ss = *m_solute_storages[r];
+			real source_term = ss.source;
+			real decay_term = ss.get_state() * ss.decay;
+			dxdt[m_solute_index[r]] = (m_solute_inflow[r] + m_solute_outflow[r] + source_term - decay_term) * factor;
+		}
+	}
+}
+
+void flux_graph::get_sparsity( std::vector<size_t>& row_start, std::vector<size_t>& columns ) const
+{
+	size_t edges = edge_count();
+	size_t states = m_storages.size() + m_solute_storages.size() + m_others.size();
+	// The states each connection depends on: the ends of all connections of its group
+	std::vector<ptrdiff_t> group_of_edge(edges, -1);
+	std::vector< std::vector<size_t> > group_states(group_count());
+	for (size_t g = 0; g < group_count(); ++g) {
+		for (size_t k = m_group_start[g]; k < m_group_start[g + 1]; ++k) {
+			size_t e = m_group_edge[k];
+			group_of_edge[e] = g;
+			if (m_left[e] >= 0) group_states[g].push_back(m_left[e]);
+			if (m_right[e] >= 0) group_states[g].push_back(m_right[e]);
+		}
+	}
+	std::vector< std::vector<size_t> > rows(states);
+	for (size_t i = 0; i < m_storages.size(); ++i)
+	{
+		std::vector<size_t>& row = rows[m_storage_index[i]];
+		row.push_back(m_storage_index[i]);
+		for (size_t k = m_gather_start[i]; k < m_gather_start[i + 1]; ++k) {
+			size_t e = m_gather_edge[k];
+			if (group_of_edge[e] >= 0) {
+				const std::vector<size_t>& dep = group_states[group_of_edge[e]];
+				row.insert(row.end(), dep.begin(), dep.end());
+			} else {
+				if (m_left[e] >= 0) row.push_back(m_left[e]);
+				if (m_right[e] >= 0) row.push_back(m_right[e]);
+			}
+		}
+		std::sort(row.begin(), row.end());
+		row.erase(std::unique(row.begin(), row.end()), row.end());
+	}
+	// Position of the solute storages by water storage and solute
+	std::vector<ptrdiff_t> solute_state(m_storages.size() * m_solutes.size(), -1);
+	for (size_t i = 0; i < m_storages.size(); ++i)
+		for (size_t r = m_solute_start[i]; r < m_solute_start[i + 1]; ++r)
+			solute_state[i * m_solutes.size() + m_solute_storages[r]->Solute.Id] = m_solute_index[r];
+	// The concentration of a node, that is not a water storage, may depend on all water storages 
+	// connected to it directly or through other nodes (see flux_node::conc)
+	std::map<const flux_node*, size_t> slot_of_node;
+	for (size_t i = 0; i < m_storages.size(); ++i)
+		slot_of_node[m_storages[i]] = i;
+	std::map<const flux_node*, std::vector<size_t> > upstream;
+	for (size_t i = 0; i < m_storages.size(); ++i)
+	{
+		if (m_solute_start[i] == m_solute_start[i + 1]) continue;
+		// The water storages, whose concentration is used by the connections of storage i
+		std::vector<size_t> sources(1, i);
+		for (size_t k = m_gather_start[i]; k < m_gather_start[i + 1]; ++k) {
+			size_t e = m_gather_edge[k];
+			const flux_node* nodes[2] = {m_connections[e]->m_left_raw, m_connections[e]->m_right_raw};
+			for (int n = 0; n < 2; ++n) {
+				std::map<const flux_node*, size_t>::const_iterator slot = slot_of_node.find(nodes[n]);
+				if (slot != slot_of_node.end()) {
+					sources.push_back(slot->second);
+					continue;
+				}
+				if (!upstream.count(nodes[n])) {
+					std::vector<size_t>& found = upstream[nodes[n]];
+					std::set<const flux_node*> visited;
+					std::vector<const flux_node*> queue(1, nodes[n]);
+					visited.insert(nodes[n]);
+					while (!queue.empty()) {
+						const flux_node* node = queue.back();
+						queue.pop_back();
+						for (flux_node::ConnectionMap::const_iterator it = node->m_Connections.begin(); it != node->m_Connections.end(); ++it) {
+							const flux_node* other = it->second->m_left_raw == node ? it->second->m_right_raw : it->second->m_left_raw;
+							std::map<const flux_node*, size_t>::const_iterator other_slot = slot_of_node.find(other);
+							if (other_slot != slot_of_node.end()) 
+								found.push_back(other_slot->second);
+							else if (visited.insert(other).second)
+								queue.push_back(other);
+						}
+					}
+				}
+				const std::vector<size_t>& found = upstream[nodes[n]];
+				sources.insert(sources.end(), found.begin(), found.end());
+			}
+		}
+		std::sort(sources.begin(), sources.end());
+		sources.erase(std::unique(sources.begin(), sources.end()), sources.end());
+		for (size_t r = m_solute_start[i]; r < m_solute_start[i + 1]; ++r)
+		{
+			std::vector<size_t>& row = rows[m_solute_index[r]];
+			row = rows[m_storage_index[i]];
+			row.push_back(m_solute_index[r]);
+			size_t id = m_solute_storages[r]->Solute.Id;
+			for (size_t k = 0; k < sources.size(); ++k) {
+				row.push_back(m_storage_index[sources[k]]);
+				if (solute_state[sources[k] * m_solutes.size() + id] >= 0)
+					row.push_back(solute_state[sources[k] * m_solutes.size() + id]);
+			}
+			std::sort(row.begin(), row.end());
+			row.erase(std::unique(row.begin(), row.end()), row.end());
+		}
+	}
+	for (size_t i = 0; i < m_others.size(); ++i)
+		rows[m_other_index[i]].push_back(m_other_index[i]);
+	row_start.assign(1, 0);
+	columns.clear();
+	for (size_t i = 0; i < states; ++i) {
+		columns.insert(columns.end(), rows[i].begin(), rows[i].end());
+		row_start.push_back(columns.size());
+	}
+}
+
+void flux_graph::copy_dq_dV( cmf::math::Time t, real * dq_dleft, real * dq_dright, char * available, bool use_OpenMP ) const
+{
+	std::string err_msg;
+	bool err=false;
+	#pragma omp parallel for if(use_OpenMP)
+	for (ptrdiff_t e = 0; e < (ptrdiff_t)edge_count(); ++e)
+	{
+		#pragma omp flush(err)
+		if (!err) {
+			try {
+				dq_dleft[e] = dq_dright[e] = 0.0;
+				available[e] = m_independent[e] && m_connections[e]->calc_dq_dV(t, dq_dleft[e], dq_dright[e]);
+			} catch(std::exception& ex) {
+				#pragma omp critical
+				{
+					err_msg = ex.what();
+					err = true;
+				}
+				#pragma omp flush(err)
+			}
+		}
+	}
+	if (err) {
+		throw std::runtime_error(err_msg);
+	}
+}
+
+bool flux_graph::is_valid() const
+{
+	return m_topology_version == flux_connection::topology_version;
+}
+
+void flux_graph::copy_dxdt( cmf::math::Time t, real * dxdt, real factor, bool use_OpenMP ) const
+{
+	std::string err_msg;
+	bool err=false;
+	// Phase 1: Calculate each flux once. Each group of connections and each chunk of 
+	// connections with a kernel is calculated by one thread
+	ptrdiff_t groups = group_count();
+	#pragma omp parallel for schedule(dynamic) if(use_OpenMP)
+	for (ptrdiff_t g = 0; g < groups + (ptrdiff_t)chunk_count(); ++g)
+	{
+		#pragma omp flush(err)
+		if (!err) {
+			try {
+				if (g < groups) {
+					for (size_t k = m_group_start[g]; k < m_group_start[g + 1]; ++k) {
+						size_t e = m_group_edge[k];
+						m_flux[e] = m_connections[e]->q(t);
+					}
+				} else {
+					size_t 
+						begin = m_chunk_start[g - groups],
+						end = m_chunk_start[g - groups + 1];
+					m_chunk_kernel[g - groups]->calc_q(t, &m_batch_connection[begin], &m_batch_flux[begin], end - begin);
+					for (size_t k = begin; k < end; ++k)
+						m_flux[m_batch_edge[k]] = m_batch_flux[k];
+				}
+			} catch(std::exception& e) {
+				#pragma omp critical
+				{
+					err_msg = e.what();
+					err = true;
+				}
+				#pragma omp flush(err)
+			}
+		}
+	}
+	if (err) {
+		throw std::runtime_error(err_msg);
+	}
+	// Phase 2: Sum the fluxes of each storage in a fixed order
+	#pragma omp parallel for if(use_OpenMP)
+	for (ptrdiff_t i = 0; i < (ptrdiff_t)m_storages.size(); ++i)
+	{
+		real dVdt = 0.0;
+		for (size_t k = m_gather_start[i]; k < m_gather_start[i + 1]; ++k)
+			dVdt += m_gather_sign[k] * m_flux[m_gather_edge[k]];
+		dxdt[m_storage_index[i]] = m_storages[i]->dxdt_from_waterbalance(dVdt) * factor;
+	}
+	if (!m_solute_storages.empty()) {
+		copy_solute_dxdt(t, dxdt, factor, use_OpenMP);
+	}
+	// The remaining states (eg. solutes) calculate their derivatives themselves. Since they are querying
+	// the fluxes of their water storage, they are calculated in sequence to keep the flux caches consistent
+	for (size_t i = 0; i < m_others.size(); ++i)
+	{
+		dxdt[m_other_index[i]] = m_others[i]->dxdt(t) * factor;
+	}
+}
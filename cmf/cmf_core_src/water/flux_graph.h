@@ -0,0 +1,178 @@
+// Copyright 2010 by Philipp Kraft
+// This file is part of cmf.
+//
+//   cmf is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   cmf is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with cmf.  If not, see <http://www.gnu.org/licenses/>.
+//
+#ifndef flux_graph_h__
+#define flux_graph_h__
+#include "../math/statevariable.h"
+#include "../math/time.h"
+#include "../math/real.h"
+#include "flux_connection.h"
+#include "WaterStorage.h"
+#include <vector>
+
+namespace cmf {
+	namespace water {
+
+		/// @ingroup connections
+		/// @brief A flattened ("compiled") representation of the connections between the state variables of a solver
+		///
+		/// The default right hand side of a solver calls WaterStorage::dxdt for each storage, which walks the
+		/// connection map of the node. Since every connection is reached from both ends, each flux is
+		/// requested twice. The flux_graph stores the connections touching the water storages of a state vector
+		/// once in contiguous arrays (left state index, right state index, connection) and calculates
+		/// the derivatives of the water storages with a single pass over the connections.
+		///
+		/// The evaluation is done in two phases: First all fluxes are calculated into an array, where
+		/// connections sharing a calculation (see flux_connection::get_shared_calculation) are grouped
+		/// and the groups are calculated in parallel. Second, the derivative of each storage is summed
+		/// from the flux array in a fixed order. Hence, the shared flux caches are never written 
+		/// concurrently and the result does not depend on the number of threads.
+		///
+		/// Independent connections providing a flux_kernel are not calculated one by one, but in chunks
+		/// of connections of the same type, by the kernel of the type.
+		///
+		/// The solute storages of the water storages in the graph are calculated in the same manner: After 
+		/// the water fluxes, the concentration of each flux is calculated once for all solutes and each 
+		/// solute storage sums the fluxes of its water storage. Other state variables are still calculated by
+		/// their own dxdt function.
+		///
+		/// The graph reflects the topology at the time of creation. If connections are created,
+		/// deleted or redirected afterwards, is_valid returns false and the graph needs to be rebuilt.
+		/// cmf::math::Integrator takes care of that, when cmf::math::Integrator::use_flux_graph is true.
+		class flux_graph {
+		public:
+			typedef std::shared_ptr<flux_graph> ptr;
+			typedef std::vector<cmf::math::StateVariable::ptr> state_vector;
+		private:
+			/// Keeps the connections alive
+			std::vector<flux_connection::ptr> m_connections;
+			/// Position of the left node of each connection in the state vector, -1 if the node is not a state
+			std::vector<ptrdiff_t> m_left;
+			/// Position of the right node of each connection in the state vector, -1 if the node is not a state
+			std::vector<ptrdiff_t> m_right;
+			/// Position and storage of the water storages in the state vector
+			std::vector<ptrdiff_t> m_storage_index;
+			std::vector<WaterStorage*> m_storages;
+			/// Position of all other state variables
+			std::vector<ptrdiff_t> m_other_index;
+			std::vector<cmf::math::StateVariable*> m_others;
+			/// Position of the left and right node of each connection in m_storages, -1 if the node is not a water storage of the graph
+			std::vector<ptrdiff_t> m_left_slot;
+			std::vector<ptrdiff_t> m_right_slot;
+			/// Connections with a node, which is not a water storage of the graph
+			std::vector<size_t> m_boundary_edge;
+			/// Connections not sharing their calculation with other connections
+			std::vector<char> m_independent;
+			/// Position of each state in m_storages, -1 if the state is not a water storage
+			std::vector<ptrdiff_t> m_storage_slot;
+			/// The solute storages of each water storage (compressed rows), with their position in the state vector
+			std::vector<size_t> m_solute_start;
+			std::vector<SoluteStorage*> m_solute_storages;
+			std::vector<ptrdiff_t> m_solute_index;
+			/// The solutes of the solute storages by their id, 0 for solutes not in the graph
+			std::vector<const solute*> m_solutes;
+			/// Concentrations of each water storage and of each connection (solutes in the inner dimension)
+			mutable std::vector<real> m_storage_conc;
+			mutable std::vector<real> m_connection_conc;
+			/// Sums of the inflows and outflows of each solute storage
+			mutable std::vector<real> m_solute_inflow;
+			mutable std::vector<real> m_solute_outflow;
+			/// The connections of each storage (compressed rows), with the sign of the flux for the storage
+			std::vector<size_t> m_gather_start;
+			std::vector<size_t> m_gather_edge;
+			std::vector<real> m_gather_sign;
+			/// Groups of connections, which need to be calculated in sequence (compressed rows)
+			std::vector<size_t> m_group_start;
+			std::vector<size_t> m_group_edge;
+			/// Independent connections with a kernel, sorted by kernel and split into chunks (compressed rows)
+			std::vector<size_t> m_chunk_start;
+			std::vector<const flux_kernel*> m_chunk_kernel;
+			std::vector<size_t> m_batch_edge;
+			std::vector<flux_connection*> m_batch_connection;
+			mutable std::vector<real> m_batch_flux;
+			/// The fluxes of the last evaluation
+			mutable std::vector<real> m_flux;
+			/// Topology version at creation time
+			size_t m_topology_version;
+			/// Calculates the derivatives of the solute storages from the fluxes of the last evaluation
+			void copy_solute_dxdt(cmf::math::Time t, real * dxdt, real factor, bool use_OpenMP) const;
+			/// Calculates the concentrations of all solutes in a connection from the flux of the last evaluation
+			void calc_connection_conc(cmf::math::Time t, size_t e) const;
+		public:
+			/// @brief Creates the graph for a state vector. The positions of the states are used as indices in copy_dxdt
+			flux_graph(const state_vector& states);
+			/// @brief Number of connections in the graph
+			size_t edge_count() const {return m_connections.size();}
+			/// @brief Number of water storages in the graph
+			size_t storage_count() const {return m_storages.size();}
+			/// @brief Number of solute storages calculated with the fluxes of the graph
+			size_t solute_storage_count() const {return m_solute_storages.size();}
+			/// @brief Number of groups of connections, that can be calculated concurrently
+			size_t group_count() const {return m_group_start.size() - 1;}
+			/// @brief Number of chunks of connections calculated by a flux_kernel
+			size_t chunk_count() const {return m_chunk_kernel.size();}
+			/// @brief Number of connections calculated by a flux_kernel
+			size_t batched_count() const {return m_batch_edge.size();}
+			/// @brief Returns the connection at position
+			flux_connection::ptr get_connection(ptrdiff_t position) const {
+				return m_connections.at(position < 0 ? position + edge_count() : position);
+			}
+			/// @brief True, if no connection was created, deleted or redirected since the graph was built
+			bool is_valid() const;
+			/// @brief Returns the sparsity pattern of the Jacobian of the state vector in compressed rows
+			///
+			/// The derivative of a water storage depends on the states at both ends of its connections. If
+			/// a connection shares its calculation with others (see flux_connection::get_shared_calculation), 
+			/// it depends on the ends of all connections of the group. Solute storages depend additionally on
+			/// the water storages and the same solute of the neighbouring storages, including storages connected 
+			/// through nodes, that are not storages. All other states are assumed to depend only on themselves.
+			/// Dependencies not expressed by connections (eg. the saturated depth of a cell) are not detected.
+			/// @param row_start Position of the first column of each row in columns, with size()+1 entries
+			/// @param columns Sorted column (state) indices of each row
+			void get_sparsity(std::vector<size_t>& row_start, std::vector<size_t>& columns) const;
+			/// @brief Position of the left node of a connection in the state vector, -1 if the node is not a state
+			ptrdiff_t left_index(size_t position) const {return m_left[position];}
+			/// @brief Position of the right node of a connection in the state vector, -1 if the node is not a state
+			ptrdiff_t right_index(size_t position) const {return m_right[position];}
+			/// @brief True, if the flux of a connection depends only on the nodes of the connection
+			bool is_independent(size_t position) const {return m_independent[position] != 0;}
+			/// @brief True, if the state at position is a water storage integrating its volume. 
+			///
+			/// The derivative of such a state is the sum of the fluxes of its connections
+			bool is_volume_state(size_t position) const {
+				return position < m_storage_slot.size() && m_storage_slot[position] >= 0 
+					&& m_storages[m_storage_slot[position]]->get_state_variable_content() == 'V';
+			}
+			/// @brief Calculates the partial derivatives of each flux for the volumes of the nodes of the connection
+			///
+			/// Only independent connections are asked for their derivatives (see flux_connection::calc_dq_dV), since 
+			/// a connection sharing its calculation may depend on other states. The states need to be the same 
+			/// as in the last call of copy_dxdt.
+			/// @param t Time of the derivatives
+			/// @param dq_dleft, dq_dright Allocated arrays of edge_count() for the derivatives of each flux for the volume of the left and right node
+			/// @param available Allocated array of edge_count(), 1 if the derivatives of the connection are calculated, else 0
+			/// @param use_OpenMP If true, the connections are calculated in parallel
+			void copy_dq_dV(cmf::math::Time t, real * dq_dleft, real * dq_dright, char * available, bool use_OpenMP=true) const;
+			/// @brief Calculates the derivatives of all states in the state vector
+			/// @param t Time at which the derivatives should be calculated
+			/// @param dxdt Allocated c array of the size of the state vector
+			/// @param factor A factor that is multiplied to the derivate (e.g. unit conversion or integration length)
+			/// @param use_OpenMP If true, the fluxes and the derivatives of the storages are calculated in parallel
+			void copy_dxdt(cmf::math::Time t, real * dxdt, real factor=1, bool use_OpenMP=true) const;
+		};
+	}
+}
+#endif // flux_graph_h__
@@ -223,6 +223,20 @@ void cmf::water::waterbalance_integrator::integrate( cmf::math::Time until )
 
 }
 
+void cmf::water::waterbalance_integrator::write_checkpoint( std::ostream& out ) const
+{
+	cmf::math::write_binary(out, _sum);
+	cmf::math::write_binary(out, _start_time.AsMilliseconds());
+	cmf::math::write_binary(out, _t.AsMilliseconds());
+}
+
+void cmf::water::waterbalance_integrator::read_checkpoint( std::istream& in )
+{
+	_sum = cmf::math::read_binary<double>(in);
+	_start_time = cmf::math::Time(cmf::math::read_binary<long long>(in));
+	_t = cmf::math::Time(cmf::math::read_binary<long long>(in));
+}
+
 double cmf::water::waterbalance_integrator::avg() const
 {
 	if (_t>_start_time)
@@ -71,6 +71,8 @@ namespace cmf {
 			friend class flux_connection;
 			// allows the waterbalance_integrator to call the water balance without refreshing the connection
 			friend class waterbalance_integrator;
+			// allows the flux_graph to collect the connections of a node
+			friend class flux_graph;
 
 			// The mapping of the connections. The id is holding the node id's
 			typedef std::map<int, con_ptr > ConnectionMap;
@@ -131,6 +133,13 @@ namespace cmf {
 			{
 				return position.z;
 			}
+			/// @brief Returns the derivative of the potential for the stored volume \f$\frac{d\Psi}{dV}\f$ in m/m3
+			///
+			/// Nodes without storage have a potential independent of any volume and return 0
+			virtual real get_dpotential_dV() const
+			{
+				return 0.0;
+			}
             /// @brief Sets the potential of this flux node
 			virtual void set_potential(real new_potential)
 			{
@@ -195,6 +204,10 @@ namespace cmf {
 			}
 			/// Integrates the flux a timestep further. Note: until is an absolut time. If until is before t0, the integration is initilized again
 			void integrate(cmf::math::Time until);
+#ifndef SWIG
+			void write_checkpoint(std::ostream& out) const;
+			void read_checkpoint(std::istream& in);
+#endif
 			waterbalance_integrator(cmf::water::flux_node::ptr node) 
 				:	_node(node), _sum(0.0), _t(cmf::math::year*5000), _name(node->to_string()+ " (Integrator)") {}
 		};
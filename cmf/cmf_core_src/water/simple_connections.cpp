@@ -30,6 +30,15 @@ real cmf::water::kinematic_wave::calc_q(cmf::math::Time t)
 	return pow(V / V0, exponent) / residencetime;
 }
 
+bool cmf::water::kinematic_wave::calc_dq_dV(cmf::math::Time t, real& dq_dVleft, real& dq_dVright)
+{
+	cmf::water::WaterStorage::ptr S = source.lock();
+	real V = S->get_volume() - residual;
+	dq_dVleft = V > 0 ? exponent * pow(V / V0, exponent - 1) / (V0 * residencetime) : 0.0;
+	dq_dVright = 0.0;
+	return true;
+}
+
 
 cmf::water::kinematic_wave::kinematic_wave(WaterStorage::ptr source, flux_node::ptr target,
 	real _traveltime, real _exponent/*=1.0*/,
@@ -47,6 +56,14 @@ real cmf::water::LinearStorageConnection::calc_q(cmf::math::Time t)
 	return V / residencetime;
 }
 
+bool cmf::water::LinearStorageConnection::calc_dq_dV(cmf::math::Time t, real& dq_dVleft, real& dq_dVright)
+{
+	cmf::water::WaterStorage::ptr S = source.lock();
+	dq_dVleft = S->get_volume() > residual ? 1 / residencetime : 0.0;
+	dq_dVright = 0.0;
+	return true;
+}
+
 cmf::water::LinearStorageConnection::LinearStorageConnection(
 	WaterStorage::ptr source, flux_node::ptr target,
 	real _residencetime, real _residual /* = 0.0 */)
@@ -63,6 +80,15 @@ real cmf::water::PowerLawConnection::calc_q(cmf::math::Time t)
 	return Q0 * pow(V / V0, beta);
 }
 
+bool cmf::water::PowerLawConnection::calc_dq_dV(cmf::math::Time t, real& dq_dVleft, real& dq_dVright)
+{
+	cmf::water::WaterStorage::ptr S = source.lock();
+	real V = S->get_volume() - residual;
+	dq_dVleft = V > 0 ? Q0 * beta * pow(V / V0, beta - 1) / V0 : 0.0;
+	dq_dVright = 0.0;
+	return true;
+}
+
 
 cmf::water::PowerLawConnection::PowerLawConnection(WaterStorage::ptr source, flux_node::ptr target,
 	real _Q0, real _V0, real _beta/*=1.0*/,
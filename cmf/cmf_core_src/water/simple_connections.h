@@ -28,6 +28,12 @@ namespace cmf {
 		public:
 			waterbalance_connection(flux_node::ptr source, flux_node::ptr target);
             virtual bool is_waterbalance_source(const flux_node& inquirer);
+#ifndef SWIG
+			/// The flux depends on all other fluxes of the source
+			const void* get_shared_calculation() const {
+				return left_node().get();
+			}
+#endif
 
         };
 
@@ -80,6 +86,7 @@ namespace cmf {
 		protected:
 			std::weak_ptr<WaterStorage> source;
 			real calc_q(cmf::math::Time t);
+			bool calc_dq_dV(cmf::math::Time t, real& dq_dVleft, real& dq_dVright);
 			void NewNodes() {
 				source = WaterStorage::cast(left_node());
 			}
@@ -120,6 +127,7 @@ namespace cmf {
 		protected:
 			std::weak_ptr<WaterStorage> source;
 			real calc_q(cmf::math::Time t);
+			bool calc_dq_dV(cmf::math::Time t, real& dq_dVleft, real& dq_dVright);
 			void NewNodes() {
 				source = WaterStorage::cast(left_node());
 			}
@@ -158,6 +166,7 @@ namespace cmf {
 		protected:
 			std::weak_ptr<WaterStorage> source;
 			real calc_q(cmf::math::Time t);
+			bool calc_dq_dV(cmf::math::Time t, real& dq_dVleft, real& dq_dVright);
 			void NewNodes() {
 				source = WaterStorage::cast(left_node());
 			}
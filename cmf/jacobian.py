@@ -91,3 +91,27 @@ class Jacobian(object):
             # Reset change of S[i]
             self.solver.set_state(i, self.solver.get_state(i) - self.delta)
         return jac
+
+
+def sparse_jacobian(solver, delta=1e-6, t=None):
+    """
+    Calculates the Jacobian J[i,j] = d dxdt[i] / d S[j] of a solver as a sparse matrix
+
+    The sparsity pattern is derived from the connections between the states and the
+    Jacobian is approximated by finite differences with about one evaluation of the
+    right hand side per connected state (see cmf.SparseJacobian)
+
+    :param solver: A cmf integrator
+    :param delta: Relative perturbation of the states
+    :param t: The time of the evaluation, default is the time of the solver
+    :return: The Jacobian as a scipy.sparse.csr_matrix
+    """
+    from scipy.sparse import csr_matrix
+    jac = cmf.SparseJacobian(solver)
+    jac.calculate(solver, solver.t if t is None else t, delta)
+    return csr_matrix(
+        (jac.get_values(),
+         jac.get_columns().astype(int),
+         jac.get_row_start().astype(int)),
+        shape=(jac.size(), jac.size())
+    )
@@ -7,6 +7,9 @@ import cmf
 import unittest
 import sys
 import glob
+import math
+import os
+import tempfile
 
 def get_project(with_solute=False):
     if with_solute:
@@ -25,10 +28,37 @@ def get_project(with_solute=False):
     return p, stores, X
 
 
+def get_cell_project(ncells=5, nlayers=5):
+    """A hillslope of cells with soil layers, draining laterally into an outlet, with a solute in the top layers"""
+    p = cmf.project('X')
+    X, = p.solutes
+    r = cmf.BrooksCoreyRetentionCurve()
+    outlet = p.NewOutlet('outlet', -10, 0, 0)
+    cells = []
+    for i in range(ncells):
+        c = p.NewCell(10 * i, 0, 1 + 0.1 * i, 100)
+        for j in range(nlayers):
+            c.add_layer(0.1 * (j + 1), r)
+        c.install_connection(cmf.Richards)
+        c.saturated_depth = 0.3
+        c.layers[0][X].state = 1.0
+        cells.append(c)
+    for u, l in zip(cells[1:], cells[:-1]):
+        u.topology.AddNeighbor(l, 10)
+    cmf.connect_cells_with_flux(p, cmf.Darcy)
+    for l in cells[0].layers:
+        cmf.Darcy(l, outlet, 10., 10.)
+    return p, cells, X
+
+
 solver_types = [
     cmf.ExplicitEuler_fixed, cmf.RKFIntegrator, cmf.HeunIntegrator,
     cmf.BDF2, cmf.ImplicitEuler,
-    cmf.CVodeIntegrator]
+    cmf.CVodeIntegrator, cmf.IMEXIntegrator, cmf.ROS2,
+    cmf.SteadyStateSolver]
+
+# The last storage of the test chain accumulates the water and has no steady state
+transient_solver_types = [st for st in solver_types if st is not cmf.SteadyStateSolver]
 
 
 class TestSolver(unittest.TestCase):
@@ -70,7 +100,7 @@ class TestSolver(unittest.TestCase):
         smass_ref = [0.9502129, 0.8008517, 0.5768099, 0.3527681, 0.1847368,
                      0.08391794, 0.03350854, 0.0119045, 0.003802992, 0.001486583]
 
-        for st in solver_types:
+        for st in transient_solver_types:
 
             p, stores, X = get_project(True)
 
@@ -91,7 +121,7 @@ class TestSolver(unittest.TestCase):
         vol_ref = [0.04978707, 0.1493612, 0.2240418, 0.2240418, 0.1680314,
                    0.1008188, 0.05040941, 0.02160403, 0.008101512, 0.003802992]
 
-        for st in solver_types:
+        for st in transient_solver_types:
 
             p, stores, X = get_project(False)
 
@@ -104,10 +134,114 @@ class TestSolver(unittest.TestCase):
 
             self.assertAlmostEqual(1 - mse_v, 1, 2, "MSE between reference volume and {} too large".format(st.__name__))
 
+    def test_cvode_sparse_results(self):
+
+        vol_ref = [0.04978707, 0.1493612, 0.2240418, 0.2240418, 0.1680314,
+                   0.1008188, 0.05040941, 0.02160403, 0.008101512, 0.003802992]
+
+        for with_solute in [False, True]:
+            vol = {}
+            for linear_solver in [0, 6]:
+                p, stores, X = get_project(with_solute)
+                solver = cmf.CVodeIntegrator(p, 1e-9)
+                solver.LinearSolver = linear_solver
+                solver(cmf.day * 3, cmf.h)
+                vol[linear_solver] = [s.volume for s in stores]
+            for v, vd, vr in zip(vol[6], vol[0], vol_ref):
+                self.assertAlmostEqual(v, vr, 6, "Sparse CVODE differs from the reference volume")
+                self.assertAlmostEqual(v, vd, 7, "Sparse CVODE differs from dense CVODE")
+
+    def test_cvode_cell_preconditioner(self):
+        def run(linear_solver, preconditioner_matrix):
+            p, cells, X = get_cell_project()
+            solver = cmf.CVodeIntegrator(p, 1e-9)
+            solver.LinearSolver = linear_solver
+            solver.preconditioner_matrix = preconditioner_matrix
+            solver(cmf.day * 10, cmf.day)
+            return [l.volume for c in cells for l in c.layers] + [l[X].state for c in cells for l in c.layers]
+
+        reference = run(0, 'B')
+        for linear_solver in [3, 4, 5]:
+            result = run(linear_solver, 'C')
+            for v, vr in zip(result, reference):
+                self.assertAlmostEqual(v, vr, 6,
+                                       "Block preconditioner with LinearSolver={} differs from the dense solver".format(linear_solver))
+
+    def test_reorder_states(self):
+        def run(reorder):
+            p, cells, X = get_cell_project(ncells=10)
+            solver = cmf.CVodeIntegrator(1e-9)
+            solver.t = cmf.Time()
+            # Layer by layer, the layers of a cell are far apart in the state vector
+            for layers in zip(*[c.layers for c in cells]):
+                solver.add_states(cmf.node_list.from_sequence(layers))
+            bandwidth = solver.get_bandwidth()
+            if reorder:
+                solver.reorder_states()
+                self.assertLess(solver.get_bandwidth(), bandwidth)
+            solver.LinearSolver = 1
+            solver.maxl = solver.get_bandwidth()
+            solver(cmf.day * 10, cmf.day)
+            return [l.volume for c in cells for l in c.layers] + [l[X].state for c in cells for l in c.layers]
+
+        for v, vr in zip(run(True), run(False)):
+            self.assertAlmostEqual(v, vr, 6, "The results change with the order of the states")
+
+    def test_dense_output(self):
+
+        vol_ref = [0.04978707, 0.1493612, 0.2240418, 0.2240418, 0.1680314,
+                   0.1008188, 0.05040941, 0.02160403, 0.008101512, 0.003802992]
+
+        def run(use_dense_output):
+            p, stores, X = get_project(True)
+            solver = cmf.CVodeIntegrator(p, 1e-9)
+            solver.use_dense_output = use_dense_output
+            volume = [stores[-1].volume for t in solver.run(solver.t, cmf.day * 3, cmf.h)]
+            for s, vr in zip(stores, vol_ref):
+                self.assertAlmostEqual(s.volume, vr, 6)
+            return volume, solver.get_rhsevals()
+
+        dense, dense_rhsevals = run(True)
+        stepped, stepped_rhsevals = run(False)
+        self.assertEqual(len(dense), 72)
+        for v, vr in zip(dense, stepped):
+            self.assertAlmostEqual(v, vr, 7, "The interpolated output differs from the output at the stop times")
+        self.assertLess(dense_rhsevals, stepped_rhsevals)
+
+    def test_newton(self):
+        vol_ref = [0.04978707, 0.1493612, 0.2240418, 0.2240418, 0.1680314,
+                   0.1008188, 0.05040941, 0.02160403, 0.008101512, 0.003802992]
+        for st in (cmf.BDF2, cmf.ImplicitEuler):
+            p, stores, X = get_project(False)
+            solver = st(p, 1e-6)
+            solver.use_newton = True
+            self.assertTrue(solver.use_newton)
+            solver(cmf.day * 3, cmf.h)
+            for i, (s, vr) in enumerate(zip(stores, vol_ref)):
+                self.assertAlmostEqual(s.volume, vr, 3, "Volume of storage {} differs for {}".format(i, st.__name__))
+
+    def test_newton_stiff(self):
+        # A fast connection before and after a slow one
+        p = cmf.project()
+        stores = [p.NewStorage('s{}'.format(i)) for i in range(4)]
+        for l, r, residencetime in zip(stores[:-1], stores[1:], [1e-5, 1, 1e-5]):
+            cmf.LinearStorageConnection(l, r, residencetime)
+        for st in (cmf.BDF2, cmf.ImplicitEuler):
+            for s in stores:
+                s.volume = 0
+            stores[0].volume = 1
+            solver = st(p, 1e-6)
+            solver.use_newton = True
+            solver(cmf.day * 3, cmf.h)
+            self.assertAlmostEqual(stores[1].volume, 0.04978707, 3)
+            self.assertAlmostEqual(stores[3].volume, 0.95021293, 3)
+            # The fixed-point iteration converges only for steps below the residence time of 1e-5 days (0.86s)
+            self.assertGreater(solver.dt, 10 * cmf.sec, "Mean time step of {} too small".format(st.__name__))
+
     def test_solver_run(self):
 
 
-        for st in solver_types:
+        for st in transient_solver_types:
 
             p, stores, X = get_project(False)
 
@@ -123,6 +257,351 @@ class TestSolver(unittest.TestCase):
 
             self.assertEqual(solver.t, cmf.day + 100 * cmf.h)
 
+    def test_steady_state(self):
+        # A chain of linear storages with a constant inflow q has the steady state V_i = q * tr_i
+        p = cmf.project()
+        stores = [p.NewStorage('s{}'.format(i)) for i in range(5)]
+        outlet = p.NewOutlet('outlet')
+        residencetimes = [0.5, 1., 2., 4., 8.]
+        for l, r, tr in zip(stores, stores[1:] + [outlet], residencetimes):
+            cmf.LinearStorageConnection(l, r, tr)
+        inflow = p.NewNeumannBoundary('inflow', stores[0])
+        inflow.flux = 2.0
+        solver = cmf.SteadyStateSolver(p)
+        iterations = solver.solve(cmf.Time())
+        self.assertLessEqual(iterations, solver.max_iterations)
+        self.assertLessEqual(solver.get_residual(), 1.0)
+        for i, (s, tr) in enumerate(zip(stores, residencetimes)):
+            self.assertAlmostEqual(s.volume / (2.0 * tr), 1.0, 6, "Volume of storage {} differs".format(i))
+        # Calling the solver sets the steady state and the time
+        for s in stores:
+            s.volume = 0
+        solver(cmf.day)
+        self.assertEqual(solver.t, cmf.day)
+        for i, (s, tr) in enumerate(zip(stores, residencetimes)):
+            self.assertAlmostEqual(s.volume / (2.0 * tr), 1.0, 6, "Volume of storage {} differs".format(i))
+
+    def test_forcing_breakpoints(self):
+        # A linear storage filled by a constant inflow, which starts at noon of the first day
+        p = cmf.project()
+        storage = p.NewStorage('storage')
+        outlet = p.NewOutlet('outlet')
+        cmf.LinearStorageConnection(storage, outlet, 1.)
+        inflow = p.NewNeumannBoundary('inflow', storage)
+        inflow.flux = cmf.timeseries.from_sequence(cmf.Time(), cmf.day, [0., 1., 1., 1.], 0)
+        solver = cmf.CVodeIntegrator(p, 1e-9)
+        solver.t = cmf.Time()
+        solver.use_forcing_breakpoints = True
+        self.assertTrue(solver.use_forcing_breakpoints)
+        self.assertEqual(solver.get_next_breakpoint(cmf.Time()), cmf.day * 0.5)
+        self.assertEqual(solver.get_next_breakpoint(cmf.day).AsMilliseconds(), cmf.never.AsMilliseconds())
+        solver(cmf.day * 3, cmf.h)
+        self.assertEqual(solver.t, cmf.day * 3)
+        self.assertAlmostEqual(storage.volume, 1 - math.exp(-2.5), 6)
+
+    def test_statistics(self):
+        p, stores, X = get_project(False)
+        solver = cmf.CVodeIntegrator(p, 1e-9)
+        solver.t = cmf.Time()
+        self.assertIsNone(solver.statistics)
+        solver.statistics = cmf.SolverStatistics(100)
+        solver(cmf.day * 3, cmf.h)
+        statistics = solver.statistics
+        self.assertGreater(statistics.get_steps(), 0)
+        self.assertEqual(statistics.size(), min(statistics.get_steps(), statistics.get_capacity()))
+        self.assertEqual(statistics.get_time(), cmf.day * 3)
+        # The statistics started with the solver, hence the totals are the counters of the solver
+        total = statistics.get_total()
+        counters = solver.get_counters()
+        self.assertGreater(total.rhsevals, 0)
+        self.assertGreater(total.jacevals, 0)
+        for name in ('rhsevals', 'jacevals', 'nonlinear_iterations', 'linear_iterations',
+                     'error_test_failures', 'convergence_failures', 'order'):
+            self.assertEqual(getattr(total, name), getattr(counters, name), name)
+        last = statistics.get_record(-1)
+        self.assertIsInstance(last, cmf.solver_counters)
+        self.assertEqual(last.t, cmf.day * 3)
+        self.assertGreater(last.dt, cmf.Time())
+        self.assertGreater(last.rhsevals, 0)
+        self.assertEqual(last.order, total.order)
+        with self.assertRaises(IndexError):
+            statistics.get_record(statistics.size())
+
+    def test_error_profile(self):
+        p, stores, X = get_project(False)
+        solver = cmf.CVodeIntegrator(p, 1e-9)
+        solver.t = cmf.Time()
+        solver.profile_errors = True
+        self.assertTrue(solver.profile_errors)
+        solver.statistics = cmf.SolverStatistics()
+        solver(cmf.day * 3, cmf.h)
+        dominance = solver.get_error_dominance()
+        share = solver.get_error_share()
+        self.assertEqual(len(dominance), len(solver))
+        self.assertEqual(len(share), len(solver))
+        # Each step is dominated by one state, and the shares of each step sum up to 1
+        self.assertEqual(dominance.sum(), solver.statistics.get_steps())
+        self.assertAlmostEqual(share.sum(), 1.0, 9)
+        profile = solver.get_error_profile(3)
+        self.assertIn(str(stores[int(dominance.argmax())]), profile)
+        self.assertIn('LinearStorageConnection', profile)
+        solver.clear_error_profile()
+        self.assertEqual(solver.get_error_dominance().sum(), 0)
+
+    def test_flux_graph(self):
+        p, stores, X = get_project(True)
+        solver = cmf.CVodeIntegrator(p, 1e-9)
+        solver(cmf.h * 6)
+        dxdt_ref = solver.get_dxdt(solver.t)
+        solver.use_flux_graph = True
+        self.assertTrue(solver.use_flux_graph)
+        dxdt = solver.get_dxdt(solver.t)
+        self.assertEqual(len(dxdt), len(dxdt_ref))
+        for i, (d, dr) in enumerate(zip(dxdt, dxdt_ref)):
+            self.assertAlmostEqual(d, dr, 12, "Flux graph differs at state {}: {} != {}".format(i, d, dr))
+
+    def test_openmp_deterministic(self):
+        p, stores, X = get_project(True)
+        solver = cmf.CVodeIntegrator(p, 1e-9)
+        solver(cmf.h * 6)
+        for use_flux_graph in (False, True):
+            solver.use_flux_graph = use_flux_graph
+            solver.use_OpenMP = False
+            dxdt_serial = list(solver.get_dxdt(solver.t))
+            solver.use_OpenMP = True
+            dxdt_parallel = list(solver.get_dxdt(solver.t))
+            self.assertEqual(dxdt_parallel, dxdt_serial,
+                             "OpenMP changes the right hand side (use_flux_graph={})".format(use_flux_graph))
+
+    def test_multi_integrator_distribute(self):
+        vol_ref = [0.04978707, 0.1493612, 0.2240418, 0.2240418, 0.1680314,
+                   0.1008188, 0.05040941, 0.02160403, 0.008101512, 0.003802992]
+        for use_OpenMP in (False, True):
+            p, stores, X = get_project(False)
+            # The chain is one component, the second integrator stays empty
+            solver = cmf.MultiIntegrator(cmf.CVodeIntegrator(1e-9), 2, p)
+            self.assertEqual(solver.get_state_count(0), 10)
+            self.assertEqual(solver.get_state_count(1), 0)
+            solver.use_OpenMP = use_OpenMP
+            solver.t = cmf.Time()
+            solver(cmf.day * 3, cmf.h)
+            for i, (s, vr) in enumerate(zip(stores, vol_ref)):
+                self.assertAlmostEqual(s.volume, vr, 4, "Volume of storage {} differs".format(i))
+
+    def test_multirate(self):
+        vol_ref = [0.04978707, 0.1493612, 0.2240418, 0.2240418, 0.1680314,
+                   0.1008188, 0.05040941, 0.02160403, 0.008101512, 0.003802992]
+        p, stores, X = get_project(True)
+        # The upper and the lower half of the chain as partitions, the lower one with four steps per hour
+        solver = cmf.MultiIntegrator(cmf.CVodeIntegrator(1e-9), 2)
+        for i in range(2):
+            solver.add_states_to_integrator(cmf.node_list.from_sequence(stores[5 * i:5 * i + 5]), i)
+        solver.set_rate(1, 4)
+        self.assertEqual(solver.get_rate(1), 4)
+        solver.t = cmf.Time()
+        solver(cmf.day * 3, cmf.h)
+        self.assertEqual(solver.get_coupling_count(), 1)
+        self.assertAlmostEqual(sum(s.volume for s in stores), 1.0, 10)
+        # The solute source of the first storage adds 1 per day
+        self.assertAlmostEqual(sum(s[X].state for s in stores), 3.0, 10)
+        for i, (s, vr) in enumerate(zip(stores, vol_ref)):
+            self.assertAlmostEqual(s.volume, vr, 4, "Volume of storage {} differs".format(i))
+
+        # Connected partitions of the same rate
+        p, stores, X = get_project(False)
+        solver = cmf.MultiIntegrator(cmf.CVodeIntegrator(1e-9), 3)
+        for i, part in enumerate([stores[:3], stores[3:6], stores[6:]]):
+            solver.add_states_to_integrator(cmf.node_list.from_sequence(part), i)
+        solver.set_rate(2, 2)
+        solver.t = cmf.Time()
+        with self.assertRaises(RuntimeError):
+            solver(cmf.day, cmf.h)
+
+    def test_ensemble(self):
+        vol_ref = [0.04978707, 0.1493612, 0.2240418, 0.2240418, 0.1680314,
+                   0.1008188, 0.05040941, 0.02160403, 0.008101512, 0.003802992]
+        # Dense, Krylov and sparse CVODE templates, the ensemble uses the sparse solver for all of them
+        for linear_solver in (0, 3, 6):
+            members = [get_project(False) for i in range(3)]
+            template = cmf.CVodeIntegrator(1e-9)
+            template.LinearSolver = linear_solver
+            solver = cmf.EnsembleIntegrator(template)
+            for i, (p, stores, X) in enumerate(members):
+                stores[0].volume = 1 + i
+                self.assertEqual(solver.add_member(p), i)
+            self.assertEqual(solver.get_member_count(), 3)
+            self.assertEqual(solver.get_member_size(), 10)
+            self.assertEqual(len(solver.get_member(1)), 10)
+            solver.t = cmf.Time()
+            solver(cmf.day * 3, cmf.h)
+            self.assertEqual(len(solver), 30)
+            for i, (p, stores, X) in enumerate(members):
+                states = solver.get_member_states(i)
+                for j, (s, vr) in enumerate(zip(stores, vol_ref)):
+                    self.assertEqual(states[j], s.volume)
+                    self.assertAlmostEqual(s.volume, (1 + i) * vr, 4,
+                                           "Volume of storage {} of member {} differs (LinearSolver={})".format(j, i, linear_solver))
+
+    def test_checkpoint(self):
+        folder = tempfile.mkdtemp()
+        filename = os.path.join(folder, 'checkpoint.bin')
+        try:
+            for st in (cmf.CVodeIntegrator, cmf.BDF2):
+                p, stores, X = get_project(True)
+                solver = st(p)
+                solver(cmf.day, cmf.h)
+                solver.save_checkpoint(filename)
+                solver(cmf.day * 3, cmf.h)
+                # Continue the integration from the checkpoint with a new model
+                p2, stores2, X2 = get_project(True)
+                solver2 = st(p2)
+                solver2.load_checkpoint(filename)
+                self.assertEqual(solver2.t, cmf.day)
+                solver2(cmf.day * 3, cmf.h)
+                for s, s2 in zip(stores, stores2):
+                    self.assertAlmostEqual(s.volume, s2.volume, 10)
+                    self.assertAlmostEqual(s[X].state, s2[X2].state, 10)
+            # A model of a different structure
+            p3, stores3, X3 = get_project(False)
+            with self.assertRaises(RuntimeError):
+                cmf.CVodeIntegrator(p3).load_checkpoint(filename)
+        finally:
+            if os.path.exists(filename):
+                os.remove(filename)
+            os.rmdir(folder)
+
+
+class TestSparseJacobian(unittest.TestCase):
+    """
+    Compares the Jacobian assembled from the flux derivatives with finite differences
+    """
+
+    def assertJacobian(self, p):
+        solver = cmf.CVodeIntegrator(p, 1e-9)
+        analytic = cmf.SparseJacobian(solver)
+        analytic.calculate(solver, solver.t)
+        self.assertEqual(analytic.derived_columns(), len(solver),
+                         "Not all columns are calculated from the flux derivatives")
+        fd = cmf.SparseJacobian(solver)
+        fd.use_flux_derivatives = False
+        fd.calculate(solver, solver.t)
+        self.assertEqual(fd.derived_columns(), 0)
+        scale = abs(fd.get_values()).max()
+        for i in range(analytic.size()):
+            for j in range(analytic.size()):
+                self.assertLessEqual(
+                    abs(analytic.get(i, j) - fd.get(i, j)), 1e-4 * (abs(fd.get(i, j)) + 1e-6 * scale),
+                    "J[{},{}]: {} != {}".format(i, j, analytic.get(i, j), fd.get(i, j)))
+
+    def soil_layers(self, p, wetness, lateral=False):
+        r = cmf.BrooksCoreyRetentionCurve()
+        layers = []
+        for i, w in enumerate(wetness):
+            if lateral or not i:
+                c = p.NewCell(10 * i, 0, 10 - i, 100)
+            l = c.add_layer(0.1 * (len(c.layers) + 1), r)
+            l.wetness = w
+            # Only test the connections of interest
+            l.remove_connection(c.surfacewater)
+            layers.append(l)
+        return layers
+
+    def storages(self, p, connection):
+        stores = [p.NewStorage('s{}'.format(i)) for i in range(4)]
+        for i, st in enumerate(stores):
+            st.volume = 1.0 + i
+        for l, r in zip(stores, stores[1:] + [p.NewOutlet('outlet')]):
+            connection(l, r)
+
+    def reaches(self, p, connection):
+        reaches = [p.NewReach(0, 10 * i, 1 - 0.1 * i, cmf.TriangularReach(10)) for i in range(3)]
+        for i, r in enumerate(reaches):
+            r.depth = 0.3 - 0.1 * i
+        for l, r in zip(reaches, reaches[1:] + [p.NewOutlet('outlet', 0, 40, 0)]):
+            connection(l, r, l.channel)
+
+    def test_richards(self):
+        p = cmf.project()
+        layers = self.soil_layers(p, [0.6, 0.8, 0.985, 0.995])
+        for u, l in zip(layers[:-1], layers[1:]):
+            cmf.Richards(u, l)
+        cmf.Richards(layers[-1], p.NewOutlet('groundwater', 0, 0, 8))
+        self.assertJacobian(p)
+
+    def test_lateral(self):
+        for connection in [cmf.Richards_lateral, cmf.Darcy]:
+            p = cmf.project()
+            layers = self.soil_layers(p, [0.995, 0.7], lateral=True)
+            connection(layers[0], layers[1], 10., 10.)
+            connection(layers[1], p.NewOutlet('outlet', 20, 0, 7), 10., 10.)
+            self.assertJacobian(p)
+
+    def test_manning(self):
+        for connection in [cmf.Manning_Kinematic, cmf.Manning_Diffusive]:
+            p = cmf.project()
+            self.reaches(p, connection)
+            self.assertJacobian(p)
+
+    def test_storage_connections(self):
+        connections = [
+            lambda l, r: cmf.kinematic_wave(l, r, 1.5, 1.5, 0.1),
+            lambda l, r: cmf.LinearStorageConnection(l, r, 2.0, 0.1),
+            lambda l, r: cmf.PowerLawConnection(l, r, 1.0, 2.0, 1.5),
+        ]
+        for connection in connections:
+            p = cmf.project()
+            self.storages(p, connection)
+            self.assertJacobian(p)
+
+    def test_sparse_lu(self):
+        p = cmf.project()
+        self.storages(p, lambda l, r: cmf.LinearStorageConnection(l, r, 2.0))
+        solver = cmf.CVodeIntegrator(p, 1e-9)
+        jac = cmf.SparseJacobian(solver)
+        jac.calculate(solver, solver.t)
+        lu = cmf.SparseLU(jac.get_row_start(), jac.get_columns())
+        self.assertEqual(lu.size(), jac.size())
+        # The iteration matrix I - gamma J of an implicit step
+        row_start, columns = jac.get_row_start(), jac.get_columns()
+        gamma = 0.1
+        values = -gamma * jac.get_values()
+        for i in range(lu.size()):
+            for k in range(int(row_start[i]), int(row_start[i + 1])):
+                if columns[k] == i:
+                    values[k] += 1
+        self.assertTrue(lu.factorize(values))
+        b = [1.0, 2.0, 3.0, 4.0]
+        x = lu.solve(b)
+        for i in range(lu.size()):
+            ax = sum(values[k] * x[int(columns[k])] for k in range(int(row_start[i]), int(row_start[i + 1])))
+            self.assertAlmostEqual(ax, b[i], 12)
+        with self.assertRaises(RuntimeError):
+            lu.factorize(values[:-1])
+
+    def test_sparse_lu_pivot(self):
+        # [[1e-20, 1], [1, 1]] is regular, but needs a row exchange
+        lu = cmf.SparseLU([0, 2, 4], [0, 1, 0, 1])
+        self.assertFalse(lu.factorize([1e-20, 1.0, 1.0, 1.0]))
+        self.assertTrue(lu.factorize([2.0, 1.0, 1.0, 1.0]))
+        x = lu.solve([3.0, 2.0])
+        self.assertAlmostEqual(x[0], 1.0, 12)
+        self.assertAlmostEqual(x[1], 1.0, 12)
+        with self.assertRaises(RuntimeError):
+            # The diagonal is not in the pattern
+            cmf.SparseLU([0, 1, 2], [1, 0])
+
+    def test_retention_curve_derivatives(self):
+        curves = [cmf.BrooksCoreyRetentionCurve(), cmf.VanGenuchtenMualem(), cmf.LinearRetention(1, 0.5, 0.1)]
+        h = 1e-7
+        for r in curves:
+            for w in [0.3, 0.6, 0.9, 0.985, 0.995]:
+                dK = (r.K(w + h) - r.K(w - h)) / (2 * h)
+                self.assertAlmostEqual(r.dK_dW(w) / dK, 1, 5,
+                                       "{}.dK_dW({})".format(type(r).__name__, w))
+                dPsiM = (r.MatricPotential(w + h) - r.MatricPotential(w - h)) / (2 * h)
+                self.assertAlmostEqual(r.dPsiM_dW(w) / dPsiM, 1, 5,
+                                       "{}.dPsiM_dW({})".format(type(r).__name__, w))
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=5)
\ No newline at end of file
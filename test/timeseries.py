@@ -83,3 +83,13 @@ class TimeseriesTest(unittest.TestCase):
             self.assertEqual(ots[t], nts[t])
 
 
+
+    def test_timeseries_next_jump(self):
+        ts = cmf.timeseries.from_sequence(cmf.Time(), cmf.h, [1., 1., 0., 0., 2.], 0)
+        # The value of a nearest neighbor timeseries jumps halfway between the records
+        self.assertEqual(ts.next_jump(cmf.Time()), cmf.h * 1.5)
+        self.assertEqual(ts.next_jump(cmf.h * 2), cmf.h * 3.5)
+        self.assertEqual(ts.next_jump(cmf.h * 4).AsMilliseconds(), cmf.never.AsMilliseconds())
+        # An interpolated timeseries has no jumps
+        ts.set_interpolationpower(1)
+        self.assertEqual(ts.next_jump(cmf.Time()).AsMilliseconds(), cmf.never.AsMilliseconds())